@@ -211,7 +211,7 @@ def fixFileNameRefs(app, env, docnames):
 def addTocTrees(app, env, docnames):
 
     trees2Add = {'rst/dev_guide_inference_and_training_aspects.rst':['dev_guide_inference.rst','dev_guide_inference_int8.rst','dev_guide_training_bf16.rst'],
-                 'rst/dev_guide_attributes.rst':['dev_guide_attributes_fpmath_mode.rst','dev_guide_attributes_quantization.rst','dev_guide_attributes_post_ops.rst','dev_guide_attributes_scratchpad.rst']}
+                 'rst/dev_guide_attributes.rst':['dev_guide_attributes_fpmath_mode.rst','dev_guide_attributes_quantization.rst','dev_guide_attributes_post_ops.rst','dev_guide_attributes_scratchpad.rst','dev_guide_attributes_thread_team.rst','dev_guide_attributes_deterministic.rst','dev_guide_attributes_rounding_mode.rst','dev_guide_attributes_dropout.rst','dev_guide_attributes_bnorm_stats.rst']}
 
 
     for rstFile in trees2Add:
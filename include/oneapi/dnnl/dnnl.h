@@ -314,6 +314,142 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Returns the primitive attributes thread team size.
+///
+/// @param attr Primitive attributes.
+/// @param size Output thread team size.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_thread_team_size(
+        const_dnnl_primitive_attr_t attr, int *size);
+
+/// Sets primitive attributes thread team size: the maximum number of threads
+/// a primitive is created for and executed with. Primitives limited to
+/// disjoint teams may be executed concurrently from different application
+/// threads without oversubscribing the cores.
+///
+/// @note
+///     The attribute limits the number of threads only. Binding of the
+///     threads to cores is defined by the threading runtime, for example by
+///     OpenMP places or by the user threadpool.
+///
+/// @param attr Primitive attributes.
+/// @param size Thread team size. Zero (default) means the number of threads
+///     is not limited by the attribute. Values larger than the number of
+///     threads available to the library have no effect.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_thread_team_size(
+        dnnl_primitive_attr_t attr, int size);
+
+/// Returns the primitive attributes deterministic mode.
+///
+/// @param attr Primitive attributes.
+/// @param value Output deterministic mode: 1 if the mode is enabled and 0
+///     otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_deterministic(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets primitive attributes deterministic mode. In this mode CPU primitives
+/// produce bitwise identical results from run to run regardless of the
+/// number of threads they are executed with, at the cost of less parallelism
+/// available to reductions.
+///
+/// @param attr Primitive attributes.
+/// @param value Deterministic mode: 0 (default) to disable and any other
+///     value to enable.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_deterministic(
+        dnnl_primitive_attr_t attr, int value);
+
+/// Returns the rounding mode of the down-conversion of results for a given
+/// memory argument.
+///
+/// @param attr Primitive attributes.
+/// @param arg Argument for which the rounding mode is queried.
+/// @param mode Output rounding mode.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_rounding(
+        const_dnnl_primitive_attr_t attr, int arg, dnnl_rounding_mode_t *mode);
+
+/// Sets the rounding mode of the down-conversion of results to bf16 or f16
+/// for a given memory argument. With #dnnl_rounding_mode_stochastic the seed
+/// must be passed at execution time as an argument with index
+/// #DNNL_ARG_ATTR_ROUNDING_SEED.
+///
+/// @param attr Primitive attributes.
+/// @param arg Argument for which the rounding mode is set. The supported
+///     arguments are #DNNL_ARG_DST, #DNNL_ARG_DIFF_SRC, and
+///     #DNNL_ARG_DIFF_WEIGHTS.
+/// @param mode Rounding mode.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_rounding(
+        dnnl_primitive_attr_t attr, int arg, dnnl_rounding_mode_t mode);
+
+/// Returns the parameters of the dropout attribute.
+///
+/// @param attr Primitive attributes.
+/// @param enabled Output dropout state: 1 if dropout is enabled and 0
+///     otherwise.
+/// @param mask_desc Output memory descriptor of the dropout mask. A zero
+///     memory descriptor means that the mask is not written.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dropout(
+        const_dnnl_primitive_attr_t attr, int *enabled,
+        const_dnnl_memory_desc_t *mask_desc);
+
+/// Enables dropout of the primitive output.
+///
+/// Each element of the destination is zeroed with the probability passed
+/// at execution time as #DNNL_ARG_ATTR_DROPOUT_PROBABILITY and the kept
+/// elements are scaled by `1 / (1 - probability)`. Random numbers are
+/// generated by a counter-based generator from the seed and the offset
+/// passed as #DNNL_ARG_ATTR_DROPOUT_SEED and #DNNL_ARG_ATTR_DROPOUT_OFFSET,
+/// and from the logical index of the element.
+///
+/// @param attr Primitive attributes.
+/// @param mask_desc Memory descriptor of the dropout mask with #dnnl_u8 data
+///     type and the dimensions of the destination, passed at execution time
+///     as #DNNL_ARG_ATTR_DROPOUT_MASK. May be NULL or a zero memory
+///     descriptor if the mask is not needed.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dropout(
+        dnnl_primitive_attr_t attr, const_dnnl_memory_desc_t mask_desc);
+
+/// Returns the batch normalization statistics attribute state.
+///
+/// @param attr Primitive attributes.
+/// @param enabled Output state: 1 if the statistics are computed and 0
+///     otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_batch_normalization_stats(
+        const_dnnl_primitive_attr_t attr, int *enabled);
+
+/// Enables or disables computation of batch normalization statistics of the
+/// primitive output.
+///
+/// The mean and the variance of the destination over all dimensions except
+/// the channel one are written at execution time to the #dnnl_f32 vectors
+/// passed as #DNNL_ARG_ATTR_STATS_MEAN and #DNNL_ARG_ATTR_STATS_VARIANCE.
+/// The statistics can be passed to a batch normalization primitive created
+/// with #dnnl_use_global_stats.
+///
+/// @param attr Primitive attributes.
+/// @param enabled Statistics computation state: non-zero to enable it and
+///     zero to disable it.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_batch_normalization_stats(
+        dnnl_primitive_attr_t attr, int enabled);
+
 /// Sets primitive attributes scaling factors for primitive operations for a
 /// given memory argument. The scaling factors must be passed at execution time
 /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -555,6 +691,81 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_dw(
         dnnl_data_type_t *dst_data_type, dnnl_dim_t *kernel_size,
         dnnl_dim_t *stride_size, dnnl_dim_t *padding_l_size);
 
+/// Appends a pointwise post-op convolution.
+///
+/// This post-op can only follow a depthwise post-op and completes a
+/// 1x1 -> depthwise -> 1x1 convolution chain (inverted residual block).
+///
+/// The kind of this post-op is #dnnl_inner_product since a pointwise
+/// convolution is an inner product applied at every spatial point.
+///
+/// The output spatial size is the one of the depthwise post-op, the number of
+/// output channels is @p output_channels. Weights and bias are passed to the
+/// primitive as `DNNL_ARG_ATTR_MULTIPLE_POST_OP(index) | DNNL_ARG_WEIGHTS` and
+/// `DNNL_ARG_ATTR_MULTIPLE_POST_OP(index) | DNNL_ARG_BIAS`.
+///
+/// See @ref dev_guide_attributes_post_ops_pointwise for more info.
+///
+/// @param post_ops Post-ops.
+/// @param weights_data_type Weights data type of pointwise post-op
+/// @param bias_data_type Bias data type of pointwise post-op
+/// @param dst_data_type Output data type of pointwise post-op
+/// @param output_channels Number of output channels of pointwise post-op
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_append_pw(dnnl_post_ops_t post_ops,
+        dnnl_data_type_t weights_data_type, dnnl_data_type_t bias_data_type,
+        dnnl_data_type_t dst_data_type, dnnl_dim_t output_channels);
+
+/// Returns the parameters of a pointwise post-op.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the pointwise post-op.
+/// @param weights_data_type Weights data type of pointwise post-op
+/// @param bias_data_type Bias data type of pointwise post-op
+/// @param dst_data_type Output data type of pointwise post-op
+/// @param output_channels Number of output channels of pointwise post-op
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_pw(
+        const_dnnl_post_ops_t post_ops, int index,
+        dnnl_data_type_t *weights_data_type, dnnl_data_type_t *bias_data_type,
+        dnnl_data_type_t *dst_data_type, dnnl_dim_t *output_channels);
+
+/// Appends a pooling post-op.
+///
+/// The post-op reduces non-overlapping @p kernel_h by @p kernel_w windows of
+/// the spatial output of the primitive (the stride is equal to the kernel and
+/// there is no padding), so the output spatial size is `OH / kernel_h` by
+/// `OW / kernel_w` rounded down. It must be the last post-op in the chain.
+///
+/// The kind of this post-op is #dnnl_pooling.
+///
+/// See @ref dev_guide_attributes_post_ops_pooling for more info.
+///
+/// @param post_ops Post-ops.
+/// @param alg_kind Pooling algorithm kind: #dnnl_pooling_max,
+///     #dnnl_pooling_avg_include_padding or #dnnl_pooling_avg_exclude_padding.
+/// @param kernel_h Height of the pooling window.
+/// @param kernel_w Width of the pooling window.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_append_pooling(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg_kind, dnnl_dim_t kernel_h, dnnl_dim_t kernel_w);
+
+/// Returns the parameters of a pooling post-op.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the pooling post-op.
+/// @param alg_kind Output pooling algorithm kind.
+/// @param kernel_h Output height of the pooling window.
+/// @param kernel_w Output width of the pooling window.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_pooling(
+        const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg_kind,
+        dnnl_dim_t *kernel_h, dnnl_dim_t *kernel_w);
+
 /// Appends a binary post-op.
 ///
 /// The kind of this post operation is #dnnl_binary.
@@ -634,6 +845,56 @@ dnnl_status_t DNNL_API dnnl_post_ops_append_prelu(
 dnnl_status_t DNNL_API dnnl_post_ops_get_params_prelu(
         const_dnnl_post_ops_t post_ops, int index, int *mask);
 
+/// Appends a rotary positional embedding (RoPE) post-op.
+///
+/// The kind of this post-op is #dnnl_rope.
+///
+/// The post-op treats every row of the destination as a token at position
+/// `pos = m + offsets[b]`, where `m` is the row index and `b` is the index of
+/// the matrix in the flattened batch, and the columns of the row as a
+/// sequence of heads of size @p head_dim. The first @p rotary_dim elements
+/// of every head are rotated by angles `pos * base^(-2i / rotary_dim)` as in
+/// the RoPE primitive, the other elements are kept.
+///
+/// The position offsets are an optional s32 tensor with one value per batch
+/// matrix passed at execution time as
+/// `DNNL_ARG_ATTR_MULTIPLE_POST_OP(index) | DNNL_ARG_OFFSETS`. Offsets are
+/// zero if the argument is not passed.
+///
+/// @note
+///     The RoPE post-op must be the last post-op and is only supported by
+///     the matmul primitive.
+///
+/// @param post_ops Post-ops.
+/// @param alg_kind RoPE algorithm kind. Possible values:
+///     #dnnl_rope_interleaved, #dnnl_rope_rotate_half.
+/// @param head_dim Size of a head. The number of columns of the destination
+///     must be a multiple of it.
+/// @param rotary_dim Number of rotated elements of a head. Must be even and
+///     not greater than @p head_dim.
+/// @param base Base of the rotation frequencies.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_post_ops_append_rope(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg_kind, dnnl_dim_t head_dim, dnnl_dim_t rotary_dim,
+        float base);
+
+/// Returns the parameters of a RoPE post-op.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the RoPE post-op.
+/// @param alg_kind Output RoPE algorithm kind.
+/// @param head_dim Output size of a head.
+/// @param rotary_dim Output number of rotated elements of a head.
+/// @param base Output base of the rotation frequencies.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @returns #dnnl_invalid_arguments if @p index does not refer to a RoPE
+///     post-op.
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_rope(
+        const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg_kind,
+        dnnl_dim_t *head_dim, dnnl_dim_t *rotary_dim, float *base);
+
 /// @} dnnl_api_attributes
 
 /// @} dnnl_api_primitives
@@ -1746,7 +2007,11 @@ dnnl_status_t DNNL_API dnnl_softmax_backward_primitive_desc_create(
 /// @param prop_kind Propagation kind. Possible values are
 ///     #dnnl_forward_training and #dnnl_forward_inference.
 /// @param alg_kind Pooling algorithm kind: either #dnnl_pooling_max,
-///     #dnnl_pooling_avg_include_padding, or #dnnl_pooling_avg_exclude_padding.
+///     #dnnl_pooling_avg_include_padding, #dnnl_pooling_avg_exclude_padding,
+///     or #dnnl_pooling_avg_adaptive. For the adaptive algorithm the pooling
+///     window is derived from the source and destination sizes, and the
+///     strides, kernel, dilation and padding values do not affect the
+///     result.
 /// @param src_desc Source memory descriptor.
 /// @param dst_desc Destination memory descriptor.
 /// @param strides Array of strides for spatial dimension.
@@ -1780,7 +2045,11 @@ dnnl_status_t DNNL_API dnnl_pooling_forward_primitive_desc_create(
 /// @param primitive_desc Output primitive descriptor.
 /// @param engine Engine to use.
 /// @param alg_kind Pooling algorithm kind: either #dnnl_pooling_max,
-///     #dnnl_pooling_avg_include_padding, or #dnnl_pooling_avg_exclude_padding.
+///     #dnnl_pooling_avg_include_padding, #dnnl_pooling_avg_exclude_padding,
+///     or #dnnl_pooling_avg_adaptive. For the adaptive algorithm the pooling
+///     window is derived from the source and destination sizes, and the
+///     strides, kernel, dilation and padding values do not affect the
+///     result.
 /// @param diff_src_desc Diff source memory descriptor.
 /// @param diff_dst_desc Diff destination memory descriptor.
 /// @param strides Array of strides for spatial dimension.
@@ -3243,6 +3512,122 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+/// @{
+
+/// Creates a primitive descriptor for an embedding bag primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Embedding bag algorithm kind. Possible values:
+///     #dnnl_embedding_bag_sum, #dnnl_embedding_bag_mean,
+///     #dnnl_embedding_bag_max.
+/// @param src_desc Embedding table memory descriptor, 2D
+///     {number of rows, embedding size}.
+/// @param indices_desc Indices memory descriptor, 1D s32
+///     {number of indices}.
+/// @param offsets_desc Bag offsets memory descriptor, 1D s32
+///     {number of bags}. A bag starts at its offset in the indices and ends
+///     at the offset of the next bag or at the end of the indices.
+/// @param weights_desc Per-sample weights memory descriptor, 1D f32
+///     {number of indices}. Can be NULL or a zero memory descriptor, only
+///     supported with #dnnl_embedding_bag_sum.
+/// @param dst_desc Destination memory descriptor, 2D
+///     {number of bags, embedding size}.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_embedding_bag
+
+/// @addtogroup dnnl_api_rope RoPE
+/// @{
+
+/// Creates a primitive descriptor for a rotary positional embedding (RoPE)
+/// primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind RoPE algorithm kind. Possible values:
+///     #dnnl_rope_interleaved, #dnnl_rope_rotate_half.
+/// @param src_desc Source memory descriptor, 3D {batch, sequence, head size}
+///     or 4D {batch, heads, sequence, head size}.
+/// @param cos_sin_desc Memory descriptor of the cosine and sine caches, 2D
+///     f32 {number of positions, rotary_dim / 2}. Can be NULL or a zero
+///     memory descriptor, in which case the values are computed from
+///     @p base.
+/// @param offsets_desc Position offsets memory descriptor, 1D s32 {batch}.
+///     Can be NULL or a zero memory descriptor, in which case positions
+///     start at zero for every batch element.
+/// @param dst_desc Destination memory descriptor with the same dimensions as
+///     @p src_desc.
+/// @param rotary_dim Number of rotated elements of a head. Must be even and
+///     not greater than the head size.
+/// @param base Base of the rotation frequencies. Ignored when
+///     @p cos_sin_desc is provided.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_rope_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t cos_sin_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, dnnl_dim_t rotary_dim, float base,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_rope
+
+/// @addtogroup dnnl_api_topk Top-k
+/// @{
+
+/// Creates a primitive descriptor for a top-k primitive.
+///
+/// The number of selected elements k is the size of @p dst_desc along
+/// @p axis.
+///
+/// @note
+///     Destination and indices memory descriptors are allowed to be
+///     initialized with #dnnl_format_tag_any or with format_kind set to
+///     #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Top-k algorithm kind. Possible values:
+///     #dnnl_topk_max, #dnnl_topk_min.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor with the same dimensions as
+///     @p src_desc except for @p axis.
+/// @param indices_desc Indices memory descriptor, s32, with the same
+///     dimensions as @p dst_desc.
+/// @param axis Axis along which the elements are selected.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc, int axis,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_topk
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3637,6 +4022,340 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Queries the size of a buffer required to hold matrix A or B of a
+/// single-precision matrix-matrix multiply in a packed format.
+///
+/// Packing an operand that is reused across several multiplications, for
+/// example weights, moves the cost of reordering it into the layout of the
+/// computational kernels out of the #dnnl_sgemm_compute() calls.
+///
+/// The packed buffer is opaque and is only valid for the library version,
+/// problem shape, and CPU that it was created for.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for the matrix A, and 'B'
+///     or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A or B of a single-precision matrix-matrix multiply.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for the matrix A, and 'B'
+///     or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the data of the matrix to pack.
+/// @param dst A pointer to the packed buffer. The size of the buffer should
+///     be queried with #dnnl_sgemm_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, void *dst);
+
+/// Performs single-precision matrix-matrix multiply with packed matrices.
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// The semantics are the ones of #dnnl_sgemm() with `alpha` equal to 1,
+/// except that any of the matrices A and B may be packed with
+/// #dnnl_sgemm_pack(). The dimensions and transposition flags used for
+/// packing must match the ones passed to this function.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to the packed buffer.
+/// @param lda The leading dimension for the matrix A. Ignored if A is
+///     packed.
+/// @param B A pointer to the B matrix data or to the packed buffer.
+/// @param ldb The leading dimension for the matrix B. Ignored if B is
+///     packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc);
+
+/// Queries the size of a buffer required to hold matrix A or B of an integer
+/// matrix-matrix multiply on 8-bit unsigned matrix A and 8-bit signed matrix
+/// B in a packed format.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for the matrix A, and 'B'
+///     or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A or B of an integer matrix-matrix multiply on 8-bit
+/// unsigned matrix A and 8-bit signed matrix B.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for the matrix A, and 'B'
+///     or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the data of the matrix to pack.
+/// @param dst A pointer to the packed buffer. The size of the buffer should
+///     be queried with #dnnl_gemm_u8s8s32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit unsigned matrix A, 8-bit
+/// signed matrix B, and 32-bit signed resulting matrix C with packed
+/// matrices.
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C + C_offset`
+///
+/// The semantics are the ones of #dnnl_gemm_u8s8s32() with `alpha` equal to
+/// 1 and zero `ao` and `bo`, except that any of the matrices A and B may be
+/// packed with #dnnl_gemm_u8s8s32_pack(). The dimensions and transposition
+/// flags used for packing must match the ones passed to this function.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C:
+///     - 'F' means that the same offset will be applied to each element of
+///         the matrix C,
+///     - 'C' means that individual offset will be applied to each element
+///         within each column,
+///     - 'R' means that individual offset will be applied to each element
+///         within each row.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to the packed buffer.
+/// @param lda The leading dimension for the matrix A. Ignored if A is
+///     packed.
+/// @param B A pointer to the B matrix data or to the packed buffer.
+/// @param ldb The leading dimension for the matrix B. Ignored if B is
+///     packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @param co An array of offset values for the matrix C. The number of
+///     elements in the array depends on the value of @p offsetc.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co);
+
+/// Performs a batch of single-precision matrix-matrix multiplies of the same
+/// shape with matrices located at a constant stride from each other.
+///
+/// The operation is defined as:
+///
+/// `C_i := alpha * op( A_i ) * op( B_i ) + beta * C_i`, for
+/// `i` in `[0, batch_size)`,
+///
+/// where `A_i = A + i * stridea`, `B_i = B + i * strideb`, and
+/// `C_i = C + i * stridec`. The semantics of every multiply are the ones of
+/// #dnnl_sgemm(). The multiplies of a batch are computed in parallel.
+///
+/// @param transa Transposition flag for matrices A_i: 'N' or 'n' means A_i
+///     are not transposed, and 'T' or 't' means that A_i are transposed.
+/// @param transb Transposition flag for matrices B_i: 'N' or 'n' means B_i
+///     are not transposed, and 'T' or 't' means that B_i are transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A_i and B_i.
+/// @param A A pointer to the A_0 matrix data.
+/// @param lda The leading dimension for the matrices A_i.
+/// @param stridea The stride in elements between matrices A_i.
+/// @param B A pointer to the B_0 matrix data.
+/// @param ldb The leading dimension for the matrices B_i.
+/// @param strideb The stride in elements between matrices B_i.
+/// @param beta The beta parameter that is used to scale the matrices C_i.
+/// @param C A pointer to the C_0 matrix data.
+/// @param ldc The leading dimension for the matrices C_i.
+/// @param stridec The stride in elements between matrices C_i.
+/// @param batch_size The number of multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stridea, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t strideb, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stridec, dnnl_dim_t batch_size);
+
+/// Performs groups of single-precision matrix-matrix multiplies with
+/// matrices passed as arrays of pointers.
+///
+/// The multiplies of group `g` share the transposition flags, the
+/// dimensions, the leading dimensions, and the alpha and beta parameters
+/// found at index `g` of the corresponding arrays. The arrays of matrices
+/// hold `group_size[0] + ... + group_size[group_count - 1]` pointers, the
+/// ones of the first group go first. The semantics of every multiply are
+/// the ones of #dnnl_sgemm(). All the multiplies are computed in parallel.
+///
+/// @param transa Array of transposition flags for matrices A.
+/// @param transb Array of transposition flags for matrices B.
+/// @param M Array of the M dimensions.
+/// @param N Array of the N dimensions.
+/// @param K Array of the K dimensions.
+/// @param alpha Array of the alpha parameters.
+/// @param A Array of pointers to the A matrices data.
+/// @param lda Array of the leading dimensions for the matrices A.
+/// @param B Array of pointers to the B matrices data.
+/// @param ldb Array of the leading dimensions for the matrices B.
+/// @param beta Array of the beta parameters.
+/// @param C Array of pointers to the C matrices data.
+/// @param ldc Array of the leading dimensions for the matrices C.
+/// @param group_count The number of groups.
+/// @param group_size Array of the numbers of multiplies in the groups.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(const char *transa,
+        const char *transb, const dnnl_dim_t *M, const dnnl_dim_t *N,
+        const dnnl_dim_t *K, const float *alpha, const float *const *A,
+        const dnnl_dim_t *lda, const float *const *B, const dnnl_dim_t *ldb,
+        const float *beta, float *const *C, const dnnl_dim_t *ldc,
+        dnnl_dim_t group_count, const dnnl_dim_t *group_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A_i, 8-bit signed matrices B_i, and 32-bit signed resulting
+/// matrices C_i of the same shape located at a constant stride from each
+/// other.
+///
+/// The semantics of every multiply are the ones of #dnnl_gemm_u8s8s32().
+/// Matrix `A_i` is located at `A + i * stridea`, matrix `B_i` at
+/// `B + i * strideb`, and matrix `C_i` at `C + i * stridec`. All the
+/// multiplies share the offsets. The multiplies of a batch are computed in
+/// parallel.
+///
+/// @param transa Transposition flag for matrices A_i.
+/// @param transb Transposition flag for matrices B_i.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C_i, see #dnnl_gemm_u8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A_i and B_i.
+/// @param A A pointer to the A_0 matrix data.
+/// @param lda The leading dimension for the matrices A_i.
+/// @param stridea The stride in elements between matrices A_i.
+/// @param ao The offset value for the matrices A_i.
+/// @param B A pointer to the B_0 matrix data.
+/// @param ldb The leading dimension for the matrices B_i.
+/// @param strideb The stride in elements between matrices B_i.
+/// @param bo The offset value for the matrices B_i.
+/// @param beta The beta parameter that is used to scale the matrices C_i.
+/// @param C A pointer to the C_0 matrix data.
+/// @param ldc The leading dimension for the matrices C_i.
+/// @param stridec The stride in elements between matrices C_i.
+/// @param co An array of offset values for the matrices C_i.
+/// @param batch_size The number of multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stridea,
+        uint8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t strideb,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stridec,
+        const int32_t *co, dnnl_dim_t batch_size);
+
+/// Performs groups of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C passed as arrays of pointers.
+///
+/// The grouping rules are the ones of #dnnl_sgemm_batch(), and the semantics
+/// of every multiply are the ones of #dnnl_gemm_u8s8s32(). The offsets of
+/// the matrices C are passed as an array of pointers with one entry per
+/// multiply.
+///
+/// @param transa Array of transposition flags for matrices A.
+/// @param transb Array of transposition flags for matrices B.
+/// @param offsetc Array of flags specifying how offsets should be applied
+///     to matrices C.
+/// @param M Array of the M dimensions.
+/// @param N Array of the N dimensions.
+/// @param K Array of the K dimensions.
+/// @param alpha Array of the alpha parameters.
+/// @param A Array of pointers to the A matrices data.
+/// @param lda Array of the leading dimensions for the matrices A.
+/// @param ao Array of the offset values for the matrices A.
+/// @param B Array of pointers to the B matrices data.
+/// @param ldb Array of the leading dimensions for the matrices B.
+/// @param bo Array of the offset values for the matrices B.
+/// @param beta Array of the beta parameters.
+/// @param C Array of pointers to the C matrices data.
+/// @param ldc Array of the leading dimensions for the matrices C.
+/// @param co Array of pointers to the offset values for the matrices C.
+/// @param group_count The number of groups.
+/// @param group_size Array of the numbers of multiplies in the groups.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch(const char *transa,
+        const char *transb, const char *offsetc, const dnnl_dim_t *M,
+        const dnnl_dim_t *N, const dnnl_dim_t *K, const float *alpha,
+        const uint8_t *const *A, const dnnl_dim_t *lda, const uint8_t *ao,
+        const int8_t *const *B, const dnnl_dim_t *ldb, const int8_t *bo,
+        const float *beta, int32_t *const *C, const dnnl_dim_t *ldc,
+        const int32_t *const *co, dnnl_dim_t group_count,
+        const dnnl_dim_t *group_size);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
@@ -148,6 +148,12 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// An embedding bag primitive.
+        embedding_bag = dnnl_embedding_bag,
+        /// A rotary positional embedding (RoPE) primitive.
+        rope = dnnl_rope,
+        /// A top-k primitive.
+        topk = dnnl_topk,
     };
 
     using handle::handle;
@@ -300,6 +306,23 @@ inline dnnl_scratchpad_mode_t convert_to_c(scratchpad_mode mode) {
     return static_cast<dnnl_scratchpad_mode_t>(mode);
 }
 
+/// Rounding mode
+enum class rounding_mode {
+    /// Rounding mode of the environment: round to nearest even (default).
+    environment = dnnl_rounding_mode_environment,
+    /// Stochastic rounding driven by the seed passed at execution time as
+    /// #DNNL_ARG_ATTR_ROUNDING_SEED.
+    stochastic = dnnl_rounding_mode_stochastic,
+};
+
+/// Converts a rounding mode enum value from C++ API to C API type.
+///
+/// @param mode C++ API rounding mode enum value.
+/// @returns Corresponding C API rounding mode enum value.
+inline dnnl_rounding_mode_t convert_to_c(rounding_mode mode) {
+    return static_cast<dnnl_rounding_mode_t>(mode);
+}
+
 /// Propagation kind.
 enum class prop_kind {
     /// Undefined propagation kind.
@@ -413,6 +436,8 @@ enum class algorithm {
     pooling_avg_include_padding = dnnl_pooling_avg_include_padding,
     /// Average pooling exclude padding
     pooling_avg_exclude_padding = dnnl_pooling_avg_exclude_padding,
+    /// Adaptive average pooling
+    pooling_avg_adaptive = dnnl_pooling_avg_adaptive,
     /// RNN cell
     vanilla_rnn = dnnl_vanilla_rnn,
     /// LSTM cell
@@ -479,6 +504,21 @@ enum class algorithm {
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// Embedding bag using sum of rows
+    embedding_bag_sum = dnnl_embedding_bag_sum,
+    /// Embedding bag using mean of rows
+    embedding_bag_mean = dnnl_embedding_bag_mean,
+    /// Embedding bag using max of rows
+    embedding_bag_max = dnnl_embedding_bag_max,
+    /// RoPE rotating pairs of adjacent elements
+    rope_interleaved = dnnl_rope_interleaved,
+    /// RoPE rotating pairs of elements from the two halves of the rotary
+    /// dimension
+    rope_rotate_half = dnnl_rope_rotate_half,
+    /// Top-k selecting the largest elements
+    topk_max = dnnl_topk_max,
+    /// Top-k selecting the smallest elements
+    topk_min = dnnl_topk_min,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -3565,6 +3605,96 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         padding_l_size = c_padding_l_size;
     }
 
+    /// Appends a pointwise post-op convolution.
+    ///
+    /// This post-op can only follow a depthwise post-op and completes a
+    /// 1x1 -> depthwise -> 1x1 convolution chain (inverted residual block).
+    ///
+    /// The kind of this post-op is #dnnl_inner_product.
+    ///
+    /// See @ref dev_guide_attributes_post_ops_pointwise for more info.
+    ///
+    /// @param weights_data_type Weights data type of pointwise post-op
+    /// @param bias_data_type Bias data type of pointwise post-op
+    /// @param dst_data_type Output data type of pointwise post-op
+    /// @param output_channels Number of output channels of pointwise post-op
+    void append_pw(memory::data_type weights_data_type,
+            memory::data_type bias_data_type, memory::data_type dst_data_type,
+            memory::dim output_channels) {
+        error::wrap_c_api(dnnl_post_ops_append_pw(get(),
+                                  memory::convert_to_c(weights_data_type),
+                                  memory::convert_to_c(bias_data_type),
+                                  memory::convert_to_c(dst_data_type),
+                                  output_channels),
+                "could not append pointwise post-op");
+    }
+
+    /// Returns the parameters of a pointwise post-op.
+    ///
+    /// @param index Index of the pointwise post-op.
+    /// @param weights_data_type Weights data type of pointwise post-op
+    /// @param bias_data_type Bias data type of pointwise post-op
+    /// @param dst_data_type Output data type of pointwise post-op
+    /// @param output_channels Number of output channels of pointwise post-op
+    void get_params_pw(int index, memory::data_type &weights_data_type,
+            memory::data_type &bias_data_type, memory::data_type &dst_data_type,
+            memory::dim &output_channels) const {
+        dnnl_data_type_t c_weights_data_type;
+        dnnl_data_type_t c_bias_data_type;
+        dnnl_data_type_t c_dst_data_type;
+        dnnl_dim_t c_output_channels;
+        error::wrap_c_api(
+                dnnl_post_ops_get_params_pw(get(), index, &c_weights_data_type,
+                        &c_bias_data_type, &c_dst_data_type,
+                        &c_output_channels),
+                "could not get parameters of pointwise post-op");
+
+        weights_data_type = static_cast<memory::data_type>(c_weights_data_type);
+        bias_data_type = static_cast<memory::data_type>(c_bias_data_type);
+        dst_data_type = static_cast<memory::data_type>(c_dst_data_type);
+        output_channels = c_output_channels;
+    }
+
+    /// Appends a pooling post-op.
+    ///
+    /// The post-op reduces non-overlapping windows of the spatial output of
+    /// the primitive and must be the last post-op in the chain.
+    ///
+    /// The kind of this post-op is #dnnl::primitive::kind::pooling.
+    ///
+    /// See @ref dev_guide_attributes_post_ops_pooling for more info.
+    ///
+    /// @param aalgorithm Pooling algorithm kind:
+    ///     #dnnl::algorithm::pooling_max,
+    ///     #dnnl::algorithm::pooling_avg_include_padding or
+    ///     #dnnl::algorithm::pooling_avg_exclude_padding.
+    /// @param kernel_h Height of the pooling window.
+    /// @param kernel_w Width of the pooling window.
+    void append_pooling(algorithm aalgorithm, memory::dim kernel_h,
+            memory::dim kernel_w) {
+        error::wrap_c_api(dnnl_post_ops_append_pooling(get(),
+                                  convert_to_c(aalgorithm), kernel_h, kernel_w),
+                "could not append pooling post-op");
+    }
+
+    /// Returns the parameters of a pooling post-op.
+    ///
+    /// @param index Index of the pooling post-op.
+    /// @param aalgorithm Output pooling algorithm kind.
+    /// @param kernel_h Output height of the pooling window.
+    /// @param kernel_w Output width of the pooling window.
+    void get_params_pooling(int index, algorithm &aalgorithm,
+            memory::dim &kernel_h, memory::dim &kernel_w) const {
+        dnnl_alg_kind_t c_alg;
+        dnnl_dim_t c_kernel_h, c_kernel_w;
+        error::wrap_c_api(dnnl_post_ops_get_params_pooling(
+                                  get(), index, &c_alg, &c_kernel_h, &c_kernel_w),
+                "could not get parameters of pooling post-op");
+        aalgorithm = static_cast<dnnl::algorithm>(c_alg);
+        kernel_h = c_kernel_h;
+        kernel_w = c_kernel_w;
+    }
+
     /// Appends a binary post-op.
     ///
     /// The kind of this post operation is #dnnl_binary.
@@ -3669,6 +3799,55 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         error::wrap_c_api(dnnl_post_ops_get_params_prelu(get(), index, &mask),
                 "could not get parameters of a binary post-op");
     }
+
+    /// Appends a rotary positional embedding (RoPE) post-op.
+    ///
+    /// The kind of this post-op is #dnnl::primitive::kind::rope.
+    ///
+    /// Every row of the destination is a token at position
+    /// `m + offsets[b]`, where `m` is the row index and `b` is the index of
+    /// the matrix in the flattened batch. The columns of a row are a sequence
+    /// of heads of size @p head_dim, the first @p rotary_dim elements of
+    /// every head are rotated as in the RoPE primitive.
+    ///
+    /// The position offsets are an optional s32 tensor with one value per
+    /// batch matrix passed at execution time as
+    /// `DNNL_ARG_ATTR_MULTIPLE_POST_OP(index) | DNNL_ARG_OFFSETS`.
+    ///
+    /// @note
+    ///     The RoPE post-op must be the last post-op and is only supported
+    ///     by the matmul primitive.
+    ///
+    /// @param aalgorithm RoPE algorithm kind. Possible values:
+    ///     #dnnl::algorithm::rope_interleaved,
+    ///     #dnnl::algorithm::rope_rotate_half.
+    /// @param head_dim Size of a head.
+    /// @param rotary_dim Number of rotated elements of a head.
+    /// @param base Base of the rotation frequencies.
+    void append_rope(algorithm aalgorithm, memory::dim head_dim,
+            memory::dim rotary_dim, float base = 10000.f) {
+        error::wrap_c_api(
+                dnnl_post_ops_append_rope(get(), convert_to_c(aalgorithm),
+                        head_dim, rotary_dim, base),
+                "could not append a rope post-op");
+    }
+
+    /// Returns the parameters of a RoPE post-op.
+    ///
+    /// @param index Index of the RoPE post-op.
+    /// @param aalgorithm Output RoPE algorithm kind.
+    /// @param head_dim Output size of a head.
+    /// @param rotary_dim Output number of rotated elements of a head.
+    /// @param base Output base of the rotation frequencies.
+    void get_params_rope(int index, algorithm &aalgorithm,
+            memory::dim &head_dim, memory::dim &rotary_dim,
+            float &base) const {
+        dnnl_alg_kind_t c_alg;
+        error::wrap_c_api(dnnl_post_ops_get_params_rope(get(), index, &c_alg,
+                                  &head_dim, &rotary_dim, &base),
+                "could not get parameters of a rope post-op");
+        aalgorithm = static_cast<dnnl::algorithm>(c_alg);
+    }
 };
 
 /// @cond DO_NOT_DOCUMENT_THIS
@@ -3737,6 +3916,124 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scratchpad mode primitive attribute");
     }
 
+    /// Returns the thread team size.
+    int get_thread_team_size() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_thread_team_size(get(), &result),
+                "could not get thread team size primitive attribute");
+        return result;
+    }
+
+    /// Sets the thread team size: the maximum number of threads a primitive
+    /// is created for and executed with.
+    ///
+    /// @param size Thread team size. Zero (default) means the number of
+    ///     threads is not limited by the attribute.
+    void set_thread_team_size(int size) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_thread_team_size(get(), size),
+                "could not set thread team size primitive attribute");
+    }
+
+    /// Returns the deterministic mode.
+    bool get_deterministic() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_deterministic(get(), &result),
+                "could not get deterministic primitive attribute");
+        return result;
+    }
+
+    /// Sets the deterministic mode: results of the primitive do not depend on
+    /// the number of threads it is executed with.
+    ///
+    /// @param value Specified deterministic mode.
+    void set_deterministic(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_deterministic(get(), value),
+                "could not set deterministic primitive attribute");
+    }
+
+    /// Returns the rounding mode for a given memory argument.
+    ///
+    /// @param arg Argument for which the rounding mode is queried.
+    rounding_mode get_rounding_mode(int arg) const {
+        dnnl_rounding_mode_t result;
+        error::wrap_c_api(dnnl_primitive_attr_get_rounding(get(), arg, &result),
+                "could not get rounding mode primitive attribute");
+        return rounding_mode(result);
+    }
+
+    /// Sets the rounding mode of the down-conversion of results for a given
+    /// memory argument. With rounding_mode::stochastic the seed must be
+    /// passed at execution time as an argument with index
+    /// #DNNL_ARG_ATTR_ROUNDING_SEED.
+    ///
+    /// @param arg Argument for which the rounding mode is set.
+    /// @param mode Specified rounding mode.
+    void set_rounding_mode(int arg, rounding_mode mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_rounding(
+                                  get(), arg, convert_to_c(mode)),
+                "could not set rounding mode primitive attribute");
+    }
+
+    /// Returns the parameters of the dropout attribute.
+    ///
+    /// @param mask_desc Output memory descriptor of the dropout mask. A zero
+    ///     memory descriptor means that the mask is not written.
+    /// @returns True if dropout is enabled.
+    bool get_dropout(memory::desc &mask_desc) const {
+        int enabled;
+        const_dnnl_memory_desc_t cdesc;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_dropout(get(), &enabled, &cdesc),
+                "could not get dropout primitive attribute");
+        dnnl_memory_desc_t cloned_md = nullptr;
+        error::wrap_c_api(dnnl_memory_desc_clone(&cloned_md, cdesc),
+                "could not clone a memory descriptor");
+        mask_desc = memory::desc(cloned_md);
+        return enabled != 0;
+    }
+
+    /// Enables dropout of the primitive output. The probability, the seed
+    /// and optionally the offset of the random number generator must be
+    /// passed at execution time as arguments with indices
+    /// #DNNL_ARG_ATTR_DROPOUT_PROBABILITY, #DNNL_ARG_ATTR_DROPOUT_SEED and
+    /// #DNNL_ARG_ATTR_DROPOUT_OFFSET.
+    ///
+    /// @param mask_desc Memory descriptor of the u8 dropout mask passed at
+    ///     execution time as #DNNL_ARG_ATTR_DROPOUT_MASK. A zero memory
+    ///     descriptor if the mask is not needed.
+    void set_dropout(const memory::desc &mask_desc = memory::desc()) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_dropout(get(), mask_desc.get(true)),
+                "could not set dropout primitive attribute");
+    }
+
+    /// Returns the batch normalization statistics attribute state.
+    ///
+    /// @returns True if the statistics are computed.
+    bool get_batch_normalization_stats() const {
+        int enabled;
+        error::wrap_c_api(dnnl_primitive_attr_get_batch_normalization_stats(
+                                  get(), &enabled),
+                "could not get batch normalization statistics primitive "
+                "attribute");
+        return enabled != 0;
+    }
+
+    /// Enables or disables computation of batch normalization statistics of
+    /// the primitive output. The mean and the variance are written at
+    /// execution time to the arguments with indices
+    /// #DNNL_ARG_ATTR_STATS_MEAN and #DNNL_ARG_ATTR_STATS_VARIANCE.
+    ///
+    /// @param enabled Statistics computation state.
+    void set_batch_normalization_stats(bool enabled = true) {
+        error::wrap_c_api(dnnl_primitive_attr_set_batch_normalization_stats(
+                                  get(), enabled),
+                "could not set batch normalization statistics primitive "
+                "attribute");
+    }
+
     /// Sets scaling factors for primitive operations for a given memory
     /// argument. The scaling factors must be passed at execution time
     /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -12515,7 +12812,11 @@ struct pooling_forward : public primitive {
         /// @param aalgorithm Pooling algorithm kind: either
         ///     #dnnl::algorithm::pooling_max,
         ///     #dnnl::algorithm::pooling_avg_include_padding,
-        ///     or #dnnl::algorithm::pooling_avg_exclude_padding.
+        ///     #dnnl::algorithm::pooling_avg_exclude_padding,
+        ///     or #dnnl::algorithm::pooling_avg_adaptive. For the adaptive
+        ///     algorithm the pooling window is derived from the source and
+        ///     destination sizes, and the strides, kernel, dilation and
+        ///     padding values do not affect the result.
         /// @param src_desc Source memory descriptor.
         /// @param dst_desc Destination memory descriptor.
         /// @param strides Vector of strides for spatial dimension.
@@ -12640,7 +12941,11 @@ struct pooling_backward : public primitive {
         /// @param aalgorithm Pooling algorithm kind: either
         ///     #dnnl::algorithm::pooling_max,
         ///     #dnnl::algorithm::pooling_avg_include_padding,
-        ///     or #dnnl::algorithm::pooling_avg_exclude_padding.
+        ///     #dnnl::algorithm::pooling_avg_exclude_padding,
+        ///     or #dnnl::algorithm::pooling_avg_adaptive. For the adaptive
+        ///     algorithm the pooling window is derived from the source and
+        ///     destination sizes, and the strides, kernel, dilation and
+        ///     padding values do not affect the result.
         /// @param diff_src_desc Diff source memory descriptor.
         /// @param diff_dst_desc Diff destination memory descriptor.
         /// @param strides Vector of strides for spatial dimension.
@@ -13024,6 +13329,399 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+///
+/// A primitive to gather rows of an embedding table and to pool them into
+/// bags using sum, mean or max operations.
+///
+/// @sa @ref dev_guide_embedding_bag in developer guide
+///
+/// @{
+
+/// Embedding bag.
+struct embedding_bag : public primitive {
+    /// Primitive descriptor for an embedding bag primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        ///     without per-sample weights.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Embedding bag algorithm kind. Possible values:
+        ///     #dnnl::algorithm::embedding_bag_sum,
+        ///     #dnnl::algorithm::embedding_bag_mean,
+        ///     #dnnl::algorithm::embedding_bag_max.
+        /// @param src_desc Embedding table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Bag offsets memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    offsets_desc, nullptr, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        ///     with per-sample weights.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Embedding bag algorithm kind. Only
+        ///     #dnnl::algorithm::embedding_bag_sum supports per-sample
+        ///     weights.
+        /// @param src_desc Embedding table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Bag offsets memory descriptor.
+        /// @param weights_desc Per-sample weights memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &weights_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    offsets_desc, &weights_desc, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an embedding bag
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::embedding_bag) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_INDICES);
+        }
+
+        /// Returns a bag offsets memory descriptor.
+        /// @returns Bag offsets memory descriptor.
+        memory::desc offsets_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_OFFSETS);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+    private:
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc *weights_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr, bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_embedding_bag_primitive_desc_create(
+                    &pd, aengine.get(), convert_to_c(aalgorithm),
+                    src_desc.get(), indices_desc.get(), offsets_desc.get(),
+                    optional_arg(weights_desc), dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for an "
+                        "embedding bag primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag() = default;
+
+    /// Constructs an embedding bag primitive.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    embedding_bag(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an embedding bag primitive from a cache blob.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    /// @param cache_blob Cache blob.
+    embedding_bag(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_embedding_bag
+
+/// @addtogroup dnnl_api_rope RoPE
+///
+/// A primitive to apply rotary positional embedding to queries or keys of an
+/// attention layer.
+///
+/// @sa @ref dev_guide_rope in developer guide
+///
+/// @{
+
+/// Rotary positional embedding (RoPE).
+struct rope : public primitive {
+    /// Primitive descriptor for a RoPE primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a RoPE primitive which
+        ///     computes the rotation angles from @p base and positions
+        ///     starting at zero.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm RoPE algorithm kind. Possible values:
+        ///     #dnnl::algorithm::rope_interleaved,
+        ///     #dnnl::algorithm::rope_rotate_half.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param rotary_dim Number of rotated elements of a head.
+        /// @param base Base of the rotation frequencies.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                memory::dim rotary_dim, float base = 10000.f,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, nullptr, nullptr,
+                    dst_desc, rotary_dim, base, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a RoPE primitive.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm RoPE algorithm kind. Possible values:
+        ///     #dnnl::algorithm::rope_interleaved,
+        ///     #dnnl::algorithm::rope_rotate_half.
+        /// @param src_desc Source memory descriptor.
+        /// @param cos_sin_desc Memory descriptor of the cosine and sine
+        ///     caches. A zero memory descriptor means the values are
+        ///     computed from @p base.
+        /// @param offsets_desc Position offsets memory descriptor. A zero
+        ///     memory descriptor means positions start at zero.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param rotary_dim Number of rotated elements of a head.
+        /// @param base Base of the rotation frequencies. Ignored when
+        ///     @p cos_sin_desc is not a zero memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &cos_sin_desc,
+                const memory::desc &offsets_desc, const memory::desc &dst_desc,
+                memory::dim rotary_dim, float base = 10000.f,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, &cos_sin_desc,
+                    &offsets_desc, dst_desc, rotary_dim, base, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for a RoPE primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a RoPE primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::rope) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns a memory descriptor of the cosine and sine caches.
+        /// @returns Cosine and sine caches memory descriptor.
+        memory::desc cos_sin_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_ROPE_COS);
+        }
+
+        /// Returns a position offsets memory descriptor.
+        /// @returns Position offsets memory descriptor.
+        memory::desc offsets_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_OFFSETS);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+    private:
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc *cos_sin_desc,
+                const memory::desc *offsets_desc, const memory::desc &dst_desc,
+                memory::dim rotary_dim, float base,
+                const primitive_attr &attr, bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_rope_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    optional_arg(cos_sin_desc), optional_arg(offsets_desc),
+                    dst_desc.get(), rotary_dim, base, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a rope "
+                        "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    rope() = default;
+
+    /// Constructs a RoPE primitive.
+    /// @param pd Primitive descriptor for a RoPE primitive.
+    rope(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a RoPE primitive from a cache blob.
+    /// @param pd Primitive descriptor for a RoPE primitive.
+    /// @param cache_blob Cache blob.
+    rope(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_rope
+
+/// @addtogroup dnnl_api_topk Top-k
+///
+/// A primitive to select the k largest or smallest elements along an axis,
+/// together with their indices.
+///
+/// @sa @ref dev_guide_topk in developer guide
+///
+/// @{
+
+/// Top-k.
+struct topk : public primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a top-k primitive.
+        ///
+        /// The number of selected elements k is the size of @p dst_desc
+        /// along @p axis.
+        ///
+        /// @note
+        ///     Destination and indices memory descriptors may be initialized
+        ///     with #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Top-k algorithm kind. Possible values:
+        ///     #dnnl::algorithm::topk_max,
+        ///     #dnnl::algorithm::topk_min.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param axis Axis along which the elements are selected.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                const memory::desc &indices_desc, int axis,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_topk_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    dst_desc.get(), indices_desc.get(), axis, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a topk "
+                        "primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a top-k primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a top-k primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::topk) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_INDICES);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    topk() = default;
+
+    /// Constructs a top-k primitive.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    topk(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a top-k primitive from a cache blob.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    /// @param cache_blob Cache blob.
+    topk(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_topk
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13269,6 +13967,102 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, void *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack_get_size()
+inline status gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack()
+inline status gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_compute()
+inline status gemm_u8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stridea, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t strideb, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stridec, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N,
+            K, alpha, A, lda, stridea, B, ldb, strideb, beta, C, ldc, stridec,
+            batch_size));
+}
+
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(const char *transa, const char *transb,
+        const dnnl_dim_t *M, const dnnl_dim_t *N, const dnnl_dim_t *K,
+        const float *alpha, const float *const *A, const dnnl_dim_t *lda,
+        const float *const *B, const dnnl_dim_t *ldb, const float *beta,
+        float *const *C, const dnnl_dim_t *ldc, dnnl_dim_t group_count,
+        const dnnl_dim_t *group_size) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K, alpha,
+            A, lda, B, ldb, beta, C, ldc, group_count, group_size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch_strided()
+inline status gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stridea, uint8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t strideb, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stridec,
+        const int32_t *co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stridea, ao, B, ldb, strideb, bo,
+            beta, C, ldc, stridec, co, batch_size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch()
+inline status gemm_u8s8s32_batch(const char *transa, const char *transb,
+        const char *offsetc, const dnnl_dim_t *M, const dnnl_dim_t *N,
+        const dnnl_dim_t *K, const float *alpha, const uint8_t *const *A,
+        const dnnl_dim_t *lda, const uint8_t *ao, const int8_t *const *B,
+        const dnnl_dim_t *ldb, const int8_t *bo, const float *beta,
+        int32_t *const *C, const dnnl_dim_t *ldc, const int32_t *const *co,
+        dnnl_dim_t group_count, const dnnl_dim_t *group_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch(transa, transb, offsetc,
+            M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co,
+            group_count, group_size));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
@@ -761,6 +761,7 @@ public:
         MishBackward = dnnl_graph_op_mish_backward,
         Multiply = dnnl_graph_op_multiply,
         Pow = dnnl_graph_op_pow,
+        EmbeddingBag = dnnl_graph_op_embedding_bag,
         PReLU = dnnl_graph_op_prelu,
         PReLUBackward = dnnl_graph_op_prelu_backward,
         Quantize = dnnl_graph_op_quantize,
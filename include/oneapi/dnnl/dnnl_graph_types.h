@@ -252,6 +252,7 @@ typedef enum {
     dnnl_graph_op_hard_sigmoid_backward,
     dnnl_graph_op_select,
     dnnl_graph_op_pow,
+    dnnl_graph_op_embedding_bag,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
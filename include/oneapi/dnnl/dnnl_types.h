@@ -1886,6 +1886,12 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// An embedding bag primitive.
+    dnnl_embedding_bag,
+    /// A rotary positional embedding (RoPE) primitive.
+    dnnl_rope,
+    /// A top-k primitive.
+    dnnl_topk,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -1970,6 +1976,8 @@ typedef enum {
     dnnl_pooling_avg_include_padding = 0x2ff,
     /// Average pooling exclude padding
     dnnl_pooling_avg_exclude_padding = 0x3ff,
+    /// Adaptive average pooling
+    dnnl_pooling_avg_adaptive = 0x4ff,
     /// Local response normalization (LRN) across multiple channels
     dnnl_lrn_across_channels = 0xaff,
     /// LRN within a single channel
@@ -2042,6 +2050,21 @@ typedef enum {
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// Embedding bag using sum of rows
+    dnnl_embedding_bag_sum = 0x40000,
+    /// Embedding bag using mean of rows
+    dnnl_embedding_bag_mean,
+    /// Embedding bag using max of rows
+    dnnl_embedding_bag_max,
+    /// RoPE rotating pairs of adjacent elements (2i, 2i + 1)
+    dnnl_rope_interleaved = 0x50000,
+    /// RoPE rotating pairs of elements from the two halves of the rotary
+    /// dimension (i, i + rotary_dim / 2)
+    dnnl_rope_rotate_half,
+    /// Top-k selecting the largest elements
+    dnnl_topk_max = 0x60000,
+    /// Top-k selecting the smallest elements
+    dnnl_topk_min,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2260,6 +2283,19 @@ typedef enum {
     dnnl_scratchpad_mode_user,
 } dnnl_scratchpad_mode_t;
 
+/// Rounding mode of the down-conversion of f32 values to lower precision
+/// floating-point data types.
+typedef enum {
+    /// Rounding mode of the environment: round to nearest even (default).
+    dnnl_rounding_mode_environment,
+    /// Stochastic rounding: a value is rounded up with the probability
+    /// proportional to its distance to the lower representable value. The
+    /// random bits are defined by the seed passed at execution time as
+    /// #DNNL_ARG_ATTR_ROUNDING_SEED and by the offset of the element in the
+    /// destination memory, so the results are reproducible.
+    dnnl_rounding_mode_stochastic,
+} dnnl_rounding_mode_t;
+
 /// @struct dnnl_primitive_attr
 /// @brief An opaque structure for primitive descriptor attributes.
 ///
@@ -2406,6 +2442,21 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for shift argument of normalization primitives.
 #define DNNL_ARG_SHIFT 52
 
+/// Group offsets argument of the grouped matmul primitive.
+#define DNNL_ARG_GROUP_OFFSETS 53
+
+/// Indices argument: indices of the embedding bag primitive or indices of the
+/// selected elements of the top-k primitive.
+#define DNNL_ARG_INDICES 54
+/// Offsets argument: bag offsets of the embedding bag primitive or position
+/// offsets of the RoPE primitive and post-op.
+#define DNNL_ARG_OFFSETS 55
+
+/// Cosine cache argument of the RoPE primitive.
+#define DNNL_ARG_ROPE_COS 56
+/// Sine cache argument of the RoPE primitive.
+#define DNNL_ARG_ROPE_SIN 57
+
 /// Workspace tensor argument. Workspace is used to pass information
 /// from forward propagation to backward propagation computations.
 #define DNNL_ARG_WORKSPACE 64
@@ -2495,9 +2546,36 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for shift argument of normalization primitives.
 #define DNNL_ARG_DIFF_SHIFT 256
 
+/// Seed of stochastic rounding provided at execution time as a single s32
+/// value.
+#define DNNL_ARG_ATTR_ROUNDING_SEED 508
+
+/// Output mask of the dropout attribute: a u8 value per element of the
+/// destination, 1 for the kept elements and 0 for the dropped ones.
+#define DNNL_ARG_ATTR_DROPOUT_MASK 509
+
+/// Dropout probability provided at execution time as a single f32 value.
+#define DNNL_ARG_ATTR_DROPOUT_PROBABILITY 510
+
+/// Seed of the dropout random number generator provided at execution time as
+/// a single s32 value.
+#define DNNL_ARG_ATTR_DROPOUT_SEED 511
+
+/// Offset of the dropout random number generator provided at execution time
+/// as a single s32 value. Optional, zero if not passed.
+#define DNNL_ARG_ATTR_DROPOUT_OFFSET 512
+
 /// Output scaling factors provided at execution time.
 #define DNNL_ARG_ATTR_OUTPUT_SCALES 513
 
+/// Output mean of the batch normalization statistics attribute: a f32 value
+/// per channel of the destination.
+#define DNNL_ARG_ATTR_STATS_MEAN 514
+
+/// Output variance of the batch normalization statistics attribute: a f32
+/// value per channel of the destination.
+#define DNNL_ARG_ATTR_STATS_VARIANCE 515
+
 /// Starting index for source arguments for primitives that take a variable
 /// number of source arguments.
 #define DNNL_ARG_MULTIPLE_SRC 1024
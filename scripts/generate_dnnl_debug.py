@@ -222,6 +222,7 @@ def sanitize_value(v):
         return "any"
     v = v.split("dnnl_fpmath_mode_")[-1]
     v = v.split("dnnl_scratchpad_mode_")[-1]
+    v = v.split("dnnl_rounding_mode_")[-1]
     v = v.split("dnnl_")[-1]
     return v
 
@@ -84,6 +84,11 @@ static_assert(sizeof(bfloat16_t) == 2, "bfloat16_t must be 2 bytes");
 void cvt_float_to_bfloat16(bfloat16_t *out, const float *inp, size_t nelems);
 void cvt_bfloat16_to_float(float *out, const bfloat16_t *inp, size_t nelems);
 
+// Converts with stochastic rounding, `offset` is the index of the first
+// element used to generate the random bits, see math::stochastic_round_fwd().
+void cvt_float_to_bfloat16_stochastic(bfloat16_t *out, const float *inp,
+        size_t nelems, size_t offset, uint32_t seed);
+
 // performs element-by-element sum of inp and add float arrays and stores
 // result to bfloat16 out array with downconversion
 // out[:] = (bfloat16_t)(inp0[:] + inp1[:])
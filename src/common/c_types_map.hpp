@@ -106,6 +106,7 @@ const alg_kind_t eltwise_round = dnnl_eltwise_round;
 const alg_kind_t pooling_max = dnnl_pooling_max;
 const alg_kind_t pooling_avg_include_padding = dnnl_pooling_avg_include_padding;
 const alg_kind_t pooling_avg_exclude_padding = dnnl_pooling_avg_exclude_padding;
+const alg_kind_t pooling_avg_adaptive = dnnl_pooling_avg_adaptive;
 const alg_kind_t lrn_across_channels = dnnl_lrn_across_channels;
 const alg_kind_t lrn_within_channel = dnnl_lrn_within_channel;
 const alg_kind_t vanilla_rnn = dnnl_vanilla_rnn;
@@ -141,6 +142,13 @@ const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
+const alg_kind_t embedding_bag_sum = dnnl_embedding_bag_sum;
+const alg_kind_t embedding_bag_mean = dnnl_embedding_bag_mean;
+const alg_kind_t embedding_bag_max = dnnl_embedding_bag_max;
+const alg_kind_t rope_interleaved = dnnl_rope_interleaved;
+const alg_kind_t rope_rotate_half = dnnl_rope_rotate_half;
+const alg_kind_t topk_max = dnnl_topk_max;
+const alg_kind_t topk_min = dnnl_topk_min;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -175,6 +183,12 @@ const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
 const scratchpad_mode_t user = dnnl_scratchpad_mode_user;
 } // namespace scratchpad_mode
 
+using rounding_mode_t = dnnl_rounding_mode_t;
+namespace rounding_mode {
+const rounding_mode_t environment = dnnl_rounding_mode_environment;
+const rounding_mode_t stochastic = dnnl_rounding_mode_stochastic;
+} // namespace rounding_mode
+
 #ifdef DNNL_EXPERIMENTAL_SPARSE
 using sparse_encoding_t = dnnl_sparse_encoding_t;
 namespace sparse_encoding {
@@ -1796,6 +1810,9 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t embedding_bag = dnnl_embedding_bag;
+const primitive_kind_t rope = dnnl_rope;
+const primitive_kind_t topk = dnnl_topk;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -1926,6 +1943,7 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct embedding_bag_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
@@ -1947,6 +1965,7 @@ struct pooling_pd_t;
 struct prelu_pd_t;
 struct reduction_pd_t;
 struct reorder_pd_t;
+struct rope_pd_t;
 struct resampling_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
@@ -1956,6 +1975,7 @@ struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
 struct sum_pd_t;
+struct topk_pd_t;
 
 } // namespace impl
 } // namespace dnnl
@@ -19,6 +19,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "concat_pd.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
@@ -123,6 +124,8 @@ status_t concat_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
 
     if (pd) return success;
 
+    threading_guard_t thr_guard(
+            attr->thread_team_size_, attr->deterministic_);
     concat_pd_t *concat_pd = nullptr;
     for (auto c = engine->get_concat_implementation_list(); *c; ++c) {
         if ((*c)(&concat_pd, engine, attr, dst_md, n, concat_dim, src_mds)
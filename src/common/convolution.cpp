@@ -158,7 +158,8 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         const data_type_t src_dt = desc.src_desc.data_type;
         const data_type_t dst_dt = desc.dst_desc.data_type;
 
-        auto fwd_attr_mask = smask_t::post_ops | smask_t::sum_dt;
+        auto fwd_attr_mask
+                = smask_t::post_ops | smask_t::sum_dt | smask_t::bnorm_stats;
 
         bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8);
         if (engine->kind() == engine_kind::gpu)
@@ -203,7 +204,8 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
             const auto &po = attr->post_ops_;
             using namespace primitive_kind;
             VCHECK_CONV_UNIMPL(po.has_default_values({binary, eltwise, prelu,
-                                       sum, convolution}),
+                                       sum, convolution, inner_product,
+                                       pooling}),
                     VERBOSE_UNSUPPORTED_POSTOP);
 
             // Check sum
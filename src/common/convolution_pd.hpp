@@ -285,7 +285,8 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
     }
 
     int n_inputs() const override {
-        return 2 + with_bias() + attr_post_op_dw_inputs() + n_binary_po_inputs()
+        return 2 + with_bias() + attr_post_op_dw_inputs()
+                + attr_post_op_pw_inputs() + n_binary_po_inputs()
                 + n_prelu_po_inputs();
     }
 
@@ -319,6 +320,14 @@ protected:
         return po.entry_[conv].depthwise_conv.bias_dt == data_type::undef ? 1
                                                                           : 2;
     }
+
+    int attr_post_op_pw_inputs() const {
+        const auto &po = attr_.post_ops_;
+        int pw = po.find(primitive_kind::inner_product);
+        if (pw == -1) return 0;
+        return po.entry_[pw].pointwise_conv.bias_dt == data_type::undef ? 1
+                                                                        : 2;
+    }
 };
 
 struct convolution_bwd_data_pd_t : public convolution_pd_t {
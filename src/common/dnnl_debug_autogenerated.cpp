@@ -1607,6 +1607,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_softmax) return "softmax";
     if (v == dnnl_layer_normalization) return "layer_normalization";
     if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_embedding_bag) return "embedding_bag";
+    if (v == dnnl_rope) return "rope";
+    if (v == dnnl_topk) return "topk";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -1650,6 +1653,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_pooling_max) return "pooling_max";
     if (v == dnnl_pooling_avg_include_padding) return "pooling_avg_include_padding";
     if (v == dnnl_pooling_avg_exclude_padding) return "pooling_avg_exclude_padding";
+    if (v == dnnl_pooling_avg_adaptive) return "pooling_avg_adaptive";
     if (v == dnnl_lrn_across_channels) return "lrn_across_channels";
     if (v == dnnl_lrn_within_channel) return "lrn_within_channel";
     if (v == dnnl_vanilla_rnn) return "vanilla_rnn";
@@ -1683,6 +1687,13 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
     if (v == dnnl_softmax_accurate) return "softmax_accurate";
     if (v == dnnl_softmax_log) return "softmax_log";
+    if (v == dnnl_embedding_bag_sum) return "embedding_bag_sum";
+    if (v == dnnl_embedding_bag_mean) return "embedding_bag_mean";
+    if (v == dnnl_embedding_bag_max) return "embedding_bag_max";
+    if (v == dnnl_rope_interleaved) return "rope_interleaved";
+    if (v == dnnl_rope_rotate_half) return "rope_rotate_half";
+    if (v == dnnl_topk_max) return "topk_max";
+    if (v == dnnl_topk_min) return "topk_min";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
@@ -1711,6 +1722,13 @@ const char *dnnl_scratchpad_mode2str(dnnl_scratchpad_mode_t v) {
     return "unknown scratchpad_mode";
 }
 
+const char *dnnl_rounding_mode2str(dnnl_rounding_mode_t v) {
+    if (v == dnnl_rounding_mode_environment) return "environment";
+    if (v == dnnl_rounding_mode_stochastic) return "stochastic";
+    assert(!"unknown rounding_mode");
+    return "unknown rounding_mode";
+}
+
 const char *dnnl_cpu_isa2str(dnnl_cpu_isa_t v) {
     if (v == dnnl_cpu_isa_default) return "cpu_isa_default";
     if (v == dnnl_cpu_isa_sse41) return "cpu_isa_sse41";
@@ -52,6 +52,60 @@
 #include "common/ittnotify.hpp"
 #endif
 
+namespace dnnl {
+namespace impl {
+
+// Each thread maintains a thread-local limit on the number of threads the
+// library uses on its behalf, 0 means there is no limit. The limit is set from
+// the thread team size primitive attribute for the time of primitive
+// creation and execution, see `threading_guard_t`.
+inline int &get_threadlocal_thread_team_size() {
+    static thread_local int thread_team_size = 0;
+    return thread_team_size;
+}
+
+inline int apply_thread_team_size(int nthr) {
+    const int team_size = get_threadlocal_thread_team_size();
+    return team_size > 0 ? std::min(nthr, team_size) : nthr;
+}
+
+// Each thread maintains a thread-local flag requesting reductions with the
+// order of accumulation independent of the number of threads. The flag is
+// set from the deterministic primitive attribute for the time of primitive
+// creation and execution, see `threading_guard_t`.
+inline bool &get_threadlocal_deterministic() {
+    static thread_local bool deterministic = false;
+    return deterministic;
+}
+
+// Sets the threading properties of a primitive for the calling thread within
+// the scope. A non-positive `thread_team_size` keeps the current limit, and
+// `deterministic == false` keeps the current flag, so that the properties of
+// a primitive apply to the primitives nested into it.
+struct threading_guard_t {
+    threading_guard_t(int thread_team_size, bool deterministic)
+        : saved_thread_team_size_(get_threadlocal_thread_team_size())
+        , saved_deterministic_(get_threadlocal_deterministic()) {
+        if (thread_team_size > 0)
+            get_threadlocal_thread_team_size() = thread_team_size;
+        if (deterministic) get_threadlocal_deterministic() = true;
+    }
+    ~threading_guard_t() {
+        get_threadlocal_thread_team_size() = saved_thread_team_size_;
+        get_threadlocal_deterministic() = saved_deterministic_;
+    }
+
+    threading_guard_t(const threading_guard_t &) = delete;
+    threading_guard_t &operator=(const threading_guard_t &) = delete;
+
+private:
+    int saved_thread_team_size_;
+    bool saved_deterministic_;
+};
+
+} // namespace impl
+} // namespace dnnl
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -66,7 +120,7 @@ inline void dnnl_thr_barrier() {}
 #include "omp.h"
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
-    return omp_get_max_threads();
+    return dnnl::impl::apply_thread_team_size(omp_get_max_threads());
 }
 inline int dnnl_in_parallel() {
     return omp_in_parallel();
@@ -80,7 +134,8 @@ inline void dnnl_thr_barrier() {
 #include "tbb/task_arena.h"
 #define DNNL_THR_SYNC 0
 inline int dnnl_get_max_threads() {
-    return tbb::this_task_arena::max_concurrency();
+    return dnnl::impl::apply_thread_team_size(
+            tbb::this_task_arena::max_concurrency());
 }
 inline int dnnl_in_parallel() {
     return 0;
@@ -134,7 +189,8 @@ inline int dnnl_get_max_threads() {
 
     // Use the default max_concurrency only when no tp is passed by
     // user (e.g. primitive creation).
-    return tp ? std::max(1, tp->get_num_threads()) : max_concurrency;
+    return dnnl::impl::apply_thread_team_size(
+            tp ? std::max(1, tp->get_num_threads()) : max_concurrency);
 }
 inline int dnnl_in_parallel() {
     using namespace dnnl::impl::threadpool_utils;
@@ -152,6 +208,8 @@ inline void dnnl_thr_barrier() {
  * Otherwise, the number of current threads varies between threading runtimes:
  * - for OpenMP and TBB, return the max number of threads since the number of
  *   threads is held in a global object throughout the entire execution.
+ * In all the cases the result is limited by the thread team size of the
+ * primitive being created or executed by the calling thread, if any.
  * - for Threadpool, since the global object in oneDNN changes throughout
  *   execution, two situations can occur:
  *   a) if the library *is* aware of a threadpool when this function is invoked,
@@ -161,10 +219,9 @@ inline void dnnl_thr_barrier() {
  */
 inline int dnnl_get_current_num_threads() {
     if (dnnl_in_parallel()) return 1;
-#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-    return omp_get_max_threads();
-#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
-    return tbb::this_task_arena::max_concurrency();
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    return dnnl_get_max_threads();
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
@@ -211,6 +268,13 @@ inline bool dnnl_thr_syncable() {
     return DNNL_THR_SYNC == 1;
 }
 
+/* Returns true if the primitive being created or executed by the calling
+ * thread requires deterministic results: implementations must not split a
+ * reduction between threads in a way that depends on the number of threads. */
+inline bool dnnl_thr_deterministic() {
+    return dnnl::impl::get_threadlocal_deterministic();
+}
+
 template <typename T, typename U>
 inline void balance211(T n, U team, U tid, T &n_start, T &n_end) {
     T n_min = 1;
@@ -132,6 +132,9 @@ PKIND_TRAITS_INST(prelu);
 PKIND_TRAITS_INST(lrn);
 PKIND_TRAITS_INST(batch_normalization);
 PKIND_TRAITS_INST(group_normalization);
+PKIND_TRAITS_INST(embedding_bag);
+PKIND_TRAITS_INST(rope);
+PKIND_TRAITS_INST(topk);
 PKIND_TRAITS_INST(layer_normalization);
 PKIND_TRAITS_INST(inner_product);
 PKIND_TRAITS_INST(rnn);
@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+using namespace dnnl::impl::data_type;
+
+#define VCHECK_EB(cond, msg, ...) \
+    VCONDCHECK(create, check, embedding_bag, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_EB_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(create, check, embedding_bag, (cond), status::unimplemented, \
+            msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+
+status_t embedding_bag_desc_init(embedding_bag_desc_t *embedding_bag_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *weights_desc, const memory_desc_t *dst_desc) {
+    VCHECK_EB(!any_null(src_desc, indices_desc, offsets_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_EB(one_of(alg_kind, embedding_bag_sum, embedding_bag_mean,
+                      embedding_bag_max),
+            VERBOSE_BAD_ALGORITHM);
+
+    const bool with_weights
+            = weights_desc && !memory_desc_wrapper(weights_desc).is_zero();
+    VCHECK_EB(IMPLICATION(with_weights, alg_kind == embedding_bag_sum),
+            VERBOSE_BAD_PARAM, "weights");
+
+    VCHECK_EB(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src", src_desc->ndims);
+    VCHECK_EB(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst", dst_desc->ndims);
+    VCHECK_EB(indices_desc->ndims == 1, VERBOSE_BAD_NDIMS, "indices",
+            indices_desc->ndims);
+    VCHECK_EB(offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS, "offsets",
+            offsets_desc->ndims);
+    VCHECK_EB(IMPLICATION(with_weights, weights_desc->ndims == 1),
+            VERBOSE_BAD_NDIMS, "weights",
+            with_weights ? weights_desc->ndims : 0);
+
+    VCHECK_EB(!memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(dst_desc)
+                                .has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(indices_desc)
+                                .has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(offsets_desc)
+                                .has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    VCHECK_EB(src_desc->dims[1] == dst_desc->dims[1], VERBOSE_INCONSISTENT_DIM,
+            "src", 1, "dst", 1);
+    VCHECK_EB(offsets_desc->dims[0] == dst_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "offsets", 0, "dst", 0);
+    VCHECK_EB(IMPLICATION(with_weights,
+                      weights_desc->dims[0] == indices_desc->dims[0]),
+            VERBOSE_INCONSISTENT_DIM, "weights", 0, "indices", 0);
+
+    VCHECK_EB(indices_desc->data_type == s32, VERBOSE_INVALID_DATATYPE,
+            "indices");
+    VCHECK_EB(offsets_desc->data_type == s32, VERBOSE_INVALID_DATATYPE,
+            "offsets");
+    VCHECK_EB(IMPLICATION(with_weights, weights_desc->data_type == f32),
+            VERBOSE_INVALID_DATATYPE, "weights");
+
+    VCHECK_EB(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_EB(one_of(dst_desc->format_kind, format_kind::blocked,
+                      format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VCHECK_EB(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "src");
+    VCHECK_EB(IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                      dst_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+
+    auto ebd = embedding_bag_desc_t();
+    ebd.primitive_kind = primitive_kind::embedding_bag;
+    ebd.alg_kind = alg_kind;
+
+    ebd.src_desc = *src_desc;
+    ebd.indices_desc = *indices_desc;
+    ebd.offsets_desc = *offsets_desc;
+    if (with_weights) ebd.weights_desc = *weights_desc;
+    ebd.dst_desc = *dst_desc;
+
+    (*embedding_bag_desc) = ebd;
+    return success;
+}
+
+status_t embedding_bag_attr_check(const embedding_bag_desc_t &desc,
+        const engine_t *engine, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    const data_type_t dst_dt = desc.dst_desc.data_type;
+
+    VCHECK_EB_UNIMPL(
+            attr->has_default_values(smask_t::scales_runtime, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    // Check scales: a common or a per-row scale of the table.
+    if (!attr->scales_.has_default_values()) {
+        const auto &sc = attr->scales_;
+        VCHECK_EB_UNIMPL(sc.has_default_values({DNNL_ARG_SRC}),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_EB_UNIMPL(one_of(sc.get(DNNL_ARG_SRC).mask_, 0, 1),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_embedding_bag_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *weights_desc, const memory_desc_t *dst_desc,
+        const primitive_attr_t *attr) {
+    auto embedding_bag_desc = embedding_bag_desc_t();
+    CHECK(embedding_bag_desc_init(&embedding_bag_desc, alg_kind, src_desc,
+            indices_desc, offsets_desc, weights_desc, dst_desc));
+    CHECK(embedding_bag_attr_check(embedding_bag_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&embedding_bag_desc, nullptr, attr);
+}
@@ -127,6 +127,11 @@ inline float16_t::operator float() const {
 void cvt_float_to_float16(float16_t *out, const float *inp, size_t nelems);
 void cvt_float16_to_float(float *out, const float16_t *inp, size_t nelems);
 
+// Converts with stochastic rounding, `offset` is the index of the first
+// element used to generate the random bits, see math::stochastic_round_fwd().
+void cvt_float_to_float16_stochastic(float16_t *out, const float *inp,
+        size_t nelems, size_t offset, uint32_t seed);
+
 // performs element-by-element sum of inp and add float arrays and stores
 // result to float16 out array with downconversion
 // out[:] = (float16_t)(inp0[:] + inp1[:])
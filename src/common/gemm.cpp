@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -25,6 +28,7 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
@@ -46,6 +50,56 @@ const char *c2f_offsetC(const char *offC) {
     return offC;
 }
 
+// Computes `batch_size` independent multiplies. When there are enough of them
+// to occupy all the threads, every multiply is computed by a single thread.
+// Otherwise, the multiplies are computed one after another, each using all
+// the threads.
+template <typename F>
+status_t gemm_batch_execute(dim_t batch_size, const F &gemm) {
+    if (batch_size < 0) return status::invalid_arguments;
+
+    if (batch_size < dnnl_get_current_num_threads()) {
+        for (dim_t i = 0; i < batch_size; i++)
+            CHECK(gemm(i));
+        return status::success;
+    }
+
+    std::atomic<status_t> batch_status(status::success);
+    parallel_nd(batch_size, [&](dim_t i) {
+        const status_t st = gemm(i);
+        if (st != status::success) batch_status = st;
+    });
+    return batch_status;
+}
+
+// Returns the offsets of the first multiply of every group in the arrays of
+// a pointer-array batch. The last element is the total number of multiplies.
+status_t get_group_offsets(dim_t group_count, const dim_t *group_size,
+        std::vector<dim_t> &offsets) {
+    if (group_count < 0 || (group_count > 0 && group_size == nullptr))
+        return status::invalid_arguments;
+
+    offsets.assign(1, 0);
+    for (dim_t g = 0; g < group_count; g++) {
+        if (group_size[g] < 0) return status::invalid_arguments;
+        offsets.push_back(offsets.back() + group_size[g]);
+    }
+    return status::success;
+}
+
+dim_t get_group(const std::vector<dim_t> &offsets, dim_t i) {
+    return std::upper_bound(offsets.begin(), offsets.end(), i)
+            - offsets.begin() - 1;
+}
+
+// The public API is row-major while the implementation is column-major, so
+// matrices A and B swap their roles.
+char c2f_identifier(char identifier) {
+    if (identifier == 'A' || identifier == 'a') return 'B';
+    if (identifier == 'B' || identifier == 'b') return 'A';
+    return identifier;
+}
+
 std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     std::string s_ = std::to_string(M);
     s_ += "x";
@@ -158,6 +212,164 @@ extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
 #endif
 }
 
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl_invalid_arguments;
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::sgemm_pack_get_size(&f_identifier, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::sgemm_pack(&f_identifier, &transb, &transa, &N, &M, &K, &ldb,
+            &lda, src, static_cast<float *>(dst));
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const void *A, dim_t lda, const void *B, dim_t ldb, float beta,
+        float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::sgemm_compute(&transb, &transa, &N, &M, &K,
+            static_cast<const float *>(B), &ldb, static_cast<const float *>(A),
+            &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl_invalid_arguments;
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_s8u8s32_pack_get_size(&f_identifier, &transb, &transa, &N,
+            &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const void *src,
+        void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_s8u8s32_pack(
+            &f_identifier, &transb, &transa, &N, &M, &K, &ldb, &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const void *A, dim_t lda,
+        const void *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8u8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+            &N, &M, &K, static_cast<const int8_t *>(B), &ldb,
+            static_cast<const uint8_t *>(A), &lda, &beta, C, &ldc, co);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stridea, const float *B, dim_t ldb, dim_t strideb, float beta,
+        float *C, dim_t ldc, dim_t stridec, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return gemm_batch_execute(batch_size, [&](dim_t i) {
+        return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha,
+                B + i * strideb, &ldb, A + i * stridea, &lda, &beta,
+                C + i * stridec, &ldc, nullptr, false);
+    });
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *const *A, const dim_t *lda, const float *const *B,
+        const dim_t *ldb, const float *beta, float *const *C, const dim_t *ldc,
+        dim_t group_count, const dim_t *group_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    std::vector<dim_t> offsets;
+    CHECK(get_group_offsets(group_count, group_size, offsets));
+    if (offsets.back() == 0) return status::success;
+    if (utils::any_null(
+                transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc))
+        return status::invalid_arguments;
+
+    return gemm_batch_execute(offsets.back(), [&](dim_t i) {
+        const dim_t g = get_group(offsets, i);
+        return cpu::extended_sgemm(&transb[g], &transa[g], &N[g], &M[g], &K[g],
+                &alpha[g], B[i], &ldb[g], A[i], &lda[g], &beta[g], C[i],
+                &ldc[g], nullptr, false);
+    });
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *A,
+        dim_t lda, dim_t stridea, uint8_t ao, const int8_t *B, dim_t ldb,
+        dim_t strideb, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stridec, const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return gemm_batch_execute(batch_size, [&](dim_t i) {
+        return cpu::gemm_s8x8s32<uint8_t>(&transb, &transa,
+                c2f_offsetC(&offsetc), &N, &M, &K, &alpha, B + i * strideb,
+                &ldb, &bo, A + i * stridea, &lda, &ao, &beta, C + i * stridec,
+                &ldc, co);
+    });
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const uint8_t *const *A, const dim_t *lda,
+        const uint8_t *ao, const int8_t *const *B, const dim_t *ldb,
+        const int8_t *bo, const float *beta, int32_t *const *C,
+        const dim_t *ldc, const int32_t *const *co, dim_t group_count,
+        const dim_t *group_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    std::vector<dim_t> offsets;
+    CHECK(get_group_offsets(group_count, group_size, offsets));
+    if (offsets.back() == 0) return status::success;
+    if (utils::any_null(transa, transb, offsetc, M, N, K, alpha, A, lda, ao, B,
+                ldb, bo, beta, C, ldc, co))
+        return status::invalid_arguments;
+
+    return gemm_batch_execute(offsets.back(), [&](dim_t i) {
+        const dim_t g = get_group(offsets, i);
+        return cpu::gemm_s8x8s32<uint8_t>(&transb[g], &transa[g],
+                c2f_offsetC(&offsetc[g]), &N[g], &M[g], &K[g], &alpha[g], B[i],
+                &ldb[g], &bo[g], A[i], &lda[g], &ao[g], &beta[g], C[i],
+                &ldc[g], co[i]);
+    });
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
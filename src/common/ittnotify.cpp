@@ -70,6 +70,9 @@ __itt_domain *itt_domain(primitive_kind_t kind) {
             CASE(softmax),
             CASE(layer_normalization),
             CASE(group_normalization),
+            CASE(embedding_bag),
+            CASE(rope),
+            CASE(topk),
     };
 #undef CASE
 
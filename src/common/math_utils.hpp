@@ -429,6 +429,62 @@ inline bool is_eltwise_ok(
     return eltwise_use_src || eltwise_use_dst;
 }
 
+// Integer hash with good avalanche properties (lowbias32 by C. Wellons).
+inline uint32_t hash_u32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+// Random bits for stochastic rounding of the element with index `idx`. The
+// bits depend on the seed and on the index only, so the result does not
+// depend on the order the elements are processed in. `mixed_seed` is
+// hash_u32(seed), JIT kernels implement the same function.
+inline uint32_t stochastic_rounding_bits(size_t idx, uint32_t mixed_seed) {
+    return hash_u32((uint32_t)idx ^ mixed_seed);
+}
+
+// Random bits for dropout of the element with a 64-bit counter `idx`. Both
+// halves of the counter go through the hash, so that streams with offsets
+// beyond 2^32 do not repeat. `mixed_seed` is hash_u32(seed).
+inline uint32_t dropout_bits(int64_t idx, uint32_t mixed_seed) {
+    const uint64_t c = static_cast<uint64_t>(idx);
+    return hash_u32((uint32_t)c ^ hash_u32((uint32_t)(c >> 32) ^ mixed_seed));
+}
+
+// Stochastically rounds `s` to bf16 or f16 using the random bits `rnd`: the
+// value is rounded up with the probability proportional to its distance to
+// the closest representable value towards zero. Returns an f32 value that is
+// exactly representable in `dst_dt`, other data types are not affected.
+inline float stochastic_round_fwd(float s, uint32_t rnd, data_type_t dst_dt) {
+    if (!utils::one_of(dst_dt, data_type::bf16, data_type::f16)) return s;
+    if (std::isnan(s) || std::isinf(s)) return s;
+
+    const uint32_t bits = utils::bit_cast<uint32_t>(s);
+    const uint32_t sign = bits & 0x80000000U;
+    uint32_t abs_bits = bits ^ sign;
+    if (dst_dt == data_type::bf16) {
+        // bf16 keeps the upper 16 bits of f32. Denormals are flushed to zero
+        // as done by the conversion to bf16.
+        if (abs_bits < 0x00800000U) return utils::bit_cast<float>(sign);
+        abs_bits = (abs_bits + (rnd & 0xffffU)) & 0xffff0000U;
+    } else if (abs_bits >= 0x38800000U) { // f16 normal: |s| >= 2^-14
+        // f16 normals keep 10 out of 23 bits of the f32 mantissa.
+        abs_bits = (abs_bits + (rnd & 0x1fffU)) & ~0x1fffU;
+        if (abs_bits >= 0x47800000U) abs_bits = 0x7f800000U; // 2^16 -> inf
+    } else {
+        // f16 subnormals have a fixed step of 2^-24.
+        const float step = 1.f / (1 << 24);
+        const float u = (float)(rnd & 0xffffU) / (1 << 16);
+        const float r = floorf(utils::bit_cast<float>(abs_bits) / step + u);
+        abs_bits = utils::bit_cast<uint32_t>(r * step);
+    }
+    return utils::bit_cast<float>(abs_bits | sign);
+}
+
 } // namespace math
 } // namespace impl
 } // namespace dnnl
@@ -21,6 +21,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "matmul_pd.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -49,8 +50,9 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     const data_type_t dst_dt = desc.dst_desc.data_type;
 
     // Matmul supports scales for floating point data types
-    auto attr_mask
-            = smask_t::post_ops | smask_t::sum_dt | smask_t::scales_runtime;
+    auto attr_mask = smask_t::post_ops | smask_t::sum_dt
+            | smask_t::scales_runtime | smask_t::rounding_mode
+            | smask_t::dropout;
 
     const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8);
     if (is_int8) attr_mask |= smask_t::zero_points_runtime;
@@ -94,9 +96,25 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         const auto &po = attr->post_ops_;
         using namespace primitive_kind;
         VCHECK_MATMUL_UNIMPL(
-                po.has_default_values({binary, eltwise, prelu, sum}),
+                po.has_default_values({binary, eltwise, prelu, sum, rope}),
                 VERBOSE_UNSUPPORTED_POSTOP);
 
+        // Check rope: it rotates heads of the floating-point destination
+        // rows, so it must be the last post-op and the heads must tile N.
+        const int rope_idx = po.find(rope);
+        if (rope_idx != -1) {
+            const auto &dst = desc.dst_desc;
+            const dim_t N = dst.dims[dst.ndims - 1];
+            VCHECK_MATMUL_UNIMPL(
+                    rope_idx == po.len() - 1, VERBOSE_UNSUPPORTED_POSTOP);
+            VCHECK_MATMUL_UNIMPL(utils::one_of(dst_dt, data_type::f32,
+                                         data_type::bf16, data_type::f16),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VCHECK_MATMUL_UNIMPL(!is_runtime_value(N)
+                            && N % po.entry_[rope_idx].rope.head_dim == 0,
+                    VERBOSE_UNSUPPORTED_POSTOP);
+        }
+
         // Check sum
         VCHECK_MATMUL_UNIMPL(po.check_sum_consistency(dst_dt, is_int8, true),
                 VERBOSE_UNSUPPORTED_POSTOP);
@@ -105,6 +123,31 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     return status::success;
 }
 
+// Grouped matmul: src {M, K} and dst {M, N} rows are split into groups by
+// offsets passed at execution time, weights are {G, K, N}.
+status_t grouped_matmul_desc_check(
+        const matmul_desc_t &desc, const primitive_attr_t *attr) {
+    const auto &src = desc.src_desc;
+    const auto &wei = desc.weights_desc;
+    const auto &dst = desc.dst_desc;
+
+    VCHECK_MATMUL(dst.dims[0] == src.dims[0], VERBOSE_INCONSISTENT_DIM, "dst",
+            0, "src", 0);
+    VCHECK_MATMUL(src.dims[1] == wei.dims[1], VERBOSE_INCONSISTENT_DIM, "src",
+            1, "weights", 1);
+    VCHECK_MATMUL(dst.dims[1] == wei.dims[2], VERBOSE_INCONSISTENT_DIM, "dst",
+            1, "weights", 2);
+    for (const auto *md : {&src, &wei, &dst})
+        VCHECK_MATMUL_UNIMPL(!memory_desc_wrapper(md).has_runtime_dims(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_MATMUL_UNIMPL(
+            desc.bias_desc.ndims == 0, VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VCHECK_MATMUL_UNIMPL(attr == nullptr || attr->has_default_values(),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    return status::success;
+}
+
 } // namespace
 
 status_t dnnl_matmul_primitive_desc_create(
@@ -122,6 +165,17 @@ status_t dnnl_matmul_primitive_desc_create(
     if (bias_md) op_d.bias_desc = *bias_md;
     op_d.dst_desc = *dst_md;
 
+    if (is_grouped_matmul(op_d)) {
+        CHECK(grouped_matmul_desc_check(op_d, attr));
+        op_d.accum_data_type = types::default_accum_data_type(
+                src_md->data_type, weights_md->data_type, dst_md->data_type,
+                prop_kind::forward);
+        VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
+                VERBOSE_INVALID_DATATYPE, "accumulation");
+        return primitive_desc_create(primitive_desc_iface, engine,
+                (const op_desc_t *)&op_d, nullptr, attr);
+    }
+
     const bool with_bias = op_d.bias_desc.ndims != 0;
     const int ndims = dst_md->ndims;
     VCHECK_MATMUL(ndims >= 2 && ndims <= DNNL_MAX_NDIMS, VERBOSE_BAD_NDIMS,
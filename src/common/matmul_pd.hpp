@@ -32,6 +32,14 @@
 namespace dnnl {
 namespace impl {
 
+// A grouped matmul multiplies 2D src by a stack of 2D weights: rows of src
+// are split into groups at execution time, and every group of rows is
+// multiplied by its own weights.
+inline bool is_grouped_matmul(const matmul_desc_t &desc) {
+    return desc.src_desc.ndims == 2 && desc.dst_desc.ndims == 2
+            && desc.weights_desc.ndims == 3;
+}
+
 struct matmul_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::matmul;
 
@@ -49,6 +57,9 @@ struct matmul_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_BIAS && with_bias()) return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_GROUP_OFFSETS && is_grouped())
+            return arg_usage_t::input;
+
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
@@ -61,6 +72,8 @@ struct matmul_pd_t : public primitive_desc_t {
             case DNNL_ARG_WEIGHTS: return weights_md(0);
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_GROUP_OFFSETS:
+                return is_grouped() ? &group_offsets_md_ : &glob_zero_md;
             default: return primitive_desc_t::arg_md(arg);
         }
     }
@@ -86,7 +99,8 @@ struct matmul_pd_t : public primitive_desc_t {
     }
 
     int n_inputs() const override {
-        return 2 + with_bias() + n_binary_po_inputs() + n_prelu_po_inputs();
+        return 2 + with_bias() + is_grouped() + n_binary_po_inputs()
+                + n_prelu_po_inputs();
     }
     int n_outputs() const override { return 1; }
 
@@ -114,6 +128,10 @@ struct matmul_pd_t : public primitive_desc_t {
     dim_t N() const { return dst_md_.dims[ndims() - 1]; }
     dim_t K() const { return src_md_.dims[ndims() - 1]; }
 
+    bool is_grouped() const { return is_grouped_matmul(desc_); }
+    // Number of groups of a grouped matmul.
+    dim_t ngroups() const { return is_grouped() ? weights_md_.dims[0] : 1; }
+
     bool is_bias_1xN() const {
         if (!with_bias()) return false;
 
@@ -146,6 +164,9 @@ protected:
     memory_desc_t weights_md_;
     memory_desc_t bias_md_;
     memory_desc_t dst_md_;
+    // s32 offsets of the first row of every group followed by the number of
+    // rows covered by the groups, {ngroups() + 1} elements.
+    memory_desc_t group_offsets_md_;
 
     matmul_pd_t(const matmul_desc_t *adesc, const primitive_attr_t *attr,
             const matmul_pd_t *hint_fwd_pd)
@@ -154,7 +175,14 @@ protected:
         , src_md_(desc_.src_desc)
         , weights_md_(desc_.weights_desc)
         , bias_md_(desc_.bias_desc)
-        , dst_md_(desc_.dst_desc) {}
+        , dst_md_(desc_.dst_desc)
+        , group_offsets_md_(glob_zero_md) {
+        if (is_grouped()) {
+            const dims_t dims = {ngroups() + 1};
+            memory_desc_init_by_tag(group_offsets_md_, 1, dims, data_type::s32,
+                    format_tag::x);
+        }
+    }
 
     // temporary solution to deal with format `any`
     bool set_default_formats() {
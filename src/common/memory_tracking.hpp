@@ -167,10 +167,12 @@ enum {
     key_brgemm_primitive_buffer_d,
     key_brgemm_primitive_zp_comp_a,
     key_brgemm_primitive_zp_comp_b,
+    key_brgemm_primitive_rope_cos_sin,
     key_concat_iptrs,
     key_concat_istrides,
     key_concat_nelems,
     key_concat_optrs,
+    key_concat_scales,
     key_concat_tent_dst,
     key_conv_adjusted_scales,
     key_conv_amx_inp_buffer,
@@ -191,6 +193,8 @@ enum {
     key_conv_brgemm_buffer,
     key_conv_brgemm_inp_buffer,
     key_conv_brgemm_inp_buffer_mask,
+    key_conv_brgemm_pool_buffer,
+    key_conv_brgemm_stats,
     key_conv_bwd_w_1st_bia_reorder,
     key_conv_bwd_w_1st_wei_reorder,
     key_conv_gemm_acc,
@@ -224,6 +228,11 @@ enum {
     key_gemm_tmp_buffer,
     key_gemm_blocked_a,
     key_gemm_blocked_b,
+    key_gnorm_coeffs,
+    key_gnorm_reduction,
+    key_gnorm_tmp_diff_ss,
+    key_gnorm_tmp_mean,
+    key_gnorm_tmp_var,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
@@ -266,6 +275,8 @@ enum {
     key_rnn_diff_states,
     key_rnn_gates,
     key_rnn_gates_blocked,
+    key_rnn_persistent_states,
+    key_rnn_persistent_weights,
     key_rnn_src_layer_trans,
     key_rnn_src_iter_trans,
     key_rnn_ht,
@@ -278,6 +289,8 @@ enum {
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_cand,
+    key_topk_partial,
     key_wino_U,
     key_wino_V,
     key_wino_M,
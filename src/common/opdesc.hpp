@@ -325,6 +325,55 @@ struct group_normalization_desc_t {
     memory_desc_t diff_dst_desc;
 };
 
+// A descriptor of an Embedding Bag operation.
+struct embedding_bag_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_embedding_bag.
+    primitive_kind_t primitive_kind;
+    // The kind of pooling of the rows of a bag. Possible values:
+    // #dnnl_embedding_bag_sum, #dnnl_embedding_bag_mean,
+    // #dnnl_embedding_bag_max.
+    alg_kind_t alg_kind;
+    // Embedding table memory descriptor, 2D [Rows, Embedding size].
+    memory_desc_t src_desc;
+    // Indices memory descriptor, 1D [Indices].
+    memory_desc_t indices_desc;
+    // Bag offsets memory descriptor, 1D [Bags].
+    memory_desc_t offsets_desc;
+    // Per-sample weights memory descriptor, 1D [Indices]. Equals to zero
+    // memory descriptor if the weights are not used.
+    memory_desc_t weights_desc;
+    // Destination memory descriptor, 2D [Bags, Embedding size].
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of a rotary positional embedding (RoPE) operation.
+struct rope_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_rope.
+    primitive_kind_t primitive_kind;
+    // The pairing of rotated elements. Possible values:
+    // #dnnl_rope_interleaved, #dnnl_rope_rotate_half.
+    alg_kind_t alg_kind;
+    // Source memory descriptor, 3D [Batch, Sequence, Head size] or
+    // 4D [Batch, Heads, Sequence, Head size].
+    memory_desc_t src_desc;
+    // Cosine and sine caches memory descriptor, 2D
+    // [Positions, Rotary dimension / 2]. Equals to zero memory descriptor if
+    // the values are computed from the base.
+    memory_desc_t cos_sin_desc;
+    // Position offsets memory descriptor, 1D [Batch]. Equals to zero memory
+    // descriptor if positions start at zero.
+    memory_desc_t offsets_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+    // Number of rotated elements of a head.
+    dim_t rotary_dim;
+    // Base of the rotation frequencies. Equals to zero if the caches are
+    // used.
+    float base;
+};
+
 // A descriptor of a Layer Normalization operation.
 struct layer_normalization_desc_t {
     // The kind of primitive. Used for self-identifying the primitive
@@ -417,6 +466,26 @@ struct reduction_desc_t {
     float p, eps;
 };
 
+// A descriptor of a top-k operation.
+struct topk_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_topk.
+    primitive_kind_t primitive_kind;
+    // The kind of selected elements. Possible values: #dnnl_topk_max,
+    // #dnnl_topk_min.
+    alg_kind_t alg_kind;
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination memory descriptor of the selected values. Equals to the
+    // source one except for the size of the axis dimension which is k.
+    memory_desc_t dst_desc;
+    // Indices memory descriptor of the selected values, s32 with the
+    // dimensions of the destination.
+    memory_desc_t indices_desc;
+    // The axis along which the elements are selected.
+    int axis;
+};
+
 /// A descriptor of a Softmax operation.
 struct softmax_desc_t {
     // The kind of primitive. Used for self-identifying the primitive
@@ -488,8 +557,8 @@ struct pooling_desc_t {
     prop_kind_t prop_kind;
     // The kind of pooling algorithm.
     // Possible values: #dnnl_pooling_max,
-    // #dnnl_pooling_avg_include_padding, and
-    // #dnnl_pooling_avg_exclude_padding.
+    // #dnnl_pooling_avg_include_padding,
+    // #dnnl_pooling_avg_exclude_padding, and #dnnl_pooling_avg_adaptive.
     alg_kind_t alg_kind;
     // Source memory descriptor.
     memory_desc_t src_desc;
@@ -602,6 +671,8 @@ struct op_desc_t {
         lrn_desc_t lrn;
         batch_normalization_desc_t batch_normalization;
         group_normalization_desc_t group_normalization;
+        embedding_bag_desc_t embedding_bag;
+        rope_desc_t rope;
         layer_normalization_desc_t layer_normalization;
         inner_product_desc_t inner_product;
         rnn_desc_t rnn;
@@ -614,6 +685,7 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        topk_desc_t topk;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -634,6 +706,8 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(lrn_desc_t);
     DECL_CTOR_AND_CONVERTERS(batch_normalization_desc_t);
     DECL_CTOR_AND_CONVERTERS(group_normalization_desc_t);
+    DECL_CTOR_AND_CONVERTERS(embedding_bag_desc_t);
+    DECL_CTOR_AND_CONVERTERS(rope_desc_t);
     DECL_CTOR_AND_CONVERTERS(layer_normalization_desc_t);
     DECL_CTOR_AND_CONVERTERS(inner_product_desc_t);
     DECL_CTOR_AND_CONVERTERS(rnn_desc_t);
@@ -646,6 +720,7 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(topk_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
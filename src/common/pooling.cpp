@@ -48,7 +48,7 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
                            padding_l),
             VERBOSE_NULL_ARG);
     VCHECK_POOLING(one_of(alg_kind, pooling_max, pooling_avg_include_padding,
-                           pooling_avg_exclude_padding),
+                           pooling_avg_exclude_padding, pooling_avg_adaptive),
             VERBOSE_BAD_ALGORITHM);
     VCHECK_POOLING(
             IMPLICATION(one_of(prop_kind, forward_training, forward_inference),
@@ -85,7 +85,7 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
     utils::array_copy(pd.dilation, dilation, sp_dims);
 
     if (one_of(alg_kind, pooling_max, pooling_avg_include_padding,
-                pooling_avg_exclude_padding)) {
+                pooling_avg_exclude_padding, pooling_avg_adaptive)) {
         pd.accum_data_type = types::default_accum_data_type(
                 src_desc->data_type, dst_desc->data_type, false);
     } else {
@@ -114,6 +114,11 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
 
         VCHECK_POOLING(str > 0 && dil >= 0 && pad_l >= 0 && (pad_r + str >= 0),
                 VERBOSE_INCONSISTENT_PRB);
+
+        // The window of the adaptive algorithm is derived from the source and
+        // destination sizes, any of them is valid.
+        if (alg_kind == pooling_avg_adaptive) continue;
+
         VCHECK_POOLING((src - ker_range + pad_l + pad_r) / str + 1 == dst,
                 VERBOSE_INCONSISTENT_PRB)
 
@@ -118,6 +118,28 @@ struct pooling_pd_t : public primitive_desc_t {
 
     bool is_dilated() const { return KDD() != 0 || KDH() != 0 || KDW() != 0; }
 
+    bool is_adaptive() const {
+        return desc_.alg_kind == alg_kind::pooling_avg_adaptive;
+    }
+
+    // A pooling with a single window covering the whole spatial domain.
+    bool is_global() const {
+        if (OD() != 1 || OH() != 1 || OW() != 1) return false;
+        if (is_adaptive()) return true;
+        return KD() == ID() && KH() == IH() && KW() == IW() && !is_dilated()
+                && padFront() == 0 && padBack() == 0 && padT() == 0
+                && padB() == 0 && padL() == 0 && padR() == 0;
+    }
+
+    // Boundaries [start, end) of the window of the adaptive pooling for the
+    // output point `o` along a dimension with `I` inputs and `O` outputs.
+    static dim_t adaptive_start(dim_t o, dim_t I, dim_t O) {
+        return o * I / O;
+    }
+    static dim_t adaptive_end(dim_t o, dim_t I, dim_t O) {
+        return utils::div_up((o + 1) * I, O);
+    }
+
     bool has_zero_dim_memory() const {
         return memory_desc_wrapper(src_desc()).has_zero_dim();
     }
@@ -121,6 +121,9 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
     CHECK_MASK(smask_t::scales, scales_);
     CHECK_MASK(smask_t::zero_points, zero_points_);
     CHECK_MASK(smask_t::post_ops, post_ops_);
+    CHECK_MASK(smask_t::rounding_mode, rounding_mode_);
+    CHECK_MASK(smask_t::dropout, dropout_);
+    CHECK_MASK(smask_t::bnorm_stats, bnorm_stats_);
     CHECK_MASK(smask_t::rnn_data_qparams, rnn_data_qparams_);
     CHECK_MASK(smask_t::rnn_weights_qparams, rnn_weights_qparams_);
     CHECK_MASK(smask_t::rnn_weights_projection_qparams,
@@ -209,6 +212,56 @@ status_t post_ops_t::append_dw(data_type_t wei_dt, data_type_t bias_dt,
     return success;
 }
 
+status_t post_ops_t::append_pw(
+        data_type_t wei_dt, data_type_t bias_dt, data_type_t dst_dt, dim_t oc) {
+    if (len() == post_ops_limit) return out_of_memory;
+    bool ok = wei_dt != data_type::undef && dst_dt != data_type::undef
+            && oc > 0;
+    if (!ok) return invalid_arguments;
+
+    // Pointwise post-op completes a chain started by a depthwise post-op and
+    // there can be only one of them.
+    ok = find(primitive_kind::convolution) != -1
+            && find(primitive_kind::inner_product) == -1;
+    if (!ok) return invalid_arguments;
+
+    entry_.emplace_back();
+    auto &e = entry_.back();
+    e.kind = primitive_kind::inner_product;
+    auto &p = e.pointwise_conv;
+    p.oc = oc;
+    p.wei_dt = wei_dt;
+    p.bias_dt = bias_dt;
+    p.dst_dt = dst_dt;
+
+    return success;
+}
+
+status_t post_ops_t::append_pooling(
+        alg_kind_t alg, dim_t kernel_h, dim_t kernel_w) {
+    using namespace alg_kind;
+    if (len() == post_ops_limit) return out_of_memory;
+    bool ok = utils::one_of(alg, pooling_max, pooling_avg_include_padding,
+                      pooling_avg_exclude_padding)
+            && kernel_h > 0 && kernel_w > 0;
+    if (!ok) return invalid_arguments;
+
+    // Pooling changes the output spatial size, so it can be applied only once
+    // and not together with convolution post-ops.
+    ok = find(primitive_kind::pooling) == -1
+            && find(primitive_kind::convolution) == -1;
+    if (!ok) return invalid_arguments;
+
+    entry_.emplace_back();
+    auto &e = entry_.back();
+    e.kind = primitive_kind::pooling;
+    e.pooling.alg = alg;
+    e.pooling.kernel_h = kernel_h;
+    e.pooling.kernel_w = kernel_w;
+
+    return success;
+}
+
 status_t post_ops_t::validate_binary(
         alg_kind_t alg, const memory_desc_t *user_src1_desc) const {
 
@@ -267,6 +320,25 @@ status_t post_ops_t::append_prelu(int mask) {
     return success;
 }
 
+status_t post_ops_t::append_rope(
+        alg_kind_t alg, dim_t head_dim, dim_t rotary_dim, float base) {
+    using namespace alg_kind;
+    if (len() == post_ops_limit) return out_of_memory;
+    bool ok = one_of(alg, rope_interleaved, rope_rotate_half) && head_dim > 0
+            && rotary_dim > 0 && rotary_dim % 2 == 0 && rotary_dim <= head_dim
+            && base > 0.f;
+    if (!ok) return invalid_arguments;
+
+    auto it_entry = entry_.emplace(entry_.end());
+    it_entry->kind = primitive_kind::rope;
+    it_entry->rope.alg = alg;
+    it_entry->rope.head_dim = head_dim;
+    it_entry->rope.rotary_dim = rotary_dim;
+    it_entry->rope.base = base;
+
+    return success;
+}
+
 bool post_ops_t::defined() const {
     for (int idx = 0; idx < len(); ++idx) {
         auto kind = entry_[idx].kind;
@@ -278,8 +350,9 @@ bool post_ops_t::defined() const {
                     || is_runtime_value(e.beta))
                 return false;
         } else if (utils::one_of(kind, primitive_kind::binary,
-                           primitive_kind::prelu,
-                           primitive_kind::convolution)) {
+                           primitive_kind::prelu, primitive_kind::convolution,
+                           primitive_kind::inner_product,
+                           primitive_kind::pooling, primitive_kind::rope)) {
             // binary is always defined
         } else {
             assert(!"unreachable");
@@ -368,13 +441,68 @@ status_t primitive_attr_t::set_scratchpad_mode(
     return success;
 }
 
+status_t primitive_attr_t::set_thread_team_size(int thread_team_size) {
+    if (thread_team_size < 0) return invalid_arguments;
+
+    thread_team_size_ = thread_team_size;
+    return success;
+}
+
+status_t primitive_attr_t::set_deterministic(bool deterministic) {
+    deterministic_ = deterministic;
+    return success;
+}
+
 status_t primitive_attr_t::set_post_ops(const post_ops_t &post_ops) {
     post_ops_.copy_from(post_ops);
     return status::success;
 }
 
+status_t dropout_t::set(const memory_desc_t *user_mask_desc) {
+    if (user_mask_desc && !types::is_zero_md(user_mask_desc)) {
+        const memory_desc_wrapper mask_d(user_mask_desc);
+        // The mask is a byte per element of the destination.
+        bool ok = mask_d.data_type() == data_type::u8 && mask_d.ndims() > 0
+                && !mask_d.has_runtime_dims_or_strides();
+        if (!ok) return invalid_arguments;
+        user_mask_desc_ = *user_mask_desc;
+    } else {
+        user_mask_desc_ = glob_zero_md;
+    }
+    mask_desc_ = user_mask_desc_;
+    enabled_ = true;
+    return success;
+}
+
+status_t dropout_t::set_default_formats(const memory_desc_t *dst_md) {
+    if (!has_mask()) return success;
+
+    const memory_desc_wrapper mask_mdw(mask_desc_);
+    if (!mask_mdw.format_any()) return success;
+
+    const memory_desc_wrapper dst_mdw(dst_md);
+    assert(!dst_mdw.format_any());
+    if (mask_mdw.ndims() != dst_mdw.ndims()) return invalid_arguments;
+    return memory_desc_init_by_blocking_desc(
+            mask_desc_, dst_mdw.blocking_desc());
+}
+
+status_t bnorm_stats_t::set_default_formats(const memory_desc_t *dst_md) {
+    if (!enabled_) return success;
+
+    // The statistics are computed per channel, which is the second dimension.
+    const memory_desc_wrapper dst_mdw(dst_md);
+    if (dst_mdw.ndims() < 2 || dst_mdw.has_runtime_dims())
+        return invalid_arguments;
+    const dims_t dims = {dst_mdw.dims()[1]};
+    return memory_desc_init_by_tag(
+            stat_desc_, 1, dims, data_type::f32, format_tag::a);
+}
+
 status_t primitive_attr_t::set_default_formats(const memory_desc_t *dst_md) {
-    return post_ops_.set_default_formats(dst_md);
+    CHECK(post_ops_.set_default_formats(dst_md));
+    CHECK(dropout_.set_default_formats(dst_md));
+    return bnorm_stats_.set_default_formats(dst_md);
 }
 
 status_t primitive_attr_t::set_gpu_attr(const primitive_attr_item_t &gpu_attr) {
@@ -435,6 +563,91 @@ status_t dnnl_primitive_attr_set_scratchpad_mode(
     return attr->set_scratchpad_mode(scratchpad_mode);
 }
 
+status_t dnnl_primitive_attr_get_thread_team_size(
+        const primitive_attr_t *attr, int *thread_team_size) {
+    if (any_null(attr, thread_team_size)) return invalid_arguments;
+
+    *thread_team_size = attr->thread_team_size_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_thread_team_size(
+        primitive_attr_t *attr, int thread_team_size) {
+    if (any_null(attr)) return invalid_arguments;
+
+    return attr->set_thread_team_size(thread_team_size);
+}
+
+status_t dnnl_primitive_attr_get_deterministic(
+        const primitive_attr_t *attr, int *value) {
+    if (any_null(attr, value)) return invalid_arguments;
+
+    *value = attr->deterministic_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_deterministic(
+        primitive_attr_t *attr, int value) {
+    if (any_null(attr)) return invalid_arguments;
+
+    return attr->set_deterministic(value);
+}
+
+status_t dnnl_primitive_attr_get_rounding(
+        const primitive_attr_t *attr, int arg, rounding_mode_t *mode) {
+    if (any_null(attr, mode)) return invalid_arguments;
+    if (!rnd_mode_t::arg_ok(arg)) return invalid_arguments;
+
+    *mode = attr->rounding_mode_.get(arg);
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_rounding(
+        primitive_attr_t *attr, int arg, rounding_mode_t mode) {
+    if (any_null(attr)) return invalid_arguments;
+
+    return attr->rounding_mode_.set(arg, mode);
+}
+
+status_t dnnl_primitive_attr_get_dropout(const primitive_attr_t *attr,
+        int *enabled, const memory_desc_t **mask_desc) {
+    if (any_null(attr)) return invalid_arguments;
+
+    if (enabled) *enabled = attr->dropout_.enabled_;
+    if (mask_desc) *mask_desc = &attr->dropout_.user_mask_desc_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dropout(
+        primitive_attr_t *attr, const memory_desc_t *mask_desc) {
+    if (any_null(attr)) return invalid_arguments;
+
+    return attr->dropout_.set(mask_desc);
+}
+
+status_t dnnl_primitive_attr_get_batch_normalization_stats(
+        const primitive_attr_t *attr, int *enabled) {
+    if (any_null(attr, enabled)) return invalid_arguments;
+
+    *enabled = attr->bnorm_stats_.enabled_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_batch_normalization_stats(
+        primitive_attr_t *attr, int enabled) {
+    if (any_null(attr)) return invalid_arguments;
+
+    attr->bnorm_stats_.enabled_ = enabled != 0;
+    attr->bnorm_stats_.stat_desc_ = glob_zero_md;
+
+    return success;
+}
+
 status_t dnnl_primitive_attr_set_scales_mask(
         primitive_attr_t *attr, int arg, int mask) {
     bool ok = attr && mask >= 0 && arg >= 0
@@ -580,6 +793,49 @@ status_t dnnl_post_ops_get_params_dw(const post_ops_t *post_ops, int index,
     return success;
 }
 
+status_t dnnl_post_ops_append_pw(post_ops_t *post_ops, data_type_t wei_dt,
+        data_type_t bias_dt, data_type_t dst_dt, dim_t output_channels) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_pw(wei_dt, bias_dt, dst_dt, output_channels);
+}
+
+status_t dnnl_post_ops_get_params_pw(const post_ops_t *post_ops, int index,
+        data_type_t *wei_dt, data_type_t *bias_dt, data_type_t *dst_dt,
+        dim_t *output_channels) {
+    if (!simple_get_params_check(
+                post_ops, index, primitive_kind::inner_product))
+        return invalid_arguments;
+
+    const auto &p = post_ops->entry_[index].pointwise_conv;
+    if (wei_dt) *wei_dt = p.wei_dt;
+    if (bias_dt) *bias_dt = p.bias_dt;
+    if (dst_dt) *dst_dt = p.dst_dt;
+    if (output_channels) *output_channels = p.oc;
+
+    return success;
+}
+
+status_t dnnl_post_ops_append_pooling(post_ops_t *post_ops,
+        alg_kind_t alg_kind, dim_t kernel_h, dim_t kernel_w) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_pooling(alg_kind, kernel_h, kernel_w);
+}
+
+status_t dnnl_post_ops_get_params_pooling(const post_ops_t *post_ops,
+        int index, alg_kind_t *alg_kind, dim_t *kernel_h, dim_t *kernel_w) {
+    if (!simple_get_params_check(post_ops, index, primitive_kind::pooling))
+        return invalid_arguments;
+
+    const auto &p = post_ops->entry_[index].pooling;
+    if (alg_kind) *alg_kind = p.alg;
+    if (kernel_h) *kernel_h = p.kernel_h;
+    if (kernel_w) *kernel_w = p.kernel_w;
+
+    return success;
+}
+
 status_t dnnl_post_ops_append_binary(post_ops_t *post_ops, alg_kind_t alg_kind,
         const memory_desc_t *user_src1_desc) {
     if (post_ops == nullptr) return invalid_arguments;
@@ -616,6 +872,28 @@ status_t dnnl_post_ops_get_params_prelu(
     return success;
 }
 
+status_t dnnl_post_ops_append_rope(post_ops_t *post_ops, alg_kind_t alg_kind,
+        dim_t head_dim, dim_t rotary_dim, float base) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_rope(alg_kind, head_dim, rotary_dim, base);
+}
+
+status_t dnnl_post_ops_get_params_rope(const post_ops_t *post_ops, int index,
+        alg_kind_t *alg_kind, dim_t *head_dim, dim_t *rotary_dim,
+        float *base) {
+    if (!simple_get_params_check(post_ops, index, primitive_kind::rope))
+        return invalid_arguments;
+
+    const auto &r = post_ops->entry_[index].rope;
+    if (alg_kind) *alg_kind = r.alg;
+    if (head_dim) *head_dim = r.head_dim;
+    if (rotary_dim) *rotary_dim = r.rotary_dim;
+    if (base) *base = r.base;
+
+    return success;
+}
+
 status_t dnnl_primitive_attr_set_rnn_data_qparams(
         primitive_attr_t *attr, const float scale, const float shift) {
     if (attr == nullptr) return invalid_arguments;
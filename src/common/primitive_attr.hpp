@@ -294,6 +294,12 @@ private:
         for (const auto &sa : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) {
             if (arg == (DNNL_ARG_ATTR_POST_OP_DW | sa)) return true;
         }
+        // point-wise convolution post op, 32 is the limit of post-ops
+        if (arg >= DNNL_ARG_ATTR_MULTIPLE_POST_OP(0)
+                && arg < DNNL_ARG_ATTR_MULTIPLE_POST_OP(32)) {
+            const int sa = arg % DNNL_ARG_ATTR_MULTIPLE_POST_OP_BASE;
+            if (sa == DNNL_ARG_WEIGHTS || sa == DNNL_ARG_DST) return true;
+        }
         return false;
     }
 };
@@ -356,6 +362,93 @@ private:
     }
 };
 
+// Rounding modes of the down-conversion of results, per memory argument.
+// Only non-default modes are stored.
+struct rnd_mode_t : public c_compatible {
+    rnd_mode_t() = default;
+
+    bool operator==(const rnd_mode_t &rhs) const {
+        return rounding_modes_map_ == rhs.rounding_modes_map_;
+    }
+
+    rounding_mode_t get(int arg) const {
+        const auto it = rounding_modes_map_.find(arg);
+        if (it == rounding_modes_map_.end()) return rounding_mode::environment;
+        return it->second;
+    }
+
+    status_t set(int arg, rounding_mode_t rm) {
+        if (!check(arg, rm)) return status::invalid_arguments;
+        if (rm == rounding_mode::environment)
+            rounding_modes_map_.erase(arg);
+        else
+            rounding_modes_map_[arg] = rm;
+        return status::success;
+    }
+
+    bool has_default_values() const { return rounding_modes_map_.empty(); }
+
+    static bool arg_ok(int arg) {
+        return utils::one_of(
+                arg, DNNL_ARG_DST, DNNL_ARG_DIFF_SRC, DNNL_ARG_DIFF_WEIGHTS);
+    }
+
+    std::map<int, rounding_mode_t> rounding_modes_map_;
+
+private:
+    static bool check(int arg, rounding_mode_t rm) {
+        const bool rm_ok = utils::one_of(
+                rm, rounding_mode::environment, rounding_mode::stochastic);
+        return arg_ok(arg) && rm_ok;
+    }
+};
+
+// Dropout applied to the output of a primitive. The probability, the seed and
+// the offset of the random number generator are passed at execution time.
+// The mask of kept elements is an optional output.
+struct dropout_t : public c_compatible {
+    dropout_t() = default;
+
+    bool operator==(const dropout_t &rhs) const {
+        return enabled_ == rhs.enabled_
+                && user_mask_desc_ == rhs.user_mask_desc_;
+    }
+
+    bool has_default_values() const { return !enabled_; }
+    bool has_mask() const {
+        return enabled_ && !types::is_zero_md(&mask_desc_);
+    }
+
+    status_t set(const memory_desc_t *user_mask_desc);
+    status_t set_default_formats(const memory_desc_t *dst_md);
+
+    bool enabled_ = false;
+    // This is an unmodifiable user copy of the mask descriptor which is used
+    // in caching mechanism. Not to be used internally.
+    memory_desc_t user_mask_desc_ = glob_zero_md;
+    // A copy of the mask descriptor with format_kind::any resolved.
+    memory_desc_t mask_desc_ = glob_zero_md;
+};
+
+// Batch normalization statistics of the output of a primitive: the mean and
+// the variance of the destination over all dimensions except the channel one.
+struct bnorm_stats_t : public c_compatible {
+    bnorm_stats_t() = default;
+
+    bool operator==(const bnorm_stats_t &rhs) const {
+        return enabled_ == rhs.enabled_;
+    }
+
+    bool has_default_values() const { return !enabled_; }
+
+    status_t set_default_formats(const memory_desc_t *dst_md);
+
+    bool enabled_ = false;
+    // Descriptor of both statistics, initialized from the destination
+    // descriptor.
+    memory_desc_t stat_desc_ = glob_zero_md;
+};
+
 struct serialization_stream_t;
 
 struct primitive_attr_item_t {
@@ -400,6 +493,19 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             dnnl::impl::data_type_t dst_dt;
         };
 
+        struct pointwise_conv_t {
+            dnnl::impl::dim_t oc;
+            dnnl::impl::data_type_t wei_dt;
+            dnnl::impl::data_type_t bias_dt;
+            dnnl::impl::data_type_t dst_dt;
+        };
+
+        struct pooling_t {
+            dnnl::impl::alg_kind_t alg;
+            dnnl::impl::dim_t kernel_h;
+            dnnl::impl::dim_t kernel_w;
+        };
+
         struct binary_t {
             dnnl::impl::alg_kind_t alg;
             // This is an unmodifiable user copy of attributes which is used in
@@ -415,6 +521,13 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             int mask;
         };
 
+        struct rope_t {
+            dnnl::impl::alg_kind_t alg;
+            dnnl::impl::dim_t head_dim;
+            dnnl::impl::dim_t rotary_dim;
+            float base;
+        };
+
         dnnl::impl::primitive_kind_t kind
                 = dnnl::impl::primitive_kind::undefined;
         union {
@@ -425,8 +538,11 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             } sum;
             eltwise_t eltwise;
             depthwise_conv_t depthwise_conv;
+            pointwise_conv_t pointwise_conv;
+            pooling_t pooling;
             binary_t binary;
             prelu_t prelu;
+            rope_t rope;
         };
 
         bool is_eltwise(bool require_scale_one = false) const {
@@ -456,6 +572,15 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             return kind == primitive_kind::convolution;
         }
 
+        bool is_pointwise_convolution() const {
+            using namespace dnnl::impl;
+            return kind == primitive_kind::inner_product;
+        }
+
+        bool is_pooling() const {
+            return kind == dnnl::impl::primitive_kind::pooling;
+        }
+
         bool is_binary() const {
             return kind == dnnl::impl::primitive_kind::binary;
         }
@@ -466,6 +591,10 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
 
         bool is_like_binary() const { return is_binary() || is_prelu(); }
 
+        bool is_rope() const {
+            return kind == dnnl::impl::primitive_kind::rope;
+        }
+
         dnnl::impl::status_t set_depthwise_scales(const float *scales);
 
         bool operator==(const entry_t &rhs) const {
@@ -499,6 +628,20 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                             && depthwise_conv.dst_dt
                                     == rhs.depthwise_conv.dst_dt;
                     break;
+                case primitive_kind::inner_product:
+                    ret = pointwise_conv.oc == rhs.pointwise_conv.oc
+                            && pointwise_conv.wei_dt
+                                    == rhs.pointwise_conv.wei_dt
+                            && pointwise_conv.bias_dt
+                                    == rhs.pointwise_conv.bias_dt
+                            && pointwise_conv.dst_dt
+                                    == rhs.pointwise_conv.dst_dt;
+                    break;
+                case primitive_kind::pooling:
+                    ret = pooling.alg == rhs.pooling.alg
+                            && pooling.kernel_h == rhs.pooling.kernel_h
+                            && pooling.kernel_w == rhs.pooling.kernel_w;
+                    break;
                 case primitive_kind::binary:
                     ret = binary.alg == rhs.binary.alg
                             && binary.user_src1_desc
@@ -507,6 +650,12 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                 case primitive_kind::prelu:
                     ret = prelu.mask == rhs.prelu.mask;
                     break;
+                case primitive_kind::rope:
+                    ret = rope.alg == rhs.rope.alg
+                            && rope.head_dim == rhs.rope.head_dim
+                            && rope.rotary_dim == rhs.rope.rotary_dim
+                            && equal_with_nan(rope.base, rhs.rope.base);
+                    break;
                 default: assert(!"unsupported post_op");
             }
             return ret;
@@ -537,9 +686,17 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             dnnl::impl::data_type_t bias_dt, dnnl::impl::data_type_t dst_dt,
             dnnl::impl::dim_t kernel_size, dnnl::impl::dim_t stride_size,
             dnnl::impl::dim_t padding_l_size);
+    dnnl::impl::status_t append_pw(dnnl::impl::data_type_t wei_dt,
+            dnnl::impl::data_type_t bias_dt, dnnl::impl::data_type_t dst_dt,
+            dnnl::impl::dim_t oc);
+    dnnl::impl::status_t append_pooling(dnnl::impl::alg_kind_t alg,
+            dnnl::impl::dim_t kernel_h, dnnl::impl::dim_t kernel_w);
     dnnl::impl::status_t append_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *user_src1_desc);
     dnnl::impl::status_t append_prelu(int mask);
+    dnnl::impl::status_t append_rope(dnnl::impl::alg_kind_t alg,
+            dnnl::impl::dim_t head_dim, dnnl::impl::dim_t rotary_dim,
+            float base);
 
     dnnl::impl::status_t prepend_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *user_src1_desc);
@@ -642,7 +799,9 @@ private:
 struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl_primitive_attr()
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
-        , fpmath_mode_(dnnl::impl::get_fpmath_mode()) {}
+        , fpmath_mode_(dnnl::impl::get_fpmath_mode())
+        , thread_team_size_(0)
+        , deterministic_(false) {}
 
     dnnl_primitive_attr *clone() const {
         return new dnnl_primitive_attr(*this);
@@ -661,6 +820,11 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         zero_points_ = other.zero_points_;
         scratchpad_mode_ = other.scratchpad_mode_;
         fpmath_mode_ = other.fpmath_mode_;
+        thread_team_size_ = other.thread_team_size_;
+        deterministic_ = other.deterministic_;
+        rounding_mode_ = other.rounding_mode_;
+        dropout_ = other.dropout_;
+        bnorm_stats_ = other.bnorm_stats_;
         post_ops_.copy_from(other.post_ops_);
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -688,12 +852,16 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         rnn_tparams = 1u << 9,
         sum_dt = 1u << 10,
         rnn_weights_projection_qparams = 1u << 11,
-        gpu_attr = 1u << 12
+        gpu_attr = 1u << 12,
+        rounding_mode = 1u << 13,
+        dropout = 1u << 14,
+        bnorm_stats = 1u << 15,
     };
 
     /** Returns true if the attributes have default values.
      *
-     * @note The scratchpad_mode_ is not take into account */
+     * @note The scratchpad_mode_, thread_team_size_ and deterministic_ are
+     * not take into account */
     bool has_default_values(skip_mask_t mask = skip_mask_t::none,
             dnnl::impl::data_type_t dst_dt = dnnl_data_type_undef) const;
 
@@ -703,8 +871,13 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_mode_ == rhs.fpmath_mode_
+                && thread_team_size_ == rhs.thread_team_size_
+                && deterministic_ == rhs.deterministic_
                 && output_scales_ == rhs.output_scales_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
+                && rounding_mode_ == rhs.rounding_mode_
+                && dropout_ == rhs.dropout_
+                && bnorm_stats_ == rhs.bnorm_stats_
                 && post_ops_ == rhs.post_ops_
                 && rnn_data_qparams_ == rhs.rnn_data_qparams_
                 && rnn_weights_qparams_ == rhs.rnn_weights_qparams_
@@ -720,6 +893,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::status_t set_fpmath_mode(dnnl::impl::fpmath_mode_t fpmath_mode);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
+    dnnl::impl::status_t set_thread_team_size(int thread_team_size);
+    dnnl::impl::status_t set_deterministic(bool deterministic);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
     dnnl::impl::status_t set_gpu_attr(
             const dnnl::impl::primitive_attr_item_t &gpu_attr);
@@ -754,6 +929,15 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::zero_points_t zero_points_;
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
     dnnl::impl::fpmath_mode_t fpmath_mode_;
+    // Maximum number of threads to create and execute a primitive with,
+    // 0 means the number of threads is not limited.
+    int thread_team_size_;
+    // Requires results independent of the number of threads, see
+    // dnnl_thr_deterministic().
+    bool deterministic_;
+    dnnl::impl::rnd_mode_t rounding_mode_;
+    dnnl::impl::dropout_t dropout_;
+    dnnl::impl::bnorm_stats_t bnorm_stats_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::scales_t rnn_weights_qparams_;
@@ -162,6 +162,19 @@ struct primitive_desc_t : public c_compatible {
         if ((arg == (DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_1))
                 && !attr()->scales_.get(DNNL_ARG_SRC_1).defined())
             return arg_usage_t::input;
+        if (arg == DNNL_ARG_ATTR_ROUNDING_SEED
+                && !attr()->rounding_mode_.has_default_values())
+            return arg_usage_t::input;
+        if (utils::one_of(arg, DNNL_ARG_ATTR_DROPOUT_PROBABILITY,
+                    DNNL_ARG_ATTR_DROPOUT_SEED, DNNL_ARG_ATTR_DROPOUT_OFFSET)
+                && !attr()->dropout_.has_default_values())
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_ATTR_DROPOUT_MASK && attr()->dropout_.has_mask())
+            return arg_usage_t::output;
+        if (utils::one_of(arg, DNNL_ARG_ATTR_STATS_MEAN,
+                    DNNL_ARG_ATTR_STATS_VARIANCE)
+                && !attr()->bnorm_stats_.has_default_values())
+            return arg_usage_t::output;
         if (arg == DNNL_ARG_SCRATCHPAD && !is_zero_md(scratchpad_md()))
             return arg_usage_t::output;
         for (int idx = 0; idx < attr()->post_ops_.len(); ++idx) {
@@ -169,7 +182,9 @@ struct primitive_desc_t : public c_compatible {
             if (post_op_has_proper_input(
                         attr(), binary, idx, arg, DNNL_ARG_SRC_1)
                     || post_op_has_proper_input(
-                            attr(), prelu, idx, arg, DNNL_ARG_WEIGHTS))
+                            attr(), prelu, idx, arg, DNNL_ARG_WEIGHTS)
+                    || post_op_has_proper_input(
+                            attr(), rope, idx, arg, DNNL_ARG_OFFSETS))
                 return arg_usage_t::input;
         }
 
@@ -197,6 +212,11 @@ struct primitive_desc_t : public c_compatible {
         switch (arg) {
             case DNNL_ARG_WORKSPACE: return workspace_md(0);
             case DNNL_ARG_SCRATCHPAD: return scratchpad_md(0);
+            case DNNL_ARG_ATTR_DROPOUT_MASK:
+                return &attr()->dropout_.mask_desc_;
+            case DNNL_ARG_ATTR_STATS_MEAN:
+            case DNNL_ARG_ATTR_STATS_VARIANCE:
+                return &attr()->bnorm_stats_.stat_desc_;
             default: return &glob_zero_md;
         }
     }
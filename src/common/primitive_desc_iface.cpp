@@ -17,6 +17,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 
 #include "engine.hpp"
 #include "primitive_desc_iface.hpp"
@@ -39,9 +40,9 @@ status_t primitive_desc_create(primitive_desc_iface_t **primitive_desc_iface,
 
     const bool known_primitive_kind = utils::one_of(op_desc->kind,
             batch_normalization, binary, convolution, deconvolution, eltwise,
-            gemm, group_normalization, inner_product, layer_normalization, lrn,
-            matmul, pooling, prelu, reduction, resampling, rnn, shuffle,
-            softmax);
+            embedding_bag, gemm, group_normalization, inner_product,
+            layer_normalization, lrn, matmul, pooling, prelu, reduction,
+            resampling, rnn, rope, shuffle, softmax, topk);
     if (!known_primitive_kind) return invalid_arguments;
 
     auto pd_iface = utils::make_unique<primitive_desc_iface_t>(engine, op_desc,
@@ -73,6 +74,8 @@ status_t dnnl_primitive_desc::init() {
     if (!pd_iterator_) return status::out_of_memory;
     if (!pd_iterator_->is_initialized()) return out_of_memory;
 
+    threading_guard_t thr_guard(pd_iterator_->attr().thread_team_size_,
+            pd_iterator_->attr().deterministic_);
     ++(*pd_iterator_);
     if (*pd_iterator_ == pd_iterator_->end()) return unimplemented;
 
@@ -84,6 +87,8 @@ status_t dnnl_primitive_desc::init() {
 
 status_t dnnl_primitive_desc::next_impl() {
     if (!pd_iterator_) return status::last_impl_reached;
+    threading_guard_t thr_guard(pd_iterator_->attr().thread_team_size_,
+            pd_iterator_->attr().deterministic_);
     ++(*pd_iterator_);
     if (*pd_iterator_ == pd_iterator_->end()) return last_impl_reached;
     pd_ = *(*pd_iterator_);
@@ -95,6 +100,8 @@ status_t dnnl_primitive_desc::create_primitive_iface(
         const cache_blob_t &cache_blob) const {
     // Step 1: create impl::primitive_t or get it from primitive cache
     std::pair<std::shared_ptr<primitive_t>, bool> p;
+    threading_guard_t thr_guard(impl()->attr()->thread_team_size_,
+            impl()->attr()->deterministic_);
     auto status = impl()->create_primitive(p, engine(), cache_blob);
     if (status != status::success) return status;
     // Step 2: create primitive_iface_t, init and return it to user
@@ -50,8 +50,16 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                 args[arg] = {mem, true};
                 n_inputs++;
                 extra_inputs += (arg == DNNL_ARG_ATTR_OUTPUT_SCALES)
+                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
+                        || (arg == DNNL_ARG_ATTR_DROPOUT_PROBABILITY)
+                        || (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
+                        || (arg == DNNL_ARG_ATTR_DROPOUT_OFFSET)
                         || (arg & DNNL_ARG_ATTR_ZERO_POINTS)
                         || (arg & DNNL_ARG_ATTR_SCALES)
+                        // position offsets of a rope post-op are optional
+                        || (arg > DNNL_ARG_ATTR_MULTIPLE_POST_OP_BASE
+                                && arg % DNNL_ARG_ATTR_MULTIPLE_POST_OP_BASE
+                                        == DNNL_ARG_OFFSETS)
                         // 1x1 + dw conv fusion
                         || (arg
                                 == (DNNL_ARG_ATTR_POST_OP_DW
@@ -67,7 +75,10 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
             case primitive_desc_t::arg_usage_t::output:
                 args[arg] = {mem, false};
                 n_outputs++;
-                extra_outputs += (arg == DNNL_ARG_SCRATCHPAD);
+                extra_outputs += (arg == DNNL_ARG_SCRATCHPAD)
+                        || (arg == DNNL_ARG_ATTR_DROPOUT_MASK)
+                        || (arg == DNNL_ARG_ATTR_STATS_MEAN)
+                        || (arg == DNNL_ARG_ATTR_STATS_VARIANCE);
                 break;
             case primitive_desc_t::arg_usage_t::unused:
                 VINFO(exec, check, primitive,
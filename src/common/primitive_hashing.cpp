@@ -69,6 +69,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -81,9 +82,11 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(rope)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
         }
@@ -198,6 +201,10 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.scratchpad_mode_));
     // fpmath_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_mode_));
+    // thread_team_size
+    seed = hash_combine(seed, attr.thread_team_size_);
+    // deterministic
+    seed = hash_combine(seed, attr.deterministic_);
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -221,6 +228,19 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
             // zero_points: mask
             seed = hash_combine(seed, mask);
         }
+    // rounding_mode: arg, mode
+    for (const auto &p : attr.rounding_mode_.rounding_modes_map_) {
+        seed = hash_combine(seed, p.first);
+        seed = hash_combine(seed, static_cast<size_t>(p.second));
+    }
+    // dropout: enabled, mask_desc
+    if (!attr.dropout_.has_default_values()) {
+        seed = hash_combine(seed, attr.dropout_.enabled_);
+        seed = hash_combine(seed, get_md_hash(attr.dropout_.user_mask_desc_));
+    }
+    // bnorm_stats: enabled
+    if (!attr.bnorm_stats_.has_default_values())
+        seed = hash_combine(seed, attr.bnorm_stats_.enabled_);
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
         const auto &entry = attr.post_ops_.entry_[i];
@@ -251,6 +271,24 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.depthwise_conv.dst_dt));
                 break;
+            case primitive_kind::inner_product:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pointwise_conv.oc));
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pointwise_conv.wei_dt));
+                seed = hash_combine(seed,
+                        static_cast<size_t>(entry.pointwise_conv.bias_dt));
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pointwise_conv.dst_dt));
+                break;
+            case primitive_kind::pooling:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.alg));
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.kernel_h));
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.kernel_w));
+                break;
             case primitive_kind::binary:
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.binary.alg));
@@ -261,6 +299,12 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.prelu.mask));
                 break;
+            case primitive_kind::rope:
+                seed = hash_combine(seed, static_cast<size_t>(entry.rope.alg));
+                seed = hash_combine(seed, entry.rope.head_dim);
+                seed = hash_combine(seed, entry.rope.rotary_dim);
+                seed = hash_combine(seed, entry.rope.base);
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -396,6 +440,21 @@ size_t get_desc_hash(const gemm_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding_bag desc
+    return seed;
+}
+
 size_t get_desc_hash(const group_normalization_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -623,6 +682,23 @@ size_t get_desc_hash(const rnn_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const rope_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.cos_sin_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Rotary dimension and base
+    seed = hash_combine(seed, desc.rotary_dim);
+    seed = hash_combine(seed, desc.base);
+    // Combined hash for rope desc
+    return seed;
+}
+
 // Shuffle
 size_t get_desc_hash(const shuffle_desc_t &desc) {
     size_t seed = 0;
@@ -673,6 +749,21 @@ size_t get_desc_hash(const sum_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Axis
+    seed = hash_combine(seed, desc.axis);
+    // Combined hash for topk desc
+    return seed;
+}
+
 size_t get_desc_hash(const zero_pad_desc_t &desc) {
     size_t seed = 0;
     // Kinds
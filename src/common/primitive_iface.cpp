@@ -17,6 +17,7 @@
 #include <string>
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -86,6 +87,8 @@ status_t primitive_execute(
     auto stream = ctx.stream();
     status_t status = success;
     auto pd = primitive_iface->pd();
+    threading_guard_t thr_guard(pd->impl()->attr()->thread_team_size_,
+            pd->impl()->attr()->deterministic_);
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
     const bool enable_itt = itt::get_itt(itt::__itt_task_level_low);
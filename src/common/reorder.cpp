@@ -18,6 +18,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_cache.hpp"
@@ -104,6 +105,8 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
     pd = primitive_cache().get_pd(key);
     if (pd) return success;
 
+    threading_guard_t thr_guard(
+            attr->thread_team_size_, attr->deterministic_);
     for (auto r = engine->get_reorder_implementation_list(src_md, dst_md); *r;
             ++r) {
         reorder_pd_t *reorder_pd = nullptr;
@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+using namespace dnnl::impl::data_type;
+
+#define VCHECK_ROPE(cond, msg, ...) \
+    VCONDCHECK(create, check, rope, (cond), status::invalid_arguments, msg, \
+            ##__VA_ARGS__);
+
+#define VCHECK_ROPE_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(create, check, rope, (cond), status::unimplemented, msg, \
+            ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+
+status_t rope_desc_init(rope_desc_t *rope_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *cos_sin_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *dst_desc,
+        dim_t rotary_dim, float base) {
+    VCHECK_ROPE(!any_null(src_desc, dst_desc), VERBOSE_NULL_ARG);
+    VCHECK_ROPE(one_of(alg_kind, rope_interleaved, rope_rotate_half),
+            VERBOSE_BAD_ALGORITHM);
+
+    const bool with_cos_sin
+            = cos_sin_desc && !memory_desc_wrapper(cos_sin_desc).is_zero();
+    const bool with_offsets
+            = offsets_desc && !memory_desc_wrapper(offsets_desc).is_zero();
+
+    const int ndims = src_desc->ndims;
+    VCHECK_ROPE(one_of(ndims, 3, 4), VERBOSE_BAD_NDIMS, "src", ndims);
+    VCHECK_ROPE(dst_desc->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS, "src",
+            "dst");
+    for (int d = 0; d < ndims; d++)
+        VCHECK_ROPE(src_desc->dims[d] == dst_desc->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "src", d, "dst", d);
+
+    const dim_t head_size = src_desc->dims[ndims - 1];
+    VCHECK_ROPE(rotary_dim > 0 && rotary_dim % 2 == 0
+                    && rotary_dim <= head_size,
+            VERBOSE_BAD_PARAM, "rotary_dim");
+    VCHECK_ROPE(IMPLICATION(!with_cos_sin, base > 0.f), VERBOSE_BAD_PARAM,
+            "base");
+
+    VCHECK_ROPE(IMPLICATION(with_cos_sin, cos_sin_desc->ndims == 2),
+            VERBOSE_BAD_NDIMS, "cos_sin",
+            with_cos_sin ? cos_sin_desc->ndims : 0);
+    VCHECK_ROPE(IMPLICATION(with_cos_sin,
+                        cos_sin_desc->dims[1] == rotary_dim / 2),
+            VERBOSE_BAD_DIM, "cos_sin", 1);
+    VCHECK_ROPE(IMPLICATION(with_offsets, offsets_desc->ndims == 1),
+            VERBOSE_BAD_NDIMS, "offsets",
+            with_offsets ? offsets_desc->ndims : 0);
+    VCHECK_ROPE(IMPLICATION(with_offsets,
+                        offsets_desc->dims[0] == src_desc->dims[0]),
+            VERBOSE_INCONSISTENT_DIM, "offsets", 0, "src", 0);
+
+    VCHECK_ROPE(!memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(dst_desc)
+                                .has_runtime_dims_or_strides()
+                    && IMPLICATION(with_cos_sin,
+                            !memory_desc_wrapper(cos_sin_desc)
+                                     .has_runtime_dims_or_strides())
+                    && IMPLICATION(with_offsets,
+                            !memory_desc_wrapper(offsets_desc)
+                                     .has_runtime_dims_or_strides()),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    VCHECK_ROPE(IMPLICATION(with_cos_sin, cos_sin_desc->data_type == f32),
+            VERBOSE_INVALID_DATATYPE, "cos_sin");
+    VCHECK_ROPE(IMPLICATION(with_offsets, offsets_desc->data_type == s32),
+            VERBOSE_INVALID_DATATYPE, "offsets");
+
+    VCHECK_ROPE(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_ROPE(one_of(dst_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VCHECK_ROPE(IMPLICATION(with_cos_sin,
+                        cos_sin_desc->format_kind == format_kind::blocked),
+            VERBOSE_UNSUPPORTED_TAG_S, "cos_sin");
+    VCHECK_ROPE(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "src");
+    VCHECK_ROPE(IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                        dst_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+
+    auto rd = rope_desc_t();
+    rd.primitive_kind = primitive_kind::rope;
+    rd.alg_kind = alg_kind;
+
+    rd.src_desc = *src_desc;
+    if (with_cos_sin) rd.cos_sin_desc = *cos_sin_desc;
+    if (with_offsets) rd.offsets_desc = *offsets_desc;
+    rd.dst_desc = *dst_desc;
+
+    rd.rotary_dim = rotary_dim;
+    // The base does not affect the result when the caches are provided.
+    rd.base = with_cos_sin ? 0.f : base;
+
+    (*rope_desc) = rd;
+    return success;
+}
+
+status_t rope_attr_check(const rope_desc_t &desc, const engine_t *engine,
+        const primitive_attr_t *attr) {
+    if (attr == nullptr) return status::success;
+
+    VCHECK_ROPE_UNIMPL(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_rope_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *cos_sin_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc, dim_t rotary_dim, float base,
+        const primitive_attr_t *attr) {
+    auto rope_desc = rope_desc_t();
+    CHECK(rope_desc_init(&rope_desc, alg_kind, src_desc, cos_sin_desc,
+            offsets_desc, dst_desc, rotary_dim, base));
+    CHECK(rope_attr_check(rope_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&rope_desc, nullptr, attr);
+}
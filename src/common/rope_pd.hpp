@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_PD_HPP
+#define COMMON_ROPE_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_ROPE(cond, msg, ...) \
+    VCONDCHECK(create, dispatch, rope, (cond), status::unimplemented, \
+            "%s," msg, this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t rope_desc_init(rope_desc_t *rope_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *cos_sin_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *dst_desc,
+        dim_t rotary_dim, float base);
+
+struct rope_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::rope;
+
+    typedef rope_pd_t hint_class;
+
+    const rope_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+
+        if (utils::one_of(arg, DNNL_ARG_ROPE_COS, DNNL_ARG_ROPE_SIN)
+                && with_cos_sin())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_OFFSETS && with_offsets())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_ROPE_COS:
+            case DNNL_ARG_ROPE_SIN: return &desc_.cos_sin_desc;
+            case DNNL_ARG_OFFSETS: return &desc_.offsets_desc;
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override {
+        return 1 + 2 * with_cos_sin() + with_offsets();
+    }
+    int n_outputs() const override { return 1; }
+
+    int ndims() const { return src_md_.ndims; }
+    dim_t MB() const { return src_md_.dims[0]; }
+    // Number of heads, equals 1 for 3D tensors.
+    dim_t H() const { return ndims() == 4 ? src_md_.dims[1] : 1; }
+    // Sequence length.
+    dim_t S() const { return src_md_.dims[ndims() - 2]; }
+    // Head size.
+    dim_t D() const { return src_md_.dims[ndims() - 1]; }
+    dim_t rotary_dim() const { return desc_.rotary_dim; }
+    // Number of positions in the cosine and sine caches.
+    dim_t n_positions() const {
+        return with_cos_sin() ? desc_.cos_sin_desc.dims[0] : 0;
+    }
+
+    bool with_cos_sin() const {
+        return !types::is_zero_md(&desc_.cos_sin_desc);
+    }
+    bool with_offsets() const {
+        return !types::is_zero_md(&desc_.offsets_desc);
+    }
+
+protected:
+    rope_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+
+    rope_pd_t(const rope_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_md_and_dt(
+                dst_md_, src_md_, dst_md_.data_type);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -36,6 +36,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -48,9 +49,11 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(rope)
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
+        CASE(topk)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -155,11 +158,28 @@ void serialize_post_ops(
                 sstream.write(&entry.depthwise_conv.bias_dt);
                 sstream.write(&entry.depthwise_conv.dst_dt);
                 break;
+            case primitive_kind::inner_product:
+                sstream.write(&entry.pointwise_conv.oc);
+                sstream.write(&entry.pointwise_conv.wei_dt);
+                sstream.write(&entry.pointwise_conv.bias_dt);
+                sstream.write(&entry.pointwise_conv.dst_dt);
+                break;
+            case primitive_kind::pooling:
+                sstream.write(&entry.pooling.alg);
+                sstream.write(&entry.pooling.kernel_h);
+                sstream.write(&entry.pooling.kernel_w);
+                break;
             case primitive_kind::binary:
                 sstream.write(&entry.binary.alg);
                 serialize_md(sstream, entry.binary.user_src1_desc);
                 break;
             case primitive_kind::prelu: sstream.write(&entry.prelu.mask); break;
+            case primitive_kind::rope:
+                sstream.write(&entry.rope.alg);
+                sstream.write(&entry.rope.head_dim);
+                sstream.write(&entry.rope.rotary_dim);
+                sstream.write(&entry.rope.base);
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -171,6 +191,10 @@ void serialize_attr(
     sstream.write(&attr.scratchpad_mode_);
     // fpmath_mode
     sstream.write(&attr.fpmath_mode_);
+    // thread_team_size
+    sstream.write(&attr.thread_team_size_);
+    // deterministic
+    sstream.write(&attr.deterministic_);
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -192,6 +216,19 @@ void serialize_attr(
             // zero_points: mask
             sstream.write(&mask);
         }
+    // rounding_mode: arg, mode
+    for (const auto &p : attr.rounding_mode_.rounding_modes_map_) {
+        sstream.write(&p.first);
+        sstream.write(&p.second);
+    }
+    // dropout: enabled, mask_desc
+    if (!attr.dropout_.has_default_values()) {
+        sstream.write(&attr.dropout_.enabled_);
+        serialize_md(sstream, attr.dropout_.user_mask_desc_);
+    }
+    // bnorm_stats: enabled
+    if (!attr.bnorm_stats_.has_default_values())
+        sstream.write(&attr.bnorm_stats_.enabled_);
 
     serialize_post_ops(sstream, attr.post_ops_);
 
@@ -315,6 +352,19 @@ void serialize_desc(serialization_stream_t &sstream, const gemm_desc_t &desc) {
     sstream.write(&desc.sum_ab_type);
 }
 
+void serialize_desc(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.indices_desc);
+    serialize_md(sstream, desc.offsets_desc);
+    serialize_md(sstream, desc.weights_desc);
+    serialize_md(sstream, desc.dst_desc);
+}
+
 void serialize_desc(serialization_stream_t &sstream,
         const group_normalization_desc_t &desc) {
     // Kinds
@@ -517,6 +567,20 @@ void serialize_desc(serialization_stream_t &sstream, const rnn_desc_t &desc) {
     sstream.write(&desc.beta);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const rope_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.cos_sin_desc);
+    serialize_md(sstream, desc.offsets_desc);
+    serialize_md(sstream, desc.dst_desc);
+    // Rotary dimension and base
+    sstream.write(&desc.rotary_dim);
+    sstream.write(&desc.base);
+}
+
 // Shuffle
 void serialize_desc(
         serialization_stream_t &sstream, const shuffle_desc_t &desc) {
@@ -561,6 +625,18 @@ void serialize_desc(serialization_stream_t &sstream, const sum_desc_t &desc) {
         serialize_md(sstream, *desc.src_mds[i]);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.indices_desc);
+    // Axis
+    sstream.write(&desc.axis);
+}
+
 } // namespace serialization
 } // namespace impl
 } // namespace dnnl
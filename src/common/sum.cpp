@@ -19,6 +19,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_cache.hpp"
@@ -53,7 +54,9 @@ status_t sum_primitive_desc_create(primitive_desc_iface_t **sum_pd_iface,
             VERBOSE_NULL_ARG);
 
     if (attr == nullptr) attr = &default_attr();
-    VCHECK_SUM_UNIMPL(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    using smask_t = primitive_attr_t::skip_mask_t;
+    VCHECK_SUM_UNIMPL(attr->has_default_values(smask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
 
     const int ndims = src_mds[0]->ndims;
     const dims_t &dims = src_mds[0]->dims;
@@ -106,6 +109,8 @@ status_t sum_primitive_desc_create(primitive_desc_iface_t **sum_pd_iface,
                 *sum_pd_iface, new primitive_desc_iface_t(pd, engine));
     }
 
+    threading_guard_t thr_guard(
+            attr->thread_team_size_, attr->deterministic_);
     for (auto s = engine->get_sum_implementation_list(); *s; ++s) {
         sum_pd_t *sum_pd = nullptr;
         if ((*s)(&sum_pd, engine, attr, dst_md, n, scales, src_mds)
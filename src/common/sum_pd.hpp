@@ -123,14 +123,16 @@ protected:
         dst_acc_md_.data_type = dnnl_f32;
     }
     /* inits dst_md_ in simple cases. The call may fail. */
-    status_t init(engine_t *engine) {
+    status_t init(engine_t *engine,
+            primitive_attr_t::skip_mask_t attr_mask
+            = primitive_attr_t::skip_mask_t::none) {
         for (int i = 0; i < n_; ++i) {
             const memory_desc_wrapper src_d(&src_mds_[i]);
             if (!src_d.is_blocking_desc() || src_d.is_additional_buffer())
                 return status::unimplemented;
         }
         bool ok = true && set_default_params() == status::success
-                && attr()->has_default_values();
+                && attr()->has_default_values(attr_mask);
         if (!ok) return status::unimplemented;
 
         // use f32 accumulator to handle float scales w/o accuracy loss
@@ -41,6 +41,7 @@
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
 #include "gemm_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
@@ -52,12 +53,15 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "rope_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
+#include "cpu/huge_pages.hpp"
 #include "cpu/platform.hpp"
 #endif
 
@@ -90,6 +94,9 @@ void print_header() {
                 dnnl_get_max_threads());
         printf("onednn_verbose,info,cpu,isa:%s\n",
                 cpu::platform::get_isa_info());
+        if (cpu::get_huge_pages_policy() != cpu::huge_pages_policy_t::none)
+            printf("onednn_verbose,info,cpu,huge_pages:%s\n",
+                    cpu::huge_pages_policy2str(cpu::get_huge_pages_policy()));
 #endif
         printf("onednn_verbose,info,gpu,runtime:%s\n",
                 dnnl_runtime2str(dnnl_version()->gpu_runtime));
@@ -485,6 +492,9 @@ int get_arg_index(int arg) {
 
 std::string get_arg(int arg) {
     if (arg & DNNL_ARG_MULTIPLE_SRC) return "msrc";
+    if (arg >= DNNL_ARG_ATTR_MULTIPLE_POST_OP(0))
+        return "attr_post_op_pw_"
+                + get_arg(arg % DNNL_ARG_ATTR_MULTIPLE_POST_OP_BASE);
 
     std::string s;
     switch (arg) {
@@ -492,6 +502,8 @@ std::string get_arg(int arg) {
         case DNNL_ARG_SRC_1: s = "src"; break;
         case DNNL_ARG_DST: s = "dst"; break;
         case DNNL_ARG_WEIGHTS: s = "wei"; break;
+        case DNNL_ARG_DIFF_SRC: s = "diff_src"; break;
+        case DNNL_ARG_DIFF_WEIGHTS: s = "diff_wei"; break;
         case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST:
             s = "attr_post_op_dw_dst";
             break;
@@ -512,8 +524,8 @@ std::string arg2str(int arg) {
 }
 
 std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
-    // scratchpad and fpmath mode are not a part of
-    // has_default_values(). Check them first.
+    // scratchpad mode, fpmath mode, thread team size and deterministic flag
+    // are not a part of has_default_values(). Check them first.
     const scratchpad_mode_t &spm = attr->scratchpad_mode_;
     if (spm != scratchpad_mode_t::dnnl_scratchpad_mode_library) {
         ss << "attr-scratchpad:" << dnnl_scratchpad_mode2str(spm) << " ";
@@ -522,6 +534,10 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
     if (fpm != fpmath_mode_t::dnnl_fpmath_mode_strict) {
         ss << "attr-fpmath:" << dnnl_fpmath_mode2str(fpm) << " ";
     }
+    if (attr->thread_team_size_ > 0) {
+        ss << "attr-thread-team:" << attr->thread_team_size_ << " ";
+    }
+    if (attr->deterministic_) { ss << "attr-deterministic:true "; }
 
     if (attr->has_default_values()) return ss;
 
@@ -561,6 +577,34 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << " ";
     }
 
+    const rnd_mode_t &rm = attr->rounding_mode_;
+    if (!rm.has_default_values()) {
+        std::string delim = empty_delim;
+        ss << "attr-rounding-mode:";
+        for (const auto &e : rm.rounding_modes_map_) {
+            ss << delim << arg2str(e.first) << ":"
+               << dnnl_rounding_mode2str(e.second);
+            delim = attr_delim;
+        }
+        ss << " ";
+    }
+
+    const dropout_t &dropout = attr->dropout_;
+    if (!dropout.has_default_values()) {
+        ss << "attr-dropout";
+        if (dropout.has_mask()) {
+            const auto &md = dropout.mask_desc_;
+            ss << ":" << md.data_type;
+            if (memory_desc_wrapper(md).format_any())
+                ss << ":any";
+            else
+                ss << ":" << md2fmt_tag_str(&md);
+        }
+        ss << " ";
+    }
+
+    if (!attr->bnorm_stats_.has_default_values()) ss << "attr-bnorm-stats ";
+
     const post_ops_t &po = attr->post_ops_;
     if (!po.has_default_values()) {
         std::string delim = empty_delim;
@@ -586,6 +630,18 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
                     if (c.wei_dt == s8 || c.dst_dt != f32)
                         ss << ":" << c.dst_dt;
                 } break;
+                case primitive_kind::inner_product: {
+                    using namespace data_type;
+                    const auto &c = e.pointwise_conv;
+                    ss << delim << "pw:oc" << c.oc;
+                    if (c.wei_dt == s8 || c.dst_dt != f32)
+                        ss << ":" << c.dst_dt;
+                } break;
+                case primitive_kind::pooling: {
+                    const auto &p = e.pooling;
+                    ss << delim << p.alg << ":" << p.kernel_h << "x"
+                       << p.kernel_w;
+                } break;
                 case primitive_kind::eltwise: {
                     const post_ops_t::entry_t::eltwise_t &ew = e.eltwise;
                     ss << delim << ew.alg;
@@ -616,6 +672,11 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
                     ss << delim << "prelu"
                        << ":" << ep.mask;
                 } break;
+                case primitive_kind::rope: {
+                    const auto &er = e.rope;
+                    ss << delim << er.alg << ":" << er.head_dim << ":"
+                       << er.rotary_dim << ":" << er.base;
+                } break;
                 default: assert(!"unsupported post op primitive kind!"); break;
             }
             delim = attr_delim;
@@ -804,6 +865,48 @@ std::string init_info_eltwise(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << " indices_" << pd->arg_md(DNNL_ARG_INDICES);
+    ss << " offsets_" << pd->arg_md(DNNL_ARG_OFFSETS);
+    if (pd->with_weights()) ss << " wei_" << pd->weights_md(0);
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << "rows" << pd->rows() << "dim" << pd->emb_dim() << "n"
+       << pd->n_indices() << "bags" << pd->n_bags();
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+    ss << " indices_" << pd->arg_md(DNNL_ARG_INDICES);
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(dst_md) << ":"
+       << pd->axis();
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_gemm(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -1187,6 +1290,28 @@ std::string init_info_rnn(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_rope(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    if (pd->with_cos_sin())
+        ss << " cos_sin_" << pd->arg_md(DNNL_ARG_ROPE_COS);
+    if (pd->with_offsets()) ss << " offsets_" << pd->arg_md(DNNL_ARG_OFFSETS);
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":rd" << pd->rotary_dim();
+    if (!pd->with_cos_sin()) ss << ":base" << pd->desc()->base;
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_shuffle(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -1336,6 +1461,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(gemm);
             CASE(group_normalization);
             CASE(inner_product);
@@ -1348,9 +1474,11 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
+            CASE(topk);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
@@ -74,6 +74,7 @@ struct acl_pooling_fwd_t : public primitive_t {
         status_t init(engine_t *engine) {
             bool ok = set_default_params() == status::success
                     && is_fwd() // ACL supports forward propagation only
+                    && !is_adaptive()
                     && utils::everyone_is(
                             src_md()->data_type, dst_md()->data_type)
                     && utils::one_of(
@@ -20,6 +20,7 @@
 #include "common/bfloat16.hpp"
 #include "common/bit_cast.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -69,6 +70,32 @@ void cvt_float_to_bfloat16(bfloat16_t *out, const float *inp, size_t nelems) {
         out[i] = inp[i];
 }
 
+void cvt_float_to_bfloat16_stochastic(bfloat16_t *out, const float *inp,
+        size_t nelems, size_t offset, uint32_t seed) {
+    const uint32_t mixed_seed = math::hash_u32(seed);
+#if DNNL_X64
+    using namespace cpu::x64;
+    if (mayiuse(cpu_isa_t::avx512_core)) {
+        cpu::x64::cvt_xf16_support::jit_call_t p_;
+        p_.inp = (void *)inp;
+        p_.out = (void *)out;
+        p_.nelems = nelems;
+        p_.offset = offset;
+        p_.mixed_seed = mixed_seed;
+        static const cpu::x64::jit_cvt_ps_to_xf16_t cvt_ps_to_bf16_stochastic(
+                data_type::bf16, 0, true);
+        cvt_ps_to_bf16_stochastic(&p_);
+        return;
+    }
+#endif
+
+    PRAGMA_OMP_SIMD()
+    for (size_t i = 0; i < nelems; ++i)
+        out[i] = math::stochastic_round_fwd(inp[i],
+                math::stochastic_rounding_bits(offset + i, mixed_seed),
+                data_type::bf16);
+}
+
 void cvt_bfloat16_to_float(float *out, const bfloat16_t *inp, size_t nelems) {
 #if DNNL_X64
     using namespace cpu::x64;
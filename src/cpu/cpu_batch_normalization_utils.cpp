@@ -58,8 +58,10 @@ bool thread_balance(bool do_blocking, bool spatial_thr_allowed, bool is_nspc,
         int &C_nthr, dim_t &C_blk_s, dim_t &C_blk_e, int &N_ithr, int &N_nthr,
         dim_t &N_s, dim_t &N_e, int &S_ithr, int &S_nthr, dim_t &S_s,
         dim_t &S_e) {
+    // In deterministic mode statistics of a channel are computed by a single
+    // thread, so that the result does not depend on the number of threads.
     if (((nthr <= C_blks) && IMPLICATION(is_nspc, N == 1))
-            || !dnnl_thr_syncable()) {
+            || !dnnl_thr_syncable() || dnnl_thr_deterministic()) {
         C_ithr = ithr;
         C_nthr = nthr;
         N_ithr = 0;
@@ -123,6 +125,12 @@ bool thread_balance(bool do_blocking, bool spatial_thr_allowed, bool is_nspc,
     return spatial_thr_allowed;
 }
 
+int get_stats_nchunks(dim_t N, int nthr) {
+    if (!dnnl_thr_deterministic()) return nthr;
+    const dim_t max_nchunks = 64;
+    return (int)nstl::max<dim_t>(1, nstl::min<dim_t>(N, max_nchunks));
+}
+
 bool is_spatial_thr(const batch_normalization_pd_t *bdesc, bool is_nspc,
         int simd_w, int data_size) {
     if (!dnnl_thr_syncable()) return false;
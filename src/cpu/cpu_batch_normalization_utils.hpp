@@ -33,6 +33,12 @@ bool thread_balance(bool do_blocking, bool spatial_thr_allowed, bool is_nhwc,
         dim_t &N_s, dim_t &N_e, int &S_ithr, int &S_nthr, dim_t &S_s,
         dim_t &S_e);
 
+// Returns the number of chunks of the minibatch that partial sums of
+// statistics are computed for. In deterministic mode the partition does not
+// depend on the number of threads and the partial sums are always added up
+// in the same order.
+int get_stats_nchunks(dim_t N, int nthr);
+
 bool is_spatial_thr(const batch_normalization_pd_t *bdesc, bool is_nhwc,
         int simd_w, int data_size);
 
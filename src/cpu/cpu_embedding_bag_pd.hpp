@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_EMBEDDING_BAG_PD_HPP
+#define CPU_CPU_EMBEDDING_BAG_PD_HPP
+
+#include <atomic>
+
+#include "common/dnnl_thread.hpp"
+#include "common/embedding_bag_pd.hpp"
+#include "cpu/cpu_engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_embedding_bag_pd_t : public embedding_bag_pd_t {
+    using embedding_bag_pd_t::embedding_bag_pd_t;
+
+    // Bag `b` covers indices [offsets[b], offsets[b + 1]), the last bag ends
+    // at the end of the indices. Returns the bounds of a bag, the offsets and
+    // the indices are expected to be validated with `check_bags()`.
+    static void bag_bounds(const int32_t *offsets, dim_t n_bags,
+            dim_t n_indices, dim_t b, dim_t &start, dim_t &end) {
+        start = offsets[b];
+        end = b + 1 < n_bags ? offsets[b + 1] : n_indices;
+    }
+
+    // The offsets must be non-decreasing and within the indices, and every
+    // index of a bag must address a row of the table.
+    status_t check_bags(const int32_t *indices, const int32_t *offsets) const {
+        const dim_t nb = n_bags();
+        const dim_t ni = n_indices();
+        const dim_t nr = rows();
+
+        for (dim_t b = 0; b < nb; b++) {
+            dim_t start = 0, end = 0;
+            bag_bounds(offsets, nb, ni, b, start, end);
+            if (start < 0 || start > end || end > ni)
+                return status::invalid_arguments;
+        }
+
+        dim_t first = 0;
+        if (nb > 0) first = offsets[0];
+        std::atomic<bool> ok(true);
+        parallel_nd(ni - first, [&](dim_t i) {
+            const dim_t idx = indices[first + i];
+            if (idx < 0 || idx >= nr)
+                ok.store(false, std::memory_order_relaxed);
+        });
+        return ok ? status::success : status::invalid_arguments;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -17,6 +17,11 @@
 #include "cpu/cpu_engine.hpp"
 #include "cpu/ref_group_normalization.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/jit_uni_group_normalization.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -29,10 +34,12 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     // clang-format off
     static const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> the_map = REG_GNORM_P({
         {{forward}, {
+            CPU_INSTANCE_X64(jit_uni_group_normalization_fwd_t)
             CPU_INSTANCE(ref_group_normalization_fwd_t)
             nullptr,
         }},
         {{backward}, REG_BWD_PK({
+            CPU_INSTANCE_X64(jit_uni_group_normalization_bwd_t)
             CPU_INSTANCE(ref_group_normalization_bwd_t)
             nullptr,
         })},
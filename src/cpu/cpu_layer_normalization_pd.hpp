@@ -17,6 +17,7 @@
 #ifndef CPU_CPU_LAYER_NORMALIZATION_PD_HPP
 #define CPU_CPU_LAYER_NORMALIZATION_PD_HPP
 
+#include "common/dnnl_thread.hpp"
 #include "common/layer_normalization_pd.hpp"
 #include "cpu/cpu_engine.hpp"
 
@@ -30,6 +31,18 @@ struct cpu_layer_normalization_fwd_pd_t : public layer_normalization_fwd_pd_t {
 
 struct cpu_layer_normalization_bwd_pd_t : public layer_normalization_bwd_pd_t {
     using layer_normalization_bwd_pd_t::layer_normalization_bwd_pd_t;
+
+protected:
+    // Returns the number of chunks of rows the partial sums of diff_scale
+    // and diff_shift are computed for. In deterministic mode the partition
+    // does not depend on the number of threads, and the partial sums are
+    // always added up in the same order.
+    int diff_ss_nchunks(int nthr) const {
+        if (!dnnl_thr_deterministic()) return nthr;
+        const dim_t max_nchunks = 64;
+        return static_cast<int>(
+                nstl::max<dim_t>(1, nstl::min(across_axis(), max_nchunks)));
+    }
 };
 
 } // namespace cpu
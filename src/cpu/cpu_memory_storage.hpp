@@ -17,6 +17,7 @@
 #ifndef CPU_CPU_MEMORY_STORAGE_HPP
 #define CPU_CPU_MEMORY_STORAGE_HPP
 
+#include <functional>
 #include <memory>
 
 #include "common/c_types_map.hpp"
@@ -25,6 +26,7 @@
 #include "common/stream.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/huge_pages.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -86,19 +88,22 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
+        huge_pages_kind_t kind = huge_pages_kind_t::none;
+        void *ptr = malloc_huge_pages(
+                size, platform::get_cache_line_size(), kind);
         if (!ptr) return status::out_of_memory;
-        data_ = decltype(data_)(ptr, destroy);
+        data_ = decltype(data_)(ptr, [size, kind](void *p) {
+            free_huge_pages(p, size, kind);
+        });
         return status::success;
     }
 
 private:
-    std::unique_ptr<void, void (*)(void *)> data_;
+    std::unique_ptr<void, std::function<void(void *)>> data_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 
     static void release(void *ptr) {}
-    static void destroy(void *ptr) { free(ptr); }
 };
 
 } // namespace cpu
@@ -23,6 +23,7 @@
 #include "cpu/ref_pooling.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/jit_uni_adaptive_pooling.hpp"
 #include "cpu/x64/jit_uni_i8i8_pooling.hpp"
 #include "cpu/x64/jit_uni_pooling.hpp"
 using namespace dnnl::impl::cpu::x64;
@@ -52,6 +53,7 @@ using namespace dnnl::impl::prop_kind;
 const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     static const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> the_map = REG_POOLING_P({
         {{forward}, {
+            CPU_INSTANCE_X64(jit_uni_adaptive_pooling_fwd_t)
             /* fp */
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx512_core_fp16, f16>)
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx512_core, bf16>)
@@ -130,4 +130,18 @@
 #define DEFINE_ZERO_POINT_VALUE(zero_point, mem_arg) \
     DEFINE_ZERO_POINT_VALUE_ATTR(pd()->attr(), zero_point, mem_arg)
 
+#define DEFINE_ROUNDING_SEED_VALUE(seed) \
+    uint32_t seed = 0; \
+    if (!pd()->attr()->rounding_mode_.has_default_values()) { \
+        const auto seed_d = ctx.memory_mdw(DNNL_ARG_ATTR_ROUNDING_SEED); \
+        bool ok = seed_d.data_type() == data_type::s32 && seed_d.ndims() == 1 \
+                && seed_d.dims()[0] == 1; \
+        if (!ok) return status::invalid_arguments; \
+        const int32_t *seed_ptr \
+                = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_ROUNDING_SEED); \
+        if (seed_ptr == nullptr) return status::invalid_arguments; \
+        seed = static_cast<uint32_t>(*seed_ptr); \
+    } \
+    MAYBE_UNUSED(seed);
+
 #endif // CPU_CPU_PRIMITIVE_HPP
@@ -43,6 +43,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             nullptr,
         }},
         {{backward}, REG_BWD_PK({
+            CPU_INSTANCE_X64(jit_uni_resampling_bwd_t)
             CPU_INSTANCE_X64(jit_avx512_core_resampling_bwd_t)
             CPU_INSTANCE(simple_resampling_bwd_t)
             CPU_INSTANCE(ref_resampling_bwd_t)
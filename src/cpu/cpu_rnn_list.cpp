@@ -18,6 +18,11 @@
 
 #include "cpu/rnn/ref_rnn.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/rnn/jit_uni_persistent_rnn.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -30,6 +35,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     // clang-format off
     static std::map<pk_impl_key_t, std::vector<impl_list_item_t>> the_map =  REG_RNN_P({
         {{forward}, {
+            CPU_INSTANCE_AVX512(jit_uni_persistent_rnn_fwd_t<avx512_core>)
+            CPU_INSTANCE_AVX2(jit_uni_persistent_rnn_fwd_t<avx2>)
             CPU_INSTANCE(ref_rnn_fwd_bf16_t)
             CPU_INSTANCE(ref_rnn_fwd_f32_t)
             CPU_INSTANCE(ref_rnn_fwd_s8s8_t)
@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_ROPE_PD_HPP
+#define CPU_CPU_ROPE_PD_HPP
+
+#include "common/rope_pd.hpp"
+#include "cpu/cpu_engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_rope_pd_t : public rope_pd_t {
+    using rope_pd_t::rope_pd_t;
+
+    // The position offsets must be non-negative and, when the cosine and sine
+    // caches are used, every position of a sequence must be in the caches.
+    status_t check_offsets(const int32_t *offsets) const {
+        if (!offsets) return status::success;
+        for (dim_t mb = 0; mb < MB(); mb++) {
+            if (offsets[mb] < 0) return status::invalid_arguments;
+            if (with_cos_sin() && offsets[mb] + S() > n_positions())
+                return status::invalid_arguments;
+        }
+        return status::success;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
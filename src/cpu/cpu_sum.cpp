@@ -22,6 +22,7 @@
 #include "cpu/simple_sum.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/jit_uni_sum.hpp"
 #include "cpu/x64/jit_uni_xf16_sum.hpp"
 using namespace dnnl::impl::cpu::x64;
 #endif
@@ -45,6 +46,7 @@ constexpr impl_list_item_t cpu_sum_impl_list[] = REG_SUM_P({
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<bf16, f32, avx2_vnni_2>)
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<f16, f16, avx2_vnni_2>)
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<f16, f32, avx2_vnni_2>)
+        SUM_INSTANCE_AVX2(jit_uni_sum_t)
         INSTANCE(simple_sum_t<f16>)
         INSTANCE(simple_sum_t<f16, f32>)
         INSTANCE(simple_sum_t<bf16>)
@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_TOPK_PD_HPP
+#define CPU_CPU_TOPK_PD_HPP
+
+#include "common/topk_pd.hpp"
+#include "common/utils.hpp"
+#include "cpu/cpu_engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_topk_pd_t : public topk_pd_t {
+    using topk_pd_t::topk_pd_t;
+
+    // Returns the logical position of the first element of a row, which is
+    // given by its outer and inner coordinates.
+    void row_pos(dim_t outer, dim_t inner, dims_t pos) const {
+        const int ax = axis();
+        const int ndims = src_md_.ndims;
+        dims_t outer_dims, inner_dims;
+        utils::array_copy(outer_dims, src_md_.dims, ax);
+        utils::array_copy(
+                inner_dims, src_md_.dims + ax + 1, ndims - ax - 1);
+        utils::l_dims_by_l_offset(pos, outer, outer_dims, ax);
+        utils::l_dims_by_l_offset(
+                pos + ax + 1, inner, inner_dims, ndims - ax - 1);
+        pos[ax] = 0;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
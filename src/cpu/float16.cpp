@@ -16,6 +16,7 @@
 
 #include "common/float16.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
 
 #include "cpu/platform.hpp"
 #if DNNL_X64
@@ -61,6 +62,16 @@ void cvt_float_to_float16(float16_t *out, const float *inp, size_t nelems) {
         out[i] = static_cast<float16_t>(inp[i]);
 }
 
+void cvt_float_to_float16_stochastic(float16_t *out, const float *inp,
+        size_t nelems, size_t offset, uint32_t seed) {
+    const uint32_t mixed_seed = math::hash_u32(seed);
+    PRAGMA_OMP_SIMD()
+    for (size_t i = 0; i < nelems; ++i)
+        out[i] = static_cast<float16_t>(math::stochastic_round_fwd(inp[i],
+                math::stochastic_rounding_bits(offset + i, mixed_seed),
+                data_type::f16));
+}
+
 void cvt_float16_to_float(float *out, const float16_t *inp, size_t nelems) {
 #if DNNL_X64
     using namespace cpu::x64;
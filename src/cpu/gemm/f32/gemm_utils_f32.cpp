@@ -62,8 +62,9 @@ void calc_nthr_nocopy_avx(dim_t m, dim_t n, dim_t k, int nthrs, int *nthrs_m,
 
     // Partition along K dimension
     //  - if threading allows having barriers (e.g. OMP)
+    //  - if the result may depend on the number of threads
     //  - if there is not enough parallelism along M or N
-    if (dnnl_thr_syncable()) {
+    if (dnnl_thr_syncable() && !dnnl_thr_deterministic()) {
         int nthr_other = nthr_k = 1;
         while ((nthr_m * nthr_n * nthr_other < nthr)
                 && (k / (nthr_other + 1) > BK_NOCOPY_AVX)) {
@@ -182,8 +183,9 @@ void calc_nthr_nocopy_avx512_common(dim_t m, dim_t n, dim_t k, int nthrs,
 
     // Partition along K dimension
     //  - if threading allows having barriers (e.g. OMP)
+    //  - if the result may depend on the number of threads
     //  - if there is not enough parallelism along M or N
-    if (dnnl_thr_syncable()) {
+    if (dnnl_thr_syncable() && !dnnl_thr_deterministic()) {
         if (n <= 2 * BN_NOCOPY_AVX512_COMMON
                 && m <= 2 * BM_NOCOPY_AVX512_COMMON * nthr && k > m && k > n) {
             nthr_k = k / BK_NOCOPY_AVX512_COMMON;
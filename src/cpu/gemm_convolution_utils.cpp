@@ -1982,8 +1982,10 @@ status_t init_conf(conv_gemm_conf_t &jcp,
             const bool outer_threading_mem_ok
                     = thr_mem_estimate < scratchpad_limit;
 
-            jcp.outer_threading = outer_threading_mem_ok
-                    && jcp.os / max_threads < 256
+            // Outer threading accumulates diff_weights per thread, it is not
+            // used in deterministic mode, which relies on gemm instead.
+            jcp.outer_threading = !dnnl_thr_deterministic()
+                    && outer_threading_mem_ok && jcp.os / max_threads < 256
                     && (jcp.mb != 1 || jcp.ngroups > 2);
             jcp.nthr = jcp.outer_threading ? max_threads : 1;
 
@@ -2026,8 +2028,9 @@ status_t init_conf(conv_gemm_conf_t &jcp,
 
             const bool outer_threading_mem_ok
                     = thr_mem_estimate < scratchpad_limit;
-            jcp.outer_threading = outer_threading_mem_ok
-                    && jcp.os / max_threads < 256
+            // See the nspc case above for deterministic mode.
+            jcp.outer_threading = !dnnl_thr_deterministic()
+                    && outer_threading_mem_ok && jcp.os / max_threads < 256
                     && (jcp.mb != 1 || jcp.ngroups > 2);
         }
 
@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "common/memory_debug.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/huge_pages.hpp"
+#include "cpu/platform.hpp"
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+#define DNNL_HUGETLB_SUPPORTED 1
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#else
+#define DNNL_HUGETLB_SUPPORTED 0
+#endif
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+#define DNNL_THP_SUPPORTED 1
+#else
+#define DNNL_THP_SUPPORTED 0
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+constexpr size_t page_1g = (size_t)1 << 30;
+
+size_t huge_page_size(huge_pages_kind_t kind) {
+    switch (kind) {
+        case huge_pages_kind_t::hugetlb_1g: return page_1g;
+        case huge_pages_kind_t::none: return 0;
+        default: return PAGE_2M;
+    }
+}
+
+void report_allocation(size_t size, huge_pages_kind_t kind) {
+    if (get_verbose(verbose_t::debuginfo) >= 1)
+        printf("onednn_verbose,info,cpu,huge_pages,alloc,size:%zu,pages:%s\n",
+                size, huge_pages_kind2str(kind));
+}
+
+#if DNNL_HUGETLB_SUPPORTED
+void *mmap_hugetlb(size_t size, huge_pages_kind_t kind) {
+    const size_t page_size = huge_page_size(kind);
+    const int page_shift = kind == huge_pages_kind_t::hugetlb_1g ? 30 : 21;
+    void *ptr = ::mmap(nullptr, utils::rnd_up(size, page_size),
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+                    | (page_shift << MAP_HUGE_SHIFT),
+            -1, 0);
+    // Failure is expected when the hugetlbfs pool is not configured or is
+    // exhausted; the caller falls back to smaller pages.
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+#endif
+
+void *malloc_thp(size_t size, huge_pages_kind_t &kind) {
+    kind = huge_pages_kind_t::none;
+    void *ptr = nullptr;
+#if DNNL_THP_SUPPORTED
+    // Aligning both the start and the size to the huge page boundary lets
+    // the kernel back the whole buffer with huge pages.
+    if (::posix_memalign(&ptr, PAGE_2M, utils::rnd_up(size, PAGE_2M)) != 0)
+        return nullptr;
+    if (::madvise(ptr, utils::rnd_up(size, PAGE_2M), MADV_HUGEPAGE) == 0)
+        kind = huge_pages_kind_t::thp;
+#endif
+    return ptr;
+}
+} // namespace
+
+huge_pages_policy_t get_huge_pages_policy() {
+    static const huge_pages_policy_t policy = []() {
+        const std::string s = getenv_string_user("HUGE_PAGES");
+        if (s == "thp" || s == "1") return huge_pages_policy_t::thp;
+        if (s == "2m" || s == "2") return huge_pages_policy_t::hugetlb_2m;
+        if (s == "1g" || s == "3") return huge_pages_policy_t::hugetlb_1g;
+        return huge_pages_policy_t::none;
+    }();
+    return policy;
+}
+
+const char *huge_pages_policy2str(huge_pages_policy_t policy) {
+    switch (policy) {
+        case huge_pages_policy_t::thp: return "thp";
+        case huge_pages_policy_t::hugetlb_2m: return "2m";
+        case huge_pages_policy_t::hugetlb_1g: return "1g";
+        default: return "none";
+    }
+}
+
+const char *huge_pages_kind2str(huge_pages_kind_t kind) {
+    switch (kind) {
+        case huge_pages_kind_t::thp: return "thp";
+        case huge_pages_kind_t::hugetlb_2m: return "hugetlb_2m";
+        case huge_pages_kind_t::hugetlb_1g: return "hugetlb_1g";
+        default: return "none";
+    }
+}
+
+void *malloc_huge_pages(size_t size, int alignment, huge_pages_kind_t &kind) {
+    kind = huge_pages_kind_t::none;
+
+    const auto policy = get_huge_pages_policy();
+    // Memory debug mode relies on its own page layout around each buffer.
+    if (policy == huge_pages_policy_t::none || size < PAGE_2M
+            || memory_debug::is_mem_debug())
+        return impl::malloc(size, alignment);
+
+    void *ptr = nullptr;
+#if DNNL_HUGETLB_SUPPORTED
+    if (policy == huge_pages_policy_t::hugetlb_1g && size >= page_1g) {
+        ptr = mmap_hugetlb(size, huge_pages_kind_t::hugetlb_1g);
+        if (ptr) kind = huge_pages_kind_t::hugetlb_1g;
+    }
+    if (!ptr
+            && utils::one_of(policy, huge_pages_policy_t::hugetlb_2m,
+                    huge_pages_policy_t::hugetlb_1g)) {
+        ptr = mmap_hugetlb(size, huge_pages_kind_t::hugetlb_2m);
+        if (ptr) kind = huge_pages_kind_t::hugetlb_2m;
+    }
+#endif
+    if (!ptr) ptr = malloc_thp(size, kind);
+    if (!ptr) ptr = impl::malloc(size, alignment);
+
+    if (ptr) report_allocation(size, kind);
+    return ptr;
+}
+
+void free_huge_pages(void *ptr, size_t size, huge_pages_kind_t kind) {
+    if (!ptr) return;
+#if DNNL_HUGETLB_SUPPORTED
+    if (utils::one_of(kind, huge_pages_kind_t::hugetlb_2m,
+                huge_pages_kind_t::hugetlb_1g)) {
+        ::munmap(ptr, utils::rnd_up(size, huge_page_size(kind)));
+        return;
+    }
+#endif
+    MAYBE_UNUSED(size);
+    MAYBE_UNUSED(kind);
+    impl::free(ptr);
+}
+
+bool advise_huge_pages(void *ptr, size_t size) {
+    if (get_huge_pages_policy() == huge_pages_policy_t::none || !ptr)
+        return false;
+#if DNNL_THP_SUPPORTED
+    const uintptr_t beg = utils::rnd_up((uintptr_t)ptr, (uintptr_t)PAGE_2M);
+    const uintptr_t end = utils::rnd_dn((uintptr_t)ptr + size, PAGE_2M);
+    if (beg >= end) return false;
+    const bool ok = ::madvise((void *)beg, end - beg, MADV_HUGEPAGE) == 0;
+    report_allocation(size,
+            ok ? huge_pages_kind_t::thp : huge_pages_kind_t::none);
+    return ok;
+#else
+    return false;
+#endif
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
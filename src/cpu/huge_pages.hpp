@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_HUGE_PAGES_HPP
+#define CPU_HUGE_PAGES_HPP
+
+#include <cstddef>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Defines which pages the library requests for large buffers it allocates on
+// its own: memory objects, scratchpads and graph constant cache buffers.
+// The policy is controlled by ONEDNN_HUGE_PAGES environment variable.
+enum class huge_pages_policy_t {
+    // Regular pages only (default).
+    none,
+    // Transparent huge pages requested with madvise(MADV_HUGEPAGE).
+    thp,
+    // Explicit 2MB hugetlbfs pages, falls back to `thp`.
+    hugetlb_2m,
+    // Explicit 1GB hugetlbfs pages for buffers of at least 1GB, falls back to
+    // `hugetlb_2m`.
+    hugetlb_1g,
+};
+
+// Pages actually backing a particular allocation.
+enum class huge_pages_kind_t {
+    none,
+    thp,
+    hugetlb_2m,
+    hugetlb_1g,
+};
+
+huge_pages_policy_t get_huge_pages_policy();
+const char *huge_pages_policy2str(huge_pages_policy_t policy);
+const char *huge_pages_kind2str(huge_pages_kind_t kind);
+
+// Allocates `size` bytes aligned at least to `alignment` following the huge
+// pages policy. Buffers smaller than a huge page are always allocated with
+// regular pages. On return `kind` holds the pages the buffer got; it must be
+// passed to `free_huge_pages()` together with the original `size`.
+void *malloc_huge_pages(size_t size, int alignment, huge_pages_kind_t &kind);
+void free_huge_pages(void *ptr, size_t size, huge_pages_kind_t kind);
+
+// Requests transparent huge pages for a buffer allocated elsewhere (e.g. by
+// a user-provided allocator). Only the 2MB-aligned part of the buffer is
+// affected. Returns true if the request was accepted.
+bool advise_huge_pages(void *ptr, size_t size);
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -20,12 +20,15 @@
 #include "cpu/matmul/gemm_bf16_matmul.hpp"
 #include "cpu/matmul/gemm_f32_matmul.hpp"
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
+#include "cpu/matmul/ref_grouped_matmul.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
 #include "cpu/matmul/ref_matmul_int8.hpp"
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
+#include "cpu/x64/matmul/jit_gemv_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
 using namespace dnnl::impl::cpu::x64;
@@ -68,6 +71,7 @@ using namespace dnnl::impl::cpu::matmul;
 // clang-format off
 constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AARCH64_ACL(acl_matmul_t)
+        CPU_INSTANCE_AVX512(jit_gemv_matmul_t)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx_fp16>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx>)
         CPU_INSTANCE_AVX512(brgemm_matmul_t<avx512_core_fp16>)
@@ -89,6 +93,14 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         /* eol */
         nullptr,
 });
+
+constexpr impl_list_item_t grouped_impl_list[] = REG_MATMUL_P({
+        CPU_INSTANCE_AVX512(brgemm_grouped_matmul_t<avx512_core>)
+        CPU_INSTANCE_AVX2(brgemm_grouped_matmul_t<avx2>)
+        CPU_INSTANCE(ref_grouped_matmul_t)
+        /* eol */
+        nullptr,
+});
 // clang-format on
 } // namespace
 
@@ -96,8 +108,7 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
 #undef CPU_INSTANCE_SPARSE_X64
 
 const impl_list_item_t *get_matmul_impl_list(const matmul_desc_t *desc) {
-    UNUSED(desc);
-    return impl_list;
+    return is_grouped_matmul(*desc) ? grouped_impl_list : impl_list;
 }
 
 } // namespace cpu
@@ -177,6 +177,16 @@ private:
     }
 };
 
+// Returns true if offsets of the groups of a grouped matmul describe
+// consecutive ranges of rows within [0, M).
+inline bool group_offsets_ok(
+        const int32_t *offsets, dim_t ngroups, dim_t M) {
+    if (offsets[0] < 0 || offsets[ngroups] > M) return false;
+    for (dim_t g = 0; g < ngroups; g++)
+        if (offsets[g] > offsets[g + 1]) return false;
+    return true;
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/matmul/ref_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+status_t ref_grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_GROUP_OFFSETS);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t G = pd()->ngroups();
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t K = pd()->K();
+
+    if (!group_offsets_ok(offsets, G, M)) return status::invalid_arguments;
+    if (N == 0) return status::success;
+
+    parallel_nd(offsets[G] - offsets[0], N, [&](dim_t i, dim_t n) {
+        const dim_t m = offsets[0] + i;
+        // The last group that starts at or before row m, empty groups are
+        // skipped this way.
+        const dim_t g = std::upper_bound(offsets, offsets + G + 1, m) - offsets
+                - 1;
+        float acc = 0.f;
+        for (dim_t k = 0; k < K; ++k) {
+            const float s = io::load_float_value(
+                    src_d.data_type(), src, src_d.off(m, k));
+            const float w = io::load_float_value(
+                    weights_d.data_type(), weights, weights_d.off(g, k, n));
+            acc += s * w;
+        }
+        io::store_float_value(dst_d.data_type(), acc, dst, dst_d.off(m, n));
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
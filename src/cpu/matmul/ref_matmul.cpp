@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2022 Intel Corporation
+* Copyright 2019-2023 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -18,6 +18,8 @@
 #include <float.h>
 #include <math.h>
 
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
@@ -25,6 +27,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_io_helper.hpp"
+#include "cpu/rope_utils.hpp"
 
 #include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
@@ -45,6 +48,11 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    DEFINE_ROUNDING_SEED_VALUE(rnd_seed);
+
+    ref_dropout_t dropout(pd()->attr()->dropout_);
+    CHECK(dropout.init(ctx));
+    const bool with_dropout = dropout.enabled();
 
     const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
     const auto weights_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
@@ -59,7 +67,6 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     matmul_helper_t helper(src_d, weights_d, dst_d);
     const int ndims = pd()->ndims();
-    const int batch_ndims = ndims - 2;
     const dim_t M = helper.M();
     const dim_t N = helper.N();
     const dim_t K = helper.K();
@@ -118,8 +125,12 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_d.data_type());
 
-    // computations
-    parallel_nd(batch, M, N, [&](dim_t mb, dim_t m, dim_t n) {
+    const bool dst_stochastic = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST)
+            == rounding_mode::stochastic;
+    const uint32_t rnd_mixed_seed = math::hash_u32(rnd_seed);
+
+    // Computes the destination value of a point up to the rope post-op.
+    auto compute = [&](dim_t mb, dim_t m, dim_t n) {
         dims_t dst_dims_idx;
         // account for M, N dims for index calculations
         const size_t l_offset = mb * M * N + m * N + n;
@@ -128,9 +139,10 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         if (with_src_scales) d *= src_scales[0];
         if (with_wei_scales) d *= wei_scales[wei_scale_stride * n];
         if (bias) d += ker_bias(dst_dims_idx);
+        if (with_dropout) d = dropout.compute_scalar(d, l_offset);
 
-        const auto dst_off = dst_d.off_v(dst_dims_idx);
         if (non_default_attrs) {
+            const auto dst_off = dst_d.off_v(dst_dims_idx);
             ref_post_ops_t::args_t args;
             args.dst_val = io::load_float_value(sum_dt, dst, dst_off);
             args.ctx = &ctx;
@@ -138,9 +150,52 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
             args.dst_md = pd()->dst_md();
             ref_post_ops->execute(d, args);
         }
+        return d;
+    };
+
+    auto store = [&](float d, dim_t mb, dim_t m, dim_t n) {
+        dims_t dst_dims_idx;
+        const size_t l_offset = mb * M * N + m * N + n;
+        utils::l_dims_by_l_offset(dst_dims_idx, l_offset, dst_d.dims(), ndims);
+        const auto dst_off = dst_d.off_v(dst_dims_idx);
         if (with_dst_scales) d *= dst_scales[0];
+        if (dst_stochastic)
+            d = math::stochastic_round_fwd(d,
+                    math::stochastic_rounding_bits(dst_off, rnd_mixed_seed),
+                    dst_d.data_type());
         io::store_float_value(dst_d.data_type(), d, dst, dst_off);
-        utils::dim_iterator(dst_d.dims(), dst_dims_idx, batch_ndims);
+    };
+
+    // computations
+    const int rope_idx = rope_utils::po_idx(pd()->attr()->post_ops_);
+    if (rope_idx == -1) {
+        parallel_nd(batch, M, N, [&](dim_t mb, dim_t m, dim_t n) {
+            store(compute(mb, m, n), mb, m, n);
+        });
+        return status::success;
+    }
+
+    // The rope post-op rotates the heads of a destination row, so a head is
+    // computed into a buffer first.
+    const auto &rope = pd()->attr()->post_ops_.entry_[rope_idx].rope;
+    const auto rope_offsets = CTX_IN_MEM(const int32_t *,
+            DNNL_ARG_ATTR_MULTIPLE_POST_OP(rope_idx) | DNNL_ARG_OFFSETS);
+    const dim_t head_dim = rope.head_dim;
+    const dim_t rd = rope.rotary_dim;
+    parallel_nd(batch, M, N / head_dim, [&](dim_t mb, dim_t m, dim_t h) {
+        std::vector<float> d(head_dim);
+        std::vector<float> cos_sin(rd);
+        for (dim_t i = 0; i < head_dim; i++)
+            d[i] = compute(mb, m, h * head_dim + i);
+
+        const dim_t pos = m + (rope_offsets ? rope_offsets[mb] : 0);
+        rope_utils::compute_cos_sin(
+                cos_sin.data(), cos_sin.data() + rd / 2, pos, rd, rope.base);
+        rope_utils::rotate(d.data(), cos_sin.data(), cos_sin.data() + rd / 2,
+                rd, rope.alg);
+
+        for (dim_t i = 0; i < head_dim; i++)
+            store(d[i], mb, m, h * head_dim + i);
     });
 
     return status::success;
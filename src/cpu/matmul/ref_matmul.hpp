@@ -68,13 +68,20 @@ struct ref_matmul_t : public primitive_t {
                                             utils::one_of(bia_type, f32, bf16)))
                     && platform::has_data_type_support(src_type)
                     && attr()->has_default_values(smask_t::scales_runtime
-                                    | smask_t::post_ops | smask_t::sum_dt,
+                                    | smask_t::post_ops | smask_t::sum_dt
+                                    | smask_t::rounding_mode
+                                    | smask_t::dropout,
                             dst_type)
+                    && IMPLICATION(attr()->rounding_mode_.get(DNNL_ARG_DST)
+                                    == rounding_mode::stochastic,
+                            utils::one_of(dst_type, bf16, f16))
                     && attr_.post_ops_.check_sum_consistency(dst_type,
                             /* is_int8 */ false)
-                    && ref_post_ops_t::primitive_kind_ok(attr()->post_ops_)
+                    && ref_post_ops_t::primitive_kind_ok(
+                            attr()->post_ops_, /* rope_ok = */ true)
                     && attr_scales_ok() && set_default_formats()
-                    && attr_.set_default_formats(dst_md(0)) == status::success;
+                    && attr_.set_default_formats(dst_md(0)) == status::success
+                    && ref_dropout_t::attr_ok(attr()->dropout_, dst_md(0));
             return ok ? status::success : status::unimplemented;
         }
     };
@@ -90,16 +90,23 @@ status_t nspc_batch_normalization_fwd_t<d_type>::execute_forward(
         return res;
     };
     const int nthr = pd()->nthr_;
+    const int nchunks = pd()->nchunks_;
 
     if (calculate_stats) {
+        // Every chunk of the minibatch has its own partial sums, see
+        // bnorm_utils::get_stats_nchunks().
         parallel(nthr, [&](const int ithr, const int nthr) {
-            dim_t N_s = 0, N_e = 0;
-            balance211(N, nthr, ithr, N_s, N_e);
+            int chunk_s = 0, chunk_e = 0;
+            balance211(nchunks, nthr, ithr, chunk_s, chunk_e);
+            for (int ichunk = chunk_s; ichunk < chunk_e; ichunk++) {
+                dim_t N_s = 0, N_e = 0;
+                balance211(N, nchunks, ichunk, N_s, N_e);
+                acc_data_t *chunk_reduce = ws_reduce + C * ichunk;
 
-            for (dim_t c = 0; c < C; c++)
-                ws_reduce[C * ithr + c] = 0.;
+                for (dim_t c = 0; c < C; c++)
+                    chunk_reduce[c] = 0.;
 
-            for (dim_t n = N_s; n < N_e; n++) {
+                for_(dim_t n = N_s; n < N_e; n++)
                 for (dim_t sp = 0; sp < SP; sp++) {
                     const acc_data_t *_src;
                     const size_t s_off = (size_t)n * SP * C + sp * C;
@@ -114,21 +121,18 @@ status_t nspc_batch_normalization_fwd_t<d_type>::execute_forward(
                     }
                     PRAGMA_OMP_SIMD()
                     for (int c = 0; c < C; c++) {
-                        ws_reduce[C * ithr + c] += _src[c];
+                        chunk_reduce[c] += _src[c];
                     }
                 }
             }
         });
         parallel_nd(C, [&](dim_t c) {
             mean[c] = 0;
-            for (dim_t n = 0; n < nthr; n++)
+            for (dim_t n = 0; n < nchunks; n++)
                 mean[c] += ws_reduce[C * n + c];
             mean[c] /= SP * N;
         });
         parallel(nthr, [&](const int ithr, const int nthr) {
-            dim_t N_s = 0, N_e = 0;
-            balance211(N, nthr, ithr, N_s, N_e);
-
             acc_data_t *mean_loc = tmp_mean + nstl::max(C, (dim_t)16) * ithr;
 
             if (ithr > 0 || save_stats) {
@@ -136,10 +140,17 @@ status_t nspc_batch_normalization_fwd_t<d_type>::execute_forward(
                     mean_loc[c] = mean[c];
             }
 
-            for (dim_t c = 0; c < C; c++)
-                ws_reduce[C * ithr + c] = 0.;
+            int chunk_s = 0, chunk_e = 0;
+            balance211(nchunks, nthr, ithr, chunk_s, chunk_e);
+            for (int ichunk = chunk_s; ichunk < chunk_e; ichunk++) {
+                dim_t N_s = 0, N_e = 0;
+                balance211(N, nchunks, ichunk, N_s, N_e);
+                acc_data_t *chunk_reduce = ws_reduce + C * ichunk;
 
-            for (dim_t n = N_s; n < N_e; n++) {
+                for (dim_t c = 0; c < C; c++)
+                    chunk_reduce[c] = 0.;
+
+                for_(dim_t n = N_s; n < N_e; n++)
                 for (dim_t sp = 0; sp < SP; sp++) {
                     const acc_data_t *_src;
                     const size_t s_off = (size_t)n * SP * C + sp * C;
@@ -155,14 +166,14 @@ status_t nspc_batch_normalization_fwd_t<d_type>::execute_forward(
                     PRAGMA_OMP_SIMD()
                     for (int c = 0; c < C; c++) {
                         acc_data_t m = _src[c] - mean_loc[c];
-                        ws_reduce[C * ithr + c] += m * m;
+                        chunk_reduce[c] += m * m;
                     }
                 }
             }
         });
         parallel_nd(C, [&](dim_t c) {
             variance[c] = 0;
-            for (dim_t n = 0; n < nthr; n++)
+            for (dim_t n = 0; n < nchunks; n++)
                 variance[c] += ws_reduce[C * n + c];
             variance[c] /= SP * N;
         });
@@ -288,17 +299,25 @@ status_t nspc_batch_normalization_bwd_t<d_type>::execute_backward(
     const dim_t tail = C % c_blk;
     const dim_t nb_c_blk = (size_t)C / c_blk;
     const int nthr = pd()->nthr_;
+    const int nchunks = pd()->nchunks_;
 
+    // Every chunk of the minibatch has its own partial sums, see
+    // bnorm_utils::get_stats_nchunks().
     parallel(nthr, [&](const int ithr, const int nthr) {
-        dim_t N_s = 0, N_e = 0;
-        balance211(N, nthr, ithr, N_s, N_e);
+        int chunk_s = 0, chunk_e = 0;
+        balance211(nchunks, nthr, ithr, chunk_s, chunk_e);
+        for (int ichunk = chunk_s; ichunk < chunk_e; ichunk++) {
+            dim_t N_s = 0, N_e = 0;
+            balance211(N, nchunks, ichunk, N_s, N_e);
+            acc_data_t *chunk_diff_gamma = ws_reduce + C * ichunk;
+            acc_data_t *chunk_diff_beta = ws_reduce + C * (nchunks + ichunk);
 
-        for (dim_t c = 0; c < C; c++) {
-            ws_reduce[C * ithr + c] = 0.;
-            ws_reduce[C * nthr + C * ithr + c] = 0.;
-        }
+            for (dim_t c = 0; c < C; c++) {
+                chunk_diff_gamma[c] = 0.;
+                chunk_diff_beta[c] = 0.;
+            }
 
-        for (dim_t n = N_s; n < N_e; n++) {
+            for_(dim_t n = N_s; n < N_e; n++)
             for (dim_t sp = 0; sp < SP; sp++) {
                 const acc_data_t *_diff_dst;
                 const acc_data_t *_src;
@@ -327,8 +346,8 @@ status_t nspc_batch_normalization_bwd_t<d_type>::execute_backward(
                         dd = 0;
                     else
                         dd = _diff_dst[c];
-                    ws_reduce[C * ithr + c] += (_src[c] - mean[c]) * dd;
-                    ws_reduce[C * nthr + C * ithr + c] += dd;
+                    chunk_diff_gamma[c] += (_src[c] - mean[c]) * dd;
+                    chunk_diff_beta[c] += dd;
                 }
             }
         }
@@ -339,9 +358,9 @@ status_t nspc_batch_normalization_bwd_t<d_type>::execute_backward(
                 = static_cast<acc_data_t>(1.0f / sqrtf(variance[c] + eps));
         diff_gamma[c] = 0;
         diff_beta[c] = 0;
-        for (dim_t n = 0; n < nthr; n++) {
+        for (dim_t n = 0; n < nchunks; n++) {
             diff_gamma[c] += ws_reduce[C * n + c];
-            diff_beta[c] += ws_reduce[C * nthr + C * n + c];
+            diff_beta[c] += ws_reduce[C * (nchunks + n) + c];
         }
         diff_gamma[c] *= sqrt_variance;
     });
@@ -27,6 +27,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_batch_normalization_pd.hpp"
+#include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -69,12 +70,14 @@ struct nspc_batch_normalization_fwd_t : public primitive_t {
             if (is_training() && fuse_norm_relu()) init_default_ws(8);
 
             nthr_ = dnnl_get_max_threads();
+            nchunks_ = bnorm_utils::get_stats_nchunks(MB(), nthr_);
             init_scratchpad();
 
             return status::success;
         }
 
         int nthr_; // To not exceed the limit in execute used for set up.
+        int nchunks_; // Number of partial sums of statistics.
 
     private:
         void init_scratchpad() {
@@ -84,8 +87,8 @@ struct nspc_batch_normalization_fwd_t : public primitive_t {
             auto scratchpad = scratchpad_registry().registrar();
             if (!stats_is_src()) {
                 const size_t stats_buf_sz = nstl::max(C(), dim_t(16)) * nthr_;
-                scratchpad.template book<acc_data_t>(
-                        key_bnorm_reduction, stats_buf_sz);
+                scratchpad.template book<acc_data_t>(key_bnorm_reduction,
+                        nstl::max(C(), dim_t(16)) * nchunks_);
                 scratchpad.template book<acc_data_t>(
                         key_bnorm_tmp_mean, stats_buf_sz);
                 scratchpad.template book<acc_data_t>(
@@ -155,12 +158,14 @@ struct nspc_batch_normalization_bwd_t : public primitive_t {
             }
 
             nthr_ = dnnl_get_max_threads();
+            nchunks_ = bnorm_utils::get_stats_nchunks(MB(), nthr_);
             init_scratchpad();
 
             return status::success;
         }
 
         int nthr_; // To not exceed the limit in execute used for set up.
+        int nchunks_; // Number of partial sums of diff_scale and diff_shift.
 
     private:
         void init_scratchpad() {
@@ -169,7 +174,7 @@ struct nspc_batch_normalization_bwd_t : public primitive_t {
 
             auto scratchpad = scratchpad_registry().registrar();
             scratchpad.template book<acc_data_t>(
-                    key_bnorm_reduction, 2 * C() * nthr_);
+                    key_bnorm_reduction, 2 * C() * nchunks_);
             scratchpad.template book<acc_data_t>(
                     key_bnorm_tmp_diff_ss, 2 * C() * (nthr_ + 1));
             if (utils::one_of(d_type, bf16, f16)) {
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2022 Intel Corporation
+* Copyright 2020-2023 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -299,12 +299,62 @@ status_t ref_post_ops_t::execute(float &res, const args_t &args) const {
                 const auto &weights_value = prelu_weights[off];
                 res = weights_value * res;
             } break;
+            case primitive_kind::rope: break;
             default: assert(!"unsupported post op primitive kind!");
         }
     }
     return status::success;
 }
 
+status_t ref_dropout_t::init(const exec_ctx_t &ctx) {
+    if (!enabled()) return status::success;
+
+    // Scalar runtime parameters are one-element memory objects.
+    auto scalar_ok = [&](int arg, data_type_t dt) {
+        const auto mdw = ctx.memory_mdw(arg);
+        return mdw.data_type() == dt && mdw.nelems() == 1;
+    };
+
+    const auto p_ptr
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_DROPOUT_PROBABILITY);
+    const auto seed_ptr
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_DROPOUT_SEED);
+    const auto offset_ptr
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_DROPOUT_OFFSET);
+    bool ok = p_ptr && seed_ptr
+            && scalar_ok(DNNL_ARG_ATTR_DROPOUT_PROBABILITY, data_type::f32)
+            && scalar_ok(DNNL_ARG_ATTR_DROPOUT_SEED, data_type::s32)
+            && IMPLICATION(offset_ptr,
+                    scalar_ok(DNNL_ARG_ATTR_DROPOUT_OFFSET, data_type::s32));
+    if (!ok) return status::invalid_arguments;
+
+    const float p = *p_ptr;
+    if (!(p >= 0.f && p <= 1.f)) return status::invalid_arguments;
+
+    if (dropout_.has_mask()) {
+        mask_ = CTX_OUT_MEM(uint8_t *, DNNL_ARG_ATTR_DROPOUT_MASK);
+        if (mask_ == nullptr) return status::invalid_arguments;
+    }
+
+    mixed_seed_ = math::hash_u32(static_cast<uint32_t>(*seed_ptr));
+    offset_ = offset_ptr ? *offset_ptr : 0;
+    drop_all_ = p == 1.f;
+    // An element is kept when its 32 random bits are not below p * 2^32.
+    threshold_ = drop_all_ ? 0 : static_cast<uint32_t>(p * 4294967296.0);
+    scale_ = drop_all_ ? 0.f : 1.f / (1.f - p);
+
+    return status::success;
+}
+
+bool ref_dropout_t::attr_ok(
+        const dropout_t &dropout, const memory_desc_t *dst_md) {
+    if (!dropout.has_mask()) return true;
+    const memory_desc_wrapper mask_d(dropout.mask_desc_);
+    const memory_desc_wrapper dst_d(dst_md);
+    return mask_d.is_blocking_desc() && mask_d.ndims() == dst_d.ndims()
+            && utils::array_cmp(mask_d.dims(), dst_d.dims(), dst_d.ndims());
+}
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
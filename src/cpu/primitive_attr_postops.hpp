@@ -19,6 +19,8 @@
 
 #include <vector>
 
+#include "common/math_utils.hpp"
+#include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/primitive_attr.hpp"
 
@@ -71,8 +73,12 @@ struct ref_post_ops_t {
 
     status_t execute(float &res, const args_t &args = args_t()) const;
 
-    static bool primitive_kind_ok(const post_ops_t &po) {
+    // A rope post-op mixes destination values of a head, so it is skipped by
+    // `execute()` and is applied by primitives which set `rope_ok`.
+    static bool primitive_kind_ok(const post_ops_t &po, bool rope_ok = false) {
         using namespace primitive_kind;
+        if (rope_ok)
+            return po.has_default_values({binary, eltwise, prelu, sum, rope});
         return po.has_default_values({binary, eltwise, prelu, sum});
     }
 
@@ -86,6 +92,43 @@ private:
     std::vector<ref_binary_scalar_t> binary_po_;
 };
 
+// Applies the dropout attribute to output values. An object is created for
+// every execution since it keeps the runtime parameters.
+struct ref_dropout_t {
+    ref_dropout_t(const dropout_t &dropout)
+        : dropout_(dropout), mask_d_(&dropout.mask_desc_) {}
+
+    // Reads the probability, the seed, the offset and the mask from the
+    // execution context.
+    status_t init(const exec_ctx_t &ctx);
+
+    bool enabled() const { return !dropout_.has_default_values(); }
+
+    // Returns the value of the element with a logical offset @p l_offset in
+    // the destination after dropout and writes the mask for it.
+    float compute_scalar(float val, dim_t l_offset) const {
+        const bool keep = !drop_all_
+                && math::dropout_bits(l_offset + offset_, mixed_seed_)
+                        >= threshold_;
+        if (mask_) mask_[mask_d_.off_l(l_offset)] = keep;
+        return keep ? val * scale_ : 0.f;
+    }
+
+    // The mask, if any, must have the dimensions of the destination.
+    static bool attr_ok(const dropout_t &dropout, const memory_desc_t *dst_md);
+
+private:
+    const dropout_t &dropout_;
+    const memory_desc_wrapper mask_d_;
+
+    uint8_t *mask_ = nullptr;
+    uint32_t mixed_seed_ = 0;
+    uint32_t threshold_ = 0;
+    dim_t offset_ = 0;
+    float scale_ = 1.f;
+    bool drop_all_ = false;
+};
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -21,6 +21,7 @@
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_eltwise.hpp"
 #include "cpu/simple_q10n.hpp"
 
@@ -101,6 +102,11 @@ status_t ref_eltwise_fwd_t<data_type>::execute_forward_generic(
     const float beta = pd()->desc()->beta;
     const int ndims = pd()->ndims();
 
+    DEFINE_ROUNDING_SEED_VALUE(rnd_seed);
+    const bool dst_stochastic = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST)
+            == rounding_mode::stochastic;
+    const uint32_t rnd_mixed_seed = math::hash_u32(rnd_seed);
+
     parallel_nd(
             MB, C, D, H, W, [&](dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) {
                 auto data_p_off = DATA_OFF(src_d, n, c, d, h, w);
@@ -114,6 +120,11 @@ status_t ref_eltwise_fwd_t<data_type>::execute_forward_generic(
                 args.dst_md = pd()->dst_md();
                 ref_post_ops->execute(res, args);
 
+                if (dst_stochastic)
+                    res = math::stochastic_round_fwd(res,
+                            math::stochastic_rounding_bits(
+                                    data_p_off, rnd_mixed_seed),
+                            data_type);
                 dst[data_p_off] = cpu::saturate_and_round<data_t>(res);
             });
     return status::success;
@@ -179,6 +190,12 @@ status_t ref_eltwise_bwd_t<data_type>::execute_backward_generic(
     const float beta = pd()->desc()->beta;
     const int ndims = pd()->ndims();
 
+    DEFINE_ROUNDING_SEED_VALUE(rnd_seed);
+    const bool diff_src_stochastic
+            = pd()->attr()->rounding_mode_.get(DNNL_ARG_DIFF_SRC)
+            == rounding_mode::stochastic;
+    const uint32_t rnd_mixed_seed = math::hash_u32(rnd_seed);
+
     parallel_nd(
             MB, C, D, H, W, [&](dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) {
                 auto data_off = DATA_OFF(data_d, n, c, d, h, w);
@@ -186,7 +203,14 @@ status_t ref_eltwise_bwd_t<data_type>::execute_backward_generic(
                 data_t s = src[data_off];
                 data_t dd = diff_dst[diff_data_off];
                 data_t &ds = diff_src[diff_data_off];
-                ds = compute_eltwise_scalar_bwd(alg_kind, dd, s, alpha, beta);
+                float res = compute_eltwise_scalar_bwd(
+                        alg_kind, dd, s, alpha, beta);
+                if (diff_src_stochastic)
+                    res = math::stochastic_round_fwd(res,
+                            math::stochastic_rounding_bits(
+                                    diff_data_off, rnd_mixed_seed),
+                            data_type);
+                ds = res;
             });
     return status::success;
 }
@@ -51,7 +51,11 @@ struct ref_eltwise_fwd_t : public primitive_t {
                     && utils::everyone_is(
                             data_type, src_md()->data_type, dst_md()->data_type)
                     && platform::has_data_type_support(data_type)
-                    && attr()->has_default_values(sm::post_ops)
+                    && attr()->has_default_values(
+                            sm::post_ops | sm::rounding_mode)
+                    && IMPLICATION(attr()->rounding_mode_.get(DNNL_ARG_DST)
+                                    == rounding_mode::stochastic,
+                            one_of(data_type, data_type::bf16, data_type::f16))
                     && ref_post_ops_t::primitive_kind_ok(attr()->post_ops_)
                     && set_default_formats_common() && src_d == dst_d
                     && attr_.set_default_formats(dst_md(0)) == status::success;
@@ -68,7 +72,10 @@ struct ref_eltwise_fwd_t : public primitive_t {
                     && src_d.only_padded_dim(1) && src_d.is_dense(true);
 
             const auto &po = attr()->post_ops_;
-            if (has_zero_dim_memory() || !po.has_default_values())
+            // Stochastic rounding is applied by the generic implementation
+            // only, random bits depend on the physical offset of an element.
+            if (has_zero_dim_memory() || !po.has_default_values()
+                    || !attr()->rounding_mode_.has_default_values())
                 use_dense_ = use_nCspBc_padded_ = false;
 
             return status::success;
@@ -115,6 +122,7 @@ struct ref_eltwise_bwd_t : public primitive_t {
         status_t init(engine_t *engine) {
             using namespace utils;
             using namespace data_type;
+            using sm = primitive_attr_t::skip_mask_t;
 
             const memory_desc_wrapper diff_src_d(diff_src_md());
             const memory_desc_wrapper diff_dst_d(diff_dst_md());
@@ -123,14 +131,20 @@ struct ref_eltwise_bwd_t : public primitive_t {
                     && utils::everyone_is(data_type, data_md()->data_type,
                             diff_src_md()->data_type, diff_dst_md()->data_type)
                     && platform::has_data_type_support(data_type)
-                    && attr()->has_default_values()
+                    && attr()->has_default_values(sm::rounding_mode)
+                    && IMPLICATION(
+                            attr()->rounding_mode_.get(DNNL_ARG_DIFF_SRC)
+                                    == rounding_mode::stochastic,
+                            one_of(data_type, bf16, f16))
                     && set_default_formats_common() && diff_dst_d == diff_src_d;
             if (!ok) return status::unimplemented;
 
             use_dense_ = diff_dst_d.is_dense()
                     || (diff_dst_d.is_dense(true) && is_zero_preserved());
 
-            if (has_zero_dim_memory()) use_dense_ = false;
+            if (has_zero_dim_memory()
+                    || !attr()->rounding_mode_.has_default_values())
+                use_dense_ = false;
             if (diff_dst_d != memory_desc_wrapper(data_md()))
                 use_dense_ = false;
 
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_embedding_bag.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    using namespace alg_kind;
+
+    if (pd()->n_bags() == 0 || pd()->emb_dim() == 0) return status::success;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_INDICES);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    const bool per_row_scales = pd()->with_scales()
+            && pd()->attr()->scales_.get(DNNL_ARG_SRC).mask_ != 0;
+
+    CHECK(pd()->check_bags(indices, offsets));
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
+
+    const alg_kind_t alg = pd()->desc()->alg_kind;
+    const dim_t n_bags = pd()->n_bags();
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t D = pd()->emb_dim();
+
+    parallel_nd(n_bags, D, [&](dim_t b, dim_t d) {
+        dim_t start = 0, end = 0;
+        pd_t::bag_bounds(offsets, n_bags, n_indices, b, start, end);
+
+        float acc = alg == embedding_bag_max ? -FLT_MAX : 0.f;
+        for (dim_t i = start; i < end; i++) {
+            const dim_t idx = indices[i];
+            float s = io::load_float_value(src_dt, src, src_d.off(idx, d));
+            s *= src_scales[per_row_scales ? idx : 0];
+            if (weights) s *= weights[i];
+            acc = alg == embedding_bag_max ? nstl::max(acc, s) : acc + s;
+        }
+
+        if (start == end)
+            acc = 0.f;
+        else if (alg == embedding_bag_mean)
+            acc /= (end - start);
+
+        io::store_float_value(dst_dt, acc, dst, dst_d.off(b, d));
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -169,13 +169,33 @@ status_t ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
         d /= num_summands;
     };
 
+    auto ker_avg_adaptive = [=](float &d, dim_t mb, dim_t oc, dim_t od,
+                                    dim_t oh, dim_t ow) {
+        const dim_t id_start = pooling_pd_t::adaptive_start(od, ID, OD);
+        const dim_t id_end = pooling_pd_t::adaptive_end(od, ID, OD);
+        const dim_t ih_start = pooling_pd_t::adaptive_start(oh, IH, OH);
+        const dim_t ih_end = pooling_pd_t::adaptive_end(oh, IH, OH);
+        const dim_t iw_start = pooling_pd_t::adaptive_start(ow, IW, OW);
+        const dim_t iw_end = pooling_pd_t::adaptive_end(ow, IW, OW);
+
+        for_(dim_t id = id_start; id < id_end; ++id)
+        for_(dim_t ih = ih_start; ih < ih_end; ++ih)
+        for (dim_t iw = iw_start; iw < iw_end; ++iw) {
+            const auto off = get_offset(src_d, mb, oc, id, ih, iw);
+            d += src[off];
+        }
+        d /= (id_end - id_start) * (ih_end - ih_start) * (iw_end - iw_start);
+    };
+
     const bool is_max_pool = alg == alg_kind::pooling_max;
 
     float base_res
             = is_max_pool ? (float)numeric_limits<data_t>::lowest() : 0.f;
     using ker_t
             = std::function<void(float &, dim_t, dim_t, dim_t, dim_t, dim_t)>;
-    ker_t kernel = is_max_pool ? (ker_t)ker_max : (ker_t)ker_avg;
+    ker_t kernel = is_max_pool ? (ker_t)ker_max
+            : alg == alg_kind::pooling_avg_adaptive ? (ker_t)ker_avg_adaptive
+                                                    : (ker_t)ker_avg;
 
     parallel_nd(MB, OC, OD, OH, OW,
             [&](dim_t mb, dim_t oc, dim_t od, dim_t oh, dim_t ow) {
@@ -318,21 +338,54 @@ status_t ref_pooling_bwd_t::execute(const exec_ctx_t &ctx) const {
         }
     };
 
-    dim_t ow_start
-            = max(dim_t(0), utils::div_up(padL - ((KW - 1) * DW + KW) + 1, SW));
-    dim_t ow_end = min(OW, 1 + (padL + IW - 1) / SW);
+    auto ker_avg_adaptive = [=](dim_t mb, dim_t oc, dim_t od, dim_t oh,
+                                    dim_t ow) {
+        const dim_t id_start = pooling_pd_t::adaptive_start(od, ID, OD);
+        const dim_t id_end = pooling_pd_t::adaptive_end(od, ID, OD);
+        const dim_t ih_start = pooling_pd_t::adaptive_start(oh, IH, OH);
+        const dim_t ih_end = pooling_pd_t::adaptive_end(oh, IH, OH);
+        const dim_t iw_start = pooling_pd_t::adaptive_start(ow, IW, OW);
+        const dim_t iw_end = pooling_pd_t::adaptive_end(ow, IW, OW);
+        const dim_t num_summands = (id_end - id_start)
+                * (ih_end - ih_start) * (iw_end - iw_start);
 
-    dim_t oh_start
-            = max(dim_t(0), utils::div_up(padT - ((KH - 1) * DH + KH) + 1, SH));
-    dim_t oh_end = min(OH, 1 + (padT + IH - 1) / SH);
+        const auto diff_dst_off = get_offset(diff_dst_d, mb, oc, od, oh, ow);
+        const float dd = io::load_float_value(
+                diff_dst_d.data_type(), diff_dst, diff_dst_off);
+        for_(dim_t id = id_start; id < id_end; ++id)
+        for_(dim_t ih = ih_start; ih < ih_end; ++ih)
+        for (dim_t iw = iw_start; iw < iw_end; ++iw) {
+            const auto diff_src_off
+                    = get_offset(diff_src_d, mb, oc, id, ih, iw);
+            const float ds = io::load_float_value(
+                    data_type::f32, diff_src, diff_src_off);
+            io::store_float_value(data_type::f32,
+                    ds + (dd / num_summands), diff_src, diff_src_off);
+        }
+    };
 
-    dim_t od_start
-            = max(dim_t(0), utils::div_up(padF - ((KD - 1) * DD + KD) + 1, SD));
-    dim_t od_end = min(OD, 1 + (padF + ID - 1) / SD);
+    // Every point of the destination contributes to the adaptive pooling.
+    dim_t ow_start = 0, ow_end = OW;
+    dim_t oh_start = 0, oh_end = OH;
+    dim_t od_start = 0, od_end = OD;
+    if (alg != alg_kind::pooling_avg_adaptive) {
+        ow_start = max(
+                dim_t(0), utils::div_up(padL - ((KW - 1) * DW + KW) + 1, SW));
+        ow_end = min(OW, 1 + (padL + IW - 1) / SW);
+
+        oh_start = max(
+                dim_t(0), utils::div_up(padT - ((KH - 1) * DH + KH) + 1, SH));
+        oh_end = min(OH, 1 + (padT + IH - 1) / SH);
+
+        od_start = max(
+                dim_t(0), utils::div_up(padF - ((KD - 1) * DD + KD) + 1, SD));
+        od_end = min(OD, 1 + (padF + ID - 1) / SD);
+    }
 
     using ker_t = std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)>;
-    ker_t kernel
-            = alg == alg_kind::pooling_max ? (ker_t)ker_max : (ker_t)ker_avg;
+    ker_t kernel = alg == alg_kind::pooling_max ? (ker_t)ker_max
+            : alg == alg_kind::pooling_avg_adaptive ? (ker_t)ker_avg_adaptive
+                                                    : (ker_t)ker_avg;
 
     const int nthr = pd()->nthr_;
     parallel(nthr, [&](const int ithr, const int nthr) {
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_rope.hpp"
+#include "cpu/rope_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_rope_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto cos = CTX_IN_MEM(const float *, DNNL_ARG_ROPE_COS);
+    auto sin = CTX_IN_MEM(const float *, DNNL_ARG_ROPE_SIN);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    CHECK(pd()->check_offsets(offsets));
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper cos_sin_d(&pd()->desc()->cos_sin_desc);
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
+
+    const alg_kind_t alg = pd()->desc()->alg_kind;
+    const float base = pd()->desc()->base;
+    const bool with_cos_sin = pd()->with_cos_sin();
+    const int ndims = pd()->ndims();
+    const dim_t D = pd()->D();
+    const dim_t rd = pd()->rotary_dim();
+
+    const auto off = [&](const memory_desc_wrapper &md, dim_t mb, dim_t h,
+                             dim_t s, dim_t d) {
+        return ndims == 4 ? md.off(mb, h, s, d) : md.off(mb, s, d);
+    };
+
+    parallel_nd(pd()->MB(), pd()->H(), pd()->S(),
+            [&](dim_t mb, dim_t h, dim_t s) {
+                const dim_t pos = s + (offsets ? offsets[mb] : 0);
+                for (dim_t i = 0; i < rd / 2; i++) {
+                    float c = 0.f, sn = 0.f;
+                    if (with_cos_sin) {
+                        const dim_t cs_off = cos_sin_d.off(pos, i);
+                        c = cos[cs_off];
+                        sn = sin[cs_off];
+                    } else {
+                        const float angle
+                                = pos * rope_utils::inv_freq(i, rd, base);
+                        c = cosf(angle);
+                        sn = sinf(angle);
+                    }
+                    dim_t i0 = 0, i1 = 0;
+                    rope_utils::pair_idx(alg, i, rd, i0, i1);
+                    const float x0 = io::load_float_value(
+                            src_dt, src, off(src_d, mb, h, s, i0));
+                    const float x1 = io::load_float_value(
+                            src_dt, src, off(src_d, mb, h, s, i1));
+                    io::store_float_value(dst_dt, x0 * c - x1 * sn, dst,
+                            off(dst_d, mb, h, s, i0));
+                    io::store_float_value(dst_dt, x0 * sn + x1 * c, dst,
+                            off(dst_d, mb, h, s, i1));
+                }
+                for (dim_t d = rd; d < D; d++) {
+                    const float x = io::load_float_value(
+                            src_dt, src, off(src_d, mb, h, s, d));
+                    io::store_float_value(
+                            dst_dt, x, dst, off(dst_d, mb, h, s, d));
+                }
+            });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -198,6 +198,10 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
+    ref_dropout_t dropout(pd()->attr()->dropout_);
+    CHECK(dropout.init(ctx));
+    const bool with_dropout = dropout.enabled();
+
     float *scratchpad_int8 = ctx.get_scratchpad_grantor().template get<float>(
             key_softmax_interim_store);
 
@@ -289,11 +293,13 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
                     d -= sd;
                 }
                 d *= src_scales[0];
+                const dim_t l_offset = ou_in_offset + c * inner_size_;
+                if (with_dropout) d = dropout.compute_scalar(d, l_offset);
 
                 // post-ops
                 ref_post_ops_t::args_t args;
                 args.ctx = &ctx;
-                args.l_offset = ou_in_offset + c * inner_size_;
+                args.l_offset = l_offset;
                 args.dst_md = pd()->dst_md();
                 ref_post_ops->execute(d, args);
                 d *= dst_scales[0];
@@ -59,14 +59,15 @@ struct ref_softmax_fwd_t : public primitive_t {
 
             VCHECK_SOFTMAX(
                     attr()->has_default_values(skip_mask_t::scales_runtime
-                            | skip_mask_t::post_ops),
+                            | skip_mask_t::post_ops | skip_mask_t::dropout),
                     VERBOSE_UNSUPPORTED_ATTR);
             VCHECK_SOFTMAX(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
             VCHECK_SOFTMAX(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
 #undef VCHECK_SOFTMAX
 
             ok = set_default_formats() == status::success
-                    && attr_.set_default_formats(dst_md(0)) == status::success;
+                    && attr_.set_default_formats(dst_md(0)) == status::success
+                    && ref_dropout_t::attr_ok(attr()->dropout_, dst_md(0));
             if (!ok) return status::unimplemented;
 
             nthr_ = 0;
@@ -125,7 +126,10 @@ struct ref_softmax_fwd_t : public primitive_t {
 
         use_dense_ = inner_size_ == 1 && src_d == dst_d && src_d.is_dense(true)
                 && src_d.only_padded_dim(axis)
-                && bd.strides[axis] == axis_blk_size;
+                && bd.strides[axis] == axis_blk_size
+                // Dropout random numbers depend on logical offsets which are
+                // computed by the generic implementation only.
+                && pd()->attr()->dropout_.has_default_values();
 
         ref_post_ops
                 = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
@@ -17,9 +17,11 @@
 #ifndef CPU_REF_SUM_HPP
 #define CPU_REF_SUM_HPP
 
+#include "common/eltwise_pd.hpp"
 #include "common/engine.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/primitive.hpp"
+#include "common/primitive_desc_iterator.hpp"
 #include "common/reorder.hpp"
 #include "common/reorder_pd.hpp"
 
@@ -38,7 +40,10 @@ struct ref_sum_t : public primitive_t {
         DECLARE_SUM_PD_T("ref:any", ref_sum_t);
 
         status_t init(engine_t *engine) {
-            bool ok = cpu_sum_pd_t::init(engine) == status::success;
+            using sm = primitive_attr_t::skip_mask_t;
+            bool ok = cpu_sum_pd_t::init(engine, sm::post_ops)
+                            == status::success
+                    && post_ops_ok();
             if (!ok) return status::unimplemented;
 
             if (has_zero_dim_memory()) return status::success;
@@ -57,13 +62,40 @@ struct ref_sum_t : public primitive_t {
                         reorder_pds_[n_], engine, dst_acc_md(), dst_md()));
             }
 
+            CHECK(init_eltwise_pds(engine));
             init_scratchpad();
             return status::success;
         }
 
         std::vector<std::shared_ptr<primitive_desc_t>> reorder_pds_;
+        // Eltwise post-ops are applied in place to the f32 accumulator, i.e.
+        // before the conversion to the destination data type.
+        std::vector<std::shared_ptr<primitive_desc_t>> eltwise_pds_;
 
     private:
+        bool post_ops_ok() const {
+            for (const auto &e : attr()->post_ops_.entry_)
+                if (!e.is_eltwise() || e.eltwise.scale != 1.f) return false;
+            return true;
+        }
+
+        status_t init_eltwise_pds(engine_t *engine) {
+            for (const auto &e : attr()->post_ops_.entry_) {
+                eltwise_desc_t ed;
+                CHECK(eltwise_desc_init(&ed, prop_kind::forward_inference,
+                        e.eltwise.alg, dst_acc_md(), dst_acc_md(), nullptr,
+                        nullptr, e.eltwise.alpha, e.eltwise.beta));
+
+                primitive_desc_iterator_t it(
+                        engine, (op_desc_t *)&ed, &default_attr(), nullptr);
+                if (!it.is_initialized()) return status::out_of_memory;
+                std::shared_ptr<primitive_desc_t> pd = *(++it);
+                if (!pd) return status::unimplemented;
+                eltwise_pds_.push_back(pd);
+            }
+            return status::success;
+        }
+
         void init_scratchpad() {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
@@ -77,6 +109,12 @@ struct ref_sum_t : public primitive_t {
                 scratchpad.book(key_nested_multiple + (int)i,
                         reorder_pds_[i]->scratchpad_registry());
             }
+            const int eltwise_key
+                    = key_nested_multiple + (int)reorder_pds_.size();
+            for (size_t i = 0; i < eltwise_pds_.size(); i++) {
+                scratchpad.book(eltwise_key + (int)i,
+                        eltwise_pds_[i]->scratchpad_registry());
+            }
         };
     };
 
@@ -88,6 +126,12 @@ struct ref_sum_t : public primitive_t {
         for (size_t i = 0; i < n; ++i)
             pd()->reorder_pds_[i]->create_primitive(reorders_[i], engine);
 
+        const size_t n_eltwise = pd()->eltwise_pds_.size();
+        eltwises_.resize(n_eltwise);
+        for (size_t i = 0; i < n_eltwise; ++i)
+            CHECK(pd()->eltwise_pds_[i]->create_primitive(
+                    eltwises_[i], engine));
+
         memory_desc_t scales_md;
         scales_md.ndims = 1;
         scales_md.dims[0] = 1;
@@ -139,6 +183,20 @@ struct ref_sum_t : public primitive_t {
             reorders_[i]->execute(r_ctx);
         }
 
+        const int eltwise_key = key_nested_multiple + (int)reorders_.size();
+        for (size_t i = 0; i < eltwises_.size(); ++i) {
+            exec_args_t e_args;
+            e_args[DNNL_ARG_SRC] = pd()->need_output_reorder()
+                    ? memory_arg_t {&acc, true}
+                    : memory_arg_t {dst.mem, true};
+            e_args[DNNL_ARG_DST] = pd()->need_output_reorder() ? dst_acc : dst;
+            exec_ctx_t e_ctx(ctx, std::move(e_args));
+
+            nested_scratchpad_t ns(ctx, eltwise_key + (int)i, eltwises_[i]);
+            e_ctx.set_scratchpad_grantor(ns.grantor());
+            CHECK(eltwises_[i]->execute(e_ctx));
+        }
+
         if (pd()->need_output_reorder()) {
             dst_acc = {&acc, true};
             r_args[DNNL_ARG_SRC] = dst_acc;
@@ -155,6 +213,7 @@ struct ref_sum_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::vector<std::shared_ptr<primitive_t>> reorders_;
+    std::vector<std::shared_ptr<primitive_t>> eltwises_;
     std::vector<std::shared_ptr<memory_t>> scales_mem_;
 };
 
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_topk.hpp"
+#include "cpu/topk_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace topk_utils;
+
+void ref_topk_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<entry_t>(
+            key_topk_cand, axis_size() * dnnl_get_max_threads());
+}
+
+status_t ref_topk_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_INDICES, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper indices_d(pd()->indices_md());
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
+
+    const int axis = pd()->axis();
+    const dim_t K = pd()->K();
+    const dim_t L = pd()->axis_size();
+    const dim_t inner = pd()->inner_size();
+    const dim_t rows = pd()->outer_size() * inner;
+    const precedes_t precedes(pd()->select_max());
+
+    auto entries_base = ctx.get_scratchpad_grantor().template get<entry_t>(
+            memory_tracking::names::key_topk_cand);
+
+    const int nthr = dnnl_get_max_threads();
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(rows, nthr, ithr, start, end);
+        entry_t *entries = entries_base + ithr * L;
+
+        for (dim_t r = start; r < end; r++) {
+            dims_t pos;
+            pd()->row_pos(r / inner, r % inner, pos);
+
+            for (dim_t l = 0; l < L; l++) {
+                pos[axis] = l;
+                const float s = io::load_float_value(
+                        src_dt, src, src_d.off_v(pos));
+                entries[l] = {s, static_cast<int32_t>(l)};
+            }
+
+            std::partial_sort(entries, entries + K, entries + L, precedes);
+
+            for (dim_t k = 0; k < K; k++) {
+                pos[axis] = k;
+                io::store_float_value(
+                        dst_dt, entries[k].value, dst, dst_d.off_v(pos));
+                indices[indices_d.off_v(pos)] = entries[k].index;
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_ROPE_UTILS_HPP
+#define CPU_ROPE_UTILS_HPP
+
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rope_utils {
+
+// Rotation frequency of the pair `i` of a head.
+inline float inv_freq(dim_t i, dim_t rotary_dim, float base) {
+    return powf(base, -2.f * i / rotary_dim);
+}
+
+// Returns the indices of the two elements of the pair `i` of a head.
+inline void pair_idx(
+        alg_kind_t alg, dim_t i, dim_t rotary_dim, dim_t &i0, dim_t &i1) {
+    if (alg == alg_kind::rope_interleaved) {
+        i0 = 2 * i;
+        i1 = 2 * i + 1;
+    } else {
+        i0 = i;
+        i1 = i + rotary_dim / 2;
+    }
+}
+
+// Fills `rotary_dim / 2` cosines and sines of the angles of a position.
+inline void compute_cos_sin(
+        float *cos, float *sin, dim_t pos, dim_t rotary_dim, float base) {
+    for (dim_t i = 0; i < rotary_dim / 2; i++) {
+        const float angle = pos * inv_freq(i, rotary_dim, base);
+        cos[i] = cosf(angle);
+        sin[i] = sinf(angle);
+    }
+}
+
+// Rotates the first `rotary_dim` elements of a contiguous head in place.
+inline void rotate(float *x, const float *cos, const float *sin,
+        dim_t rotary_dim, alg_kind_t alg) {
+    const dim_t half = rotary_dim / 2;
+    if (alg == alg_kind::rope_interleaved) {
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < half; i++) {
+            const float x0 = x[2 * i];
+            const float x1 = x[2 * i + 1];
+            x[2 * i] = x0 * cos[i] - x1 * sin[i];
+            x[2 * i + 1] = x0 * sin[i] + x1 * cos[i];
+        }
+    } else {
+        float *x_hi = x + half;
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < half; i++) {
+            const float x0 = x[i];
+            const float x1 = x_hi[i];
+            x[i] = x0 * cos[i] - x1 * sin[i];
+            x_hi[i] = x0 * sin[i] + x1 * cos[i];
+        }
+    }
+}
+
+// A rope post-op is supported as the last post-op only: the rotation mixes
+// elements of a head, so the other post-ops are applied before it.
+inline int po_idx(const post_ops_t &po) {
+    const int idx = po.find(primitive_kind::rope);
+    return idx == po.len() - 1 ? idx : -1;
+}
+
+} // namespace rope_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2022 Intel Corporation
+* Copyright 2017-2023 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -40,9 +40,20 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
     auto o_base_ptr = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
     if (o_base_ptr == nullptr) return status::success;
 
+    const memory_desc_wrapper o_d(pd()->dst_md(0));
+
+    strides_t os = {0};
+    bool has_outer_loop = false;
+    for (int i = 0; i < perm[concat_dim]; i++) {
+        os[i] = o_d.blocking_desc().strides[iperm[i]];
+        // CAVEAT: if this impl supports not matching stag and dtag, strides
+        // should be taken into account for this condition.
+        if (o_d.padded_dims()[iperm[i]] != 1) has_outer_loop = true;
+    }
+
     for (int a = 0; a < num_arrs; ++a) {
         const memory_desc_wrapper i_d(pd()->src_md(a));
-        const memory_desc_wrapper o_d(pd()->src_image_md(a));
+        const memory_desc_wrapper i_image_d(pd()->src_image_md(a));
         const auto iptr = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a);
         if (iptr == nullptr) {
             iptrs[a] = nullptr;
@@ -50,25 +61,23 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
             continue;
         }
         iptrs[a] = iptr + i_d.blk_off(0);
-        optrs[a] = o_base_ptr + o_d.blk_off(0);
+        optrs[a] = o_base_ptr + i_image_d.blk_off(0);
         nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
+        bool is_inplace = iptrs[a] == optrs[a];
         for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
-            if (i < perm[concat_dim])
+            if (i < perm[concat_dim]) {
                 is[a][i] = size_t(i_d.blocking_desc().strides[iperm[i]]);
-            else
+                is_inplace = is_inplace && is[a][i] == os[i];
+            } else
                 is[a][i] = 0;
         }
-    }
-
-    const memory_desc_wrapper o_d(pd()->dst_md(0));
-
-    strides_t os = {0};
-    bool has_outer_loop = false;
-    for (int i = 0; i < perm[concat_dim]; i++) {
-        os[i] = o_d.blocking_desc().strides[iperm[i]];
-        // CAVEAT: if this impl supports not matching stag and dtag, strides
-        // should be taken into account for this condition.
-        if (o_d.padded_dims()[iperm[i]] != 1) has_outer_loop = true;
+        // The producer has already written the input into its slice of the
+        // destination (the input memory is a sub-memory view of dst), so
+        // there is nothing to copy.
+        if (is_inplace) {
+            iptrs[a] = nullptr;
+            nelems_to_copy[a] = 0;
+        }
     }
 
     // Applies when concat axis is the outermost dimension, e.g. concat_axis = 0
@@ -222,6 +222,7 @@ status_t simple_layer_normalization_bwd_t::pd_t::init(engine_t *engine) {
     }
 
     nthr_ = dnnl_get_max_threads();
+    nchunks_ = diff_ss_nchunks(nthr_);
     init_scratchpad();
     return status::success;
 }
@@ -271,6 +272,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
     }
 
     const int max_nthr = pd()->nthr_;
+    const dim_t nchunks = pd()->nchunks_;
 
     const auto src_dt = pd()->src_md()->data_type;
     const auto diff_dst_dt = pd()->diff_dst_md()->data_type;
@@ -278,9 +280,10 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
     const auto eps = pd()->desc()->layer_norm_epsilon;
     const auto calculate_diff_stats = !pd()->stats_are_src();
 
-    parallel(max_nthr, [&](int ithr, int nthr) {
+    // Every chunk of rows has its own partial sums, see diff_ss_nchunks().
+    parallel_nd(nchunks, [&](dim_t ichunk) {
         dim_t N_start = 0, N_end = 0;
-        balance211(N, nthr, ithr, N_start, N_end);
+        balance211(N, nchunks, ichunk, N_start, N_end);
         const size_t block_size = N_end - N_start;
         const char *const __restrict src_ptr
                 = reinterpret_cast<const char *>(src)
@@ -292,8 +295,8 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
         const float *var_ptr = &variance[N_start];
         float *const inv_sqrtvar_ptr = &inv_sqrtvar[N_start];
 
-        float *my_diff_gamma = reduce + C * ithr;
-        float *my_diff_beta = reduce + C * nthr + C * ithr;
+        float *my_diff_gamma = reduce + C * ichunk;
+        float *my_diff_beta = reduce + C * nchunks + C * ichunk;
 
         PRAGMA_OMP_SIMD()
         for (dim_t c = 0; c < C; c++) {
@@ -318,9 +321,9 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
 
     parallel_nd(C, [&](dim_t c) {
         float diff_gamma = 0, diff_beta = 0;
-        for (dim_t n = 0; n < max_nthr; n++) {
+        for (dim_t n = 0; n < nchunks; n++) {
             diff_gamma += reduce[C * n + c];
-            diff_beta += reduce[C * max_nthr + C * n + c];
+            diff_beta += reduce[C * nchunks + C * n + c];
         }
         diff_scale[c] = diff_gamma;
         diff_shift[c] = diff_beta;
@@ -0,0 +1,473 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/dw_convolution_utils.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/streaming_fused_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t streaming_fused_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto &po = attr()->post_ops_;
+    dw_idx_ = po.find(primitive_kind::convolution);
+    pw_idx_ = po.find(primitive_kind::inner_product);
+
+    const bool ok = dw_idx_ != -1 && pw_idx_ > dw_idx_ && is_fwd()
+            && ndims() == 4 && !with_groups()
+            && !memory_desc_wrapper(src_md_).has_zero_dim()
+            && !memory_desc_wrapper(dst_md_).has_zero_dim()
+            && everyone_is(1, KH(), KW(), KSH(), KSW())
+            && everyone_is(0, KDH(), KDW(), padT(), padB(), padL(), padR())
+            && attr()->has_default_values(
+                    smask_t::scales_runtime | smask_t::post_ops)
+            && post_ops_ok() && scales_ok()
+            && set_default_formats_common(nhwc, any, nhwc)
+            && memory_desc_matches_tag(src_md_, nhwc)
+            && memory_desc_matches_tag(dst_md_, nhwc);
+    if (!ok) return unimplemented;
+
+    const auto &dw = po.entry_[dw_idx_].depthwise_conv;
+    const auto &pw = po.entry_[pw_idx_].pointwise_conv;
+    oc_ = dst_md_.dims[1];
+    ih_ = dst_md_.dims[2];
+    iw_ = dst_md_.dims[3];
+    kh_ = dw.kernel;
+    stride_ = dw.stride;
+    t_pad_ = dw.padding;
+    oh_ = utils::div_up(ih_, stride_);
+    ow_ = utils::div_up(iw_, stride_);
+
+    const dims_t fused_dst_dims = {MB(), pw.oc, oh_, ow_};
+    CHECK(memory_desc_init_by_tag(
+            fused_dst_md_, 4, fused_dst_dims, pw.dst_dt, nhwc));
+
+    init_band_size();
+    CHECK(init_root_pds(engine));
+    CHECK(init_dw_pds(engine));
+    CHECK(init_pw_pds(engine));
+    init_args();
+    init_scratchpad();
+    init_name();
+
+    return success;
+}
+
+bool streaming_fused_convolution_fwd_t::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    if (po.find(primitive_kind::convolution, dw_idx_ + 1) != -1) return false;
+
+    for (int idx = 0; idx < po.len(); ++idx) {
+        const auto &e = po.entry_[idx];
+        if (one_of(idx, dw_idx_, pw_idx_) || e.is_eltwise()) continue;
+        // Accumulation makes sense only for the final destination, e.g. for
+        // the residual connection of the block.
+        if (e.is_sum(false, false) && idx > pw_idx_) continue;
+        return false;
+    }
+    return true;
+}
+
+bool streaming_fused_convolution_fwd_t::pd_t::scales_ok() const {
+    const int pw_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(pw_idx_);
+    return attr()->scales_.has_default_values({DNNL_ARG_SRC, DNNL_ARG_WEIGHTS,
+            DNNL_ARG_DST, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS,
+            DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST, pw_arg | DNNL_ARG_WEIGHTS,
+            pw_arg | DNNL_ARG_DST});
+}
+
+void streaming_fused_convolution_fwd_t::pd_t::init_band_size() {
+    const auto &po = attr()->post_ops_;
+    const size_t dw_dsz
+            = types::data_type_size(po.entry_[dw_idx_].depthwise_conv.dst_dt);
+    mid_row_size_ = iw_ * oc_ * types::data_type_size(dst_md_.data_type);
+    const size_t dw_row_size = ow_ * oc_ * dw_dsz;
+
+    // Every band is processed by all threads, so the intermediate buffers of
+    // a band are sized to fit in a half of the aggregate L2 cache.
+    const size_t budget = (size_t)platform::get_per_core_cache_size(2)
+            * dnnl_get_max_threads() / 2;
+    const size_t halo_size
+            = nstl::max<dim_t>(kh_ - stride_, 0) * mid_row_size_;
+    const size_t band_row_size = stride_ * mid_row_size_ + dw_row_size;
+    band_oh_ = budget > halo_size ? (budget - halo_size) / band_row_size : 1;
+    band_oh_ = nstl::max<dim_t>(1, nstl::min(band_oh_, oh_));
+
+    // Balance the bands so that the last one is not much shorter.
+    nb_bands_ = utils::div_up(oh_, band_oh_);
+    band_oh_ = utils::div_up(oh_, nb_bands_);
+
+    const dim_t max_ih_len = (band_oh_ - 1) * stride_ + kh_;
+    mid_buf_size_ = utils::rnd_up(max_ih_len * mid_row_size_, PAGE_4K);
+    dw_buf_size_ = band_oh_ * dw_row_size;
+}
+
+streaming_fused_convolution_fwd_t::pd_t::band_t
+streaming_fused_convolution_fwd_t::pd_t::band(dim_t b) const {
+    band_t bd;
+    bd.oh_start = b * band_oh_;
+    bd.oh_len = nstl::min(band_oh_, oh_ - bd.oh_start);
+    bd.ih_start = bd.oh_start * stride_ - t_pad_;
+    bd.ih_len = (bd.oh_len - 1) * stride_ + kh_;
+    bd.t_pad = nstl::max<dim_t>(0, -bd.ih_start);
+    bd.b_pad = nstl::max<dim_t>(0, bd.ih_start + bd.ih_len - ih_);
+    return bd;
+}
+
+status_t streaming_fused_convolution_fwd_t::pd_t::create_op_pd(
+        std::shared_ptr<primitive_desc_t> &pd, engine_t *engine,
+        const convolution_desc_t &cd, const primitive_attr_t &attr) {
+    primitive_desc_iterator_t it(engine, (op_desc_t *)&cd, &attr, nullptr);
+    if (!it.is_initialized()) return out_of_memory;
+    pd = *(++it);
+    if (!pd) return unimplemented;
+
+    user_scratchpad_size_ = nstl::max<size_t>(user_scratchpad_size_,
+            pd->scratchpad_size(attr.scratchpad_mode_));
+    return success;
+}
+
+status_t streaming_fused_convolution_fwd_t::pd_t::init_root_pds(
+        engine_t *engine) {
+    primitive_attr_t attr_1x1(*attr());
+    if (!attr_1x1.is_initialized()) return out_of_memory;
+
+    // Keep only the scales and the post-ops of the 1x1 convolution.
+    const int pw_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(pw_idx_);
+    for (int arg : {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS,
+                 DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST,
+                 pw_arg | DNNL_ARG_WEIGHTS, pw_arg | DNNL_ARG_DST})
+        CHECK(attr_1x1.scales_.reset(arg));
+    auto &e = attr_1x1.post_ops_.entry_;
+    e.erase(e.begin() + dw_idx_, e.end());
+
+    for (dim_t b = 0; b < nb_bands_; ++b) {
+        const auto bd = band(b);
+        const dim_t rows = bd.ih_len - bd.t_pad - bd.b_pad;
+        if (std::find(root_rows_.begin(), root_rows_.end(), rows)
+                != root_rows_.end())
+            continue;
+
+        convolution_desc_t cd = *desc();
+        const dims_t src_dims = {1, IC(), rows, iw_};
+        const dims_t dst_dims = {1, oc_, rows, iw_};
+        CHECK(memory_desc_init_by_tag(cd.src_desc, 4, src_dims,
+                src_md_.data_type, format_tag::nhwc));
+        CHECK(memory_desc_init_by_tag(cd.dst_desc, 4, dst_dims,
+                dst_md_.data_type, format_tag::nhwc));
+        // All the band primitives must share the weights layout.
+        if (!root_pds_.empty()) cd.weights_desc = *weights_md(0);
+
+        std::shared_ptr<primitive_desc_t> pd;
+        CHECK(create_op_pd(pd, engine, cd, attr_1x1));
+        root_pds_.push_back(pd);
+        root_rows_.push_back(rows);
+    }
+    return success;
+}
+
+status_t streaming_fused_convolution_fwd_t::pd_t::init_dw_pds(
+        engine_t *engine) {
+    convolution_desc_t cd_dw;
+    primitive_attr_t attr_dw;
+    CHECK(get_depthwise_conv_desc(cd_dw, dst_md_, *attr(), attr_dw, dw_idx_));
+    // Post-ops starting from the pointwise one belong to the last stage.
+    auto &e = attr_dw.post_ops_.entry_;
+    e.erase(e.begin() + (pw_idx_ - dw_idx_ - 1), e.end());
+
+    const auto &dw = attr()->post_ops_.entry_[dw_idx_].depthwise_conv;
+    const dim_t pad_r = (ow_ - 1) * stride_ - iw_ + kh_ - t_pad_;
+    const dims_t strides = {stride_, stride_};
+    const dims_t padding_l = {0, t_pad_};
+    const dims_t padding_r = {0, pad_r};
+
+    // The full band and the last one, if it is shorter.
+    for (dim_t b : {(dim_t)0, nb_bands_ - 1}) {
+        const auto bd = band(b);
+        if (!dw_pds_.empty() && bd.oh_len == band_oh_) break;
+
+        memory_desc_t src_md, weights_md, dst_md;
+        const dims_t src_dims = {1, oc_, bd.ih_len, iw_};
+        const dims_t dst_dims = {1, oc_, bd.oh_len, ow_};
+        CHECK(memory_desc_init_by_tag(
+                src_md, 4, src_dims, dst_md_.data_type, format_tag::nhwc));
+        CHECK(memory_desc_init_by_tag(
+                dst_md, 4, dst_dims, dw.dst_dt, format_tag::nhwc));
+        weights_md = dw_pds_.empty() ? cd_dw.weights_desc
+                                     : *dw_pds_.front()->weights_md(0);
+
+        convolution_desc_t cd;
+        CHECK(conv_desc_init(&cd, prop_kind::forward_inference,
+                alg_kind::convolution_auto, &src_md, &weights_md,
+                dw.bias_dt != data_type::undef ? &cd_dw.bias_desc : nullptr,
+                &dst_md, strides, nullptr, padding_l, padding_r));
+
+        std::shared_ptr<primitive_desc_t> pd;
+        CHECK(create_op_pd(pd, engine, cd, attr_dw));
+        dw_pds_.push_back(pd);
+    }
+    return success;
+}
+
+status_t streaming_fused_convolution_fwd_t::pd_t::init_pw_pds(
+        engine_t *engine) {
+    const auto &po = attr()->post_ops_;
+    const auto &dw = po.entry_[dw_idx_].depthwise_conv;
+    const auto &pw = po.entry_[pw_idx_].pointwise_conv;
+    const int pw_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(pw_idx_);
+
+    // The pointwise convolution reads the depthwise output, so its src scales
+    // are the depthwise dst ones.
+    primitive_attr_t attr_pw;
+    attr_pw.scratchpad_mode_ = attr()->scratchpad_mode_;
+    const std::pair<int, int> scale_args[]
+            = {{DNNL_ARG_SRC, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST},
+                    {DNNL_ARG_WEIGHTS, pw_arg | DNNL_ARG_WEIGHTS},
+                    {DNNL_ARG_DST, pw_arg | DNNL_ARG_DST}};
+    for (const auto &a : scale_args) {
+        const auto &s = attr()->scales_.get(a.second);
+        if (!s.has_default_values())
+            CHECK(attr_pw.scales_.set(a.first, s.mask_));
+    }
+    for (int idx = pw_idx_ + 1; idx < po.len(); ++idx) {
+        attr_pw.post_ops_.entry_.emplace_back();
+        attr_pw.post_ops_.entry_.back().copy_from(po.entry_[idx]);
+    }
+
+    const dims_t weights_dims = {pw.oc, oc_, 1, 1};
+    const dims_t bias_dims = {pw.oc};
+    const dims_t strides = {1, 1};
+    const dims_t padding = {0, 0};
+    memory_desc_t bias_md;
+    if (pw.bias_dt != data_type::undef)
+        CHECK(memory_desc_init_by_tag(
+                bias_md, 1, bias_dims, pw.bias_dt, format_tag::a));
+
+    for (dim_t b : {(dim_t)0, nb_bands_ - 1}) {
+        const auto bd = band(b);
+        if (!pw_pds_.empty() && bd.oh_len == band_oh_) break;
+
+        memory_desc_t src_md, weights_md, dst_md;
+        const dims_t src_dims = {1, oc_, bd.oh_len, ow_};
+        const dims_t dst_dims = {1, pw.oc, bd.oh_len, ow_};
+        CHECK(memory_desc_init_by_tag(
+                src_md, 4, src_dims, dw.dst_dt, format_tag::nhwc));
+        CHECK(memory_desc_init_by_tag(
+                dst_md, 4, dst_dims, pw.dst_dt, format_tag::nhwc));
+        if (pw_pds_.empty())
+            CHECK(memory_desc_init_by_tag(weights_md, 4, weights_dims,
+                    pw.wei_dt, format_tag::any));
+        else
+            weights_md = *pw_pds_.front()->weights_md(0);
+
+        convolution_desc_t cd;
+        CHECK(conv_desc_init(&cd, prop_kind::forward_inference,
+                alg_kind::convolution_direct, &src_md, &weights_md,
+                pw.bias_dt != data_type::undef ? &bias_md : nullptr, &dst_md,
+                strides, nullptr, padding, padding));
+
+        std::shared_ptr<primitive_desc_t> pd;
+        CHECK(create_op_pd(pd, engine, cd, attr_pw));
+        pw_pds_.push_back(pd);
+    }
+    return success;
+}
+
+void streaming_fused_convolution_fwd_t::pd_t::init_args() {
+    const auto &scales = attr()->scales_;
+    const auto &po = attr()->post_ops_;
+    const int dw_arg = DNNL_ARG_ATTR_POST_OP_DW;
+    const int pw_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(pw_idx_);
+    const auto add_scales = [&](arg_map_t &args, int arg, int ctx_arg) {
+        if (!scales.get(ctx_arg).has_default_values())
+            args.emplace_back(DNNL_ARG_ATTR_SCALES | arg,
+                    DNNL_ARG_ATTR_SCALES | ctx_arg);
+    };
+
+    root_args_.emplace_back(DNNL_ARG_WEIGHTS, DNNL_ARG_WEIGHTS);
+    if (with_bias()) root_args_.emplace_back(DNNL_ARG_BIAS, DNNL_ARG_BIAS);
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST})
+        add_scales(root_args_, arg, arg);
+
+    dw_args_.emplace_back(DNNL_ARG_WEIGHTS, dw_arg | DNNL_ARG_WEIGHTS);
+    if (po.entry_[dw_idx_].depthwise_conv.bias_dt != data_type::undef)
+        dw_args_.emplace_back(DNNL_ARG_BIAS, dw_arg | DNNL_ARG_BIAS);
+    add_scales(dw_args_, DNNL_ARG_SRC, DNNL_ARG_DST);
+    add_scales(dw_args_, DNNL_ARG_WEIGHTS, dw_arg | DNNL_ARG_WEIGHTS);
+    add_scales(dw_args_, DNNL_ARG_DST, dw_arg | DNNL_ARG_DST);
+
+    pw_args_.emplace_back(DNNL_ARG_WEIGHTS, pw_arg | DNNL_ARG_WEIGHTS);
+    if (po.entry_[pw_idx_].pointwise_conv.bias_dt != data_type::undef)
+        pw_args_.emplace_back(DNNL_ARG_BIAS, pw_arg | DNNL_ARG_BIAS);
+    add_scales(pw_args_, DNNL_ARG_SRC, dw_arg | DNNL_ARG_DST);
+    add_scales(pw_args_, DNNL_ARG_WEIGHTS, pw_arg | DNNL_ARG_WEIGHTS);
+    add_scales(pw_args_, DNNL_ARG_DST, pw_arg | DNNL_ARG_DST);
+}
+
+void streaming_fused_convolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_fusion_inout_buffer, mid_buf_size_ + dw_buf_size_, 1,
+            PAGE_4K);
+    scratchpad.book(
+            key_fusion_forward_scratchpad, user_scratchpad_size_, 1, PAGE_4K);
+}
+
+void streaming_fused_convolution_fwd_t::pd_t::init_name() {
+    for (const auto &pds : {root_pds_, dw_pds_, pw_pds_}) {
+        name_.append(":");
+        name_.append(pds.front()->name());
+    }
+}
+
+const memory_desc_t *streaming_fused_convolution_fwd_t::pd_t::arg_md(
+        int arg, bool user_input) const {
+    const int pw_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(pw_idx_);
+    if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_SRC))
+        return user_input ? &desc()->dst_desc : &dst_md_;
+    if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS))
+        return dw_pds_.front()->weights_md(0);
+    if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS))
+        return dw_pds_.front()->weights_md(1);
+    if (arg == (pw_arg | DNNL_ARG_WEIGHTS))
+        return pw_pds_.front()->weights_md(0);
+    if (arg == (pw_arg | DNNL_ARG_BIAS)) return pw_pds_.front()->weights_md(1);
+    return convolution_fwd_pd_t::arg_md(arg, user_input);
+}
+
+primitive_desc_t::arg_usage_t
+streaming_fused_convolution_fwd_t::pd_t::arg_usage(int arg) const {
+    const int pw_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(pw_idx_);
+    if (one_of(arg, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS,
+                pw_arg | DNNL_ARG_WEIGHTS))
+        return arg_usage_t::input;
+    if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS)
+            && attr_post_op_dw_inputs() > 1)
+        return arg_usage_t::input;
+    if (arg == (pw_arg | DNNL_ARG_BIAS) && attr_post_op_pw_inputs() > 1)
+        return arg_usage_t::input;
+    return convolution_fwd_pd_t::arg_usage(arg);
+}
+
+status_t streaming_fused_convolution_fwd_t::init(engine_t *engine) {
+    const auto create = [&](const std::vector<std::shared_ptr<
+                                    primitive_desc_t>> &pds,
+                                std::vector<std::shared_ptr<primitive_t>> &ps) {
+        for (const auto &op_pd : pds) {
+            std::shared_ptr<primitive_t> p;
+            CHECK(op_pd->create_primitive(p, engine));
+            ps.push_back(p);
+        }
+        return success;
+    };
+    CHECK(create(pd()->root_pds_, root_ps_));
+    CHECK(create(pd()->dw_pds_, dw_ps_));
+    CHECK(create(pd()->pw_pds_, pw_ps_));
+    return success;
+}
+
+status_t streaming_fused_convolution_fwd_t::execute_op(const exec_ctx_t &ctx,
+        const std::shared_ptr<primitive_t> &op, const pd_t::arg_map_t &args,
+        memory_t *src, memory_t *dst) const {
+    exec_args_t exec_args;
+    exec_args[DNNL_ARG_SRC] = {src, true};
+    exec_args[DNNL_ARG_DST] = {dst, false};
+    for (const auto &a : args)
+        exec_args[a.first] = ctx.args().at(a.second);
+
+    exec_ctx_t op_ctx(ctx, std::move(exec_args));
+    nested_scratchpad_t ns(ctx, key_fusion_forward_scratchpad, op);
+    op_ctx.set_scratchpad_grantor(ns.grantor());
+    return op->execute(op_ctx);
+}
+
+status_t streaming_fused_convolution_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    engine_t *engine = ctx.stream()->engine();
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto mid_buf = scratchpad.template get<char>(key_fusion_inout_buffer);
+    auto dw_buf = mid_buf + pd()->mid_buf_size_;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t row_size = pd()->mid_row_size_;
+    const auto &root_rows = pd()->root_rows_;
+    const auto flags = memory_flags_t::use_runtime_ptr;
+
+    for (dim_t n = 0; n < pd()->MB(); ++n)
+        for (dim_t b = 0; b < pd()->nb_bands_; ++b) {
+            const auto bd = pd()->band(b);
+            const dim_t rows = bd.ih_len - bd.t_pad - bd.b_pad;
+            const size_t r = std::find(root_rows.begin(), root_rows.end(), rows)
+                    - root_rows.begin();
+            const size_t i = bd.oh_len == pd()->band_oh_ ? 0 : 1;
+            const auto &root_pd = pd()->root_pds_[r];
+            const auto &dw_pd = pd()->dw_pds_[i];
+            const auto &pw_pd = pd()->pw_pds_[i];
+
+            // Rows of the depthwise src outside of the 1x1 dst are padding.
+            std::memset(mid_buf, 0, bd.t_pad * row_size);
+            std::memset(mid_buf + (bd.ih_len - bd.b_pad) * row_size, 0,
+                    bd.b_pad * row_size);
+
+            const dim_t ih = bd.ih_start + bd.t_pad;
+            memory_t root_src(engine, root_pd->src_md(), flags,
+                    const_cast<char *>(src)
+                            + src_d.blk_off(n, 0, ih) * src_d.data_type_size());
+            memory_t root_dst(engine, root_pd->dst_md(), flags,
+                    mid_buf + bd.t_pad * row_size);
+            CHECK(execute_op(ctx, root_ps_[r], pd()->root_args_, &root_src,
+                    &root_dst));
+
+            memory_t dw_src(engine, dw_pd->src_md(), flags, mid_buf);
+            memory_t dw_dst(engine, dw_pd->dst_md(), flags, dw_buf);
+            CHECK(execute_op(ctx, dw_ps_[i], pd()->dw_args_, &dw_src, &dw_dst));
+
+            memory_t pw_dst(engine, pw_pd->dst_md(), flags,
+                    dst
+                            + dst_d.blk_off(n, 0, bd.oh_start)
+                                    * dst_d.data_type_size());
+            CHECK(execute_op(ctx, pw_ps_[i], pd()->pw_args_, &dw_dst, &pw_dst));
+        }
+
+    return success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_STREAMING_FUSED_CONVOLUTION_HPP
+#define CPU_STREAMING_FUSED_CONVOLUTION_HPP
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Executes a 1x1 -> depthwise -> pointwise convolution chain (inverted
+// residual block) expressed with depthwise and pointwise post-ops.
+//
+// The expanded intermediate tensor is never materialized: the spatial domain
+// is split into bands of output rows sized to stay in L2, and for every band
+// the 1x1 convolution computes only the rows (plus halo) the depthwise
+// convolution needs, the depthwise convolution consumes them right away and
+// the pointwise convolution writes the band of the final destination. All
+// three stages are regular primitives created for band shapes, so the best
+// available implementation is used for every data type.
+struct streaming_fused_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        pd_t(const pd_t &other) = default;
+
+        DECLARE_COMMON_PD_T(name_.c_str(), streaming_fused_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        const memory_desc_t *dst_md(
+                int index = 0, bool user_input = false) const override {
+            return index == 0 ? &fused_dst_md_ : &glob_zero_md;
+        }
+
+        // The weights of the 1x1 convolution are known once the stage
+        // primitives are created.
+        const memory_desc_t *weights_md(
+                int index = 0, bool user_input = false) const override {
+            if (root_pds_.empty())
+                return cpu_convolution_fwd_pd_t::weights_md(index, user_input);
+            return root_pds_.front()->weights_md(index);
+        }
+
+        const memory_desc_t *arg_md(
+                int arg, bool user_input = false) const override;
+        arg_usage_t arg_usage(int arg) const override;
+
+        // A band of depthwise output rows and the rows of the 1x1 output it
+        // reads. Rows outside of the 1x1 output are zero padding.
+        struct band_t {
+            dim_t oh_start, oh_len;
+            dim_t ih_start, ih_len;
+            dim_t t_pad, b_pad;
+        };
+        band_t band(dim_t b) const;
+
+        // Maps an argument of a stage primitive to an argument of the fused
+        // primitive.
+        using arg_map_t = std::vector<std::pair<int, int>>;
+
+        std::vector<std::shared_ptr<primitive_desc_t>> root_pds_;
+        std::vector<std::shared_ptr<primitive_desc_t>> dw_pds_;
+        std::vector<std::shared_ptr<primitive_desc_t>> pw_pds_;
+        // Number of real (non-padded) 1x1 rows computed by root_pds_[i].
+        std::vector<dim_t> root_rows_;
+        arg_map_t root_args_, dw_args_, pw_args_;
+
+        int dw_idx_ = -1, pw_idx_ = -1;
+        // Shape of the 1x1 output. It is not queried with OC(), OH() and OW()
+        // as dst_md() describes the final destination.
+        dim_t oc_ = 0, ih_ = 0, iw_ = 0, oh_ = 0, ow_ = 0;
+        dim_t kh_ = 0, stride_ = 0, t_pad_ = 0;
+        // Number of depthwise output rows processed at once.
+        dim_t band_oh_ = 0, nb_bands_ = 0;
+        size_t mid_row_size_ = 0, mid_buf_size_ = 0, dw_buf_size_ = 0;
+        size_t user_scratchpad_size_ = 0;
+
+    private:
+        std::string name_ = "streaming_fused_convolution:any";
+        memory_desc_t fused_dst_md_ = types::zero_md();
+
+        bool post_ops_ok() const;
+        bool scales_ok() const;
+        void init_band_size();
+        status_t create_op_pd(std::shared_ptr<primitive_desc_t> &pd,
+                engine_t *engine, const convolution_desc_t &cd,
+                const primitive_attr_t &attr);
+        status_t init_root_pds(engine_t *engine);
+        status_t init_dw_pds(engine_t *engine);
+        status_t init_pw_pds(engine_t *engine);
+        void init_args();
+        void init_scratchpad();
+        void init_name();
+    };
+
+    streaming_fused_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    status_t execute_op(const exec_ctx_t &ctx,
+            const std::shared_ptr<primitive_t> &op, const pd_t::arg_map_t &args,
+            memory_t *src, memory_t *dst) const;
+
+    std::vector<std::shared_ptr<primitive_t>> root_ps_;
+    std::vector<std::shared_ptr<primitive_t>> dw_ps_;
+    std::vector<std::shared_ptr<primitive_t>> pw_ps_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
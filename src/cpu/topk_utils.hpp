@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_TOPK_UTILS_HPP
+#define CPU_TOPK_UTILS_HPP
+
+#include <cmath>
+#include <stdint.h>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace topk_utils {
+
+// A selected element and its index along the axis.
+struct entry_t {
+    float value;
+    int32_t index;
+};
+
+// NaN is ordered as greater than any number, so that it is selected first by
+// the max algorithm and last by the min one.
+inline bool greater(float a, float b) {
+    return (std::isnan(a) && !std::isnan(b)) || a > b;
+}
+
+inline bool equal(float a, float b) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+// The order of the output: elements go from the best to the worst one, ties
+// are resolved in favor of the lower index.
+struct precedes_t {
+    precedes_t(bool select_max) : select_max_(select_max) {}
+
+    bool operator()(const entry_t &a, const entry_t &b) const {
+        if (equal(a.value, b.value)) return a.index < b.index;
+        return select_max_ ? greater(a.value, b.value)
+                           : greater(b.value, a.value);
+    }
+
+private:
+    bool select_max_;
+};
+
+// Returns false only if `x` can not be selected in place of `thr` which is
+// the worst of the already selected elements with lower indices. NaNs pass
+// the filter, it is a superset of the elements which precede `thr`.
+inline bool passes(float x, float thr, bool select_max) {
+    return select_max ? !(x <= thr) : !(x >= thr);
+}
+
+} // namespace topk_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
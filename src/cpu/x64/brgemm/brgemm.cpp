@@ -108,6 +108,7 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
     brgemm_p.b_zp_compensations = post_ops_data.b_zp_compensations;
     brgemm_p.c_zp_values = post_ops_data.c_zp_values;
     brgemm_p.ptr_dst_scales = post_ops_data.dst_scales;
+    brgemm_p.ptr_stats = post_ops_data.stats;
     assert(brg_kernel);
     (*brg_kernel)(&brgemm_p);
 }
@@ -142,6 +143,7 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
     brgemm_p.b_zp_compensations = post_ops_data.b_zp_compensations;
     brgemm_p.c_zp_values = post_ops_data.c_zp_values;
     brgemm_p.ptr_dst_scales = post_ops_data.dst_scales;
+    brgemm_p.ptr_stats = post_ops_data.stats;
     assert(brg_kernel);
     (*brg_kernel)(&brgemm_p);
 }
@@ -346,6 +348,7 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
 
     const auto &dst_scales = attr->scales_.get(DNNL_ARG_DST);
     brg->with_dst_scales = !dst_scales.has_default_values();
+    brg->with_stats = !attr->bnorm_stats_.has_default_values();
     const bool scales_ok = src_scales.mask_ == 0 && dst_scales.mask_ == 0
             && attr->scales_.has_default_values(
                     {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST});
@@ -463,6 +466,10 @@ status_t brgemm_kernel_create(
     if (!brg_kernel) return status::invalid_arguments;
     *brg_kernel = nullptr;
 
+    // Statistics are collected by the generic brgemm kernel only.
+    if (brg.with_stats && (brg.is_dgmm || can_dispatch_uker(&brg)))
+        return status::unimplemented;
+
     if (brg.is_dgmm) {
         if (brg.type == brgemm_static_offs) return status::unimplemented;
 #define CASE(isa) \
@@ -674,6 +681,7 @@ int brgemm_cmp(const brgemm_t &lhs, const brgemm_t &rhs) {
 
     CMP_BRGEMM_FIELD(is_oc_scale);
     CMP_BRGEMM_FIELD(with_dst_scales);
+    CMP_BRGEMM_FIELD(with_stats);
 
     // Compare all non-pointer parameters of brgemm_attr_t except derived
     CMP_BRGEMM_FIELD(brgattr.max_bs);
@@ -231,6 +231,10 @@ struct brgemm_t {
 
     int is_oc_scale = 0;
     bool with_dst_scales = false;
+    // The kernel adds per-column sums and sums of squares of the values
+    // stored to D to the f32 arrays passed in ptr_stats. The sums of squares
+    // are located LDD elements after the sums.
+    bool with_stats = false;
 
     brgemm_attr_t brgattr;
 
@@ -403,6 +407,7 @@ struct brgemm_kernel_params_t {
     size_t skip_accm = 0;
     int32_t zp_a_val = 1;
     const void *ptr_dst_scales = nullptr;
+    void *ptr_stats = nullptr;
 };
 
 template <cpu_isa_t isa, typename Vmm>
@@ -505,7 +510,8 @@ struct brgemm_post_ops_data_t {
             const void *b_zp_compensations = nullptr,
             const void *c_zp_values = nullptr, bool skip_accumulation = false,
             int32_t zp_a_val = 1, bool do_only_comp = false,
-            bool do_only_zp_a_val = false, const float *dst_scales = nullptr)
+            bool do_only_zp_a_val = false, const float *dst_scales = nullptr,
+            float *stats = nullptr)
         : bias(bias)
         , scales(scales)
         , binary_post_ops_rhs(binary_post_ops_rhs)
@@ -520,7 +526,8 @@ struct brgemm_post_ops_data_t {
         , zp_a_val {zp_a_val}
         , do_only_comp {do_only_comp}
         , do_only_zp_a_val {do_only_zp_a_val}
-        , dst_scales(dst_scales) {}
+        , dst_scales(dst_scales)
+        , stats(stats) {}
 
     const void *bias = nullptr;
     const float *scales = nullptr;
@@ -537,6 +544,7 @@ struct brgemm_post_ops_data_t {
     const bool do_only_comp = false;
     const bool do_only_zp_a_val = false;
     const float *dst_scales = nullptr;
+    float *stats = nullptr;
 };
 
 } // namespace x64
@@ -163,6 +163,7 @@ private:
 
     const reg64_t reg_aux_scales = reg_aux_B;
     const reg64_t reg_aux_dst_scales = reg_aux_B;
+    const reg64_t reg_aux_stats = reg_aux_B;
     const reg64_t reg_do_post_ops = reg_rdb_loop;
     const reg64_t reg_do_comp = reg_rdb_loop;
     const reg64_t reg_skip_accm = reg_rdb_loop;
@@ -207,7 +208,9 @@ private:
     constexpr static int reg_zp_a_val_offs_ = 168;
     constexpr static int reg_do_comp_offs_ = 176;
     constexpr static int reg_dst_scales_offs_ = 184;
-    constexpr static int stack_space_needed_ = 192;
+    constexpr static int reg_stats_offs_ = 192;
+    constexpr static int reg_aux_stats_offs_ = 200;
+    constexpr static int stack_space_needed_ = 208;
 
     bool is_ldb_loop_ = false;
     bool with_binary_non_scalar_bcast_ = false;
@@ -296,6 +299,7 @@ private:
             int ldb_and_bdb_offset, bool is_ld_tail);
     void apply_compensation(int bd_block, int ld_block, bool is_ld_tail);
     void apply_alpha_beta(int bd_block, int ld_block, bool is_ld_tail);
+    void accumulate_stats(int bd_block, int ld_block2, bool is_ld_tail);
     void apply_post_ops(int bd_block, int ld_block2, int ldb_and_bdb_offset,
             bool is_ld_tail);
     void restore_A_B_matrices();
@@ -344,6 +348,7 @@ private:
     int bdb_compensation_offset(int bd_block2) const noexcept;
     int compensation_vpad_offset(int ld, int bd) const noexcept;
     int scales_offset(int ld, bool is_tail = false) const noexcept;
+    int stats_offset(int ld, bool is_tail = false) const noexcept;
     int zp_comp_a_offset(int ld, bool is_tail = false) const noexcept;
     int zp_comp_a_vpad_offset(int ld, int bd) const noexcept;
     int bdb_zp_comp_a_offset(int bd_block2) const noexcept;
@@ -491,6 +496,13 @@ int jit_brgemm_kernel_t<isa, Wmm>::scales_offset(
                      : brg.is_oc_scale * sizeof(float) * ld * brg.ld_block;
 }
 
+template <cpu_isa_t isa, typename Wmm>
+int jit_brgemm_kernel_t<isa, Wmm>::stats_offset(
+        int ld, bool is_tail) const noexcept {
+    return (is_tail) ? sizeof(float) * brg.ldb_tail
+                     : sizeof(float) * ld * brg.ld_block;
+}
+
 template <cpu_isa_t isa, typename Wmm>
 int jit_brgemm_kernel_t<isa, Wmm>::zp_comp_a_offset(
         int ld, bool is_tail) const noexcept {
@@ -598,6 +610,11 @@ void jit_brgemm_kernel_t<isa, Wmm>::advance_ldb_post_op_regs() {
         add(reg_aux_scales, scales_offset(1));
         mov(ptr[rsp + reg_aux_scales_offs_], reg_aux_scales);
     }
+    if (brg.with_stats) {
+        mov(reg_aux_stats, ptr[rsp + reg_aux_stats_offs_]);
+        add(reg_aux_stats, stats_offset(1));
+        mov(ptr[rsp + reg_aux_stats_offs_], reg_aux_stats);
+    }
     if (brg.zp_type_a != brgemm_broadcast_t::none) {
         mov(reg_aux_zp_comp_a, ptr[rsp + reg_aux_zp_comp_a_offs_]);
         add(reg_aux_zp_comp_a, zp_comp_a_offset(1));
@@ -622,6 +639,11 @@ void jit_brgemm_kernel_t<isa, Wmm>::restore_ldb_post_op_regs(int ld_block2) {
         sub(reg_aux_scales, scales_offset(ld_block2 - 1));
         mov(ptr[rsp + reg_aux_scales_offs_], reg_aux_scales);
     }
+    if (brg.with_stats) {
+        mov(reg_aux_stats, ptr[rsp + reg_aux_stats_offs_]);
+        sub(reg_aux_stats, stats_offset(ld_block2 - 1));
+        mov(ptr[rsp + reg_aux_stats_offs_], reg_aux_stats);
+    }
     if (brg.zp_type_a != brgemm_broadcast_t::none) {
         mov(reg_aux_zp_comp_a, ptr[rsp + reg_aux_zp_comp_a_offs_]);
         sub(reg_aux_zp_comp_a, zp_comp_a_offset(ld_block2 - 1));
@@ -687,6 +709,12 @@ void jit_brgemm_kernel_t<isa, Wmm>::ldb_regs_shift(
                 (is_tail) ? scales_offset(1, true) : scales_offset(ld_block2));
         mov(ptr[rsp + reg_aux_scales_offs_], reg_aux_scales);
     }
+    if (brg.with_stats) {
+        mov(reg_aux_stats, ptr[rsp + reg_aux_stats_offs_]);
+        add(reg_aux_stats,
+                (is_tail) ? stats_offset(1, true) : stats_offset(ld_block2));
+        mov(ptr[rsp + reg_aux_stats_offs_], reg_aux_stats);
+    }
     if (brg.zp_type_a != brgemm_broadcast_t::none) {
         mov(reg_aux_zp_comp_a, ptr[rsp + reg_aux_zp_comp_a_offs_]);
         add(reg_aux_zp_comp_a,
@@ -732,6 +760,10 @@ void jit_brgemm_kernel_t<isa, Wmm>::copy_post_ops_stack_values_to_aux(
             mov(reg_scales, ptr[rsp + reg_scales_offs_]);
             mov(ptr[rsp + reg_aux_scales_offs_], reg_scales);
         }
+        if (brg.with_stats) {
+            mov(reg_aux_stats, ptr[rsp + reg_stats_offs_]);
+            mov(ptr[rsp + reg_aux_stats_offs_], reg_aux_stats);
+        }
 
         if (brg.zp_type_a != brgemm_broadcast_t::none) {
             mov(reg_zp_comp_a, ptr[rsp + reg_zp_comp_a_offs_]);
@@ -815,6 +847,11 @@ void jit_brgemm_kernel_t<isa, Wmm>::read_params() {
         mov(ptr[rsp + reg_dst_scales_offs_], reg_dst_scales);
     }
 
+    if (brg.with_stats) {
+        mov(reg_aux_stats, ptr[param1 + GET_OFF(ptr_stats)]);
+        mov(ptr[rsp + reg_stats_offs_], reg_aux_stats);
+    }
+
     mov(reg_do_post_ops, ptr[param1 + GET_OFF(do_post_ops)]);
     mov(ptr[rsp + reg_do_post_ops_offs_], reg_do_post_ops);
 
@@ -1014,6 +1051,42 @@ void jit_brgemm_kernel_t<isa, Wmm>::apply_post_ops(
             rhs_arg_params);
 }
 
+template <cpu_isa_t isa, typename Wmm>
+void jit_brgemm_kernel_t<isa, Wmm>::accumulate_stats(
+        int bd_block, int ld_block2, bool is_ld_tail) {
+    // Adds the values about to be stored to the per-column sums and sums of
+    // squares, so the statistics of D are collected without reading it back.
+    // vmm_tmp(1) keeps the tail mask on avx2, so both sums go through
+    // vmm_tmp(0) one after another.
+    auto k_mask = (!is_ld_tail) ? ld_full_mask : ld_tail_mask;
+    const auto vmm_stat = vmm_tmp(0);
+
+    mov(reg_aux_stats, ptr[rsp + reg_aux_stats_offs_]);
+    for_(int is_sqsum = 0; is_sqsum < 2; is_sqsum++)
+    for (int ld = 0; ld < ld_block2; ld++) {
+        const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
+        const auto addr = ptr[reg_aux_stats + stats_offset(ld)
+                + is_sqsum * sizeof(float) * brg.LDD];
+        const bool use_masks
+                = IMPLICATION(is_tail, isa_has_masks(brg.isa_impl));
+        if (use_masks)
+            uni_vmovups(vmm_mask(vmm_stat, is_tail, false, k_mask), addr);
+        else
+            vmaskmovps(vmm_stat, vmm_tail_mask(), addr);
+        for (int bd = 0; bd < bd_block; bd++) {
+            const auto vmm = accm(ld_block2, bd, ld);
+            if (is_sqsum)
+                uni_vfmadd231ps(vmm_stat, vmm, vmm);
+            else
+                uni_vaddps(vmm_stat, vmm_stat, vmm);
+        }
+        if (use_masks)
+            uni_vmovups(addr, vmm_mask(vmm_stat, is_tail, true, k_mask));
+        else
+            vmaskmovps(addr, vmm_tail_mask(), vmm_stat);
+    }
+}
+
 template <cpu_isa_t isa, typename Wmm>
 void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators_apply_post_ops(
         int bd_block, int ld_block2, int ldb_and_bdb_offset, bool is_ld_tail) {
@@ -1134,6 +1207,8 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators_apply_post_ops(
         // maybe_set_avx_mask(is_ld_tail);
     }
 
+    if (brg.with_stats) accumulate_stats(bd_block, ld_block2, is_ld_tail);
+
     if (brg.is_bf16_emu) bf16_emu_->init_vcvtneps2bf16();
 
     for (int bd = 0; bd < bd_block; bd++) {
@@ -1313,7 +1388,7 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators(int bd_block2,
     const bool are_post_ops_applicable = one_of(true, brg.with_eltwise,
             brg.with_binary, brg.with_scales, brg.with_bias, brg.with_sum,
             brg.dt_d != brg.dt_c, brg.req_s8s8_compensation, has_zero_points,
-            brg.with_dst_scales);
+            brg.with_dst_scales, brg.with_stats);
     const bool need_to_apply_alpha_beta = brg.beta != 0.f || brg.alpha != 1.f;
     const bool need_generate_zp_a_compensation
             = brg.is_int8 && (brg.req_s8s8_compensation || has_zero_points);
@@ -1399,7 +1474,7 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators(int bd_block2,
                                 brg.with_scales,
                                 brg.zp_type_a != brgemm_broadcast_t::none,
                                 brg.zp_type_c == brgemm_broadcast_t::per_n,
-                                brg.with_dst_scales);
+                                brg.with_dst_scales, brg.with_stats);
                     }
                     if (bdb < bd_block2 - 1) {
                         advance_bdb_post_op_regs(adj_bd_block);
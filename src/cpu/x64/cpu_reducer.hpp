@@ -63,7 +63,9 @@ namespace x64 {
  * master (@sa reduce_balancer_t::master()).
  *
  * If threading driver does not allow sync between sub-group of threads (e.g.
- * TBB) the # of thread per group is enforced to be 1.
+ * TBB) the # of thread per group is enforced to be 1. The same applies to
+ * deterministic mode, as the order of accumulation of partial results of the
+ * threads within a group depends on the # of threads.
  */
 struct reduce_balancer_t {
     reduce_balancer_t() { init(1, 1, 1, 1, 0); } /* trivial balance */
@@ -75,7 +77,8 @@ struct reduce_balancer_t {
     reduce_balancer_t &init(int nthr, int job_size, int njobs,
             int reduction_size, size_t max_buffer_size,
             bool lock_free = false) {
-        allow_nthr_in_group_ = lock_free ? true : dnnl_thr_syncable();
+        allow_nthr_in_group_ = !dnnl_thr_deterministic()
+                && (lock_free ? true : dnnl_thr_syncable());
         nthr_ = nthr;
         job_size_ = job_size;
         njobs_ = njobs;
@@ -1039,6 +1039,10 @@ static inline bool nocopy_checker(
 
     if (arg->force_nocopy) return true;
 
+    // The nocopy and copy-based kernels block K differently, in deterministic
+    // mode the choice must not depend on the number of threads.
+    if (dnnl_thr_deterministic()) nthr = 1;
+
     auto m = arg->m, n = arg->n, k = arg->k;
     auto lda = arg->lda, ldb = arg->ldb, ldc = arg->ldc;
     auto transa = arg->transa, transb = arg->transb;
@@ -1267,7 +1271,8 @@ static inline void set_thread_opts_pack(int nthrs,
     };
 
     // Choose k blocking.
-    if ((m / MBLK + n / NBLK) < nthrs && do_k_blocking) {
+    if ((m / MBLK + n / NBLK) < nthrs && do_k_blocking
+            && !dnnl_thr_deterministic()) {
         for (int nk = 1; nk <= 4 && k >= ((KBLK + 1) * nk); nk++)
             if (nthrs % nk == 0) nthr_k = nk;
 
@@ -413,7 +413,10 @@ static inline void gemv_threading_driver(const int trans, const dim_t m,
     enum { M_MIN = 500, N_MIN = 128 };
     bool is_short_fat = m <= nthr_goal * M_MIN && n >= nthr_goal * N_MIN;
 
-    bool use_y_buf = trans == no_trans && (is_bf16 || (is_f32 && is_short_fat));
+    // The buffers hold partial sums over n, which are not used in
+    // deterministic mode.
+    bool use_y_buf = trans == no_trans && !dnnl_thr_deterministic()
+            && (is_bf16 || (is_f32 && is_short_fat));
     bool is_syncable = dnnl_thr_syncable();
 
     c_t *ybuf = nullptr;
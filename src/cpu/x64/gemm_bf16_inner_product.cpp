@@ -143,6 +143,7 @@ status_t gemm_bf16_inner_product_bwd_weights_t<diff_wei_data_type>::
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto diff_weights = CTX_OUT_MEM(diff_wei_data_t *, DNNL_ARG_DIFF_WEIGHTS);
+    DEFINE_ROUNDING_SEED_VALUE(rnd_seed);
 
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     diff_dst += diff_dst_d.offset0();
@@ -183,8 +184,14 @@ status_t gemm_bf16_inner_product_bwd_weights_t<diff_wei_data_type>::
             start = std::min(work_size, start * blksize);
             end = std::min(work_size, end * blksize);
             if (end > start) {
-                cvt_float_to_bfloat16((bfloat16_t *)&diff_weights[start],
-                        (const float *)&acc[start], end - start);
+                if (pd()->diff_wei_stochastic())
+                    cvt_float_to_bfloat16_stochastic(
+                            (bfloat16_t *)&diff_weights[start],
+                            (const float *)&acc[start], end - start, start,
+                            rnd_seed);
+                else
+                    cvt_float_to_bfloat16((bfloat16_t *)&diff_weights[start],
+                            (const float *)&acc[start], end - start);
             }
         });
     }
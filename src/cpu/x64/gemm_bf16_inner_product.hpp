@@ -212,7 +212,10 @@ struct gemm_bf16_inner_product_bwd_weights_t : public primitive_t {
                     && diff_wei_data_type == diff_weights_md()->data_type
                     && IMPLICATION(with_bias(),
                             one_of(diff_weights_md(1)->data_type, f32, bf16))
-                    && attr()->has_default_values()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::rounding_mode)
+                    && IMPLICATION(diff_wei_stochastic(),
+                            diff_wei_data_type == bf16)
                     && set_default_params() == status::success
                     && dense_gemm_consitency_check(
                             src_md(), diff_weights_md(), diff_dst_md());
@@ -229,6 +232,12 @@ struct gemm_bf16_inner_product_bwd_weights_t : public primitive_t {
 
         bool diff_wei_is_acc_ = false;
         int bias_reduction_nthr_ = 1;
+
+        bool diff_wei_stochastic() const {
+            return attr()->rounding_mode_.get(DNNL_ARG_DIFF_WEIGHTS)
+                    == rounding_mode::stochastic;
+        }
+
         static const dim_t bias_blksize = 32;
 
         void get_bias_partitioning(
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -4129,8 +4130,9 @@ status_t jit_avx512_common_conv_bwd_weights_kernel_f32::init_conf(
         // weights and the data buffers cannot both be traversed optimally, so
         // for performance, the weights must fit in cache.
         const unsigned int L2_cache_size = platform::get_per_core_cache_size(2);
-        use_nxc_harness
-                = (data_size / nthreads + kernel_size > L2_cache_size / 3)
+        // The harness splits only the reduction dimensions between threads.
+        use_nxc_harness = !dnnl_thr_deterministic()
+                && (data_size / nthreads + kernel_size > L2_cache_size / 3)
                 && (jcp.oc % jcp.simd_w == 0) && (jcp.ic % jcp.simd_w == 0)
                 && jcp.kw > 1 && ndims == 3
                 && (kernel_size < L2_cache_size / 2);
@@ -4303,7 +4305,11 @@ void jit_avx512_common_conv_bwd_weights_kernel_f32::balance(
     dim_t best_mem_cost = calc_mem_cost(nthr_mb_, nthr_oc_b_, nthr_ic_b_);
 
     /* step 1: find the best thread distribution with lowest memory cost */
-    const int nthr_mb_max = nstl::min(nthr, j.mb * j.od * nthr_oh_reduce);
+    // In deterministic mode every element of diff_weights is accumulated by a
+    // single thread.
+    const int nthr_mb_max = dnnl_thr_deterministic()
+            ? 1
+            : nstl::min(nthr, j.mb * j.od * nthr_oh_reduce);
     for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
         const int nthr_par = nthr / nthr_mb;
         const int nthr_oc_b_max = nstl::min(nthr_par, j.nb_oc);
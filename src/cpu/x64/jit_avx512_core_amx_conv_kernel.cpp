@@ -5548,7 +5548,11 @@ void jit_avx512_core_amx_bwd_weights_kernel_t::balance(const jit_conv_conf_t &j,
 
     /* find the best thread distribution with lowest memory cost */
 
-    const int nthr_mb_max = nstl::min(nthr, j.nthr_mb_work);
+    // In deterministic mode every element of diff_weights is accumulated by a
+    // single thread.
+    const int nthr_mb_max = dnnl_thr_deterministic()
+            ? 1
+            : nstl::min(nthr, j.nthr_mb_work);
     for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
         const int nthr_par = nthr / nthr_mb;
         const int nthr_oc_b_max = nstl::min(nthr_par,
@@ -1876,7 +1876,11 @@ void jit_avx512_core_bf16_1x1_conv_kernel::balance(
     auto best_mem_cost = calc_mem_cost(nthr_mb, nthr_oc_b, nthr_ic_b);
 
     /* step 1: find the best thread distribution with lowest memory cost */
-    const int nthr_mb_max = nstl::min(nthr, jcp.mb * nb_reduce);
+    // In deterministic mode every element of diff_weights is accumulated by a
+    // single thread.
+    const int nthr_mb_max = dnnl_thr_deterministic()
+            ? 1
+            : nstl::min(nthr, jcp.mb * nb_reduce);
     for (nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
         const int nthr_par = nthr / nthr_mb;
         const int nthr_oc_b_max = nstl::min(nthr_par, nb_load);
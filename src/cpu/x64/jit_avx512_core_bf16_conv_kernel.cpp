@@ -4646,7 +4646,11 @@ void jit_avx512_core_bf16_conv_bwd_weights_kernel_f32::balance(
     float best_mem_cost = calc_mem_cost(nthr_mb_, nthr_oc_b_, nthr_ic_b_);
 
     /* find the best thread distribution with lowest memory cost */
-    const int nthr_mb_max = nstl::min(nthr, j.nthr_mb_work);
+    // In deterministic mode every element of diff_weights is accumulated by a
+    // single thread.
+    const int nthr_mb_max = dnnl_thr_deterministic()
+            ? 1
+            : nstl::min(nthr, j.nthr_mb_work);
     for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
         const int nthr_par = nthr / nthr_mb;
         const int nthr_oc_b_max = nstl::min(nthr_par, j.nb_oc);
@@ -301,7 +301,8 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::add_brg_descriptor(
     auto LDD = jcp_.oc_without_padding;
     brg.with_sum = with_sum;
     brg.with_weights_scale_adjust = jcp_.scale_adjust_factor != 1.0f;
-    CHECK(brgemm_desc_set_postops(&brg, attr(), &dst_md_, LDD, jcp_.bia_dt));
+    CHECK(brgemm_desc_set_postops(
+            &brg, conv_attr(), &dst_md_, LDD, jcp_.bia_dt));
     jcp_.amx_buf_size_per_thread = nstl::max(
             brg.get_wsp_buffer_size(), jcp_.amx_buf_size_per_thread);
 
@@ -394,7 +395,7 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::init(
 
     using skip_mask_t = primitive_attr_t::skip_mask_t;
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
-            | skip_mask_t::zero_points_runtime;
+            | skip_mask_t::zero_points_runtime | skip_mask_t::bnorm_stats;
     if (is_int8) skip_mask |= skip_mask_t::scales_runtime;
 
     bool ok = is_fwd() && set_default_alg_kind(alg_kind::convolution_direct)
@@ -412,6 +413,15 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::init(
             src_md_, weights_md_, dst_md_, bias_md_, attr_,
             dnnl_get_max_threads()));
 
+    with_pooling_ = jcp_.with_pooling;
+    if (with_pooling_) {
+        CHECK(brgemm_convolution_utils::init_conv_attr(conv_attr_, attr_));
+        const dims_t pooled_dims = {dst_md_.dims[0], dst_md_.dims[1],
+                jcp_.oh / jcp_.pool_kh, jcp_.ow / jcp_.pool_kw};
+        CHECK(memory_desc_init_by_tag(pooled_dst_md_, ndims, pooled_dims,
+                dst_md_.data_type, format_tag::nhwc));
+    }
+
     const auto adj_M = nstl::max(jcp_.M, jcp_.M_tail);
 
     // 1. The unrolled kernel can be used for exec_trans and exec_base and for
@@ -580,10 +590,13 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::init(
                     && jcp_.os_block / jcp_.ow == jcp_.oh_block));
 
     ic_chunks = div_up(jcp_.nb_ic, jcp_.nb_ic_blocking);
+    // The statistics are collected while the post-ops are applied, so every
+    // dst value has to be stored through the post-ops path.
     need_postwork = jcp_.with_bias || jcp_.with_eltwise || jcp_.with_binary
             || (one_of(src_type, u8, s8) && wei_type == s8) // oscales needed
             || (jcp_.dst_dt != jcp_.acc_dt) || jcp_.with_sum || jcp_.use_M_mask
-            || jcp_.src_zero_point || jcp_.dst_zero_point;
+            || jcp_.src_zero_point || jcp_.dst_zero_point
+            || jcp_.with_bnorm_stats;
 
     const int M_begin = 0;
     const int M_end = nstl::max(jcp_.M, jcp_.M_tail);
@@ -725,7 +738,8 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::add_po_kernel(
     bcfg->alpha = !is_init && IMPLICATION(jcp.with_sum, jcp.use_buffer);
     bcfg->beta = is_init ? 0 : 1;
     CHECK(safe_ptr_assign(kernels_po_[ker_idx],
-            new jit_brgemm_kernel_post_ops<isa>(jcp, *bcfg, *_pd->attr())));
+            new jit_brgemm_kernel_post_ops<isa>(
+                    jcp, *bcfg, *_pd->conv_attr())));
     kernels_po_[ker_idx]->create_kernel();
     return status::success;
 }
@@ -1231,8 +1245,19 @@ struct brgemm_convolution_fwd_t<isa, use_inversion>::brgemm_thread_ctx_t {
     uint8_t *__restrict inp_buffer_mask {nullptr};
     const char *const __restrict weights {nullptr};
     void *__restrict inp_buffer_zero {nullptr};
+    char *__restrict pool_buffer {nullptr};
+    float *__restrict stats {nullptr};
 };
 
+template <cpu_isa_t isa, bool use_inversion>
+inline dim_t brgemm_convolution_fwd_t<isa, use_inversion>::get_dst_row_offset(
+        const brgemm_thread_ctx_t &btc) const {
+    // pooling buffer keeps only the rows of the current work item
+    return btc.pool_buffer
+            ? (btc.oh - btc.ohb * pd()->jcp_.oh_block) * dst_w_sz
+            : btc.od * dst_h_sz + btc.oh * dst_w_sz;
+}
+
 template <cpu_isa_t isa, bool use_inversion>
 status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
         const exec_ctx_t &ctx) const {
@@ -1305,9 +1330,16 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
     char *const wsp_tile_global = is_amx
             ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
             : nullptr;
+    char *const pool_buffer_global = jcp.with_pooling
+            ? scratchpad.template get<char>(key_conv_brgemm_pool_buffer)
+            : nullptr;
 
     maybe_conv_weights(ctx, wei, wei);
 
+    float *const stats_global = jcp.with_bnorm_stats
+            ? scratchpad.template get<float>(key_conv_brgemm_stats)
+            : nullptr;
+
     // --------------- Parallel section ------------------------------
     const dim_t work_amount = static_cast<dim_t>(jcp.mb) * jcp.ngroups
             * jcp.nb_oc * jcp.nb_od * jcp.nb_oh * jcp.nb_ow;
@@ -1349,6 +1381,9 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
                 : nullptr;
 
         btc.input = jcp.copy_input ? btc.inp_buffer : src;
+        btc.pool_buffer = jcp.with_pooling
+                ? pool_buffer_global + dst_dsz * ithr * jcp.pool_buffer_size
+                : nullptr;
 
         dim_t start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
@@ -1377,6 +1412,20 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
             btc.s8s8_comp_ptr
                     = jcp.s8s8_compensation_required ? s8s8_comp_base : nullptr;
             btc.dst_scales = dst_scales;
+            if (jcp.with_bnorm_stats) {
+                // The kernels add the statistics of the stored values to the
+                // slot of the spatial work item, zeroed for the channels of
+                // the current one.
+                const dim_t nd = static_cast<dim_t>(n) * jcp.nb_od + odb;
+                const dim_t slot = (nd * jcp.nb_oh + ohb) * jcp.nb_ow + owb;
+                btc.stats = stats_global + slot * jcp.stats_buffer_size;
+                const int oc = ocb * jcp.oc_block;
+                const int g_oc = g * jcp.oc + oc;
+                const int oc_l = nstl::min(jcp.oc_block, jcp.oc - oc);
+                std::memset(btc.stats + g_oc, 0, sizeof(float) * oc_l);
+                std::memset(btc.stats + jcp.oc_without_padding + g_oc, 0,
+                        sizeof(float) * oc_l);
+            }
 
             if (jcp.exec_type == exec_trans
                     && (last_btc.n != n || last_btc.g != g)) {
@@ -1415,6 +1464,7 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
                 last_btc.ohb = ohb;
                 last_btc.owb = owb;
             }
+            if (jcp.with_pooling) perform_pooling(btc);
             if (jcp.loop_order == loop_ndhwgc)
                 nd_iterator_step(n, jcp.mb, odb, jcp.nb_od, ohb, jcp.nb_oh, owb,
                         jcp.nb_ow, g, jcp.ngroups, ocb, jcp.nb_oc);
@@ -1427,6 +1477,8 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
         if (is_amx) { amx_tile_release(); }
     });
 
+    if (jcp.with_bnorm_stats) reduce_stats(ctx, stats_global);
+
     if (_pd->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
 
     return status::success;
@@ -1530,6 +1582,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::perform_outwork(
         p.c_zp_values = btc.dst_zp_vals;
         p.a_comp_val = btc.src_zp_vals;
         p.ptr_dst_scales = (void *)btc.dst_scales;
+        p.ptr_stats = btc.stats ? (void *)(btc.stats + g_oc) : nullptr;
     }
 
     auto call_outwork_ker = [&](bool is_postwork, bool has_postcomp,
@@ -1548,7 +1601,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::perform_outwork(
 
             p.ptr_out = dst_base
                     + dst_dsz
-                            * (btc.od * dst_h_sz + btc.oh * dst_w_sz
+                            * (get_dst_row_offset(btc)
                                     + ow_pw_s * jcp.oc_without_padding);
             p.ptr_in = static_cast<void *>(
                     jcp.use_buffer ? (
@@ -1560,7 +1613,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::perform_outwork(
                     ? (btc.c_buffer + acc_dsz * (ow_pw_s - ow) * jcp.LDC)
                     : dst_base
                             + dst_dsz
-                                    * (btc.od * dst_h_sz + btc.oh * dst_w_sz
+                                    * (get_dst_row_offset(btc)
                                             + ow_pw_s * jcp.oc_without_padding);
             p.ptr_out = static_cast<void *>(ptr_Cz);
         }
@@ -1581,6 +1634,124 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::perform_outwork(
     }
 }
 
+template <cpu_isa_t isa, bool use_inversion>
+void brgemm_convolution_fwd_t<isa, use_inversion>::reduce_stats(
+        const exec_ctx_t &ctx, const float *stats) const {
+    const auto &jcp = pd()->jcp_;
+    auto mean = CTX_OUT_MEM(float *, DNNL_ARG_ATTR_STATS_MEAN);
+    auto variance = CTX_OUT_MEM(float *, DNNL_ARG_ATTR_STATS_VARIANCE);
+
+    // The work item slots are reduced in the same order for any number of
+    // threads, so the statistics are reproducible.
+    const dim_t C = jcp.oc_without_padding;
+    const dim_t nslots
+            = static_cast<dim_t>(jcp.mb) * jcp.nb_od * jcp.nb_oh * jcp.nb_ow;
+    const double inv_size = 1. / (static_cast<double>(jcp.mb) * OD * OH * OW);
+    parallel_nd(C, [&](dim_t c) {
+        double sum = 0., sqsum = 0.;
+        for (dim_t slot = 0; slot < nslots; slot++) {
+            const float *const slot_stats
+                    = stats + slot * jcp.stats_buffer_size;
+            sum += slot_stats[c];
+            sqsum += slot_stats[C + c];
+        }
+        const double m = sum * inv_size;
+        if (mean) mean[c] = static_cast<float>(m);
+        if (variance)
+            variance[c] = static_cast<float>(
+                    nstl::max(0., sqsum * inv_size - m * m));
+    });
+}
+
+template <cpu_isa_t isa, bool use_inversion>
+void brgemm_convolution_fwd_t<isa, use_inversion>::perform_pooling(
+        const brgemm_thread_ctx_t &btc) const {
+    const auto _pd = pd();
+    const auto &jcp = _pd->jcp_;
+    const memory_desc_wrapper dst_d(_pd->dst_md(0));
+
+    // The work item rows are in the pooling buffer with the dst layout.
+    // Windows cut by the right or bottom border are dropped.
+    const int PH = OH / jcp.pool_kh;
+    const int PW = OW / jcp.pool_kw;
+    const int oh_s = btc.ohb * jcp.oh_block;
+    const int ph_s = oh_s / jcp.pool_kh;
+    const int ph_e = nstl::min(PH, (oh_s + jcp.oh_block) / jcp.pool_kh);
+    const int ow_s = btc.owb * jcp.ow_block;
+    const int pw_s = ow_s / jcp.pool_kw;
+    const int pw_e = nstl::min(PW, (ow_s + jcp.ow_block) / jcp.pool_kw);
+    const int oc = btc.ocb * jcp.oc_block;
+    const int g_oc = btc.g * jcp.oc + oc;
+    const int oc_l = nstl::min(jcp.oc_block, jcp.oc - oc);
+
+    const bool is_max = jcp.pool_alg == alg_kind::pooling_max;
+    const float lowest = nstl::numeric_limits<float>::lowest();
+    const float inv_ks = 1.f / (jcp.pool_kh * jcp.pool_kw);
+    const char *const buf = btc.pool_buffer + dst_dsz * g_oc;
+    char *const dst = btc.brgemm_ctx.dst;
+
+    // Averages of integer values are in range, so only rounding is needed.
+    const auto load = [&](const char *ptr, dim_t off) -> float {
+        using namespace data_type;
+        switch (jcp.dst_dt) {
+            case f32: return reinterpret_cast<const float *>(ptr)[off];
+            case bf16: return reinterpret_cast<const bfloat16_t *>(ptr)[off];
+            case f16: return reinterpret_cast<const float16_t *>(ptr)[off];
+            case s32: return reinterpret_cast<const int32_t *>(ptr)[off];
+            case s8: return reinterpret_cast<const int8_t *>(ptr)[off];
+            case u8: return reinterpret_cast<const uint8_t *>(ptr)[off];
+            default: assert(!"unsupported data type");
+        }
+        return 0.f;
+    };
+    const auto store = [&](char *ptr, dim_t off, float v) {
+        using namespace data_type;
+        switch (jcp.dst_dt) {
+            case f32: reinterpret_cast<float *>(ptr)[off] = v; break;
+            case bf16: reinterpret_cast<bfloat16_t *>(ptr)[off] = v; break;
+            case f16: reinterpret_cast<float16_t *>(ptr)[off] = v; break;
+            case s32:
+                reinterpret_cast<int32_t *>(ptr)[off]
+                        = static_cast<int32_t>(nearbyintf(v));
+                break;
+            case s8:
+                reinterpret_cast<int8_t *>(ptr)[off]
+                        = static_cast<int8_t>(nearbyintf(v));
+                break;
+            case u8:
+                reinterpret_cast<uint8_t *>(ptr)[off]
+                        = static_cast<uint8_t>(nearbyintf(v));
+                break;
+            default: assert(!"unsupported data type");
+        }
+    };
+
+    constexpr int c_block = 16;
+    for_(int ph = ph_s; ph < ph_e; ph++)
+    for (int pw = pw_s; pw < pw_e; pw++) {
+        const dim_t dst_off = dst_d.blk_off(btc.n, g_oc, ph, pw);
+        for (int c_s = 0; c_s < oc_l; c_s += c_block) {
+            const int c_l = nstl::min(c_block, oc_l - c_s);
+            float acc[c_block];
+            for (int c = 0; c < c_l; c++)
+                acc[c] = is_max ? lowest : 0.f;
+            for_(int kh = 0; kh < jcp.pool_kh; kh++)
+            for (int kw = 0; kw < jcp.pool_kw; kw++) {
+                const dim_t off = (ph * jcp.pool_kh + kh - oh_s) * dst_w_sz
+                        + (pw * jcp.pool_kw + kw) * jcp.oc_without_padding
+                        + c_s;
+                for (int c = 0; c < c_l; c++) {
+                    const float v = load(buf, off + c);
+                    acc[c] = is_max ? nstl::max(acc[c], v) : acc[c] + v;
+                }
+            }
+            for (int c = 0; c < c_l; c++)
+                store(dst, dst_off + c_s + c,
+                        is_max ? acc[c] : acc[c] * inv_ks);
+        }
+    }
+}
+
 template <cpu_isa_t isa, bool use_inversion>
 inline void brgemm_convolution_fwd_t<isa, use_inversion>::call_brgemm_kernel(
         const brgemm_thread_ctx_t &btc, const brgemm_kernel_t *brg_ker,
@@ -1616,7 +1787,8 @@ inline void brgemm_convolution_fwd_t<isa, use_inversion>::call_brgemm_kernel(
                 static_cast<size_t>(g_oc), 0, btc.brgemm_ctx.dst, 0,
                 static_cast<void *>(src_zp_ptr), nullptr,
                 static_cast<void *>(btc.dst_zp_vals), false, btc.src_zp_vals,
-                do_only_comp, do_only_pass_comp, btc.dst_scales};
+                do_only_comp, do_only_pass_comp, btc.dst_scales,
+                btc.stats ? btc.stats + g_oc : nullptr};
 
         void *scratch = is_amx ? static_cast<void *>(btc.wsp_tile)
                                : static_cast<void *>(s8s8_comp);
@@ -1901,8 +2073,9 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::maybe_conv_inp(
             = bias ? bias + (bias_d.blk_off(g_oc) * bia_dsz) : nullptr; \
     const auto nb_ic_b = nstl::min(jcp.nb_ic_blocking, jcp.nb_ic - icb) \
             - (is_ic_tail ? 1 : 0); \
-    char *const __restrict dst_base \
-            = btc.brgemm_ctx.dst + dst_dsz * (btc.n * dst_d_sz + g_oc); \
+    char *const __restrict dst_base = btc.pool_buffer \
+            ? btc.pool_buffer + dst_dsz * g_oc \
+            : btc.brgemm_ctx.dst + dst_dsz * (btc.n * dst_d_sz + g_oc); \
     char *ptr_C; \
     char *ptr_D; \
     int kd_b(0), kd_e(0), kh_b(0), kh_e(0), k_l(0), iiw_b(0);
@@ -1970,7 +2143,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::ker_base(
         iiw_b = ow_b * SW - LP;
         ptr_D = dst_base
                 + dst_dsz
-                        * (btc.od * dst_h_sz + btc.oh * dst_w_sz
+                        * (get_dst_row_offset(btc)
                                 + ow_b * jcp.oc_without_padding);
         ptr_C = (jcp.use_buffer)
                 ? btc.c_buffer + acc_dsz * (ow_b - ow) * jcp.LDC
@@ -2099,7 +2272,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::ker_trans(
     iiw_b = ow_b * SW - iiw_shift;
     ptr_D = dst_base
             + dst_dsz
-                    * (btc.od * dst_h_sz + btc.oh * dst_w_sz
+                    * (get_dst_row_offset(btc)
                             + ow_b * jcp.oc_without_padding);
     ptr_C = (jcp.use_buffer) ? btc.c_buffer + acc_dsz * (ow_b - ow) * jcp.LDC
                              : static_cast<char *>(ptr_D);
@@ -2208,7 +2381,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::ker_vpad(
     iiw_b = ow_b * SW - LP;
     ptr_D = dst_base
             + dst_dsz
-                    * (btc.od * dst_h_sz + btc.oh * dst_w_sz
+                    * (get_dst_row_offset(btc)
                             + ow_b * jcp.oc_without_padding);
     ptr_C = (jcp.use_buffer) ? btc.c_buffer + acc_dsz * (ow_b - ow) * jcp.LDC
                              : static_cast<char *>(ptr_D);
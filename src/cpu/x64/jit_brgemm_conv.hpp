@@ -64,6 +64,20 @@ struct brgemm_convolution_fwd_t : public primitive_t {
 
         status_t init(engine_t *engine);
 
+        // With pooling post-op the primitive output is the pooled tensor,
+        // while dst_md_ describes the convolution output.
+        const memory_desc_t *dst_md(
+                int index = 0, bool user_input = false) const override {
+            return with_pooling_ && index == 0
+                    ? &pooled_dst_md_
+                    : cpu_convolution_fwd_pd_t::dst_md(index, user_input);
+        }
+
+        // Attributes for brgemm kernels, without the pooling post-op.
+        const primitive_attr_t *conv_attr() const {
+            return with_pooling_ ? &conv_attr_ : attr();
+        }
+
         int brgs_sz_;
         std::shared_ptr<brgemm_containers::brgemm_desc_container_t>
                 brgemm_descriptors_;
@@ -157,6 +171,10 @@ struct brgemm_convolution_fwd_t : public primitive_t {
         int ndims = 0;
 
     protected:
+        bool with_pooling_ = false;
+        primitive_attr_t conv_attr_;
+        memory_desc_t pooled_dst_md_;
+
         bool arg_scales_ok() const {
             std::vector<int> supported_args
                     = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST};
@@ -234,6 +252,12 @@ private:
             int ker_ow_f, int kd_l, int kh_l, bool maybe_do_init,
             bool do_postwork, bool do_post_comp) const;
 
+    void perform_pooling(const brgemm_thread_ctx_t &btc) const;
+
+    void reduce_stats(const exec_ctx_t &ctx, const float *stats) const;
+
+    inline dim_t get_dst_row_offset(const brgemm_thread_ctx_t &btc) const;
+
     void call_brgemm_kernel(const brgemm_thread_ctx_t &btc,
             const brgemm_kernel_t *brg_ker, int batch_size, char *ptr_C,
             char *ptr_D, const char *bias_w, int g_oc, bool do_postops,
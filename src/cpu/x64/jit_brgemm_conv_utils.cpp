@@ -234,7 +234,10 @@ bool post_ops_ok(jit_brgemm_conv_conf_t &jcp, primitive_attr_t &attr,
         const memory_desc_wrapper &dst_d) {
     using namespace injector;
 
-    const auto &post_ops = attr.post_ops_;
+    // pooling post-op is not handled by brgemm kernels
+    post_ops_t post_ops;
+    post_ops.copy_from(attr.post_ops_);
+    if (jcp.with_pooling) post_ops.entry_.pop_back();
 
     return injector::post_ops_ok(post_ops_ok_args_t(jcp.isa,
             {sum, eltwise, binary}, post_ops, &dst_d,
@@ -244,6 +247,14 @@ bool post_ops_ok(jit_brgemm_conv_conf_t &jcp, primitive_attr_t &attr,
                     broadcasting_strategy_t::no_broadcast}));
 }
 
+status_t init_conv_attr(
+        primitive_attr_t &conv_attr, const primitive_attr_t &attr) {
+    CHECK(conv_attr.copy_from(attr));
+    auto &po = conv_attr.post_ops_;
+    if (po.len() > 0 && po.entry_.back().is_pooling()) po.entry_.pop_back();
+    return status::success;
+}
+
 bool is_groups_ok(jit_brgemm_conv_conf_t &jcp) {
     // Enable grouped convs for the shapes not supported in direct convs
     // direct approach only supports int8/bf16 grouped conv
@@ -1058,6 +1069,8 @@ void brg_blocking_t::iterate_ker_block(brg_blocking_t &best_brgb, int kd_block_,
         const auto spb = div_up(sp, ns);
         if (spb == prev_spb || spb > start_sp_block) continue;
         if (is_os_blocking && spb != ow) continue;
+        // a block of pooling post-op windows must not be split by threads
+        if (with_pooling && spb != ow && spb % pool_kw != 0) continue;
         prev_spb = spb;
         ow_block = spb;
         sp_block = ow_block;
@@ -1716,12 +1729,44 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     if (!IMPLICATION(is_f32, one_of(isa, avx512_core, avx2) || jcp.is_bf32))
         return status::unimplemented;
 
+    const auto &p = attr.post_ops_;
+    const int pool_ind = p.find(primitive_kind::pooling);
+    jcp.with_pooling = pool_ind != -1;
+    if (jcp.with_pooling) {
+        // Pooling is applied to the final dst values of non-overlapping
+        // windows, so it must be the last post-op and nothing may read dst.
+        const auto &pool = p.entry_[pool_ind].pooling;
+        jcp.pool_alg = pool.alg;
+        jcp.pool_kh = static_cast<int>(pool.kernel_h);
+        jcp.pool_kw = static_cast<int>(pool.kernel_w);
+        const bool pool_ok = pool_ind == p.len() - 1 && jcp.ndims == 4
+                && one_of(jcp.prop_kind, forward_training, forward_inference)
+                && everyone_is(-1, p.find(primitive_kind::sum),
+                        p.find(primitive_kind::binary),
+                        p.find(primitive_kind::prelu))
+                && jcp.oh >= jcp.pool_kh && jcp.ow >= jcp.pool_kw;
+        if (!pool_ok) return status::unimplemented;
+    }
+
+    jcp.with_bnorm_stats = !attr.bnorm_stats_.has_default_values();
+    if (jcp.with_bnorm_stats) {
+        // The kernels collect the statistics from the values they store to
+        // dst, so dst must hold the convolution output in a floating-point
+        // data type.
+        const bool stats_ok = !jcp.with_pooling
+                && one_of(jcp.prop_kind, forward_training, forward_inference)
+                && one_of(jcp.dst_dt, f32, bf16, f16);
+        if (!stats_ok) return status::unimplemented;
+        // Sums and sums of squares for every channel, padded to a cache line
+        // of floats to avoid false sharing between work items.
+        jcp.stats_buffer_size = rnd_up(2 * jcp.oc_without_padding, 16);
+    }
+
     if (!post_ops_ok(jcp, attr, dst_d)) return status::unimplemented;
 
     jcp.amx_h = 16;
     jcp.amx_w = 64 / (jcp.is_bf32 ? types::data_type_size(bf16) : jcp.src_dsz);
 
-    const auto &p = attr.post_ops_;
     jcp.with_sum = p.find(primitive_kind::sum) != -1;
     const int eltwise_ind = p.find(primitive_kind::eltwise);
     jcp.with_eltwise = eltwise_ind != -1;
@@ -1835,6 +1880,9 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
     int selected_ur = 0;
     MAYBE_UNUSED(selected_ur);
 
+    primitive_attr_t conv_attr;
+    CHECK(init_conv_attr(conv_attr, attr));
+
     auto try_exec_type = [&]() {
         brg_blocking_t best_brgb = zero<decltype(best_brgb)>();
         best_brgb.oc_block = min_oc_block;
@@ -1857,7 +1905,7 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
             const status_t blocking_ok = cur_brgb.calc_blocks();
             if (blocking_ok != status::success) continue;
 
-            const status_t st = cur_brgb.get_brgemm_ur(&attr, dst_md);
+            const status_t st = cur_brgb.get_brgemm_ur(&conv_attr, dst_md);
             if (st != status::success) continue;
             cur_brgb.eff = cur_brgb.est_eff();
             if (cur_brgb.eff > best_brgb.eff) best_brgb = cur_brgb;
@@ -1979,7 +2027,8 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
                 && jcp.t_pad < jcp.kh && jcp.b_pad < jcp.kh
                 && jcp.r_pad < jcp.kw && jcp.l_pad < jcp.kw;
 
-        if (is_amx(isa)
+        // The unrolled kernel does not collect statistics.
+        if (is_amx(isa) && !jcp.with_bnorm_stats
                 && IMPLICATION(!jcp.is_relo,
                         /* heuristic */ jcp.kw_sets == 1 && jcp.ow < 256)) {
             jcp.use_M_mask = jcp.is_os_blocking ? 2 : 0;
@@ -2017,7 +2066,7 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
     }
     if (try_exec_base && try_exec_type_res == false) {
         jcp.exec_type = exec_base;
-        if (is_amx(isa) && jcp.ow < (8 * 1024)) {
+        if (is_amx(isa) && !jcp.with_bnorm_stats && jcp.ow < (8 * 1024)) {
             jcp.use_uker = true;
             jcp.use_interleave_stores = true;
             jcp.hint_prefetching = brgemm_kernel_prefetching_t::brgemm_prf1;
@@ -2051,6 +2100,21 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
 
     jcp.buffer_size = jcp.LDC * jcp.M;
 
+    if (jcp.with_pooling) {
+        // Each work item computes whole rows of pooling windows into a
+        // per-thread buffer with the dst row layout and reduces them right
+        // away, so the buffer stays in cache and only pooled values are
+        // written to dst.
+        if (jcp.is_os_blocking) {
+            if (jcp.oh_block % jcp.pool_kh != 0) return status::unimplemented;
+        } else
+            jcp.oh_block = rnd_up(jcp.oh_block, jcp.pool_kh);
+        if (jcp.ow_block != jcp.ow && jcp.ow_block % jcp.pool_kw != 0)
+            return status::unimplemented;
+        jcp.pool_buffer_size = static_cast<dim_t>(jcp.oh_block) * jcp.ow
+                * jcp.oc_without_padding;
+    }
+
     jcp.nb_od = div_up(jcp.od, jcp.od_block);
     jcp.nb_oh = div_up(jcp.oh, jcp.oh_block);
 
@@ -2165,7 +2229,7 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     const memory_desc_wrapper dst_d(&dst_md);
     const memory_desc_wrapper bias_d(&bias_md);
 
-    if (!jcp.is_1x1) return status::unimplemented;
+    if (!jcp.is_1x1 || jcp.with_pooling) return status::unimplemented;
 
     using namespace data_type;
     // ===================== blocking =================================
@@ -2376,6 +2440,18 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_buffer, jcp.nthr * jcp.buffer_size,
                 jcp.acc_dsz, 0, P4K);
     }
+    if (jcp.with_pooling) {
+        scratchpad.book(key_conv_brgemm_pool_buffer,
+                jcp.nthr * jcp.pool_buffer_size, jcp.dst_dsz, 0, P4K);
+    }
+    if (jcp.with_bnorm_stats) {
+        // One slot per spatial work item: the slots do not depend on the
+        // number of threads and are reduced in a fixed order.
+        const dim_t nslots = static_cast<dim_t>(jcp.mb) * jcp.nb_od
+                * jcp.nb_oh * jcp.nb_ow;
+        scratchpad.book(key_conv_brgemm_stats, nslots * jcp.stats_buffer_size,
+                sizeof(float), 64);
+    }
     if (is_amx(jcp.isa)) {
         scratchpad.book(key_conv_amx_tile_buffer,
                 jcp.nthr * jcp.amx_buf_size_per_thread, sizeof(char), 0, P4K);
@@ -2487,7 +2563,11 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
 
         /* find the best thread distribution with lowest memory cost */
 
-        const int nthr_mb_max = nstl::min(nthr, jcp.nthr_mb_work);
+        // In deterministic mode every element of diff_weights is accumulated
+        // by a single thread.
+        const int nthr_mb_max = dnnl_thr_deterministic()
+                ? 1
+                : nstl::min(nthr, jcp.nthr_mb_work);
         for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
             const int nthr_par = nthr / nthr_mb;
             const int nthr_oc_b_max = nstl::min(nthr_par,
@@ -2517,11 +2597,14 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
     int nthr, nthr_mb, nthr_g, nthr_oc_b, nthr_ic_b;
     balance(nthr, nthr_mb, nthr_g, nthr_oc_b, nthr_ic_b);
 
-    // empiric balancing for some shapes
+    // empiric balancing for some shapes, all of them split the reduction
+    const bool empiric_balance_ok = !dnnl_thr_deterministic();
     const auto sps = (jcp.ih * jcp.iw);
     bool neat_1x1
             = everyone_is(1, jcp.id, jcp.kh, jcp.kw, jcp.ngroups, jcp.stride_h);
-    if (neat_1x1 && jcp.nthr >= 28 && jcp.mb >= jcp.nthr) {
+    if (!empiric_balance_ok) {
+        // keep the balance found above
+    } else if (neat_1x1 && jcp.nthr >= 28 && jcp.mb >= jcp.nthr) {
         const bool more_oc = (jcp.ic < jcp.oc);
         if (sps >= 56 * 56 && jcp.ic >= 64 && jcp.oc >= 64) {
             nthr_mb = jcp.nthr;
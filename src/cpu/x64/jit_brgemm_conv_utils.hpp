@@ -41,6 +41,11 @@ bool is_amx(cpu_isa_t isa);
 bool uses_batch_elements(
         brgemm_batch_kind_t brg_type, conv_brgemm_exec_type_t exec_type);
 
+// Copies attributes without the pooling post-op, which is applied by the
+// convolution driver rather than by brgemm kernels.
+status_t init_conv_attr(
+        primitive_attr_t &conv_attr, const primitive_attr_t &attr);
+
 status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
         cpu_isa_t isa, const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
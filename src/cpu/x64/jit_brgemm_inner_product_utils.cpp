@@ -513,8 +513,11 @@ status_t jit_brgemm_ip_fwd_conf_t::init_conf(cpu_isa_t isa,
     //    in os and oc dimensions w/o enabling IC parallelism.
     bool use_parallel_ic_reduction_for_f32 = is_f32_compute && jbgp.ic > 1024
             && low_work_amount && jbgp.nthr > 1 && !is_gigantic_shape;
-    bool use_parallel_ic_reduction = use_parallel_ic_reduction_for_f32
-            || use_parallel_ic_reduction_for_bf16;
+    // In deterministic mode IC is not split between threads, so that the
+    // order of the accumulation does not depend on the number of threads.
+    bool use_parallel_ic_reduction = !dnnl_thr_deterministic()
+            && (use_parallel_ic_reduction_for_f32
+                    || use_parallel_ic_reduction_for_bf16);
 
     // For os > 256, compute all os blocks as a single chunk when performing
     // IC reduction. Note that this condition is empirical
@@ -1061,7 +1064,11 @@ void jit_brgemm_ip_bwd_w_conf_t::thread_balance(int &nb_os_blocking_,
 
     /* find the best thread distribution with lowest memory cost */
     const int min_osb_chunk = is_f32 ? 32 : is_xf16 ? 8 : 1;
-    const int nthr_mb_max = nstl::min(nthr, div_up(j.nb_os, min_osb_chunk));
+    // In deterministic mode every element of diff_weights is accumulated by a
+    // single thread.
+    const int nthr_mb_max = dnnl_thr_deterministic()
+            ? 1
+            : nstl::min(nthr, div_up(j.nb_os, min_osb_chunk));
     for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
         int nb_os_blocking = j.nb_os_blocking;
         int os_chunks = div_up(j.nb_os, nb_os_blocking);
@@ -359,6 +359,7 @@ struct brgemm_kernel_post_ops_t {
     int32_t *s8s8_compensation;
     const void *dst_orig;
     void *ptr_dst_scales;
+    void *ptr_stats;
 };
 
 template <cpu_isa_t isa>
@@ -496,7 +497,9 @@ private:
     constexpr static int reg_zp_a_val_offs_ = 48;
     constexpr static int reg_apply_comp_offs_ = 56;
     constexpr static int reg_dst_scales_offs_ = 64;
-    constexpr static int stack_space_needed_ = 72;
+    constexpr static int reg_stats_offs_ = 72;
+    constexpr static int aux_reg_stats_offs_ = 80;
+    constexpr static int stack_space_needed_ = 88;
 
     /* bf16 emulation */
     Xbyak::Zmm bf16_emu_reserv_1 = Xbyak::Zmm(27);
@@ -718,6 +721,38 @@ private:
         }
     }
 
+    // Adds the values about to be stored to the per-channel sums and sums of
+    // squares located LDD elements apart.
+    void accumulate_stats(int m_block, int n_block, int tail = 0) {
+        const auto k_mask = (tail == 0) ? k_full_mask : k_tail_mask;
+        const bool use_masks = IMPLICATION(tail > 0, isa_has_masks(isa));
+        const int simd_w = vreg_traits<Vmm>::vlen / sizeof(float);
+        const auto vmm_stat = vmm_tmp(0);
+        mov(reg_tmp, ptr[rsp + aux_reg_stats_offs_]);
+        for_(int is_sqsum = 0; is_sqsum < 2; is_sqsum++)
+        for (int n = 0; n < n_block; n++) {
+            const size_t offset
+                    = sizeof(float) * (n * brg.ld_block + is_sqsum * LDD_);
+            const auto addr = ptr[reg_tmp + offset];
+            if (use_masks)
+                vmovups(maybe_mask(vmm_stat, tail > 0, false, k_mask), addr);
+            else
+                load_data(data_type::f32, vmm_stat, addr, tail);
+            for (int m = 0; m < m_block; m++) {
+                const auto vmm = vector(m, n, n_block);
+                if (is_sqsum)
+                    uni_vfmadd231ps(vmm_stat, vmm, vmm);
+                else
+                    uni_vaddps(vmm_stat, vmm_stat, vmm);
+            }
+            if (use_masks)
+                vmovups(addr, maybe_mask(vmm_stat, tail > 0, true, k_mask));
+            else
+                store_data(data_type::f32, vmm_stat, reg_tmp, offset,
+                        tail > 0 ? tail : simd_w);
+        }
+    }
+
     void apply_post_ops(int m_block, int n_block, int tail = 0) {
         const auto vector = [=](int m, int n) { return Vmm(m * n_block + n); };
         auto k_mask = (tail == 0) ? k_full_mask : k_tail_mask;
@@ -821,6 +856,9 @@ private:
             }
         }
 
+        if (brg.beta != 0 && brg.with_stats)
+            accumulate_stats(m_block, n_block, tail);
+
         const bool dt_requires_saturation = types::is_integral_dt(out_dt_);
 
         const reg64_t reg_tmp_gpr = reg_tmp;
@@ -898,6 +936,10 @@ private:
                 mov(ptr[rsp + aux_reg_s8s8_comp_offs_], aux_reg_s8s8_comp);
             }
             mov(aux_reg_scales, reg_scales);
+            if (brg.with_stats) {
+                mov(reg_tmp, ptr[rsp + reg_stats_offs_]);
+                mov(ptr[rsp + aux_reg_stats_offs_], reg_tmp);
+            }
         }
         mov(aux_reg_out, reg_out);
 
@@ -932,6 +974,11 @@ private:
                 }
 
                 add(aux_reg_scales, is_oc_scale_ * sizeof(float) * oc_l_offset);
+                if (brg.with_stats) {
+                    mov(reg_tmp, ptr[rsp + aux_reg_stats_offs_]);
+                    add(reg_tmp, sizeof(float) * oc_l_offset);
+                    mov(ptr[rsp + aux_reg_stats_offs_], reg_tmp);
+                }
             }
         }
         if (nb2_tail > 0) {
@@ -964,6 +1011,11 @@ private:
                 }
 
                 add(aux_reg_scales, is_oc_scale_ * sizeof(float) * oc_l_offset);
+                if (brg.with_stats) {
+                    mov(reg_tmp, ptr[rsp + aux_reg_stats_offs_]);
+                    add(reg_tmp, sizeof(float) * oc_l_offset);
+                    mov(ptr[rsp + aux_reg_stats_offs_], reg_tmp);
+                }
             }
         }
         if (nb_tail > 0) {
@@ -1050,6 +1102,10 @@ private:
                 mov(reg_dst_scales, ptr[param1 + GET_OFF(ptr_dst_scales)]);
                 mov(ptr[rsp + reg_dst_scales_offs_], reg_dst_scales);
             }
+            if (brg.with_stats) {
+                mov(reg_tmp, ptr[param1 + GET_OFF(ptr_stats)]);
+                mov(ptr[rsp + reg_stats_offs_], reg_tmp);
+            }
         }
         mov(reg_out, ptr[param1 + GET_OFF(ptr_out)]);
 
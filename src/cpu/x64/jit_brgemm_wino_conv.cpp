@@ -0,0 +1,414 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+bool brgemm_wino_convolution_fwd_t<isa>::pd_t::post_ops_ok() const {
+    const auto &p = attr()->post_ops_;
+    for (int i = 0; i < p.len(); i++) {
+        const auto &e = p.entry_[i];
+        if (e.is_eltwise()) {
+            if (!eltwise_injector::is_supported(trans_isa, e.eltwise.alg))
+                return false;
+        } else if (e.is_sum(false)) {
+            if (!one_of(e.sum.dt, data_type::undef, dst_md()->data_type))
+                return false;
+        } else
+            return false;
+    }
+    return true;
+}
+
+// Compares the amount of arithmetic of direct and Winograd algorithms. The
+// latter runs smaller GEMMs and spends time in transforms, so it is only
+// chosen when it saves a considerable part of the work.
+template <cpu_isa_t isa>
+bool brgemm_wino_convolution_fwd_t<isa>::pd_t::is_winograd_profitable() const {
+    const auto &jcp = jcp_;
+    // Direct bf16 convolution on AMX outperforms AVX-512 based GEMMs.
+    if (jcp.wino_dt == bf16 && mayiuse(avx512_core_amx)) return false;
+    if (jcp.ic < 64 || jcp.oc < 64) return false;
+
+    const double alpha2 = jcp.alpha * jcp.alpha;
+    const double tiles = (double)jcp.mb * jcp.nb_tiles;
+    const double gemm_ops = tiles * alpha2 * jcp.ic * jcp.oc;
+    const double trans_ops = tiles * alpha2 * jcp.alpha * (jcp.ic + jcp.oc);
+    const double direct_ops
+            = (double)jcp.mb * jcp.oh * jcp.ow * 9 * jcp.ic * jcp.oc;
+    return gemm_ops + trans_ops < 0.6 * direct_ops;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const convolution_desc_t &cd = *desc();
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto bia_type
+            = with_bias() ? weights_md(1)->data_type : data_type::undef;
+    const auto dst_type = dst_md(0)->data_type;
+
+    const bool is_bf16 = isa == avx512_core_bf16;
+    const bool dt_ok = is_bf16
+            ? everyone_is(bf16, src_type, wei_type)
+                    && one_of(dst_type, bf16, f32)
+                    && one_of(bia_type, data_type::undef, bf16, f32)
+            : everyone_is(f32, src_type, wei_type, dst_type)
+                    && one_of(bia_type, data_type::undef, f32);
+
+    bool ok = is_fwd() && mayiuse(isa) && dt_ok
+            && one_of(cd.alg_kind, alg_kind::convolution_winograd,
+                    alg_kind::convolution_auto)
+            && ndims() == 4 && !with_groups()
+            && attr()->has_default_values(skip_mask_t::post_ops, dst_type)
+            && post_ops_ok() && !has_zero_dim_memory()
+            && set_default_formats_common(nhwc, hwio, nhwc);
+    if (!ok) return status::unimplemented;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper weights_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const memory_desc_wrapper bias_d(weights_md(1));
+    ok = src_d.matches_tag(nhwc) && dst_d.matches_tag(nhwc)
+            && weights_d.is_plain()
+            && IMPLICATION(with_bias(), bias_d.is_dense());
+    if (!ok) return status::unimplemented;
+
+    auto &jcp = jcp_;
+    jcp = zero<decltype(jcp)>();
+    jcp.nthr = dnnl_get_max_threads();
+    jcp.mb = MB();
+    jcp.ic = IC();
+    jcp.oc = OC();
+    jcp.ih = IH();
+    jcp.iw = IW();
+    jcp.oh = OH();
+    jcp.ow = OW();
+    jcp.t_pad = padT();
+    jcp.l_pad = padL();
+    jcp.r = 3;
+
+    const int b_pad = padB();
+    const int r_pad = padR();
+    // Only "same" and "valid" paddings are supported.
+    ok = KH() == jcp.r && KW() == jcp.r && KSH() == 1 && KSW() == 1
+            && KDH() == 0 && KDW() == 0
+            && everyone_is(true, jcp.t_pad >= 0, jcp.t_pad <= 1,
+                    jcp.l_pad >= 0, jcp.l_pad <= 1, b_pad >= 0, b_pad <= 1,
+                    r_pad >= 0, r_pad <= 1);
+    if (!ok) return status::unimplemented;
+
+    jcp.isa = trans_isa;
+    jcp.brg_isa = isa;
+    jcp.simd_w = cpu_isa_traits<trans_isa>::vlen / sizeof(float);
+    if (jcp.ic % jcp.simd_w != 0 || jcp.oc % jcp.simd_w != 0)
+        return status::unimplemented;
+
+    jcp.src_dt = src_type;
+    jcp.wei_dt = wei_type;
+    jcp.bia_dt = bia_type;
+    jcp.dst_dt = dst_type;
+    jcp.wino_dt = src_type;
+    jcp.with_bias = with_bias();
+    jcp.with_sum = attr()->post_ops_.find(primitive_kind::sum) != -1;
+    jcp.with_eltwise = attr()->post_ops_.find(primitive_kind::eltwise) != -1;
+    jcp.src_dsz = types::data_type_size(jcp.src_dt);
+    jcp.bia_dsz = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+    jcp.dst_dsz = types::data_type_size(jcp.dst_dt);
+    jcp.wino_dsz = types::data_type_size(jcp.wino_dt);
+
+    // F(6x6, 3x3) needs fewer products per output point but is less
+    // accurate, so it is used for f32 only and only when tiles fit the output
+    // well enough.
+    auto tiles_cost = [&](int m) {
+        const int alpha = m + jcp.r - 1;
+        return (dim_t)div_up(jcp.oh, m) * div_up(jcp.ow, m) * alpha * alpha;
+    };
+    jcp.m = !is_bf16 && 10 * tiles_cost(6) < 9 * tiles_cost(4) ? 6 : 4;
+    jcp.alpha = jcp.m + jcp.r - 1;
+    jcp.tile_h = div_up(jcp.oh, jcp.m);
+    jcp.tile_w = div_up(jcp.ow, jcp.m);
+    jcp.nb_tiles = jcp.tile_h * jcp.tile_w;
+
+    if (cd.alg_kind == alg_kind::convolution_auto
+            && !is_winograd_profitable())
+        return status::unimplemented;
+    if (!set_default_alg_kind(alg_kind::convolution_winograd))
+        return status::unimplemented;
+
+    // Transformed src and products of a block of tiles should stay in L2.
+    const dim_t alpha2 = jcp.alpha * jcp.alpha;
+    const dim_t total_tiles = (dim_t)jcp.mb * jcp.nb_tiles;
+    const dim_t tile_bytes = alpha2
+            * (jcp.ic * (dim_t)jcp.wino_dsz + jcp.oc * (dim_t)sizeof(float));
+    const dim_t l2_tiles
+            = platform::get_per_core_cache_size(2) / 2 / tile_bytes;
+    jcp.tile_block = (int)nstl::max<dim_t>(1,
+            nstl::min<dim_t>(nstl::min<dim_t>(l2_tiles, 64),
+                    div_up(total_tiles, jcp.nthr)));
+    jcp.nb_tile_blocks = (int)div_up(total_tiles, jcp.tile_block);
+    jcp.tile_block_tail = (int)(total_tiles % jcp.tile_block);
+
+    for (int i = 0; i < 2; i++) {
+        const int M = i == 0 ? jcp.tile_block : jcp.tile_block_tail;
+        if (M == 0) continue;
+        brgemm_t &brg = brgs_[i];
+        CHECK(brgemm_desc_init(&brg, jcp.brg_isa, brgemm_addr, jcp.wino_dt,
+                jcp.wino_dt, false /*transA*/, false /*transB*/,
+                brgemm_row_major, 1.f /*alpha*/, 0.f /*beta*/, jcp.ic, jcp.oc,
+                jcp.oc, M, jcp.oc, jcp.ic));
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        brgattr.hint_expected_A_size = M * jcp.ic;
+        brgattr.hint_expected_B_size = jcp.ic * jcp.oc;
+        brgattr.hint_expected_C_size = M * jcp.oc;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+
+    init_scratchpad();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    const auto &jcp = jcp_;
+    const size_t alpha2 = jcp.alpha * jcp.alpha;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_wino_U, alpha2 * jcp.ic * jcp.oc, jcp.wino_dsz);
+    // Transformed src of a tile block followed by a zero-padded copy of a
+    // single src tile.
+    scratchpad.book(key_wino_V,
+            jcp.nthr * alpha2 * (jcp.tile_block + 1) * jcp.ic, jcp.wino_dsz);
+    scratchpad.book<float>(
+            key_wino_M, jcp.nthr * alpha2 * jcp.tile_block * jcp.oc);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::init(engine_t *engine) {
+    const auto &jcp = pd()->jcp_;
+
+    CHECK(safe_ptr_assign(
+            src_trans_, new trans_kernel_t(jcp, trans_kernel_t::kind_t::src)));
+    CHECK(src_trans_->create_kernel());
+    CHECK(safe_ptr_assign(dst_trans_,
+            new trans_kernel_t(jcp, trans_kernel_t::kind_t::dst,
+                    pd()->attr()->post_ops_)));
+    CHECK(dst_trans_->create_kernel());
+
+    for (int i = 0; i < 2; i++) {
+        if (i == 1 && jcp.tile_block_tail == 0) continue;
+        brgemm_kernel_t *brg_kernel = nullptr;
+        CHECK(brgemm_kernel_create(&brg_kernel, pd()->brgs_[i]));
+        CHECK(safe_ptr_assign(brg_kernels_[i], brg_kernel));
+    }
+    return status::success;
+}
+
+// U = G g G^T, stored as U[a][ic][oc] or, for bf16, in VNNI layout
+// U[a][ic / 2][oc][2] expected by brgemm.
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::transform_weights(
+        const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+    const auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const memory_desc_wrapper weights_d(pd()->weights_md());
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    char *U = scratchpad.template get<char>(key_wino_U);
+
+    const int r = jcp.r;
+    const int alpha = jcp.alpha;
+    const float *G = brgemm_wino::get_g(jcp.m);
+    const bool is_bf16 = jcp.wino_dt == bf16;
+
+    parallel_nd(jcp.ic, jcp.oc, [&](dim_t ic, dim_t oc) {
+        float g[3][3];
+        for_(int kh = 0; kh < r; kh++)
+        for (int kw = 0; kw < r; kw++) {
+            const auto off = weights_d.off(oc, ic, kh, kw);
+            g[kh][kw] = is_bf16
+                    ? static_cast<float>(
+                            reinterpret_cast<const bfloat16_t *>(weights)[off])
+                    : reinterpret_cast<const float *>(weights)[off];
+        }
+
+        float Gg[8][3];
+        for_(int i = 0; i < alpha; i++)
+        for (int l = 0; l < r; l++) {
+            Gg[i][l] = 0.f;
+            for (int k = 0; k < r; k++)
+                Gg[i][l] += G[i * r + k] * g[k][l];
+        }
+
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            float u = 0.f;
+            for (int l = 0; l < r; l++)
+                u += Gg[i][l] * G[j * r + l];
+            const dim_t a = i * alpha + j;
+            if (is_bf16) {
+                const dim_t off
+                        = ((a * (jcp.ic / 2) + ic / 2) * jcp.oc + oc) * 2
+                        + ic % 2;
+                reinterpret_cast<bfloat16_t *>(U)[off] = u;
+            } else {
+                reinterpret_cast<float *>(U)[(a * jcp.ic + ic) * jcp.oc + oc]
+                        = u;
+            }
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    transform_weights(ctx);
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    const char *U = scratchpad.template get<char>(key_wino_U);
+    char *V_base = scratchpad.template get<char>(key_wino_V);
+    float *M_base = scratchpad.template get<float>(key_wino_M);
+
+    const int m = jcp.m;
+    const int alpha = jcp.alpha;
+    const dim_t alpha2 = alpha * alpha;
+    const dim_t total_tiles = (dim_t)jcp.mb * jcp.nb_tiles;
+    const size_t src_row_size = jcp.ic * jcp.src_dsz;
+    const size_t V_thr_size = alpha2 * (jcp.tile_block + 1) * src_row_size;
+    const size_t stage_size = alpha2 * src_row_size;
+    const dim_t M_thr_size = alpha2 * jcp.tile_block * jcp.oc;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211((dim_t)jcp.nb_tile_blocks, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *V = V_base + ithr * V_thr_size;
+        char *stage = V + alpha2 * jcp.tile_block * src_row_size;
+        float *M = M_base + ithr * M_thr_size;
+        brgemm_batch_element_t batch;
+        brgemm_wino::jit_brgemm_wino_trans_call_s p;
+
+        for (dim_t tbi = start; tbi < end; tbi++) {
+            const dim_t tile_start = tbi * jcp.tile_block;
+            const int nt = (int)nstl::min<dim_t>(
+                    jcp.tile_block, total_tiles - tile_start);
+
+            for (int t = 0; t < nt; t++) {
+                const dim_t tile = tile_start + t;
+                const dim_t n = tile / jcp.nb_tiles;
+                const int th = (int)(tile % jcp.nb_tiles) / jcp.tile_w;
+                const int tw = (int)(tile % jcp.nb_tiles) % jcp.tile_w;
+                const int ih0 = th * m - jcp.t_pad;
+                const int iw0 = tw * m - jcp.l_pad;
+
+                p = brgemm_wino::jit_brgemm_wino_trans_call_s();
+                if (ih0 >= 0 && iw0 >= 0 && ih0 + alpha <= jcp.ih
+                        && iw0 + alpha <= jcp.iw) {
+                    p.src = src
+                            + src_d.blk_off(n, 0, ih0, iw0) * jcp.src_dsz;
+                    p.src_row_stride = jcp.iw * src_row_size;
+                } else {
+                    // Tiles crossing the borders go through a zero-padded
+                    // copy.
+                    std::memset(stage, 0, stage_size);
+                    const int i_s = nstl::max(0, -ih0);
+                    const int i_e = nstl::min(alpha, jcp.ih - ih0);
+                    const int j_s = nstl::max(0, -iw0);
+                    const int j_e = nstl::min(alpha, jcp.iw - iw0);
+                    for (int i = i_s; i < i_e && j_s < j_e; i++)
+                        std::memcpy(stage + (i * alpha + j_s) * src_row_size,
+                                src
+                                        + src_d.blk_off(n, 0, ih0 + i,
+                                                  iw0 + j_s)
+                                                * jcp.src_dsz,
+                                (j_e - j_s) * src_row_size);
+                    p.src = stage;
+                    p.src_row_stride = alpha * src_row_size;
+                }
+                p.dst = V + t * src_row_size;
+                (*src_trans_)(&p);
+            }
+
+            const auto brg_kernel
+                    = brg_kernels_[nt == jcp.tile_block ? 0 : 1].get();
+            for (dim_t a = 0; a < alpha2; a++) {
+                batch.ptr.A = V + a * jcp.tile_block * src_row_size;
+                batch.ptr.B = U + a * jcp.ic * jcp.oc * jcp.wino_dsz;
+                brgemm_kernel_execute(brg_kernel, 1, &batch,
+                        (void *)(M + a * jcp.tile_block * jcp.oc));
+            }
+
+            for (int t = 0; t < nt; t++) {
+                const dim_t tile = tile_start + t;
+                const dim_t n = tile / jcp.nb_tiles;
+                const int oh0 = (int)(tile % jcp.nb_tiles) / jcp.tile_w * m;
+                const int ow0 = (int)(tile % jcp.nb_tiles) % jcp.tile_w * m;
+
+                p = brgemm_wino::jit_brgemm_wino_trans_call_s();
+                p.src = M + t * jcp.oc;
+                p.dst = dst + dst_d.blk_off(n, 0, oh0, ow0) * jcp.dst_dsz;
+                p.bias = bias;
+                p.valid_rows = nstl::min(m, jcp.oh - oh0);
+                p.valid_cols = nstl::min(m, jcp.ow - ow0);
+                (*dst_trans_)(&p);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_wino_convolution_fwd_t<avx2>;
+template struct brgemm_wino_convolution_fwd_t<avx512_core>;
+template struct brgemm_wino_convolution_fwd_t<avx512_core_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
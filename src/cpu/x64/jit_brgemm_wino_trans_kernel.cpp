@@ -0,0 +1,373 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_trans_kernel.hpp"
+
+#define GET_OFF(field) offsetof(jit_brgemm_wino_trans_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino {
+
+using namespace dnnl::impl::data_type;
+using namespace Xbyak;
+
+namespace {
+// F(4x4, 3x3), alpha = 6
+// clang-format off
+const float bt_4[6 * 6] = {
+    4.f,  0.f, -5.f,  0.f, 1.f, 0.f,
+    0.f, -4.f, -4.f,  1.f, 1.f, 0.f,
+    0.f,  4.f, -4.f, -1.f, 1.f, 0.f,
+    0.f, -2.f, -1.f,  2.f, 1.f, 0.f,
+    0.f,  2.f, -1.f, -2.f, 1.f, 0.f,
+    0.f,  4.f,  0.f, -5.f, 0.f, 1.f,
+};
+const float g_4[6 * 3] = {
+    1.f / 4,    0.f,         0.f,
+    -1.f / 6,   -1.f / 6,    -1.f / 6,
+    -1.f / 6,   1.f / 6,     -1.f / 6,
+    1.f / 24,   1.f / 12,    1.f / 6,
+    1.f / 24,   -1.f / 12,   1.f / 6,
+    0.f,        0.f,         1.f,
+};
+const float at_4[4 * 6] = {
+    1.f, 1.f,  1.f, 1.f,  1.f, 0.f,
+    0.f, 1.f, -1.f, 2.f, -2.f, 0.f,
+    0.f, 1.f,  1.f, 4.f,  4.f, 0.f,
+    0.f, 1.f, -1.f, 8.f, -8.f, 1.f,
+};
+
+// F(6x6, 3x3), alpha = 8
+const float bt_6[8 * 8] = {
+    1.f,  0.f,    -21.f / 4, 0.f,       21.f / 4, 0.f,     -1.f, 0.f,
+    0.f,  1.f,     1.f,     -17.f / 4, -17.f / 4, 1.f,      1.f, 0.f,
+    0.f, -1.f,     1.f,      17.f / 4, -17.f / 4, -1.f,     1.f, 0.f,
+    0.f,  1.f / 2, 1.f / 4, -5.f / 2,  -5.f / 4,  2.f,      1.f, 0.f,
+    0.f, -1.f / 2, 1.f / 4,  5.f / 2,  -5.f / 4, -2.f,      1.f, 0.f,
+    0.f,  2.f,     4.f,     -5.f / 2,  -5.f,      1.f / 2,  1.f, 0.f,
+    0.f, -2.f,     4.f,      5.f / 2,  -5.f,     -1.f / 2,  1.f, 0.f,
+    0.f, -1.f,     0.f,      21.f / 4,  0.f,     -21.f / 4, 0.f, 1.f,
+};
+const float g_6[8 * 3] = {
+    1.f,         0.f,          0.f,
+    -2.f / 9,    -2.f / 9,     -2.f / 9,
+    -2.f / 9,    2.f / 9,      -2.f / 9,
+    1.f / 90,    1.f / 45,     2.f / 45,
+    1.f / 90,    -1.f / 45,    2.f / 45,
+    32.f / 45,   16.f / 45,    8.f / 45,
+    32.f / 45,   -16.f / 45,   8.f / 45,
+    0.f,         0.f,          1.f,
+};
+const float at_6[6 * 8] = {
+    1.f, 1.f,  1.f, 1.f,   1.f,  1.f,      1.f,      0.f,
+    0.f, 1.f, -1.f, 2.f,  -2.f,  1.f / 2, -1.f / 2,  0.f,
+    0.f, 1.f,  1.f, 4.f,   4.f,  1.f / 4,  1.f / 4,  0.f,
+    0.f, 1.f, -1.f, 8.f,  -8.f,  1.f / 8, -1.f / 8,  0.f,
+    0.f, 1.f,  1.f, 16.f, 16.f,  1.f / 16, 1.f / 16, 0.f,
+    0.f, 1.f, -1.f, 32.f, -32.f, 1.f / 32, -1.f / 32, 1.f,
+};
+// clang-format on
+} // namespace
+
+const float *get_bt(int m) {
+    return m == 6 ? bt_6 : bt_4;
+}
+const float *get_g(int m) {
+    return m == 6 ? g_6 : g_4;
+}
+const float *get_at(int m) {
+    return m == 6 ? at_6 : at_4;
+}
+
+template <cpu_isa_t isa>
+jit_brgemm_wino_trans_kernel_t<isa>::jit_brgemm_wino_trans_kernel_t(
+        const jit_brgemm_wino_conv_conf_t &ajcp, kind_t kind,
+        const post_ops_t &post_ops)
+    : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+    , jcp(ajcp)
+    , kind_(kind)
+    , post_ops_(post_ops) {
+    if (kind_ != kind_t::dst) return;
+    for (const auto &e : post_ops_.entry_) {
+        if (!e.is_eltwise()) continue;
+        eltwise_injectors_.emplace_back(
+                new jit_uni_eltwise_injector_f32<isa>(this, e.eltwise,
+                        true /*save_state*/, reg_eltwise_table, Opmask(1)));
+    }
+}
+
+template <cpu_isa_t isa>
+int jit_brgemm_wino_trans_kernel_t<isa>::table_idx(float c) {
+    for (size_t i = 0; i < table_.size(); i++)
+        if (table_[i] == c) return static_cast<int>(i);
+    table_.push_back(c);
+    return static_cast<int>(table_.size()) - 1;
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_wino_trans_kernel_t<isa>::lincomb(
+        const Vmm &acc, const float *coefs, int n) {
+    bool first = true;
+    for (int k = 0; k < n; k++) {
+        const float c = coefs[k];
+        if (c == 0.f) continue;
+        const Vmm in = vmm_in(k);
+        const bool is_one = c == 1.f;
+        const bool is_minus_one = c == -1.f;
+        if (!is_one && !is_minus_one)
+            uni_vbroadcastss(
+                    vmm_coef, ptr[reg_table + table_idx(c) * sizeof(float)]);
+        if (first) {
+            if (is_one)
+                uni_vmovups(acc, in);
+            else if (is_minus_one) {
+                uni_vxorps(acc, acc, acc);
+                uni_vsubps(acc, acc, in);
+            } else
+                uni_vmulps(acc, in, vmm_coef);
+            first = false;
+        } else {
+            if (is_one)
+                uni_vaddps(acc, acc, in);
+            else if (is_minus_one)
+                uni_vsubps(acc, acc, in);
+            else
+                uni_vfmadd231ps(acc, in, vmm_coef);
+        }
+    }
+    if (first) uni_vxorps(acc, acc, acc);
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_wino_trans_kernel_t<isa>::load(
+        const Vmm &vmm, const Address &addr, data_type_t dt) {
+    switch (dt) {
+        case f32: uni_vmovups(vmm, addr); break;
+        case bf16:
+            vpmovzxwd(vmm, addr);
+            vpslld(vmm, vmm, 16);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_wino_trans_kernel_t<isa>::store(
+        const Address &addr, const Vmm &vmm, data_type_t dt) {
+    switch (dt) {
+        case f32: uni_vmovups(addr, vmm); break;
+        case bf16: {
+            const Ymm ymm(vmm.getIdx());
+            vcvtneps2bf16(ymm, vmm);
+            vmovdqu16(addr, ymm);
+        } break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+Address jit_brgemm_wino_trans_kernel_t<isa>::src_ptr(int row, int col) const {
+    // Rows are addressed relative to two bases four rows apart so that any of
+    // up to eight rows is reachable with a single scaled index.
+    const Reg64 base = row < 4 ? reg_src : reg_src4;
+    const dim_t off = (dim_t)col * jcp.ic * jcp.src_dsz;
+    switch (row % 4) {
+        case 0: return ptr[base + off];
+        case 1: return ptr[base + reg_stride + off];
+        case 2: return ptr[base + reg_stride * 2 + off];
+        default: return ptr[base + reg_stride3 + off];
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_wino_trans_kernel_t<isa>::generate_src_trans() {
+    const int alpha = jcp.alpha;
+    const float *bt = get_bt(jcp.m);
+    const dim_t a_stride = (dim_t)jcp.tile_block * jcp.ic * jcp.wino_dsz;
+
+    mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_stride, ptr[reg_param + GET_OFF(src_row_stride)]);
+    lea(reg_stride3, ptr[reg_stride + reg_stride * 2]);
+    lea(reg_src4, ptr[reg_src + reg_stride * 4]);
+
+    Label l_ic_loop;
+    mov(reg_cnt, jcp.ic / jcp.simd_w);
+    L(l_ic_loop);
+    {
+        // T = B^T d
+        for (int j = 0; j < alpha; j++) {
+            for (int k = 0; k < alpha; k++)
+                load(vmm_in(k), src_ptr(k, j), jcp.src_dt);
+            for (int i = 0; i < alpha; i++) {
+                lincomb(vmm_acc, &bt[i * alpha], alpha);
+                uni_vmovups(ws_ptr(i * alpha + j), vmm_acc);
+            }
+        }
+        // V = T B
+        for (int i = 0; i < alpha; i++) {
+            for (int k = 0; k < alpha; k++)
+                uni_vmovups(vmm_in(k), ws_ptr(i * alpha + k));
+            for (int j = 0; j < alpha; j++) {
+                lincomb(vmm_acc, &bt[j * alpha], alpha);
+                store(ptr[reg_dst + (i * alpha + j) * a_stride], vmm_acc,
+                        jcp.wino_dt);
+            }
+        }
+
+        add(reg_src, jcp.simd_w * jcp.src_dsz);
+        add(reg_src4, jcp.simd_w * jcp.src_dsz);
+        add(reg_dst, jcp.simd_w * jcp.wino_dsz);
+        dec(reg_cnt);
+        jnz(l_ic_loop, T_NEAR);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_wino_trans_kernel_t<isa>::apply_postops(
+        const Vmm &vmm, const Address &dst_addr) {
+    size_t eltwise_idx = 0;
+    for (const auto &e : post_ops_.entry_) {
+        if (e.is_sum(false)) {
+            load(vmm_tmp, dst_addr, jcp.dst_dt);
+            if (e.sum.scale == 1.f)
+                uni_vaddps(vmm, vmm, vmm_tmp);
+            else {
+                uni_vbroadcastss(vmm_coef,
+                        ptr[reg_table + table_idx(e.sum.scale) * sizeof(float)]);
+                uni_vfmadd231ps(vmm, vmm_tmp, vmm_coef);
+            }
+        } else if (e.is_eltwise()) {
+            eltwise_injectors_[eltwise_idx++]->compute_vector(vmm.getIdx());
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_wino_trans_kernel_t<isa>::generate_dst_trans() {
+    const int alpha = jcp.alpha;
+    const int m = jcp.m;
+    const float *at = get_at(m);
+    const dim_t a_stride = (dim_t)jcp.tile_block * jcp.oc * sizeof(float);
+    const dim_t dst_row_stride = (dim_t)jcp.ow * jcp.oc * jcp.dst_dsz;
+    const dim_t dst_col_stride = (dim_t)jcp.oc * jcp.dst_dsz;
+    const Vmm vmm_bias = Vmm(11);
+
+    mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    if (jcp.with_bias) mov(reg_bias, ptr[reg_param + GET_OFF(bias)]);
+    mov(reg_valid_rows, ptr[reg_param + GET_OFF(valid_rows)]);
+    mov(reg_valid_cols, ptr[reg_param + GET_OFF(valid_cols)]);
+
+    Label l_oc_loop;
+    mov(reg_cnt, jcp.oc / jcp.simd_w);
+    L(l_oc_loop);
+    {
+        // T = A^T M
+        for (int j = 0; j < alpha; j++) {
+            for (int k = 0; k < alpha; k++)
+                uni_vmovups(
+                        vmm_in(k), ptr[reg_src + (k * alpha + j) * a_stride]);
+            for (int i = 0; i < m; i++) {
+                lincomb(vmm_acc, &at[i * alpha], alpha);
+                uni_vmovups(ws_ptr(i * alpha + j), vmm_acc);
+            }
+        }
+        // Y = T A, row `i` of T is no longer needed once it is loaded, so
+        // the result overwrites it.
+        for (int i = 0; i < m; i++) {
+            for (int k = 0; k < alpha; k++)
+                uni_vmovups(vmm_in(k), ws_ptr(i * alpha + k));
+            for (int j = 0; j < m; j++) {
+                lincomb(vmm_acc, &at[j * alpha], alpha);
+                uni_vmovups(ws_ptr(i * alpha + j), vmm_acc);
+            }
+        }
+
+        if (jcp.with_bias) load(vmm_bias, ptr[reg_bias], jcp.bia_dt);
+
+        Label l_tile_done;
+        for (int i = 0; i < m; i++) {
+            Label l_row_done;
+            cmp(reg_valid_rows, i);
+            jle(l_tile_done, T_NEAR);
+            for (int j = 0; j < m; j++) {
+                cmp(reg_valid_cols, j);
+                jle(l_row_done, T_NEAR);
+                const auto dst_addr
+                        = ptr[reg_dst + i * dst_row_stride + j * dst_col_stride];
+                uni_vmovups(vmm_acc, ws_ptr(i * alpha + j));
+                if (jcp.with_bias) uni_vaddps(vmm_acc, vmm_acc, vmm_bias);
+                apply_postops(vmm_acc, dst_addr);
+                store(dst_addr, vmm_acc, jcp.dst_dt);
+            }
+            L(l_row_done);
+        }
+        L(l_tile_done);
+
+        add(reg_src, jcp.simd_w * sizeof(float));
+        add(reg_dst, jcp.simd_w * jcp.dst_dsz);
+        if (jcp.with_bias) add(reg_bias, jcp.simd_w * jcp.bia_dsz);
+        dec(reg_cnt);
+        jnz(l_oc_loop, T_NEAR);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_wino_trans_kernel_t<isa>::generate() {
+    const int ws_size = jcp.alpha * jcp.alpha * vlen;
+
+    preamble();
+    sub(rsp, ws_size);
+    mov(reg_ws, rsp);
+    mov(reg_table, l_table);
+
+    if (kind_ == kind_t::src)
+        generate_src_trans();
+    else
+        generate_dst_trans();
+
+    add(rsp, ws_size);
+    postamble();
+
+    align(64);
+    L(l_table);
+    for (const float c : table_)
+        dd(float2int(c));
+
+    for (auto &inj : eltwise_injectors_)
+        inj->prepare_table();
+}
+
+template struct jit_brgemm_wino_trans_kernel_t<avx512_core>;
+template struct jit_brgemm_wino_trans_kernel_t<avx2>;
+
+} // namespace brgemm_wino
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
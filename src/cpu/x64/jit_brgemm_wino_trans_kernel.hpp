@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_TRANS_KERNEL_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_TRANS_KERNEL_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/primitive_attr.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino {
+
+// Transformation matrices of Winograd F(m x m, 3 x 3) algorithm stored
+// row-major: B^T is alpha x alpha, G is alpha x r and A^T is m x alpha.
+const float *get_bt(int m);
+const float *get_g(int m);
+const float *get_at(int m);
+
+struct jit_brgemm_wino_trans_call_s {
+    const void *src;
+    void *dst;
+    const void *bias;
+    // Distance in bytes between rows of the src tile (input transform only).
+    size_t src_row_stride;
+    // Number of dst rows and columns to be stored (output transform only).
+    size_t valid_rows;
+    size_t valid_cols;
+};
+
+// Applies Winograd transforms to a single tile for all channels. Each
+// transformed value is a linear combination of alpha vectors with
+// compile-time coefficients, so the kernel is fully unrolled over the tile
+// and loops over channels only.
+// - src: computes V = B^T d B for an alpha x alpha src tile. The result for
+//   the point `a` is stored at `dst + a * tile_block * ic * wino_dsz`.
+// - dst: computes Y = A^T M A, applies bias and post-ops and stores the
+//   `valid_rows x valid_cols` part of the m x m result to dst.
+template <cpu_isa_t isa>
+struct jit_brgemm_wino_trans_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_wino_trans_kernel_t)
+
+    enum class kind_t { src, dst };
+
+    jit_brgemm_wino_trans_kernel_t(const jit_brgemm_wino_conv_conf_t &ajcp,
+            kind_t kind, const post_ops_t &post_ops = post_ops_t());
+
+    void operator()(const jit_brgemm_wino_trans_call_s *p) const {
+        jit_generator::operator()(p);
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    jit_brgemm_wino_conv_conf_t jcp;
+    kind_t kind_;
+    post_ops_t post_ops_;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_dst = r9;
+    const Xbyak::Reg64 reg_cnt = r10;
+    const Xbyak::Reg64 reg_table = r11;
+    const Xbyak::Reg64 reg_ws = r12;
+    // src transform
+    const Xbyak::Reg64 reg_src4 = r13;
+    const Xbyak::Reg64 reg_stride = r14;
+    const Xbyak::Reg64 reg_stride3 = r15;
+    // dst transform
+    const Xbyak::Reg64 reg_bias = r13;
+    const Xbyak::Reg64 reg_valid_rows = r14;
+    const Xbyak::Reg64 reg_valid_cols = r15;
+    // The eltwise injector uses rax as a pointer to its table.
+    const Xbyak::Reg64 reg_eltwise_table = rax;
+
+    // Vmm(0 .. alpha - 1) hold the values being combined.
+    Vmm vmm_in(int k) const { return Vmm(k); }
+    const Vmm vmm_acc = Vmm(8);
+    const Vmm vmm_coef = Vmm(9);
+    const Vmm vmm_tmp = Vmm(10);
+
+    Xbyak::Label l_table;
+    std::vector<float> table_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+
+    Xbyak::Address ws_ptr(int idx) const { return ptr[reg_ws + idx * vlen]; }
+    Xbyak::Address src_ptr(int row, int col) const;
+
+    int table_idx(float c);
+    void lincomb(const Vmm &acc, const float *coefs, int n);
+    void load(const Vmm &vmm, const Xbyak::Address &addr, data_type_t dt);
+    void store(const Xbyak::Address &addr, const Vmm &vmm, data_type_t dt);
+    void apply_postops(const Vmm &vmm, const Xbyak::Address &dst_addr);
+
+    void generate_src_trans();
+    void generate_dst_trans();
+    void generate() override;
+};
+
+} // namespace brgemm_wino
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -185,6 +185,7 @@ public:
         _cmp_neq_uq = 4u,
         _cmp_nlt_us = 5u,
         _cmp_nle_us = 6u,
+        _cmp_nge_us = 9u,
 
         _op_floor = 1u,
         _op_mxcsr = 4u,
@@ -617,6 +617,27 @@ struct jit_resampling_call_s {
     float weight_back = 0.0f;
 };
 
+// A point of diff_dst contributing to a point of diff_src in the backward
+// resampling: the byte offset of the point and the interpolation weight.
+struct jit_resampling_bwd_entry_t {
+    unsigned offset;
+    float weight;
+};
+
+struct jit_resampling_bwd_call_s {
+    const void *diff_dst = nullptr;
+    void *diff_src = nullptr;
+
+    // Contributions along the depth and height dimensions combined.
+    const jit_resampling_bwd_entry_t *entries_dh = nullptr;
+    const jit_resampling_bwd_entry_t *entries_dh_end = nullptr;
+
+    // Contributions along the width dimension, the ones for iw are
+    // entries_w[ranges_w[iw]:ranges_w[iw + 1]].
+    const unsigned *ranges_w = nullptr;
+    const jit_resampling_bwd_entry_t *entries_w = nullptr;
+};
+
 struct jit_brdgmm_conv_conf_t {
 
     int nthr;
@@ -656,6 +677,36 @@ struct jit_brdgmm_conv_conf_t {
     cpu_isa_t isa;
 };
 
+struct jit_brgemm_wino_conv_conf_t {
+    int nthr;
+    int mb, ic, oc;
+    int ih, iw, oh, ow;
+    int t_pad, l_pad;
+    // Winograd F(m x m, r x r) with alpha = m + r - 1.
+    int m, r, alpha;
+    int simd_w;
+    int tile_h, tile_w, nb_tiles; // tiles per image: tile_h * tile_w
+    int tile_block, nb_tile_blocks, tile_block_tail;
+
+    bool with_bias;
+    bool with_sum;
+    bool with_eltwise;
+
+    data_type_t src_dt;
+    data_type_t wei_dt;
+    data_type_t bia_dt;
+    data_type_t dst_dt;
+    data_type_t wino_dt; // data type of transformed src and weights
+
+    size_t src_dsz;
+    size_t bia_dsz;
+    size_t dst_dsz;
+    size_t wino_dsz;
+
+    cpu_isa_t isa; // isa of transform kernels
+    cpu_isa_t brg_isa;
+};
+
 enum conv_brgemm_loop_order_t {
     loop_ndhwgc,
     loop_ngcdhw,
@@ -707,6 +758,16 @@ struct jit_brgemm_conv_conf_t {
     bool with_sum;
     bool with_eltwise;
     bool with_binary;
+    // pooling post-op is applied by the driver to a per-thread dst buffer
+    bool with_pooling;
+    alg_kind_t pool_alg;
+    int pool_kh, pool_kw;
+    dim_t pool_buffer_size;
+    // per-channel sums of dst values and of their squares are accumulated
+    // by the kernels for every spatial work item for the batch normalization
+    // statistics; stats_buffer_size is the size of one work item slot
+    bool with_bnorm_stats;
+    dim_t stats_buffer_size;
 
     bool is_fused_conv;
     bool is_is_blocking;
@@ -895,8 +956,23 @@ struct jit_reduction_conf_t {
     alg_kind_t alg = alg_kind::undef;
     cpu_isa_t isa = isa_undef;
 
+    // A reduction pass reduces [idle_size][reduce_size][inner_stride] tensor
+    // to [idle_size][inner_stride] one, a kernel call handles inner_size
+    // consecutive inner elements.
     dim_t idle_size = 0;
     dim_t reduce_size = 0;
+    dim_t inner_size = 1;
+    dim_t inner_stride = 1;
+
+    // A reduction may be split into several passes, the intermediate results
+    // are kept in f32.
+    bool is_first_pass = true;
+    bool is_last_pass = true;
+    // number of src values reduced to one dst value over all the passes
+    dim_t full_reduce_size = 0;
+
+    float p = 0.f;
+    float eps = 0.f;
 
     bool is_saturation_needed = false;
 
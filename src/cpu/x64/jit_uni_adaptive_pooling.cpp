@@ -0,0 +1,475 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <float.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_adaptive_pooling.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace data_type;
+using namespace alg_kind;
+using namespace Xbyak;
+
+namespace {
+
+using io_data_types_t = io::jit_io_multi_dt_helper_t<Zmm>::data_types_t;
+
+// Number of vectors of channels processed by a kernel at once.
+constexpr int pool_unroll = 4;
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_adaptive_pooling_kernel_impl_t
+    : public jit_uni_adaptive_pooling_kernel_t,
+      public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_adaptive_pooling_kernel_impl_t);
+
+    jit_uni_adaptive_pooling_kernel_impl_t(const jit_adaptive_pool_conf_t &conf)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , conf_(conf)
+        , simd_w_(cpu_isa_traits<isa>::vlen / sizeof(float))
+        , src_dt_sz_(types::data_type_size(conf.src_dt))
+        , dst_dt_sz_(types::data_type_size(conf.dst_dt))
+        , tail_(conf.c_last_chunk % simd_w_) {
+        io_data_types_t dts {conf_.src_dt, conf_.dst_dt};
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(vmm_bf16_emu_1, vmm_bf16_emu_2,
+                vmm_bf16_emu_3, reg_tmp, vmm_bf16_emu_4);
+        io::io_saturation_conf_t io_saturation_conf(
+                vmm_zero.getIdx(), vmm_saturation_ubound.getIdx(), reg_tmp);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, isa, dts,
+                io::io_conf_t(), io_tail_conf, io_bf16_conf,
+                {{conf_.dst_dt, io_saturation_conf}});
+    }
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    const jit_adaptive_pool_conf_t conf_;
+    const dim_t simd_w_;
+    const size_t src_dt_sz_;
+    const size_t dst_dt_sz_;
+    const dim_t tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_w_ranges = r10;
+    const Reg64 reg_ow = r11;
+    const Reg64 reg_kd = r12;
+    const Reg64 reg_kh = r13;
+    const Reg64 reg_d_cnt = r14;
+    const Reg64 reg_h_cnt = r15;
+    const Reg64 reg_tmp = rax;
+    const Reg64 reg_w_cnt = rbx;
+    const Reg64 reg_d_ptr = rdx;
+    const Reg64 reg_h_ptr = rsi;
+    const Reg64 reg_w_ptr = rbp;
+    const Reg64 reg_nw = abi_not_param1;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_zero = Vmm(1);
+    const Vmm vmm_saturation_ubound = Vmm(2);
+    // Holds the number of points of the window for average algorithms and
+    // the initial value of the accumulators for the max one.
+    const Vmm vmm_aux = Vmm(3);
+
+    const Zmm vmm_bf16_emu_1 = Zmm(28);
+    const Zmm vmm_bf16_emu_2 = Zmm(29);
+    const Zmm vmm_bf16_emu_3 = Zmm(30);
+    const Zmm vmm_bf16_emu_4 = Zmm(31);
+
+    const int tail_opmask_idx = 1;
+
+    // Two sets of accumulators are interleaved along the width when the
+    // chunk is narrow, which hides the latency of the accumulation.
+    Vmm vmm_acc(int s, int i) const { return Vmm(4 + s * pool_unroll + i); }
+    Vmm vmm_src(int i) const { return Vmm(4 + 2 * pool_unroll + i); }
+
+    bool is_max() const { return conf_.alg == pooling_max; }
+
+    void accumulate(int s, int nvec, size_t w_off, bool tail) {
+        for (int v = 0; v < nvec; v++) {
+            io_[conf_.src_dt]->load(
+                    ptr[reg_w_ptr + w_off + v * simd_w_ * src_dt_sz_],
+                    vmm_src(v), tail && v == nvec - 1);
+            if (is_max())
+                uni_vmaxps(vmm_acc(s, v), vmm_acc(s, v), vmm_src(v));
+            else
+                uni_vaddps(vmm_acc(s, v), vmm_acc(s, v), vmm_src(v));
+        }
+    }
+
+    void compute_channels(size_t c_off, int nvec, bool tail) {
+        const int n_sets = nvec <= pool_unroll / 2 ? 2 : 1;
+        const size_t w_step = conf_.w_stride * src_dt_sz_;
+
+        for_(int s = 0; s < n_sets; s++)
+        for (int v = 0; v < nvec; v++) {
+            if (is_max())
+                uni_vmovups(vmm_acc(s, v), vmm_aux);
+            else
+                uni_vpxor(vmm_acc(s, v), vmm_acc(s, v), vmm_acc(s, v));
+        }
+
+        Label d_loop, h_loop;
+        lea(reg_d_ptr, ptr[reg_src + c_off * src_dt_sz_]);
+        mov(reg_d_cnt, reg_kd);
+        L(d_loop);
+        {
+            mov(reg_h_ptr, reg_d_ptr);
+            mov(reg_h_cnt, reg_kh);
+            L(h_loop);
+            {
+                Label w_loop, w_end;
+                mov(reg_w_ptr, reg_h_ptr);
+                mov(reg_w_cnt, reg_nw);
+                if (n_sets == 2) {
+                    Label w_pair_loop, w_pair_end;
+                    L(w_pair_loop);
+                    {
+                        cmp(reg_w_cnt, 2);
+                        jl(w_pair_end, T_NEAR);
+                        accumulate(0, nvec, 0, tail);
+                        accumulate(1, nvec, w_step, tail);
+                        add(reg_w_ptr, 2 * w_step);
+                        sub(reg_w_cnt, 2);
+                        jmp(w_pair_loop, T_NEAR);
+                    }
+                    L(w_pair_end);
+                }
+                L(w_loop);
+                {
+                    cmp(reg_w_cnt, 0);
+                    je(w_end, T_NEAR);
+                    accumulate(0, nvec, 0, tail);
+                    add(reg_w_ptr, w_step);
+                    dec(reg_w_cnt);
+                    jmp(w_loop, T_NEAR);
+                }
+                L(w_end);
+
+                add(reg_h_ptr, conf_.h_stride * src_dt_sz_);
+                dec(reg_h_cnt);
+                jnz(h_loop, T_NEAR);
+            }
+            add(reg_d_ptr, conf_.d_stride * src_dt_sz_);
+            dec(reg_d_cnt);
+            jnz(d_loop, T_NEAR);
+        }
+
+        for (int v = 0; v < nvec; v++) {
+            if (n_sets == 2) {
+                if (is_max())
+                    uni_vmaxps(vmm_acc(0, v), vmm_acc(0, v), vmm_acc(1, v));
+                else
+                    uni_vaddps(vmm_acc(0, v), vmm_acc(0, v), vmm_acc(1, v));
+            }
+            if (!is_max()) uni_vdivps(vmm_acc(0, v), vmm_acc(0, v), vmm_aux);
+            io_[conf_.dst_dt]->store(vmm_acc(0, v),
+                    ptr[reg_dst + (c_off + v * simd_w_) * dst_dt_sz_],
+                    tail && v == nvec - 1);
+        }
+    }
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+    void compute_row(dim_t c) {
+        const dim_t nvec_full = c / simd_w_;
+        const bool has_tail = c % simd_w_ != 0;
+
+        Label ow_loop;
+        mov(reg_w_ranges, ptr[reg_param + PARAM_OFF(w_ranges)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_ow, conf_.ow);
+        L(ow_loop);
+        {
+            // The source pointer is moved to the start of the window along
+            // the width and restored after the point is computed.
+            mov(reg_tmp, ptr[reg_w_ranges]);
+            mov(reg_nw, ptr[reg_w_ranges + sizeof(dim_t)]);
+            sub(reg_nw, reg_tmp);
+            imul(reg_tmp, reg_tmp, conf_.w_stride * src_dt_sz_);
+            add(reg_src, reg_tmp);
+
+            if (!is_max()) {
+                const Xmm xmm_aux(vmm_aux.getIdx());
+                mov(reg_tmp, reg_nw);
+                imul(reg_tmp, reg_kd);
+                imul(reg_tmp, reg_kh);
+                uni_vmovq(xmm_aux, reg_tmp);
+                uni_vcvtdq2ps(xmm_aux, xmm_aux);
+                uni_vbroadcastss(vmm_aux, xmm_aux);
+            }
+
+            for (dim_t v = 0; v < nvec_full; v += pool_unroll) {
+                const int nvec
+                        = static_cast<int>(nstl::min<dim_t>(
+                                pool_unroll, nvec_full - v));
+                compute_channels(v * simd_w_, nvec, false);
+            }
+            if (has_tail) compute_channels(nvec_full * simd_w_, 1, true);
+
+            mov(reg_tmp, ptr[reg_w_ranges]);
+            imul(reg_tmp, reg_tmp, conf_.w_stride * src_dt_sz_);
+            sub(reg_src, reg_tmp);
+
+            add(reg_dst, conf_.w_stride * dst_dt_sz_);
+            add(reg_w_ranges, 2 * sizeof(dim_t));
+            dec(reg_ow);
+            jnz(ow_loop, T_NEAR);
+        }
+    }
+
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+        io_.init_saturate_f32({conf_.dst_dt});
+        if (is_max()) init_vmm(vmm_aux, reg_tmp, -FLT_MAX);
+
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_kd, ptr[reg_param + PARAM_OFF(kd)]);
+        mov(reg_kh, ptr[reg_param + PARAM_OFF(kh)]);
+
+        if (conf_.c_last_chunk != conf_.c_chunk) {
+            Label last_chunk, row_end;
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(is_last_chunk)]);
+            cmp(reg_tmp, 0);
+            jne(last_chunk, T_NEAR);
+            compute_row(conf_.c_chunk);
+            jmp(row_end, T_NEAR);
+            L(last_chunk);
+            compute_row(conf_.c_last_chunk);
+            L(row_end);
+        } else {
+            compute_row(conf_.c_chunk);
+        }
+
+        postamble();
+    }
+#undef PARAM_OFF
+};
+
+jit_uni_adaptive_pooling_kernel_t *jit_uni_adaptive_pooling_kernel_t::create(
+        const jit_adaptive_pool_conf_t &conf) {
+    switch (conf.isa) {
+        case avx512_core_fp16:
+            return new jit_uni_adaptive_pooling_kernel_impl_t<avx512_core_fp16>(
+                    conf);
+        case avx512_core:
+            return new jit_uni_adaptive_pooling_kernel_impl_t<avx512_core>(
+                    conf);
+        case avx2:
+            return new jit_uni_adaptive_pooling_kernel_impl_t<avx2>(conf);
+        default: assert(!"kernel is empty.");
+    }
+    return nullptr;
+}
+
+status_t jit_uni_adaptive_pooling_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace prop_kind;
+
+    conf_ = jit_adaptive_pool_conf_t();
+    if (!mayiuse(avx2) || !is_fwd() || has_zero_dim_memory())
+        return status::unimplemented;
+    if (!attr()->has_default_values()) return status::unimplemented;
+    if (set_default_params() != status::success) return status::unimplemented;
+
+    // Regular algorithms are taken only when there is a single window, a max
+    // pooling for training needs a workspace which is not supported.
+    const alg_kind_t alg = desc()->alg_kind;
+    if (!is_adaptive() && !is_global()) return status::unimplemented;
+    if (alg == pooling_max && desc()->prop_kind == forward_training)
+        return status::unimplemented;
+
+    const data_type_t src_dt = src_md()->data_type;
+    if (src_dt != dst_md()->data_type
+            || !utils::one_of(src_dt, f32, bf16, f16, s8, u8))
+        return status::unimplemented;
+
+    conf_.alg = alg;
+    conf_.src_dt = src_dt;
+    conf_.dst_dt = src_dt;
+
+    if (!layouts_ok()) return status::unimplemented;
+
+    if (is_global()) {
+        // The spatial domain is dense, so the window is a single range.
+        conf_.ow = 1;
+        w_ranges_ = {0, ID() * IH() * IW()};
+    } else {
+        conf_.ow = OW();
+        w_ranges_.resize(2 * OW());
+        for (dim_t ow = 0; ow < OW(); ow++) {
+            w_ranges_[2 * ow] = adaptive_start(ow, IW(), OW());
+            w_ranges_[2 * ow + 1] = adaptive_end(ow, IW(), OW());
+        }
+    }
+
+    return status::success;
+}
+
+bool jit_uni_adaptive_pooling_fwd_t::pd_t::layouts_ok() {
+    using namespace format_tag;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const format_tag_t nspc_tag = utils::pick(ndims() - 3, nwc, nhwc, ndhwc);
+    const format_tag_t blk8_tag
+            = utils::pick(ndims() - 3, nCw8c, nChw8c, nCdhw8c);
+    const format_tag_t blk16_tag
+            = utils::pick(ndims() - 3, nCw16c, nChw16c, nCdhw16c);
+    const format_tag_t tag
+            = memory_desc_matches_one_of_tag(*src_md(), nspc_tag, blk8_tag,
+                    blk16_tag);
+    if (tag == format_tag::undef || !dst_d.matches_tag(tag)) return false;
+
+    const bool is_blk8 = tag == blk8_tag;
+    const dim_t blk = is_blk8 ? 8 : tag == blk16_tag ? 16 : 0;
+
+    // 8-channel blocks are processed with ymm registers, data types
+    // without conversion instructions there are not supported.
+    if (conf_.src_dt == f16)
+        conf_.isa = avx512_core_fp16;
+    else if (!is_blk8 && mayiuse(avx512_core))
+        conf_.isa = avx512_core;
+    else
+        conf_.isa = avx2;
+    if (!mayiuse(conf_.isa)) return false;
+    if (conf_.isa == avx2 && !utils::one_of(conf_.src_dt, f32, s8, u8))
+        return false;
+    if (conf_.isa == avx512_core_fp16 && is_blk8) return false;
+
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    const int nd = ndims();
+    conf_.w_stride = src_strides[nd - 1];
+    conf_.h_stride = nd >= 4 ? src_strides[nd - 2] : 0;
+    conf_.d_stride = nd >= 5 ? src_strides[nd - 3] : 0;
+
+    if (blk > 0) {
+        // Padded channels of a block are computed as well, they are zero in
+        // the source, so the destination padding stays zero.
+        conf_.c_chunk = blk;
+        conf_.c_last_chunk = blk;
+        n_chunks_ = src_d.padded_dims()[1] / blk;
+        src_chunk_stride_ = src_strides[1];
+        dst_chunk_stride_ = dst_strides[1];
+    } else {
+        const dim_t simd_w = isa_max_vlen(conf_.isa) / sizeof(float);
+        conf_.c_chunk = nstl::min<dim_t>(IC(), pool_unroll * simd_w);
+        n_chunks_ = utils::div_up(IC(), conf_.c_chunk);
+        conf_.c_last_chunk = IC() - (n_chunks_ - 1) * conf_.c_chunk;
+        src_chunk_stride_ = conf_.c_chunk;
+        dst_chunk_stride_ = conf_.c_chunk;
+    }
+
+    return true;
+}
+
+status_t jit_uni_adaptive_pooling_fwd_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, jit_uni_adaptive_pooling_kernel_t::create(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+status_t jit_uni_adaptive_pooling_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t src_dt_sz = src_d.data_type_size();
+    const size_t dst_dt_sz = dst_d.data_type_size();
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    src += src_d.offset0() * src_dt_sz;
+    dst += dst_d.offset0() * dst_dt_sz;
+
+    const auto &conf = pd()->conf_;
+    const bool is_global = pd()->is_global();
+    const int nd = pd()->ndims();
+    const dim_t MB = pd()->MB();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t n_chunks = pd()->n_chunks_;
+    const dim_t src_n_stride = src_d.blocking_desc().strides[0];
+    const dim_t dst_n_stride = dst_d.blocking_desc().strides[0];
+    const dim_t dst_h_stride
+            = nd >= 4 ? dst_d.blocking_desc().strides[nd - 2] : 0;
+    const dim_t dst_d_stride
+            = nd >= 5 ? dst_d.blocking_desc().strides[nd - 3] : 0;
+    const dim_t *w_ranges = pd()->w_ranges_.data();
+
+    parallel_nd(MB, n_chunks, OD, OH,
+            [&](dim_t mb, dim_t chunk, dim_t od, dim_t oh) {
+                dim_t id_start = 0, id_end = 1, ih_start = 0, ih_end = 1;
+                if (!is_global) {
+                    id_start = pooling_pd_t::adaptive_start(od, ID, OD);
+                    id_end = pooling_pd_t::adaptive_end(od, ID, OD);
+                    ih_start = pooling_pd_t::adaptive_start(oh, IH, OH);
+                    ih_end = pooling_pd_t::adaptive_end(oh, IH, OH);
+                }
+
+                const dim_t src_off = mb * src_n_stride
+                        + chunk * pd()->src_chunk_stride_
+                        + id_start * conf.d_stride + ih_start * conf.h_stride;
+                const dim_t dst_off = mb * dst_n_stride
+                        + chunk * pd()->dst_chunk_stride_ + od * dst_d_stride
+                        + oh * dst_h_stride;
+
+                jit_uni_adaptive_pooling_kernel_t::call_params_t p;
+                p.src = src + src_off * src_dt_sz;
+                p.dst = dst + dst_off * dst_dt_sz;
+                p.w_ranges = w_ranges;
+                p.kd = id_end - id_start;
+                p.kh = ih_end - ih_start;
+                p.is_last_chunk = chunk == n_chunks - 1;
+                (*kernel_)(&p);
+            });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_ADAPTIVE_POOLING_HPP
+#define CPU_X64_JIT_UNI_ADAPTIVE_POOLING_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_pooling_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Channels are processed in chunks which are contiguous at every spatial
+// point: a part of the channels for nspc layouts, or a channel block for
+// blocked layouts. All strides are in elements.
+struct jit_adaptive_pool_conf_t {
+    cpu_isa_t isa;
+    alg_kind_t alg;
+    data_type_t src_dt;
+    data_type_t dst_dt;
+    dim_t ow;
+    dim_t w_stride;
+    dim_t h_stride;
+    dim_t d_stride;
+    dim_t c_chunk;
+    // Number of channels of the last chunk, equals `c_chunk` if the number
+    // of channels is divisible by the chunk size.
+    dim_t c_last_chunk;
+};
+
+// Computes a row of `ow` destination points of a channel chunk. The window
+// of a point covers `kd` x `kh` source rows, starting at `src`, and the
+// range of source points along the width given by `w_ranges`.
+struct jit_uni_adaptive_pooling_kernel_t {
+    struct call_params_t {
+        const void *src;
+        void *dst;
+        // Pairs of [iw_start, iw_end) for every destination point.
+        const dim_t *w_ranges;
+        size_t kd;
+        size_t kh;
+        size_t is_last_chunk;
+    };
+
+    static jit_uni_adaptive_pooling_kernel_t *create(
+            const jit_adaptive_pool_conf_t &conf);
+    virtual ~jit_uni_adaptive_pooling_kernel_t() = default;
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+// Forward pooling with a window which depends on the destination point:
+// the adaptive average pooling and any pooling with a single window covering
+// the whole spatial domain. The latter is computed over the flattened
+// spatial domain, and channels are split into chunks so that small
+// minibatches still expose enough parallelism.
+struct jit_uni_adaptive_pooling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_pooling_fwd_pd_t {
+        using cpu_pooling_fwd_pd_t::cpu_pooling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit_adaptive:", conf_.isa, ""),
+                jit_uni_adaptive_pooling_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_adaptive_pool_conf_t conf_;
+        dim_t n_chunks_ = 0;
+        // Stride between channel chunks in elements.
+        dim_t src_chunk_stride_ = 0;
+        dim_t dst_chunk_stride_ = 0;
+        std::vector<dim_t> w_ranges_;
+
+    private:
+        bool layouts_ok();
+    };
+
+    jit_uni_adaptive_pooling_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_adaptive_pooling_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
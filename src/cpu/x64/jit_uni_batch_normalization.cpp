@@ -135,8 +135,11 @@ struct jit_bnorm_conf_t {
     // to use (ie set N_nthr, C_nthr, and S_nthr)
     bool thread_partition(bool spatial_thr_allowed, int nthr, dim_t N,
             dim_t C_blks, dim_t SP, int &C_nthr, int &N_nthr, int &S_nthr) {
+        // In deterministic mode statistics of a channel are accumulated by a
+        // single thread, so that the order of summation does not depend on
+        // the number of threads.
         if (((nthr <= C_blks) && IMPLICATION(is_nspc_, N == 1))
-                || !dnnl_thr_syncable()) {
+                || !dnnl_thr_syncable() || dnnl_thr_deterministic()) {
             C_nthr = nthr;
             N_nthr = 1;
             S_nthr = 1;
@@ -0,0 +1,485 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_concat.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace memory_tracking::names;
+using namespace data_type;
+using namespace Xbyak;
+
+namespace {
+
+using io_data_types_t = io::jit_io_multi_dt_helper_t<Zmm>::data_types_t;
+
+// Number of elements of an input processed by a thread at once.
+constexpr dim_t concat_chunk_len = 4096;
+
+cpu_isa_t get_concat_isa() {
+    return mayiuse(avx512_core) ? avx512_core : avx2;
+}
+
+dim_t get_concat_simd_w() {
+    return isa_max_vlen(get_concat_isa()) / sizeof(float);
+}
+
+// xf16 data is processed by the avx512_core instantiation only.
+cpu_isa_t get_concat_io_isa(cpu_isa_t isa, const io_data_types_t &dts) {
+    if (dts.count(f16)) return avx512_core_fp16;
+    if (dts.count(bf16))
+        return mayiuse(avx512_core_bf16) ? avx512_core_bf16 : avx512_core;
+    return isa;
+}
+
+bool concat_dt_ok(data_type_t dt) {
+    if (dt == bf16) return mayiuse(avx512_core);
+    if (dt == f16) return mayiuse(avx512_core_fp16);
+    return utils::one_of(dt, f32, s8, u8);
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_concat_kernel_t : public jit_concat_kernel_t,
+                                 public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_concat_kernel_t);
+
+    jit_uni_concat_kernel_t(const jit_concat_conf_t &conf)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , conf_(conf)
+        , simd_w_(cpu_isa_traits<isa>::vlen / sizeof(float))
+        , src_dt_sz_(types::data_type_size(conf.src_dt))
+        , dst_dt_sz_(types::data_type_size(conf.dst_dt))
+        , tail_(conf.nelems % simd_w_) {
+        io_data_types_t dts {conf_.src_dt, conf_.dst_dt};
+        const cpu_isa_t io_isa = get_concat_io_isa(isa, dts);
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        io::io_saturation_conf_t io_saturation_conf(
+                vmm_zero.getIdx(), vmm_saturation_ubound.getIdx(), reg_tmp);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa, dts,
+                io::io_conf_t(), io_tail_conf, io_bf16_conf,
+                {{conf_.dst_dt, io_saturation_conf}});
+        // Non-temporal stores cannot be masked, the tail goes through `io_`.
+        if (conf_.use_nt)
+            io_nt_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                    {conf_.dst_dt}, io::io_conf_t(true), utils::nullopt,
+                    io_bf16_conf, {{conf_.dst_dt, io_saturation_conf}});
+    }
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    static constexpr int unroll_ = 8;
+
+    const jit_concat_conf_t conf_;
+    const dim_t simd_w_;
+    const size_t src_dt_sz_;
+    const size_t dst_dt_sz_;
+    const dim_t tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    io::jit_io_multi_dt_helper_t<Vmm> io_nt_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_nelems = r10;
+    const Reg64 reg_tmp = r11;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_zero = Vmm(1);
+    const Vmm vmm_saturation_ubound = Vmm(2);
+    const Vmm vmm_scale = Vmm(3);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+
+    Vmm vmm_data(int i) const { return Vmm(4 + i); }
+
+    void compute_block(int nvec, bool tail) {
+        for (int i = 0; i < nvec; i++) {
+            const Vmm x = vmm_data(i);
+            io_[conf_.src_dt]->load(
+                    ptr[reg_src + i * simd_w_ * src_dt_sz_], x, tail);
+            if (conf_.with_scale) uni_vmulps(x, x, vmm_scale);
+        }
+        auto &io_store = conf_.use_nt && !tail ? io_nt_ : io_;
+        for (int i = 0; i < nvec; i++)
+            io_store[conf_.dst_dt]->store(vmm_data(i),
+                    ptr[reg_dst + i * simd_w_ * dst_dt_sz_], tail);
+    }
+
+    void advance(dim_t elems) {
+        add(reg_src, elems * src_dt_sz_);
+        add(reg_dst, elems * dst_dt_sz_);
+        sub(reg_nelems, elems);
+    }
+
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+        io_.init_saturate_f32({conf_.dst_dt});
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_nelems, ptr[reg_param + PARAM_OFF(nelems)]);
+        if (conf_.with_scale) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(scale)]);
+            uni_vbroadcastss(vmm_scale, ptr[reg_tmp]);
+        }
+#undef PARAM_OFF
+
+        Label unroll_loop, unroll_end, vec_loop, vec_end;
+        L(unroll_loop);
+        {
+            cmp(reg_nelems, unroll_ * simd_w_);
+            jl(unroll_end, T_NEAR);
+            compute_block(unroll_, false);
+            advance(unroll_ * simd_w_);
+            jmp(unroll_loop, T_NEAR);
+        }
+        L(unroll_end);
+
+        L(vec_loop);
+        {
+            cmp(reg_nelems, simd_w_);
+            jl(vec_end, T_NEAR);
+            compute_block(1, false);
+            advance(simd_w_);
+            jmp(vec_loop, T_NEAR);
+        }
+        L(vec_end);
+
+        // Only the chunk covering the end of the contiguous part has a tail.
+        if (tail_) {
+            Label tail_end;
+            cmp(reg_nelems, 0);
+            je(tail_end, T_NEAR);
+            compute_block(1, true);
+            L(tail_end);
+        }
+
+        if (conf_.use_nt) sfence();
+
+        postamble();
+    }
+};
+
+jit_concat_kernel_t *jit_concat_kernel_t::create(
+        const jit_concat_conf_t &conf) {
+    if (mayiuse(avx512_core))
+        return new jit_uni_concat_kernel_t<avx512_core>(conf);
+    else if (mayiuse(avx2))
+        return new jit_uni_concat_kernel_t<avx2>(conf);
+    assert(!"kernel is empty.");
+    return nullptr;
+}
+
+status_t jit_uni_concat_t::pd_t::init(engine_t *engine) {
+    using sm = primitive_attr_t::skip_mask_t;
+
+    if (!mayiuse(avx2)) return status::unimplemented;
+    if (!attr()->has_default_values(sm::scales_runtime))
+        return status::unimplemented;
+    if (cpu_concat_pd_t::init() != status::success)
+        return status::unimplemented;
+
+    const memory_desc_wrapper dst_d(dst_md());
+    if (dst_d.ndims() > 6 || !concat_dt_ok(dst_d.data_type()))
+        return status::unimplemented;
+
+    const auto &sc = attr()->scales_;
+    bool needs_conversion = false;
+    confs_.resize(n_inputs());
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        if (!concat_dt_ok(i_d.data_type())) return status::unimplemented;
+
+        const int arg = DNNL_ARG_MULTIPLE_SRC + i;
+        const bool with_scale = !sc.get(arg).has_default_values();
+        if (with_scale) {
+            int mask = 0;
+            CHECK(sc.get(arg, &mask, nullptr));
+            if (mask != 0) return status::unimplemented;
+        }
+
+        needs_conversion = needs_conversion || with_scale
+                || i_d.data_type() != dst_d.data_type();
+        confs_[i].src_dt = i_d.data_type();
+        confs_[i].dst_dt = dst_d.data_type();
+        confs_[i].with_scale = with_scale;
+    }
+
+    if (!layouts_ok()) return status::unimplemented;
+
+    // Streaming the destination around the caches pays off only when it
+    // does not fit into them anyway.
+    const size_t llc_size = platform::get_per_core_cache_size(3)
+            * dnnl_get_max_threads();
+    use_nt_ = dst_d.size() > llc_size;
+
+    // Plain copies are handled by simple_concat_t as well.
+    if (!needs_conversion && !use_nt_) return status::unimplemented;
+
+    for (auto &conf : confs_)
+        conf.use_nt = use_nt_;
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+// The same requirements as for simple_concat_t except that the data types
+// of the inputs do not have to match the destination one.
+bool jit_uni_concat_t::pd_t::layouts_ok() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = dst_d.ndims();
+    const bool ignore_strides = true;
+
+    if (dst_d.format_kind() != format_kind::blocked) return false;
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        const memory_desc_wrapper o_d(src_image_md(i));
+        const bool ok = utils::everyone_is(format_kind::blocked,
+                                i_d.format_kind(), o_d.format_kind())
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *o_d.md_, ignore_strides)
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *dst_d.md_, ignore_strides)
+                && !i_d.is_additional_buffer();
+        if (!ok) return false;
+    }
+
+    dims_t blocks = {0};
+    dst_d.compute_blocks(blocks);
+
+    strides_t strides = {0};
+    utils::array_copy(strides, dst_d.blocking_desc().strides, ndims);
+
+    dims_t ou_blocks = {0};
+    utils::array_copy(ou_blocks, dst_d.padded_dims(), ndims);
+
+    for (int d = 0; d < ndims; d++) {
+        iperm_[d] = d;
+        ou_blocks[d] /= blocks[d];
+    }
+
+    utils::simultaneous_sort(strides, ou_blocks, iperm_, ndims,
+            [](stride_t a, stride_t b) { return b - a; });
+
+    int perm[DNNL_MAX_NDIMS] {};
+    for (int d = 0; d < ndims; d++)
+        perm[iperm_[d]] = d;
+
+    // The dimensions preceding the concat one in memory are iterated over
+    // outside, the rest is copied contiguously.
+    n_outer_dims_ = perm[concat_dim()];
+    for (int d = 0; d < n_outer_dims_; d++)
+        outer_dims_[d] = ou_blocks[d];
+
+    auto nelems_to_concat = [&](const memory_desc_wrapper &data_d) {
+        dim_t nelems = 1;
+        for (int d = n_outer_dims_; d < ndims; d++)
+            nelems *= data_d.padded_dims()[iperm_[d]] / blocks[iperm_[d]];
+        for (int d = 0; d < ndims; d++)
+            nelems *= blocks[d];
+        return nelems;
+    };
+
+    if (nelems_to_concat(dst_d)
+            != dst_d.padded_dims()[concat_dim()] / blocks[concat_dim()]
+                    * dst_d.blocking_desc().strides[concat_dim()])
+        return false;
+
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        for (int d = n_outer_dims_; d < ndims; d++) {
+            if (dst_d.blocking_desc().strides[iperm_[d]]
+                    != i_d.blocking_desc().strides[iperm_[d]])
+                return false;
+        }
+        confs_[i].nelems = nelems_to_concat(i_d);
+    }
+
+    return true;
+}
+
+void jit_uni_concat_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<const void *>(key_concat_iptrs, n_inputs());
+    scratchpad.template book<void *>(key_concat_optrs, n_inputs());
+    scratchpad.template book<const float *>(key_concat_scales, n_inputs());
+    scratchpad.template book<strides_t>(key_concat_istrides, n_inputs());
+}
+
+status_t jit_uni_concat_t::init(engine_t *engine) {
+    const auto &confs = pd()->confs_;
+    for (const auto &conf : confs) {
+        kernels_.emplace_back(jit_concat_kernel_t::create(conf));
+        CHECK(kernels_.back()->create_kernel());
+        if (!conf.use_nt) continue;
+
+        jit_concat_conf_t conf_no_nt = conf;
+        conf_no_nt.use_nt = false;
+        kernels_no_nt_.emplace_back(jit_concat_kernel_t::create(conf_no_nt));
+        CHECK(kernels_no_nt_.back()->create_kernel());
+    }
+    return status::success;
+}
+
+status_t jit_uni_concat_t::execute(const exec_ctx_t &ctx) const {
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    auto iptrs = scratchpad.template get<const char *>(key_concat_iptrs);
+    auto optrs = scratchpad.template get<char *>(key_concat_optrs);
+    auto scales = scratchpad.template get<const float *>(key_concat_scales);
+    auto is = scratchpad.template get<strides_t>(key_concat_istrides);
+
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    if (dst == nullptr) return status::success;
+
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    const auto &confs = pd()->confs_;
+    const int num_arrs = pd()->n_inputs();
+    const int n_outer_dims = pd()->n_outer_dims_;
+    const dim_t *outer_dims = pd()->outer_dims_;
+    const int *iperm = pd()->iperm_;
+    const size_t dst_dt_sz = o_d.data_type_size();
+
+    strides_t os = {0};
+    dim_t n_outer = 1;
+    for (int d = 0; d < n_outer_dims; d++) {
+        os[d] = o_d.blocking_desc().strides[iperm[d]];
+        n_outer *= outer_dims[d];
+    }
+
+    dim_t chunks_per_outer = 0;
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        const memory_desc_wrapper i_image_d(pd()->src_image_md(a));
+        const auto iptr = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + a);
+        chunks_per_outer += utils::div_up(confs[a].nelems, concat_chunk_len);
+        if (iptr == nullptr) {
+            iptrs[a] = nullptr;
+            continue;
+        }
+        iptrs[a] = iptr + i_d.blk_off(0) * i_d.data_type_size();
+        optrs[a] = dst + i_image_d.blk_off(0) * dst_dt_sz;
+        scales[a] = nullptr;
+        if (confs[a].with_scale) {
+            scales[a] = CTX_IN_MEM(const float *,
+                    DNNL_ARG_ATTR_SCALES | (DNNL_ARG_MULTIPLE_SRC + a));
+            if (scales[a] == nullptr) return status::invalid_arguments;
+        }
+
+        bool is_inplace = iptrs[a] == optrs[a] && !confs[a].with_scale
+                && confs[a].src_dt == confs[a].dst_dt;
+        for (int d = 0; d < DNNL_MAX_NDIMS; d++) {
+            if (d < n_outer_dims) {
+                is[a][d] = i_d.blocking_desc().strides[iperm[d]];
+                is_inplace = is_inplace && is[a][d] == os[d];
+            } else
+                is[a][d] = 0;
+        }
+        // The input is a sub-memory view of dst, nothing to copy.
+        if (is_inplace) iptrs[a] = nullptr;
+    }
+
+    // Non-temporal stores require every vector to be aligned, chunks start
+    // at a multiple of a vector length inside the contiguous part.
+    const size_t nt_alignment = get_concat_simd_w() * dst_dt_sz;
+    const dim_t work_amount = n_outer * chunks_per_outer;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            dim_t outer = iwork / chunks_per_outer;
+            dim_t ichunk = iwork % chunks_per_outer;
+            int a = 0;
+            for (;; ++a) {
+                const dim_t nchunks
+                        = utils::div_up(confs[a].nelems, concat_chunk_len);
+                if (ichunk < nchunks) break;
+                ichunk -= nchunks;
+            }
+            if (iptrs[a] == nullptr) continue;
+
+            dim_t in_off = 0, out_off = 0;
+            for (int d = n_outer_dims - 1; d >= 0; d--) {
+                const dim_t idx = outer % outer_dims[d];
+                outer /= outer_dims[d];
+                in_off += idx * is[a][d];
+                out_off += idx * os[d];
+            }
+
+            const dim_t e_start = ichunk * concat_chunk_len;
+            jit_concat_kernel_t::call_params_t p;
+            p.src = iptrs[a]
+                    + (in_off + e_start)
+                            * types::data_type_size(confs[a].src_dt);
+            p.dst = optrs[a] + (out_off + e_start) * dst_dt_sz;
+            p.scale = scales[a];
+            p.nelems = nstl::min(
+                    concat_chunk_len, confs[a].nelems - e_start);
+
+            const bool nt_ok = confs[a].use_nt
+                    && reinterpret_cast<uintptr_t>(p.dst) % nt_alignment
+                            == 0;
+            const auto &ker = !confs[a].use_nt || nt_ok ? kernels_[a]
+                                                        : kernels_no_nt_[a];
+            (*ker)(&p);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_CONCAT_HPP
+#define CPU_X64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_concat_conf_t {
+    data_type_t src_dt;
+    data_type_t dst_dt;
+    bool with_scale;
+    // Full vectors are written with non-temporal stores.
+    bool use_nt;
+    // Number of elements copied contiguously for every outer index of the
+    // input. Each call of a kernel covers either a multiple of a vector
+    // length or the end of this range.
+    dim_t nelems;
+};
+
+// Copies `nelems` elements of `src` to `dst` converting the data type and
+// multiplying the values by `scale[0]` on the way.
+struct jit_concat_kernel_t {
+    struct call_params_t {
+        const void *src;
+        void *dst;
+        const float *scale;
+        size_t nelems;
+    };
+
+    static jit_concat_kernel_t *create(const jit_concat_conf_t &conf);
+    virtual ~jit_concat_kernel_t() = default;
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+// Concatenates all inputs in a single parallel pass. Unlike
+// `simple_concat_t`, the inputs may have a data type different from the
+// destination one and may be scaled. The layouts of all tensors still have
+// to match, as for `simple_concat_t`.
+struct jit_uni_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        pd_t(const pd_t &rhs) = default;
+
+        DECLARE_CONCAT_PD_T("jit:uni", jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        std::vector<jit_concat_conf_t> confs_;
+        // Physical dimensions iterated over outside of the contiguous part,
+        // in the order of decreasing strides.
+        int n_outer_dims_ = 0;
+        dims_t outer_dims_ {};
+        int iperm_[DNNL_MAX_NDIMS] {};
+        bool use_nt_ = false;
+
+    private:
+        bool layouts_ok();
+        void init_scratchpad();
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<std::unique_ptr<jit_concat_kernel_t>> kernels_;
+    // Regular stores only, used when a destination chunk is not aligned
+    // for non-temporal stores.
+    std::vector<std::unique_ptr<jit_concat_kernel_t>> kernels_no_nt_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -158,8 +158,75 @@ void jit_uni_cvt_ps_to_xf16_t<avx512_core_fp16>::cvt_ps_to_xf16(
     vcvtps2ph(addr_m_out, vmm_input, _op_mxcsr);
 }
 
+void jit_avx512_core_cvt_ps_to_bf16_t::init_stochastic_rounding() {
+    static const uint32_t iota[16]
+            = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    auto broadcast_u32 = [&](const Vmm &vmm, uint32_t value) {
+        mov(reg_idx.cvt32(), value);
+        vpbroadcastd(vmm, reg_idx.cvt32());
+    };
+
+    mov(reg_offset, ptr[abi_param1 + GET_OFF(offset)]);
+    vpbroadcastd(vmm_seed, ptr[abi_param1 + GET_OFF(mixed_seed)]);
+    mov(reg_out_start, reg_output);
+    mov(reg_idx, reinterpret_cast<size_t>(iota));
+    vmovups(vmm_iota, ptr[reg_idx]);
+    broadcast_u32(vmm_hash_mul_1, 0x7feb352dU);
+    broadcast_u32(vmm_hash_mul_2, 0x846ca68bU);
+    broadcast_u32(vmm_rnd_mask, 0xffffU);
+    broadcast_u32(vmm_sign_mask, 0x80000000U);
+    broadcast_u32(vmm_qnan_bit, 0x00400000U);
+}
+
+void jit_avx512_core_cvt_ps_to_bf16_t::cvt_ps_to_bf16_stochastic(
+        const int idx, const bool is_tail) {
+    const size_t out_offset = sizeof(bfloat16_t) * idx;
+    const auto addr_m_out = is_tail
+            ? ptr[reg_output + out_offset] | ktail_xf16_mask
+            : ptr[reg_output + out_offset];
+    const Vmm vmm_m_in = is_tail ? vmm_input | ktail_f32_mask | T_z : vmm_input;
+    vmovups(vmm_m_in, ptr[reg_input + sizeof(float) * idx]);
+
+    // Index of the first element: offset + (output - output_start) / 2 + idx.
+    mov(reg_idx, reg_output);
+    sub(reg_idx, reg_out_start);
+    shr(reg_idx, 1);
+    lea(reg_idx, ptr[reg_idx + reg_offset + idx]);
+    vpbroadcastd(vmm_rnd, reg_idx.cvt32());
+    vpaddd(vmm_rnd, vmm_rnd, vmm_iota);
+
+    // math::stochastic_rounding_bits()
+    vpxord(vmm_rnd, vmm_rnd, vmm_seed);
+    vpsrld(vmm_rnd_tmp, vmm_rnd, 16);
+    vpxord(vmm_rnd, vmm_rnd, vmm_rnd_tmp);
+    vpmulld(vmm_rnd, vmm_rnd, vmm_hash_mul_1);
+    vpsrld(vmm_rnd_tmp, vmm_rnd, 15);
+    vpxord(vmm_rnd, vmm_rnd, vmm_rnd_tmp);
+    vpmulld(vmm_rnd, vmm_rnd, vmm_hash_mul_2);
+    vpsrld(vmm_rnd_tmp, vmm_rnd, 16);
+    vpxord(vmm_rnd, vmm_rnd, vmm_rnd_tmp);
+    vpandd(vmm_rnd, vmm_rnd, vmm_rnd_mask);
+
+    // Adding to the bits of f32 never changes the sign of non-NaN values.
+    // NaNs are quieted and denormals are flushed to zero as vcvtneps2bf16
+    // does.
+    const Vmm vmm_res = Vmm(vmm_output.getIdx());
+    vpaddd(vmm_res, vmm_input, vmm_rnd);
+    vfpclassps(k_nan, vmm_input, 0x81); // QNaN | SNaN
+    vfpclassps(k_denorm, vmm_input, 0x20);
+    vpord(vmm_res | k_nan, vmm_input, vmm_qnan_bit);
+    vpandd(vmm_res | k_denorm, vmm_input, vmm_sign_mask);
+    vpsrld(vmm_res, vmm_res, 16);
+    vpmovdw(addr_m_out, vmm_res);
+}
+
 void jit_avx512_core_cvt_ps_to_bf16_t::cvt_ps_to_xf16(
         const int idx, const bool is_tail) {
+    if (stochastic_rounding_) {
+        cvt_ps_to_bf16_stochastic(idx, is_tail);
+        return;
+    }
+
     const size_t out_offset = sizeof(float16_t) * idx;
     const auto addr_m_out = is_tail
             ? ptr[reg_output + out_offset] | ktail_xf16_mask
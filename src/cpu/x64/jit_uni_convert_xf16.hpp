@@ -41,6 +41,10 @@ struct jit_call_t {
     void *out;
     void *add;
     size_t nelems;
+    // Used by stochastic rounding only: the index of the first element and
+    // math::hash_u32() of the seed, see math::stochastic_rounding_bits().
+    size_t offset;
+    uint32_t mixed_seed;
 };
 struct jit_cvt_xf16_to_ps_params_t {
     const void *inp;
@@ -104,9 +108,11 @@ protected:
 struct jit_avx512_core_cvt_ps_to_bf16_t
     : public jit_uni_cvt_ps_to_xf16_t<avx512_core> {
 
-    jit_avx512_core_cvt_ps_to_bf16_t(impl::data_type_t dt, size_t nelems = 0)
+    jit_avx512_core_cvt_ps_to_bf16_t(impl::data_type_t dt, size_t nelems = 0,
+            bool stochastic_rounding = false)
         : jit_uni_cvt_ps_to_xf16_t<avx512_core>(dt, nelems)
-        , use_bf16_emu_(!mayiuse(avx512_core_bf16))
+        , stochastic_rounding_(stochastic_rounding)
+        , use_bf16_emu_(!mayiuse(avx512_core_bf16) && !stochastic_rounding)
         , bf16_emu_(use_bf16_emu_ ? utils::make_unique<bf16_emulation_t>(this,
                             vmm_one, vmm_even, vmm_selector, reg_scratch,
                             vmm_fp32_tmp)
@@ -115,20 +121,52 @@ struct jit_avx512_core_cvt_ps_to_bf16_t
     }
 
 private:
+    // Stochastic rounding adds random bits to the 16 lower bits of f32 and
+    // truncates them, see math::stochastic_round_fwd().
+    const bool stochastic_rounding_;
     const bool use_bf16_emu_;
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
 
+    // used in stochastic rounding
+    const Vmm vmm_iota = Vmm(6);
+    const Vmm vmm_seed = Vmm(7);
+    const Vmm vmm_hash_mul_1 = Vmm(8);
+    const Vmm vmm_hash_mul_2 = Vmm(9);
+    const Vmm vmm_rnd_mask = Vmm(10);
+    const Vmm vmm_sign_mask = Vmm(11);
+    const Vmm vmm_qnan_bit = Vmm(12);
+    const Vmm vmm_rnd = Vmm(13);
+    const Vmm vmm_rnd_tmp = Vmm(14);
+    const Xbyak::Opmask k_nan = Xbyak::Opmask(4);
+    const Xbyak::Opmask k_denorm = Xbyak::Opmask(5);
+    Xbyak::Reg64 reg_out_start = r10;
+    Xbyak::Reg64 reg_offset = r11;
+    Xbyak::Reg64 reg_idx = r12;
+
     void cvt_ps_to_xf16(const int idx, const bool is_tail) override;
     void init_bf16() override {
         if (use_bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+        if (stochastic_rounding_) init_stochastic_rounding();
     }
+    void init_stochastic_rounding();
+    void cvt_ps_to_bf16_stochastic(const int idx, const bool is_tail);
 };
 
 struct jit_cvt_ps_to_xf16_t {
 
-    jit_cvt_ps_to_xf16_t(impl::data_type_t data_type, size_t nelems = 0)
+    // Stochastic rounding is supported for bf16 on avx512_core only.
+    jit_cvt_ps_to_xf16_t(impl::data_type_t data_type, size_t nelems = 0,
+            bool stochastic_rounding = false)
         : nelems_(nelems) {
-        if (data_type == data_type::f16 && mayiuse(avx512_core_fp16))
+        if (stochastic_rounding) {
+            if (data_type == data_type::bf16 && mayiuse(avx512_core))
+                kernel_ = utils::make_unique<jit_avx512_core_cvt_ps_to_bf16_t>(
+                        data_type, nelems, true);
+            else {
+                assert(!"unsupported configuration for stochastic rounding");
+                return;
+            }
+        } else if (data_type == data_type::f16 && mayiuse(avx512_core_fp16))
             kernel_ = utils::make_unique<
                     jit_uni_cvt_ps_to_xf16_t<avx512_core_fp16>>(
                     data_type, nelems);
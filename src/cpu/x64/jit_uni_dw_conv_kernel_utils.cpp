@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/dnnl_thread.hpp"
+
 #include "cpu/cpu_convolution_pd.hpp"
 
 #include "cpu/x64/jit_uni_dw_conv_kernel_utils.hpp"
@@ -663,7 +665,11 @@ void jit_uni_dw_conv_bwd_weights_kernel<isa, kernel_dt>::balance(
          */
         jcp.oh_blk_size = 15;
         jcp.nthr_g = nstl::min(jcp.nb_ch, nthreads);
-        jcp.nthr_mb = nstl::min(nstl::max(1, nthreads / jcp.nthr_g), jcp.mb);
+        // In deterministic mode every element of diff_weights is accumulated
+        // by a single thread.
+        jcp.nthr_mb = dnnl_thr_deterministic()
+                ? 1
+                : nstl::min(nstl::max(1, nthreads / jcp.nthr_g), jcp.mb);
         jcp.nthr = jcp.nthr_g * jcp.nthr_mb;
     } else if (jcp.harness == harness_nxc) {
         /* Allocate threads and partition space with regards to 'nb_ch', 'mb'
@@ -671,8 +677,16 @@ void jit_uni_dw_conv_bwd_weights_kernel<isa, kernel_dt>::balance(
          *
          * note: 'prioritize_threading == true' showed slightly greater
          * performance, but there might be cases where the opposite holds true;
-         * code is left for future tuning. */
-        partition_nthr_nxc(jcp, nthreads, true);
+         * code is left for future tuning.
+         *
+         * In deterministic mode every element of diff_weights is accumulated
+         * by a single thread over the whole spatial in a single block. */
+        if (dnnl_thr_deterministic()) {
+            jcp.nthr_g = nstl::min(
+                    utils::div_up(jcp.nb_ch, jcp.nb_ch_blocking), nthreads);
+            jcp.oh_blk_size = jcp.oh;
+        } else
+            partition_nthr_nxc(jcp, nthreads, true);
         jcp.nthr = jcp.nthr_g * jcp.nthr_mb * jcp.nthr_oh;
     }
 }
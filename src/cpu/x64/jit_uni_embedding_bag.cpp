@@ -0,0 +1,390 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <float.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_embedding_bag.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace data_type;
+using namespace alg_kind;
+using namespace Xbyak;
+
+namespace {
+
+using io_data_types_t = io::jit_io_multi_dt_helper_t<Zmm>::data_types_t;
+
+// Number of vectors of a row processed by a kernel at once.
+constexpr int emb_unroll = 4;
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_kernel_impl_t
+    : public jit_uni_embedding_bag_kernel_t,
+      public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_kernel_impl_t);
+
+    jit_uni_embedding_bag_kernel_impl_t(const jit_embedding_bag_conf_t &conf)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , conf_(conf)
+        , simd_w_(cpu_isa_traits<isa>::vlen / sizeof(float))
+        , src_dt_sz_(types::data_type_size(conf.src_dt))
+        , dst_dt_sz_(types::data_type_size(conf.dst_dt))
+        , tail_(conf.c_last_chunk % simd_w_) {
+        io_data_types_t dts {conf_.src_dt, conf_.dst_dt};
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(vmm_bf16_emu_1, vmm_bf16_emu_2,
+                vmm_bf16_emu_3, reg_tmp, vmm_bf16_emu_4);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, isa, dts,
+                io::io_conf_t(), io_tail_conf, io_bf16_conf);
+    }
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    const jit_embedding_bag_conf_t conf_;
+    const dim_t simd_w_;
+    const size_t src_dt_sz_;
+    const size_t dst_dt_sz_;
+    const dim_t tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_indices = r10;
+    const Reg64 reg_weights = r11;
+    const Reg64 reg_scales = r12;
+    const Reg64 reg_n = r13;
+    const Reg64 reg_cnt = r14;
+    const Reg64 reg_idx = r15;
+    const Reg64 reg_row = rbx;
+    const Reg64 reg_pf = rdx;
+    const Reg64 reg_tmp = rax;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    // Holds the initial value of the accumulators for the max algorithm and
+    // the number of rows of the bag for the mean one.
+    const Vmm vmm_aux = Vmm(1);
+    // Product of the scale of a row and the weight of an index.
+    const Vmm vmm_factor = Vmm(2);
+    const Vmm vmm_weight = Vmm(3);
+    const Vmm vmm_common_scale = Vmm(4);
+
+    const Zmm vmm_bf16_emu_1 = Zmm(28);
+    const Zmm vmm_bf16_emu_2 = Zmm(29);
+    const Zmm vmm_bf16_emu_3 = Zmm(30);
+    const Zmm vmm_bf16_emu_4 = Zmm(31);
+
+    const int tail_opmask_idx = 1;
+
+    Vmm vmm_acc(int i) const { return Vmm(5 + i); }
+    Vmm vmm_src(int i) const { return Vmm(5 + emb_unroll + i); }
+
+    bool is_max() const { return conf_.alg == embedding_bag_max; }
+    bool with_factor() const {
+        return conf_.with_weights || conf_.scales_mask >= 0;
+    }
+
+    void prefetch_row(dim_t c) {
+        const int pf = conf_.prefetch_distance;
+        if (pf <= 0) return;
+
+        Label no_prefetch;
+        cmp(reg_cnt, pf);
+        jle(no_prefetch, T_NEAR);
+        movsxd(reg_pf, dword[reg_indices + pf * sizeof(int32_t)]);
+        imul(reg_pf, reg_pf, conf_.row_stride * src_dt_sz_);
+        const dim_t cache_line = 64;
+        const dim_t chunk_sz = c * src_dt_sz_;
+        for (dim_t off = 0; off < chunk_sz; off += cache_line)
+            prefetcht0(ptr[reg_src + reg_pf + off]);
+        L(no_prefetch);
+    }
+
+    void load_factor() {
+        if (conf_.scales_mask == 1)
+            uni_vbroadcastss(
+                    vmm_factor, ptr[reg_scales + reg_idx * sizeof(float)]);
+        else if (conf_.scales_mask == 0)
+            uni_vmovups(vmm_factor, vmm_common_scale);
+
+        if (!conf_.with_weights) return;
+        if (conf_.scales_mask >= 0) {
+            uni_vbroadcastss(vmm_weight, ptr[reg_weights]);
+            uni_vmulps(vmm_factor, vmm_factor, vmm_weight);
+        } else {
+            uni_vbroadcastss(vmm_factor, ptr[reg_weights]);
+        }
+    }
+
+    void compute_chunk(dim_t c) {
+        const int nvec_full = static_cast<int>(c / simd_w_);
+        const bool has_tail = c % simd_w_ != 0;
+        const int nvec = nvec_full + has_tail;
+        assert(nvec <= emb_unroll);
+
+        for (int v = 0; v < nvec; v++) {
+            if (is_max())
+                uni_vmovups(vmm_acc(v), vmm_aux);
+            else
+                uni_vpxor(vmm_acc(v), vmm_acc(v), vmm_acc(v));
+        }
+
+        Label idx_loop, idx_end;
+        mov(reg_cnt, reg_n);
+        L(idx_loop);
+        {
+            cmp(reg_cnt, 0);
+            je(idx_end, T_NEAR);
+
+            movsxd(reg_idx, dword[reg_indices]);
+            prefetch_row(c);
+            if (with_factor()) load_factor();
+            imul(reg_row, reg_idx, conf_.row_stride * src_dt_sz_);
+
+            for (int v = 0; v < nvec; v++) {
+                io_[conf_.src_dt]->load(
+                        ptr[reg_src + reg_row + v * simd_w_ * src_dt_sz_],
+                        vmm_src(v), has_tail && v == nvec - 1);
+                if (is_max()) {
+                    if (with_factor())
+                        uni_vmulps(vmm_src(v), vmm_src(v), vmm_factor);
+                    uni_vmaxps(vmm_acc(v), vmm_acc(v), vmm_src(v));
+                } else if (with_factor()) {
+                    uni_vfmadd231ps(vmm_acc(v), vmm_src(v), vmm_factor);
+                } else {
+                    uni_vaddps(vmm_acc(v), vmm_acc(v), vmm_src(v));
+                }
+            }
+
+            add(reg_indices, sizeof(int32_t));
+            if (conf_.with_weights) add(reg_weights, sizeof(float));
+            dec(reg_cnt);
+            jmp(idx_loop, T_NEAR);
+        }
+        L(idx_end);
+
+        // An empty bag gives zeros, the mean is taken for non-empty ones.
+        if (conf_.alg != embedding_bag_sum) {
+            Label empty_bag, store;
+            cmp(reg_n, 0);
+            je(empty_bag, T_NEAR);
+            if (conf_.alg == embedding_bag_mean) {
+                const Xmm xmm_aux(vmm_aux.getIdx());
+                uni_vmovq(xmm_aux, reg_n);
+                uni_vcvtdq2ps(xmm_aux, xmm_aux);
+                uni_vbroadcastss(vmm_aux, xmm_aux);
+                for (int v = 0; v < nvec; v++)
+                    uni_vdivps(vmm_acc(v), vmm_acc(v), vmm_aux);
+            }
+            jmp(store, T_NEAR);
+            L(empty_bag);
+            for (int v = 0; v < nvec; v++)
+                uni_vpxor(vmm_acc(v), vmm_acc(v), vmm_acc(v));
+            L(store);
+        }
+
+        for (int v = 0; v < nvec; v++)
+            io_[conf_.dst_dt]->store(vmm_acc(v),
+                    ptr[reg_dst + v * simd_w_ * dst_dt_sz_],
+                    has_tail && v == nvec - 1);
+    }
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+        if (is_max()) init_vmm(vmm_aux, reg_tmp, -FLT_MAX);
+
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_indices, ptr[reg_param + PARAM_OFF(indices)]);
+        mov(reg_n, ptr[reg_param + PARAM_OFF(n)]);
+        if (conf_.with_weights)
+            mov(reg_weights, ptr[reg_param + PARAM_OFF(weights)]);
+        if (conf_.scales_mask >= 0)
+            mov(reg_scales, ptr[reg_param + PARAM_OFF(scales)]);
+        if (conf_.scales_mask == 0)
+            uni_vbroadcastss(vmm_common_scale, ptr[reg_scales]);
+
+        if (conf_.c_last_chunk != conf_.c_chunk) {
+            Label last_chunk, chunk_end;
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(is_last_chunk)]);
+            cmp(reg_tmp, 0);
+            jne(last_chunk, T_NEAR);
+            compute_chunk(conf_.c_chunk);
+            jmp(chunk_end, T_NEAR);
+            L(last_chunk);
+            compute_chunk(conf_.c_last_chunk);
+            L(chunk_end);
+        } else {
+            compute_chunk(conf_.c_chunk);
+        }
+
+        postamble();
+    }
+#undef PARAM_OFF
+};
+
+jit_uni_embedding_bag_kernel_t *jit_uni_embedding_bag_kernel_t::create(
+        const jit_embedding_bag_conf_t &conf) {
+    switch (conf.isa) {
+        case avx512_core:
+            return new jit_uni_embedding_bag_kernel_impl_t<avx512_core>(conf);
+        case avx2: return new jit_uni_embedding_bag_kernel_impl_t<avx2>(conf);
+        default: assert(!"kernel is empty.");
+    }
+    return nullptr;
+}
+
+status_t jit_uni_embedding_bag_t::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    conf_ = jit_embedding_bag_conf_t();
+    VDISPATCH_EMBEDDING_BAG(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_EMBEDDING_BAG(
+            attr()->has_default_values(skip_mask_t::scales_runtime),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_EMBEDDING_BAG(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+
+    conf_.alg = desc()->alg_kind;
+    conf_.src_dt = src_md()->data_type;
+    conf_.dst_dt = dst_md()->data_type;
+    VDISPATCH_EMBEDDING_BAG(utils::one_of(conf_.src_dt, f32, bf16, s8, u8)
+                    && utils::one_of(conf_.dst_dt, f32, bf16),
+            VERBOSE_UNSUPPORTED_DT);
+
+    // Conversions of bf16 are not implemented for ymm registers.
+    conf_.isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    VDISPATCH_EMBEDDING_BAG(IMPLICATION(conf_.isa == avx2,
+                                    conf_.src_dt != bf16
+                                            && conf_.dst_dt != bf16),
+            VERBOSE_ISA_DT_MISMATCH);
+
+    // Rows of the table and of the destination must be dense.
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const bool rows_dense = src_d.blocking_desc().inner_nblks == 0
+            && dst_d.blocking_desc().inner_nblks == 0
+            && src_d.blocking_desc().strides[1] == 1
+            && dst_d.blocking_desc().strides[1] == 1;
+    VDISPATCH_EMBEDDING_BAG(rows_dense, VERBOSE_UNSUPPORTED_TAG);
+
+    // The offset of a row is computed with a 32-bit immediate.
+    conf_.row_stride = src_d.blocking_desc().strides[0];
+    VDISPATCH_EMBEDDING_BAG(
+            conf_.row_stride * src_d.data_type_size() <= INT32_MAX,
+            VERBOSE_BAD_PARAM, "src");
+
+    const dim_t simd_w = isa_max_vlen(conf_.isa) / sizeof(float);
+    conf_.c_chunk = nstl::max<dim_t>(
+            1, nstl::min<dim_t>(emb_dim(), emb_unroll * simd_w));
+    n_chunks_ = utils::div_up(emb_dim(), conf_.c_chunk);
+    conf_.c_last_chunk = emb_dim() - (n_chunks_ - 1) * conf_.c_chunk;
+
+    conf_.with_weights = with_weights();
+    conf_.scales_mask
+            = with_scales() ? attr()->scales_.get(DNNL_ARG_SRC).mask_ : -1;
+    conf_.prefetch_distance = 8;
+
+    return status::success;
+}
+
+status_t jit_uni_embedding_bag_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, jit_uni_embedding_bag_kernel_t::create(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+status_t jit_uni_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->n_bags() == 0 || pd()->emb_dim() == 0) return status::success;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_INDICES);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+
+    CHECK(pd()->check_bags(indices, offsets));
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t src_dt_sz = src_d.data_type_size();
+    const size_t dst_dt_sz = dst_d.data_type_size();
+    src += src_d.offset0() * src_dt_sz;
+    dst += dst_d.offset0() * dst_dt_sz;
+
+    const auto &conf = pd()->conf_;
+    const dim_t n_bags = pd()->n_bags();
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t n_chunks = pd()->n_chunks_;
+    const dim_t dst_row_stride = dst_d.blocking_desc().strides[0];
+
+    parallel_nd(n_bags, n_chunks, [&](dim_t b, dim_t chunk) {
+        dim_t start = 0, end = 0;
+        pd_t::bag_bounds(offsets, n_bags, n_indices, b, start, end);
+
+        const dim_t c_off = chunk * conf.c_chunk;
+
+        jit_uni_embedding_bag_kernel_t::call_params_t p;
+        p.src = src + c_off * src_dt_sz;
+        p.dst = dst + (b * dst_row_stride + c_off) * dst_dt_sz;
+        p.indices = indices + start;
+        p.weights = weights ? weights + start : nullptr;
+        p.scales = src_scales;
+        p.n = end - start;
+        p.is_last_chunk = chunk == n_chunks - 1;
+        (*kernel_)(&p);
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_EMBEDDING_BAG_HPP
+#define CPU_X64_JIT_UNI_EMBEDDING_BAG_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_embedding_bag_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_embedding_bag_conf_t {
+    cpu_isa_t isa;
+    alg_kind_t alg;
+    data_type_t src_dt;
+    data_type_t dst_dt;
+    // Stride between rows of the table in elements.
+    dim_t row_stride;
+    dim_t c_chunk;
+    // Number of elements of the last chunk of a row, equals `c_chunk` if the
+    // embedding size is divisible by the chunk size.
+    dim_t c_last_chunk;
+    bool with_weights;
+    // -1 if there are no scales, otherwise the mask of the table scales.
+    int scales_mask;
+    // Distance in indices at which rows of a bag are prefetched.
+    int prefetch_distance;
+};
+
+// Pools a chunk of the rows of a bag into a chunk of a destination row. The
+// rows are gathered by the indices of the bag and the row of an index a few
+// iterations ahead is prefetched, as the gather pattern is not predictable
+// by hardware prefetchers.
+struct jit_uni_embedding_bag_kernel_t {
+    struct call_params_t {
+        // Table and destination pointers at the start of the chunk.
+        const void *src;
+        void *dst;
+        // Indices and per-sample weights at the start of the bag.
+        const int32_t *indices;
+        const float *weights;
+        const float *scales;
+        size_t n;
+        size_t is_last_chunk;
+    };
+
+    static jit_uni_embedding_bag_kernel_t *create(
+            const jit_embedding_bag_conf_t &conf);
+    virtual ~jit_uni_embedding_bag_kernel_t() = default;
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+// Embedding bag with plain row-major table and destination. Bags are split
+// along the embedding size into chunks which are processed in parallel, so
+// small batches of bags with wide rows still use all the threads.
+struct jit_uni_embedding_bag_t : public primitive_t {
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", conf_.isa, ""),
+                jit_uni_embedding_bag_t);
+
+        status_t init(engine_t *engine);
+
+        jit_embedding_bag_conf_t conf_;
+        dim_t n_chunks_ = 0;
+    };
+
+    jit_uni_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_embedding_bag_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,1404 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_group_normalization.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace memory_tracking::names;
+using namespace data_type;
+using namespace Xbyak;
+
+namespace {
+
+using io_data_types_t = io::jit_io_multi_dt_helper_t<Zmm>::data_types_t;
+
+cpu_isa_t get_gnorm_isa() {
+    return mayiuse(avx512_core) ? avx512_core : avx2;
+}
+
+// xf16 data is processed by the avx512_core instantiation only.
+cpu_isa_t get_gnorm_io_isa(cpu_isa_t isa, const io_data_types_t &dts) {
+    if (dts.count(f16)) return avx512_core_fp16;
+    if (dts.count(bf16))
+        return mayiuse(avx512_core_bf16) ? avx512_core_bf16 : avx512_core;
+    return isa;
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct jit_gnorm_stat_kernel_t : public gnorm_stat_kernel_t,
+                                 public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_gnorm_stat_kernel_t);
+
+    jit_gnorm_stat_kernel_t(const gnorm_conf_t &conf, kind_t kind)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , conf_(conf)
+        , kind_(kind)
+        , simd_w_(cpu_isa_traits<isa>::vlen / sizeof(float))
+        , src_dt_sz_(types::data_type_size(conf.src_dt))
+        , src2_dt_sz_(kind == kind_t::diff
+                          ? types::data_type_size(conf.src2_dt)
+                          : 0)
+        , acc_dt_sz_(kind == kind_t::mean_var ? sizeof(double) : sizeof(float))
+        , tail_(conf.len % simd_w_) {
+        io_data_types_t dts {conf_.src_dt, f32};
+        if (kind_ == kind_t::diff) dts.insert(conf_.src2_dt);
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this,
+                get_gnorm_io_isa(isa, dts), dts, io::io_conf_t(),
+                io_tail_conf, io_bf16_conf);
+    }
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    // Half of a vector register, the f32 elements of which are converted to
+    // a full vector of f64.
+    using Vmm_half = typename vreg_traits<Vmm>::Vmm_lower_t;
+    const AddressFrame &vmmword = (isa == avx2) ? yword : zword;
+    // mean_var needs six registers per vector of columns.
+    static constexpr int unroll_ = isa == avx2 ? 2 : 4;
+
+    const gnorm_conf_t conf_;
+    const kind_t kind_;
+    const size_t simd_w_;
+    const size_t src_dt_sz_;
+    const size_t src2_dt_sz_;
+    const size_t acc_dt_sz_;
+    const dim_t tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_src2 = r9;
+    const Reg64 reg_mean = r10;
+    const Reg64 reg_tmp = r11;
+    const Reg64 reg_acc0 = r12;
+    const Reg64 reg_acc1 = r13;
+    const Reg64 reg_nrows = r14;
+    const Reg64 reg_cnt = r15;
+    const Reg64 reg_row_src = rax;
+    const Reg64 reg_row_src2 = rbx;
+    const Reg64 reg_rows = rdx;
+    const Reg64 reg_pivot = rsi;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_x = Vmm(isa == avx2 ? 13 : 24);
+    const Vmm vmm_y = Vmm(isa == avx2 ? 14 : 25);
+    const Vmm vmm_tmp = Vmm(isa == avx2 ? 15 : 26);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+
+    // diff: f32 accumulators and per column means.
+    Vmm vmm_acc0(int i) const { return Vmm(1 + i); }
+    Vmm vmm_acc1(int i) const { return Vmm(1 + unroll_ + i); }
+    Vmm vmm_mean(int i) const { return Vmm(1 + 2 * unroll_ + i); }
+    // mean_var: pivots and f64 accumulators of the lower (h = 0) and the
+    // upper (h = 1) halves of a vector of columns.
+    Vmm vmm_pivot(int i) const { return Vmm(1 + i); }
+    Vmm vmm_sum(int i, int h) const { return Vmm(1 + unroll_ + 2 * i + h); }
+    Vmm vmm_sq(int i, int h) const { return Vmm(1 + 3 * unroll_ + 2 * i + h); }
+
+    // Subtracts mean keeping zeros in the tail lanes, so that they do not
+    // contribute to the sum of squares.
+    void sub_mean(const Vmm &x, const Vmm &mean, bool tail) {
+        if (!tail)
+            uni_vsubps(x, x, mean);
+        else if (is_superset(isa, avx512_core))
+            uni_vsubps(x | Opmask(tail_opmask_idx) | T_z, x, mean);
+        else {
+            uni_vpxor(vmm_tmp, vmm_tmp, vmm_tmp);
+            uni_vblendvps(vmm_tmp, vmm_tmp, mean, vmm_tail_mask);
+            uni_vsubps(x, x, vmm_tmp);
+        }
+    }
+
+    void accumulate(int i, const Vmm &mean, const Reg64 &src,
+            const Reg64 &src2, size_t offt, bool tail) {
+        io_[conf_.src_dt]->load(
+                vmmword[src + offt * src_dt_sz_], vmm_x, tail);
+        switch (kind_) {
+            case kind_t::mean_var: {
+                sub_mean(vmm_x, mean, tail);
+                const Vmm_half x_hi(vmm_tmp.getIdx());
+                vcvtps2pd(vmm_y, Vmm_half(vmm_x.getIdx()));
+                if (is_superset(isa, avx512_core))
+                    vextractf64x4(x_hi, Zmm(vmm_x.getIdx()), 1);
+                else
+                    vextractf128(x_hi, Ymm(vmm_x.getIdx()), 1);
+                vcvtps2pd(vmm_tmp, x_hi);
+                vaddpd(vmm_sum(i, 0), vmm_sum(i, 0), vmm_y);
+                vfmadd231pd(vmm_sq(i, 0), vmm_y, vmm_y);
+                vaddpd(vmm_sum(i, 1), vmm_sum(i, 1), vmm_tmp);
+                vfmadd231pd(vmm_sq(i, 1), vmm_tmp, vmm_tmp);
+                break;
+            }
+            case kind_t::diff:
+                // diff_dst is zero in the tail lanes, no masking is needed.
+                io_[conf_.src2_dt]->load(
+                        vmmword[src2 + offt * src2_dt_sz_], vmm_y, tail);
+                uni_vaddps(vmm_acc0(i), vmm_acc0(i), vmm_y);
+                uni_vsubps(vmm_x, vmm_x, mean);
+                uni_vfmadd231ps(vmm_acc1(i), vmm_y, vmm_x);
+                break;
+        }
+    }
+
+    void zero_accumulators(int nvec) {
+        for (int i = 0; i < nvec; i++) {
+            if (kind_ == kind_t::mean_var) {
+                for (int h = 0; h < 2; h++) {
+                    uni_vpxor(vmm_sum(i, h), vmm_sum(i, h), vmm_sum(i, h));
+                    uni_vpxor(vmm_sq(i, h), vmm_sq(i, h), vmm_sq(i, h));
+                }
+            } else {
+                uni_vpxor(vmm_acc0(i), vmm_acc0(i), vmm_acc0(i));
+                uni_vpxor(vmm_acc1(i), vmm_acc1(i), vmm_acc1(i));
+            }
+        }
+    }
+
+    void advance(size_t elems) {
+        if (elems == 0) return;
+        add(reg_src, elems * src_dt_sz_);
+        if (kind_ == kind_t::diff) add(reg_src2, elems * src2_dt_sz_);
+        if (conf_.by_columns) {
+            if (kind_ == kind_t::diff) add(reg_mean, elems * sizeof(float));
+            if (kind_ == kind_t::mean_var)
+                add(reg_pivot, elems * sizeof(float));
+            add(reg_acc0, elems * acc_dt_sz_);
+            add(reg_acc1, elems * acc_dt_sz_);
+        }
+    }
+
+    // The temporary register may have no VEX encoding on avx512.
+    void extract_upper_xmm(const Xmm &dst, int src_idx) {
+        if (is_superset(isa, avx512_core))
+            vextractf32x4(dst, Ymm(src_idx), 1);
+        else
+            vextractf128(dst, Ymm(src_idx), 1);
+    }
+
+    // Sums `n` f32 accumulators horizontally and adds the result to a scalar
+    // in memory.
+    void reduce_ps_and_add(int first_idx, int n, const Reg64 &reg_acc) {
+        for (int i = 1; i < n; i++)
+            uni_vaddps(Vmm(first_idx), Vmm(first_idx), Vmm(first_idx + i));
+        const Xmm xmm_acc(first_idx), xmm_tmp(vmm_tmp.getIdx());
+        if (is_superset(isa, avx512_core)) {
+            vextractf64x4(Ymm(vmm_tmp.getIdx()), Zmm(first_idx), 1);
+            vaddps(Ymm(first_idx), Ymm(first_idx), Ymm(vmm_tmp.getIdx()));
+        }
+        extract_upper_xmm(xmm_tmp, first_idx);
+        vaddps(xmm_acc, xmm_acc, xmm_tmp);
+        vhaddps(xmm_acc, xmm_acc, xmm_acc);
+        vhaddps(xmm_acc, xmm_acc, xmm_acc);
+        vaddss(xmm_acc, xmm_acc, dword[reg_acc]);
+        vmovss(dword[reg_acc], xmm_acc);
+    }
+
+    // Sums `n` f64 accumulators horizontally and stores the result.
+    void reduce_pd_and_store(int first_idx, int n, const Reg64 &reg_acc) {
+        for (int i = 1; i < n; i++)
+            vaddpd(Vmm(first_idx), Vmm(first_idx), Vmm(first_idx + i));
+        const Xmm xmm_acc(first_idx), xmm_tmp(vmm_tmp.getIdx());
+        if (is_superset(isa, avx512_core)) {
+            vextractf64x4(Ymm(vmm_tmp.getIdx()), Zmm(first_idx), 1);
+            vaddpd(Ymm(first_idx), Ymm(first_idx), Ymm(vmm_tmp.getIdx()));
+        }
+        extract_upper_xmm(xmm_tmp, first_idx);
+        vaddpd(xmm_acc, xmm_acc, xmm_tmp);
+        vunpckhpd(xmm_tmp, xmm_acc, xmm_acc);
+        vaddsd(xmm_acc, xmm_acc, xmm_tmp);
+        vmovsd(qword[reg_acc], xmm_acc);
+    }
+
+    // A row is contiguous and reduced into a single value.
+    void generate_ncsp() {
+        const dim_t chunk = unroll_ * simd_w_;
+        const dim_t n_chunks = conf_.len / chunk;
+        const int rem_vecs = (conf_.len % chunk) / simd_w_;
+        const bool is_mean_var = kind_ == kind_t::mean_var;
+        const Vmm vmm_bcast = is_mean_var ? vmm_pivot(0) : vmm_mean(0);
+
+        if (!is_mean_var) uni_vbroadcastss(vmm_bcast, ptr[reg_mean]);
+
+        Label row_loop, row_end;
+        L(row_loop);
+        {
+            cmp(reg_nrows, 0);
+            je(row_end, T_NEAR);
+
+            if (is_mean_var) {
+                // The first element of the row is the pivot.
+                io_[conf_.src_dt]->load(
+                        vmmword[reg_src], vmm_x, conf_.len < (dim_t)simd_w_);
+                uni_vbroadcastss(vmm_bcast, Xmm(vmm_x.getIdx()));
+                vmovss(dword[reg_pivot], Xmm(vmm_x.getIdx()));
+            }
+
+            zero_accumulators(unroll_);
+            if (n_chunks > 0) {
+                Label chunk_loop;
+                mov(reg_cnt, n_chunks);
+                L(chunk_loop);
+                {
+                    for (int i = 0; i < unroll_; i++)
+                        accumulate(i, vmm_bcast, reg_src, reg_src2,
+                                i * simd_w_, false);
+                    advance(chunk);
+                    dec(reg_cnt);
+                    jnz(chunk_loop, T_NEAR);
+                }
+            }
+            for (int i = 0; i < rem_vecs; i++)
+                accumulate(
+                        i, vmm_bcast, reg_src, reg_src2, i * simd_w_, false);
+            if (tail_)
+                accumulate(rem_vecs, vmm_bcast, reg_src, reg_src2,
+                        rem_vecs * simd_w_, true);
+            advance(rem_vecs * simd_w_ + tail_);
+
+            if (is_mean_var) {
+                reduce_pd_and_store(
+                        vmm_sum(0, 0).getIdx(), 2 * unroll_, reg_acc0);
+                reduce_pd_and_store(
+                        vmm_sq(0, 0).getIdx(), 2 * unroll_, reg_acc1);
+                add(reg_pivot, sizeof(float));
+            } else {
+                reduce_ps_and_add(vmm_acc0(0).getIdx(), unroll_, reg_acc0);
+                reduce_ps_and_add(vmm_acc1(0).getIdx(), unroll_, reg_acc1);
+            }
+            add(reg_acc0, acc_dt_sz_);
+            add(reg_acc1, acc_dt_sz_);
+
+            dec(reg_nrows);
+            jmp(row_loop, T_NEAR);
+        }
+        L(row_end);
+    }
+
+    // Processes `nvec` columns vectors, the last one is partial if `tail`
+    // is set, over all the rows.
+    void column_block(int nvec, bool tail) {
+        const bool is_mean_var = kind_ == kind_t::mean_var;
+        zero_accumulators(nvec);
+        for (int i = 0; i < nvec; i++) {
+            const bool is_tail = tail && i == nvec - 1;
+            // The first row holds the pivots, and the tail lanes of both the
+            // pivots and the data are zero.
+            if (is_mean_var)
+                io_[conf_.src_dt]->load(
+                        vmmword[reg_src + i * simd_w_ * src_dt_sz_],
+                        vmm_pivot(i), is_tail);
+            else
+                io_[f32]->load(vmmword[reg_mean + i * simd_w_ * sizeof(float)],
+                        vmm_mean(i), is_tail);
+        }
+
+        mov(reg_row_src, reg_src);
+        if (kind_ == kind_t::diff) mov(reg_row_src2, reg_src2);
+        mov(reg_rows, reg_nrows);
+        Label row_loop;
+        L(row_loop);
+        {
+            for (int i = 0; i < nvec; i++)
+                accumulate(i, is_mean_var ? vmm_pivot(i) : vmm_mean(i),
+                        reg_row_src, reg_row_src2, i * simd_w_,
+                        tail && i == nvec - 1);
+            add(reg_row_src, conf_.len * src_dt_sz_);
+            if (kind_ == kind_t::diff)
+                add(reg_row_src2, conf_.len * src2_dt_sz_);
+            dec(reg_rows);
+            jnz(row_loop, T_NEAR);
+        }
+
+        if (is_mean_var) {
+            // Whole vectors are stored, the buffers are padded.
+            for (int i = 0; i < nvec; i++) {
+                for (int h = 0; h < 2; h++) {
+                    const size_t offt
+                            = (i * simd_w_ + h * simd_w_ / 2) * sizeof(double);
+                    uni_vmovups(vmmword[reg_acc0 + offt], vmm_sum(i, h));
+                    uni_vmovups(vmmword[reg_acc1 + offt], vmm_sq(i, h));
+                }
+                uni_vmovups(vmmword[reg_pivot + i * simd_w_ * sizeof(float)],
+                        vmm_pivot(i));
+            }
+            return;
+        }
+
+        auto add_acc = [&](const Reg64 &reg_acc, const Vmm &acc, int i,
+                               bool is_tail) {
+            const auto addr = vmmword[reg_acc + i * simd_w_ * sizeof(float)];
+            io_[f32]->load(addr, vmm_tmp, is_tail);
+            uni_vaddps(acc, acc, vmm_tmp);
+            io_[f32]->store(acc, addr, is_tail);
+        };
+        for (int i = 0; i < nvec; i++) {
+            const bool is_tail = tail && i == nvec - 1;
+            add_acc(reg_acc0, vmm_acc0(i), i, is_tail);
+            add_acc(reg_acc1, vmm_acc1(i), i, is_tail);
+        }
+    }
+
+    // Rows are reduced into per column values, the columns are processed
+    // by blocks of vectors that fit in registers.
+    void generate_by_columns() {
+        const dim_t chunk = unroll_ * simd_w_;
+        const dim_t n_chunks = conf_.len / chunk;
+        const int rem_vecs = (conf_.len % chunk) / simd_w_;
+
+        Label end;
+        cmp(reg_nrows, 0);
+        je(end, T_NEAR);
+
+        if (n_chunks > 0) {
+            Label chunk_loop;
+            mov(reg_cnt, n_chunks);
+            L(chunk_loop);
+            {
+                column_block(unroll_, false);
+                advance(chunk);
+                dec(reg_cnt);
+                jnz(chunk_loop, T_NEAR);
+            }
+        }
+        if (rem_vecs > 0 || tail_ > 0)
+            column_block(rem_vecs + (tail_ > 0), tail_ > 0);
+
+        L(end);
+    }
+
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_src2, ptr[reg_param + PARAM_OFF(diff_dst)]);
+        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+        mov(reg_pivot, ptr[reg_param + PARAM_OFF(pivot)]);
+        mov(reg_acc0, ptr[reg_param + PARAM_OFF(acc0)]);
+        mov(reg_acc1, ptr[reg_param + PARAM_OFF(acc1)]);
+        mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
+
+        if (conf_.by_columns)
+            generate_by_columns();
+        else
+            generate_ncsp();
+
+        postamble();
+    }
+};
+
+template <cpu_isa_t isa>
+struct jit_gnorm_data_kernel_t : public gnorm_data_kernel_t,
+                                 public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_gnorm_data_kernel_t);
+
+    jit_gnorm_data_kernel_t(
+            const gnorm_conf_t &conf, const post_ops_t &post_ops)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , conf_(conf)
+        , simd_w_(cpu_isa_traits<isa>::vlen / sizeof(float))
+        , src_dt_sz_(types::data_type_size(conf.src_dt))
+        , src2_dt_sz_(with_src2() ? types::data_type_size(conf.src2_dt) : 0)
+        , dst_dt_sz_(types::data_type_size(conf.dst_dt))
+        , tail_(conf.len % simd_w_) {
+        io_data_types_t dts {conf_.src_dt, conf_.dst_dt, f32};
+        if (with_src2()) dts.insert(conf_.src2_dt);
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        io::io_saturation_conf_t io_saturation_conf(
+                vmm_zero.getIdx(), vmm_saturation_ubound.getIdx(), reg_tmp);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this,
+                get_gnorm_io_isa(isa, dts), dts, io::io_conf_t(),
+                io_tail_conf, io_bf16_conf,
+                {{conf_.dst_dt, io_saturation_conf}});
+
+        for (const auto &e : post_ops.entry_) {
+            assert(e.is_eltwise());
+            eltwise_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this, e.eltwise,
+                            true /*save_state*/, reg_table, Opmask(2)));
+        }
+    }
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    const AddressFrame &vmmword = (isa == avx2) ? yword : zword;
+    static constexpr int unroll_ = 4;
+
+    const gnorm_conf_t conf_;
+    const size_t simd_w_;
+    const size_t src_dt_sz_;
+    const size_t src2_dt_sz_;
+    const size_t dst_dt_sz_;
+    const dim_t tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_src2 = r9;
+    const Reg64 reg_dst = r10;
+    const Reg64 reg_tmp = r11;
+    const Reg64 reg_a = r12;
+    const Reg64 reg_b = r13;
+    const Reg64 reg_c = r14;
+    const Reg64 reg_nrows = r15;
+    const Reg64 reg_cnt = rax;
+    const Reg64 reg_table = rbx;
+    const Reg64 reg_off_coeff = rdx;
+    const Reg64 reg_m = rsi;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_zero = Vmm(1);
+    const Vmm vmm_saturation_ubound = Vmm(2);
+    const Vmm vmm_dst_scale = Vmm(3);
+    const Vmm vmm_a = Vmm(4);
+    const Vmm vmm_b = Vmm(5);
+    const Vmm vmm_c = Vmm(6);
+    const Vmm vmm_tmp = Vmm(7);
+    const Vmm vmm_src2 = Vmm(12);
+    const Vmm vmm_m = Vmm(13);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+
+    bool with_src2() const { return conf_.src2_dt != data_type::undef; }
+    Vmm vmm_data(int i) const { return Vmm(8 + i); }
+
+    // Loads a per column coefficient by columns, ncsp coefficients are
+    // broadcast once per row.
+    const Vmm &coeff(const Reg64 &reg, const Vmm &vmm_bcast, size_t offt,
+            bool tail) {
+        if (!conf_.by_columns) return vmm_bcast;
+        io_[f32]->load(
+                vmmword[reg + reg_off_coeff + offt * sizeof(float)], vmm_tmp,
+                tail);
+        return vmm_tmp;
+    }
+
+    void compute_block(int nvec, bool tail) {
+        for (int i = 0; i < nvec; i++) {
+            const bool is_tail = tail && i == nvec - 1;
+            const size_t offt = i * simd_w_;
+            const Vmm x = vmm_data(i);
+            io_[conf_.src_dt]->load(
+                    vmmword[reg_src + offt * src_dt_sz_], x, is_tail);
+            if (conf_.with_mean)
+                uni_vsubps(x, x, coeff(reg_m, vmm_m, offt, is_tail));
+            uni_vmulps(x, x, coeff(reg_a, vmm_a, offt, is_tail));
+            if (with_src2()) {
+                io_[conf_.src2_dt]->load(
+                        vmmword[reg_src2 + offt * src2_dt_sz_], vmm_src2,
+                        is_tail);
+                uni_vfmadd231ps(
+                        x, vmm_src2, coeff(reg_b, vmm_b, offt, is_tail));
+            }
+            uni_vaddps(x, x, coeff(reg_c, vmm_c, offt, is_tail));
+        }
+
+        for (auto &inj : eltwise_injectors_)
+            inj->compute_vector_range(
+                    vmm_data(0).getIdx(), vmm_data(0).getIdx() + nvec);
+
+        for (int i = 0; i < nvec; i++) {
+            const bool is_tail = tail && i == nvec - 1;
+            const Vmm x = vmm_data(i);
+            uni_vmulps(x, x, vmm_dst_scale);
+            io_[conf_.dst_dt]->store(
+                    x, vmmword[reg_dst + i * simd_w_ * dst_dt_sz_], is_tail);
+        }
+    }
+
+    void advance(size_t elems) {
+        if (elems == 0) return;
+        add(reg_src, elems * src_dt_sz_);
+        if (with_src2()) add(reg_src2, elems * src2_dt_sz_);
+        add(reg_dst, elems * dst_dt_sz_);
+        if (conf_.by_columns) add(reg_off_coeff, elems * sizeof(float));
+    }
+
+    void generate() override {
+        const dim_t chunk = unroll_ * simd_w_;
+        const dim_t n_chunks = conf_.len / chunk;
+        const int rem_vecs = (conf_.len % chunk) / simd_w_;
+
+        preamble();
+
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_src2, ptr[reg_param + PARAM_OFF(src2)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_m, ptr[reg_param + PARAM_OFF(m)]);
+        mov(reg_a, ptr[reg_param + PARAM_OFF(a)]);
+        mov(reg_b, ptr[reg_param + PARAM_OFF(b)]);
+        mov(reg_c, ptr[reg_param + PARAM_OFF(c)]);
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(dst_scale)]);
+        mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
+
+        uni_vbroadcastss(vmm_dst_scale, ptr[reg_tmp]);
+        io_.init_saturate_f32({conf_.dst_dt});
+
+        Label row_loop, row_end;
+        L(row_loop);
+        {
+            cmp(reg_nrows, 0);
+            je(row_end, T_NEAR);
+
+            if (conf_.by_columns) {
+                xor_(reg_off_coeff, reg_off_coeff);
+            } else {
+                if (conf_.with_mean) uni_vbroadcastss(vmm_m, ptr[reg_m]);
+                uni_vbroadcastss(vmm_a, ptr[reg_a]);
+                if (with_src2()) uni_vbroadcastss(vmm_b, ptr[reg_b]);
+                uni_vbroadcastss(vmm_c, ptr[reg_c]);
+            }
+
+            if (n_chunks > 0) {
+                Label chunk_loop;
+                mov(reg_cnt, n_chunks);
+                L(chunk_loop);
+                {
+                    compute_block(unroll_, false);
+                    advance(chunk);
+                    dec(reg_cnt);
+                    jnz(chunk_loop, T_NEAR);
+                }
+            }
+            if (rem_vecs > 0 || tail_ > 0) {
+                compute_block(rem_vecs + (tail_ > 0), tail_ > 0);
+                advance(rem_vecs * simd_w_ + tail_);
+            }
+
+            if (!conf_.by_columns) {
+                if (conf_.with_mean) add(reg_m, sizeof(float));
+                add(reg_a, sizeof(float));
+                if (with_src2()) add(reg_b, sizeof(float));
+                add(reg_c, sizeof(float));
+            }
+
+            dec(reg_nrows);
+            jmp(row_loop, T_NEAR);
+        }
+        L(row_end);
+
+        postamble();
+
+        for (auto &inj : eltwise_injectors_)
+            inj->prepare_table();
+    }
+};
+
+gnorm_stat_kernel_t *gnorm_stat_kernel_t::create(
+        const gnorm_conf_t &conf, kind_t kind) {
+    if (mayiuse(avx512_core))
+        return new jit_gnorm_stat_kernel_t<avx512_core>(conf, kind);
+    else if (mayiuse(avx2))
+        return new jit_gnorm_stat_kernel_t<avx2>(conf, kind);
+    assert(!"kernel is empty.");
+    return nullptr;
+}
+
+gnorm_data_kernel_t *gnorm_data_kernel_t::create(
+        const gnorm_conf_t &conf, const post_ops_t &post_ops) {
+    if (mayiuse(avx512_core))
+        return new jit_gnorm_data_kernel_t<avx512_core>(conf, post_ops);
+    else if (mayiuse(avx2))
+        return new jit_gnorm_data_kernel_t<avx2>(conf, post_ops);
+    assert(!"kernel is empty.");
+    return nullptr;
+}
+
+namespace {
+
+// Returns true when both tensors are dense and in the same layout: channels
+// last (nspc), blocked by channels without padding, or channels first
+// (ncsp).
+bool gnorm_layout_ok(const memory_desc_t *src_md, const memory_desc_t *dst_md,
+        gnorm_layout_t &layout) {
+    using namespace format_tag;
+    const auto src_tag = memory_desc_matches_one_of_tag(*src_md, nwc, nhwc,
+            ndhwc, nCw16c, nChw16c, nCdhw16c, nCw8c, nChw8c, nCdhw8c, ncw,
+            nchw, ncdhw);
+    const auto dst_tag = memory_desc_matches_one_of_tag(*dst_md, nwc, nhwc,
+            ndhwc, nCw16c, nChw16c, nCdhw16c, nCw8c, nChw8c, nCdhw8c, ncw,
+            nchw, ncdhw);
+    if (src_tag == format_tag::undef || src_tag != dst_tag) return false;
+
+    const dim_t C = src_md->dims[1];
+    layout.by_columns = !utils::one_of(src_tag, ncw, nchw, ncdhw);
+    if (utils::one_of(src_tag, nCw16c, nChw16c, nCdhw16c))
+        layout.blk = 16;
+    else if (utils::one_of(src_tag, nCw8c, nChw8c, nCdhw8c))
+        layout.blk = 8;
+    else
+        layout.blk = C;
+    return C % layout.blk == 0;
+}
+
+// Returns the number of chunks the spatial dimension of an image is split
+// into when processing columns. Every chunk is a work item with its own
+// partial sums, which are added up in the order of chunks. In deterministic
+// mode the partition does not depend on the number of threads.
+dim_t gnorm_sp_nchunks(dim_t N, dim_t SP, int nthr) {
+    const dim_t min_work = dnnl_thr_deterministic() ? 64 : 4 * nthr;
+    return nstl::max<dim_t>(1, nstl::min(SP, utils::div_up(min_work, N)));
+}
+
+// Per thread buffers are padded, so that kernels may store whole vectors.
+dim_t gnorm_padded_C(dim_t C) {
+    return utils::rnd_up(C, 16) + 16;
+}
+
+bool gnorm_dt_ok(data_type_t dt) {
+    if (dt == bf16) return mayiuse(avx512_core);
+    if (dt == f16) return mayiuse(avx512_core_fp16);
+    return utils::one_of(dt, f32, s8, u8);
+}
+
+// Statistics of a part of a group, combined with the parallel algorithm of
+// Chan et al.
+struct gnorm_partial_stat_t {
+    double n, mean, m2;
+
+    void combine(const gnorm_partial_stat_t &other) {
+        const double total = n + other.n;
+        const double delta = other.mean - mean;
+        mean += delta * other.n / total;
+        m2 += other.m2 + delta * delta * n * other.n / total;
+        n = total;
+    }
+};
+
+// Converts sums of `n` values shifted by `pivot` into statistics.
+gnorm_partial_stat_t gnorm_partial_stat(
+        double n, float pivot, double sum, double sum_sq) {
+    const double shift = sum / n;
+    return {n, pivot + shift, nstl::max(0.0, sum_sq - sum * shift)};
+}
+
+} // namespace
+
+status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_GNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_GNORM(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_GNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_GNORM(utils::one_of(src_md()->data_type, f32, bf16, f16, s8, u8)
+                    && gnorm_dt_ok(src_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(dst_md()->data_type, f32, bf16, f16, s8, u8)
+                    && gnorm_dt_ok(dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(check_scale_shift_data_type(), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(
+            attr()->has_default_values(
+                    skip_mask_t::scales_runtime | skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GNORM(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_GNORM(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_GNORM(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GNORM(gnorm_layout_ok(src_md(), dst_md(), layout_),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    nthr_ = dnnl_get_max_threads();
+    layout_.sp_nchunks = gnorm_sp_nchunks(MB(), D() * H() * W(), nthr_);
+    init_scratchpad();
+
+    return status::success;
+}
+
+bool jit_uni_group_normalization_fwd_t::pd_t::post_ops_ok() const {
+    const cpu_isa_t isa = get_gnorm_isa();
+    for (const auto &e : attr()->post_ops_.entry_) {
+        if (!e.is_eltwise()) return false;
+        if (!eltwise_injector::is_supported(isa, e.eltwise.alg)) return false;
+    }
+    return true;
+}
+
+void jit_uni_group_normalization_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    const dim_t G = desc()->groups;
+    const dim_t C_PER_G = C() / G;
+    if (layout_.by_columns) {
+        // Per thread f64 sums and f32 pivots of the statistics kernel, which
+        // are reused for per channel coefficients by the data kernel.
+        const dim_t C_pad = gnorm_padded_C(C());
+        scratchpad.template book<float>(key_gnorm_coeffs, nthr_ * 5 * C_pad);
+        if (!stats_is_src()) {
+            // Per chunk partial statistics of every group.
+            scratchpad.template book<gnorm_partial_stat_t>(
+                    key_gnorm_reduction, MB() * layout_.sp_nchunks * G);
+            if (!is_training()) {
+                scratchpad.template book<float>(key_gnorm_tmp_mean, MB() * G);
+                scratchpad.template book<float>(key_gnorm_tmp_var, MB() * G);
+            }
+        }
+    } else {
+        scratchpad.template book<float>(key_gnorm_coeffs, nthr_ * 3 * C_PER_G);
+    }
+}
+
+status_t jit_uni_group_normalization_fwd_t::init(engine_t *engine) {
+    const auto *p = pd();
+    const auto &layout = p->layout_;
+    const dim_t C_PER_G = p->C() / p->desc()->groups;
+    const dim_t SP = p->D() * p->H() * p->W();
+    const data_type_t src_dt = p->src_md()->data_type;
+    const data_type_t dst_dt = p->dst_md()->data_type;
+
+    if (!p->stats_is_src()) {
+        const gnorm_conf_t stat_conf {layout.by_columns,
+                layout.by_columns ? layout.blk : C_PER_G * SP, src_dt,
+                data_type::undef, f32, false};
+        CHECK(safe_ptr_assign(stat_kernel_,
+                gnorm_stat_kernel_t::create(
+                        stat_conf, gnorm_stat_kernel_t::kind_t::mean_var)));
+        CHECK(stat_kernel_->create_kernel());
+    }
+
+    const gnorm_conf_t data_conf {layout.by_columns,
+            layout.by_columns ? layout.blk : SP, src_dt, data_type::undef,
+            dst_dt, true};
+    CHECK(safe_ptr_assign(data_kernel_,
+            gnorm_data_kernel_t::create(data_conf, p->attr()->post_ops_)));
+    CHECK(data_kernel_->create_kernel());
+
+    return status::success;
+}
+
+status_t jit_uni_group_normalization_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    return pd()->layout_.by_columns ? execute_by_columns(ctx)
+                                    : execute_ncsp(ctx);
+}
+
+// Work items are chunks of the spatial dimension of every image. The
+// statistics kernel computes per channel sums of a work item in a single
+// pass, and they are combined into per group partial statistics. The
+// partial statistics of all the chunks of an image are then combined in
+// order, and the data kernel normalizes the same work items.
+status_t jit_uni_group_normalization_fwd_t::execute_by_columns(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+    auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
+    auto mean = pd()->stats_is_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+            : CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_MEAN, status);
+    CHECK(status);
+    auto variance = pd()->stats_is_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+            : CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_VARIANCE, status);
+    CHECK(status);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto *partials
+            = scratchpad.template get<gnorm_partial_stat_t>(key_gnorm_reduction);
+    float *coeffs = scratchpad.template get<float>(key_gnorm_coeffs);
+
+    const auto &layout = pd()->layout_;
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->desc()->groups;
+    const dim_t C_PER_G = C / G;
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t blk = layout.blk;
+    const dim_t nblk = C / blk;
+    const dim_t nchunks = layout.sp_nchunks;
+    const dim_t C_pad = gnorm_padded_C(C);
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool calculate_stats = !pd()->stats_is_src();
+    const bool save_stats = pd()->is_training();
+    const int nthr = pd()->nthr_;
+
+    const size_t src_dt_sz = types::data_type_size(pd()->src_md()->data_type);
+    const size_t dst_dt_sz = types::data_type_size(pd()->dst_md()->data_type);
+
+    // Offset of the first row of a chunk of a block of channels.
+    auto data_off = [&](dim_t n, dim_t cb, dim_t sp) {
+        return ((n * nblk + cb) * SP + sp) * blk;
+    };
+
+    if (calculate_stats) {
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            double *sum = reinterpret_cast<double *>(coeffs + ithr * 5 * C_pad);
+            double *sum_sq = sum + C_pad;
+            float *pivot = reinterpret_cast<float *>(sum_sq + C_pad);
+
+            for_nd(ithr, nthr, N, nchunks, [&](dim_t n, dim_t ichunk) {
+                dim_t sp_s {0}, sp_e {0};
+                balance211(SP, nchunks, ichunk, sp_s, sp_e);
+                if (sp_s >= sp_e) return;
+
+                // Blocks are processed in order, since every call may
+                // overwrite the beginning of the next block in the buffers.
+                for (dim_t cb = 0; cb < nblk; cb++) {
+                    gnorm_stat_kernel_t::call_params_t p;
+                    p.src = src + data_off(n, cb, sp_s) * src_dt_sz;
+                    p.diff_dst = nullptr;
+                    p.mean = nullptr;
+                    p.pivot = pivot + cb * blk;
+                    p.acc0 = sum + cb * blk;
+                    p.acc1 = sum_sq + cb * blk;
+                    p.nrows = sp_e - sp_s;
+                    (*stat_kernel_)(&p);
+                }
+
+                const double nrows = sp_e - sp_s;
+                for (dim_t g = 0; g < G; g++) {
+                    gnorm_partial_stat_t stat {0, 0, 0};
+                    for (dim_t c = g * C_PER_G; c < (g + 1) * C_PER_G; c++) {
+                        const auto c_stat = gnorm_partial_stat(
+                                nrows, pivot[c], sum[c], sum_sq[c]);
+                        if (stat.n == 0)
+                            stat = c_stat;
+                        else
+                            stat.combine(c_stat);
+                    }
+                    partials[(n * nchunks + ichunk) * G + g] = stat;
+                }
+            });
+        });
+
+        float *tmp_mean = scratchpad.template get<float>(key_gnorm_tmp_mean);
+        float *tmp_var = scratchpad.template get<float>(key_gnorm_tmp_var);
+        if (!save_stats) {
+            mean = tmp_mean;
+            variance = tmp_var;
+        }
+        parallel_nd(N, G, [&](dim_t n, dim_t g) {
+            gnorm_partial_stat_t stat {0, 0, 0};
+            for (dim_t ichunk = 0; ichunk < nchunks; ichunk++) {
+                const auto &part = partials[(n * nchunks + ichunk) * G + g];
+                if (part.n == 0) continue;
+                if (stat.n == 0)
+                    stat = part;
+                else
+                    stat.combine(part);
+            }
+            mean[n * G + g] = static_cast<float>(stat.mean);
+            variance[n * G + g] = static_cast<float>(stat.m2 / stat.n);
+        });
+    }
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        float *m = coeffs + ithr * 5 * C_pad;
+        float *a = m + C_pad;
+        float *c = a + C_pad;
+
+        dim_t n_prev = -1;
+        for_nd(ithr, nthr, N, nchunks, [&](dim_t n, dim_t ichunk) {
+            dim_t sp_s {0}, sp_e {0};
+            balance211(SP, nchunks, ichunk, sp_s, sp_e);
+            if (sp_s >= sp_e) return;
+
+            if (n != n_prev) {
+                for (dim_t ch = 0; ch < C; ch++) {
+                    const dim_t stat_off = n * G + ch / C_PER_G;
+                    const float sm = (scale ? scale[ch] : 1.0f)
+                            / sqrtf(variance[stat_off] + eps);
+                    const float sv = shift ? shift[ch] : 0;
+                    m[ch] = mean[stat_off];
+                    a[ch] = sm * src_scales[0];
+                    c[ch] = sv * src_scales[0];
+                }
+                n_prev = n;
+            }
+
+            for (dim_t cb = 0; cb < nblk; cb++) {
+                const dim_t off = data_off(n, cb, sp_s);
+                gnorm_data_kernel_t::call_params_t p;
+                p.src = src + off * src_dt_sz;
+                p.src2 = nullptr;
+                p.dst = dst + off * dst_dt_sz;
+                p.m = m + cb * blk;
+                p.a = a + cb * blk;
+                p.b = nullptr;
+                p.c = c + cb * blk;
+                p.dst_scale = dst_scales;
+                p.nrows = sp_e - sp_s;
+                (*data_kernel_)(&p);
+            }
+        });
+    });
+
+    return status::success;
+}
+
+// Every group of an image is contiguous and processed by a single thread.
+status_t jit_uni_group_normalization_fwd_t::execute_ncsp(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+    auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
+    auto mean = pd()->stats_is_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+            : CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_MEAN, status);
+    CHECK(status);
+    auto variance = pd()->stats_is_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+            : CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_VARIANCE, status);
+    CHECK(status);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *coeffs = scratchpad.template get<float>(key_gnorm_coeffs);
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->desc()->groups;
+    const dim_t C_PER_G = C / G;
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool calculate_stats = !pd()->stats_is_src();
+    const bool save_stats = pd()->is_training();
+
+    const size_t src_dt_sz = types::data_type_size(pd()->src_md()->data_type);
+    const size_t dst_dt_sz = types::data_type_size(pd()->dst_md()->data_type);
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        float *m = coeffs + ithr * 3 * C_PER_G;
+        float *a = m + C_PER_G;
+        float *c = a + C_PER_G;
+
+        for_nd(ithr, nthr, N, G, [&](dim_t n, dim_t g) {
+            const dim_t stat_off = n * G + g;
+            const dim_t data_off = (n * C + g * C_PER_G) * SP;
+
+            float v_mean = calculate_stats ? 0 : mean[stat_off];
+            float v_variance = calculate_stats ? 0 : variance[stat_off];
+            if (calculate_stats) {
+                double sum = 0, sum_sq = 0;
+                float pivot = 0;
+                gnorm_stat_kernel_t::call_params_t p;
+                p.src = src + data_off * src_dt_sz;
+                p.diff_dst = nullptr;
+                p.mean = nullptr;
+                p.pivot = &pivot;
+                p.acc0 = &sum;
+                p.acc1 = &sum_sq;
+                p.nrows = 1;
+                (*stat_kernel_)(&p);
+
+                const auto stat = gnorm_partial_stat(
+                        C_PER_G * SP, pivot, sum, sum_sq);
+                v_mean = static_cast<float>(stat.mean);
+                v_variance = static_cast<float>(stat.m2 / stat.n);
+                if (save_stats) {
+                    mean[stat_off] = v_mean;
+                    variance[stat_off] = v_variance;
+                }
+            }
+
+            const float sqrt_variance = sqrtf(v_variance + eps);
+            for (dim_t i = 0; i < C_PER_G; i++) {
+                const dim_t ch = g * C_PER_G + i;
+                const float sm = (scale ? scale[ch] : 1.0f) / sqrt_variance;
+                const float sv = shift ? shift[ch] : 0;
+                m[i] = v_mean;
+                a[i] = sm * src_scales[0];
+                c[i] = sv * src_scales[0];
+            }
+
+            gnorm_data_kernel_t::call_params_t p;
+            p.src = src + data_off * src_dt_sz;
+            p.src2 = nullptr;
+            p.dst = dst + data_off * dst_dt_sz;
+            p.m = m;
+            p.a = a;
+            p.b = nullptr;
+            p.c = c;
+            p.dst_scale = dst_scales;
+            p.nrows = C_PER_G;
+            (*data_kernel_)(&p);
+        });
+    });
+
+    return status::success;
+}
+
+status_t jit_uni_group_normalization_bwd_t::pd_t::init(engine_t *engine) {
+    VDISPATCH_GNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_GNORM(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_GNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_GNORM(utils::one_of(src_md()->data_type, f32, bf16, f16)
+                    && gnorm_dt_ok(src_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(diff_dst_md()->data_type, f32, bf16, f16)
+                    && gnorm_dt_ok(diff_dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(diff_src_md()->data_type, f32, bf16, f16)
+                    && gnorm_dt_ok(diff_src_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GNORM(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    gnorm_layout_t diff_src_layout;
+    VDISPATCH_GNORM(gnorm_layout_ok(src_md(), diff_dst_md(), layout_)
+                    && gnorm_layout_ok(
+                            src_md(), diff_src_md(), diff_src_layout),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    nthr_ = dnnl_get_max_threads();
+    layout_.sp_nchunks = gnorm_sp_nchunks(MB(), D() * H() * W(), nthr_);
+    init_scratchpad();
+
+    return status::success;
+}
+
+void jit_uni_group_normalization_bwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    const dim_t C_PER_G = C() / desc()->groups;
+    // Per image and channel sums of diff_dst and of diff_dst * (src - mean),
+    // followed by the per channel diff_shift and diff_scale.
+    scratchpad.template book<float>(
+            key_gnorm_tmp_diff_ss, 2 * MB() * C() + 2 * C());
+    if (layout_.by_columns) {
+        // Per chunk partial sums, and per thread channel means and
+        // coefficients.
+        scratchpad.template book<float>(
+                key_gnorm_reduction, MB() * layout_.sp_nchunks * 2 * C());
+        scratchpad.template book<float>(
+                key_gnorm_coeffs, nthr_ * 4 * gnorm_padded_C(C()));
+    } else {
+        scratchpad.template book<float>(key_gnorm_coeffs, nthr_ * 4 * C_PER_G);
+    }
+}
+
+status_t jit_uni_group_normalization_bwd_t::init(engine_t *engine) {
+    const auto *p = pd();
+    const auto &layout = p->layout_;
+    const dim_t SP = p->D() * p->H() * p->W();
+    const dim_t len = layout.by_columns ? layout.blk : SP;
+    const data_type_t src_dt = p->src_md()->data_type;
+    const data_type_t diff_dst_dt = p->diff_dst_md()->data_type;
+    const data_type_t diff_src_dt = p->diff_src_md()->data_type;
+
+    const gnorm_conf_t stat_conf {
+            layout.by_columns, len, src_dt, diff_dst_dt, f32, false};
+    CHECK(safe_ptr_assign(diff_kernel_,
+            gnorm_stat_kernel_t::create(
+                    stat_conf, gnorm_stat_kernel_t::kind_t::diff)));
+    CHECK(diff_kernel_->create_kernel());
+
+    // With global statistics diff_src does not depend on src, and diff_dst
+    // is the only input.
+    const gnorm_conf_t data_conf = p->stats_is_src()
+            ? gnorm_conf_t {layout.by_columns, len, diff_dst_dt,
+                    data_type::undef, diff_src_dt, false}
+            : gnorm_conf_t {layout.by_columns, len, src_dt, diff_dst_dt,
+                    diff_src_dt, true};
+    CHECK(safe_ptr_assign(data_kernel_,
+            gnorm_data_kernel_t::create(data_conf, post_ops_t())));
+    CHECK(data_kernel_->create_kernel());
+
+    return status::success;
+}
+
+status_t jit_uni_group_normalization_bwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    auto diff_dst = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_DST);
+    auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+
+    auto diff_src = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+    auto diff_scale = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SCALE, status);
+    CHECK(status);
+    auto diff_shift = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SHIFT, status);
+    CHECK(status);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *diff_ss = scratchpad.template get<float>(key_gnorm_tmp_diff_ss);
+    float *ws_reduction = scratchpad.template get<float>(key_gnorm_reduction);
+    float *coeffs = scratchpad.template get<float>(key_gnorm_coeffs);
+
+    const auto &layout = pd()->layout_;
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->desc()->groups;
+    const dim_t C_PER_G = C / G;
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t blk = layout.blk;
+    const dim_t nblk = C / blk;
+    const dim_t nchunks = layout.sp_nchunks;
+    const dim_t C_pad = gnorm_padded_C(C);
+    const float CSP = C_PER_G * SP;
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool calculate_diff_stats = !pd()->stats_is_src();
+    const int nthr = pd()->nthr_;
+
+    const size_t src_dt_sz = types::data_type_size(pd()->src_md()->data_type);
+    const size_t diff_dst_dt_sz
+            = types::data_type_size(pd()->diff_dst_md()->data_type);
+    const size_t diff_src_dt_sz
+            = types::data_type_size(pd()->diff_src_md()->data_type);
+
+    float *sum_dd = diff_ss;
+    float *sum_dd_src = diff_ss + N * C;
+    float *d_beta = diff_ss + 2 * N * C;
+    float *d_gamma = d_beta + C;
+
+    auto inv_sqrtvar = [&](dim_t stat_off) {
+        return 1.0f / sqrtf(variance[stat_off] + eps);
+    };
+    // Offset of the first row of a chunk of a block of channels.
+    auto data_off = [&](dim_t n, dim_t cb, dim_t sp) {
+        return ((n * nblk + cb) * SP + sp) * blk;
+    };
+
+    // Per image and channel sums of diff_dst and diff_dst * (src - mean).
+    if (layout.by_columns) {
+        // Every chunk of an image has its own partial sums, which are added
+        // up in the order of chunks.
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            float *mean_c = coeffs + ithr * 4 * C_pad;
+            dim_t n_prev = -1;
+            for_nd(ithr, nthr, N, nchunks, [&](dim_t n, dim_t ichunk) {
+                float *acc = ws_reduction + (n * nchunks + ichunk) * 2 * C;
+                utils::array_set(acc, 0.f, 2 * C);
+
+                dim_t sp_s {0}, sp_e {0};
+                balance211(SP, nchunks, ichunk, sp_s, sp_e);
+                if (sp_s >= sp_e) return;
+
+                if (n != n_prev) {
+                    for (dim_t c = 0; c < C; c++)
+                        mean_c[c] = mean[n * G + c / C_PER_G];
+                    n_prev = n;
+                }
+                for (dim_t cb = 0; cb < nblk; cb++) {
+                    gnorm_stat_kernel_t::call_params_t p;
+                    p.src = src + data_off(n, cb, sp_s) * src_dt_sz;
+                    p.diff_dst
+                            = diff_dst + data_off(n, cb, sp_s) * diff_dst_dt_sz;
+                    p.mean = mean_c + cb * blk;
+                    p.pivot = nullptr;
+                    p.acc0 = acc + cb * blk;
+                    p.acc1 = acc + C + cb * blk;
+                    p.nrows = sp_e - sp_s;
+                    (*diff_kernel_)(&p);
+                }
+            });
+        });
+        parallel_nd(N, C, [&](dim_t n, dim_t c) {
+            float s_dd = 0, s_dd_src = 0;
+            for (dim_t ichunk = 0; ichunk < nchunks; ichunk++) {
+                const float *acc
+                        = ws_reduction + (n * nchunks + ichunk) * 2 * C;
+                s_dd += acc[c];
+                s_dd_src += acc[C + c];
+            }
+            sum_dd[n * C + c] = s_dd;
+            sum_dd_src[n * C + c] = s_dd_src;
+        });
+    } else {
+        utils::array_set(diff_ss, 0.f, 2 * N * C);
+        parallel_nd(N, G, [&](dim_t n, dim_t g) {
+            const dim_t off = (n * C + g * C_PER_G) * SP;
+            gnorm_stat_kernel_t::call_params_t p;
+            p.src = src + off * src_dt_sz;
+            p.diff_dst = diff_dst + off * diff_dst_dt_sz;
+            p.mean = &mean[n * G + g];
+            p.pivot = nullptr;
+            p.acc0 = sum_dd + n * C + g * C_PER_G;
+            p.acc1 = sum_dd_src + n * C + g * C_PER_G;
+            p.nrows = C_PER_G;
+            (*diff_kernel_)(&p);
+        });
+    }
+
+    parallel_nd(C, [&](dim_t c) {
+        const dim_t g = c / C_PER_G;
+        float diff_gamma = 0;
+        float diff_beta = 0;
+        for (dim_t n = 0; n < N; n++) {
+            diff_gamma += sum_dd_src[n * C + c] * inv_sqrtvar(n * G + g);
+            diff_beta += sum_dd[n * C + c];
+        }
+        d_gamma[c] = diff_gamma;
+        d_beta[c] = diff_beta;
+        if (diff_scale) diff_scale[c] = diff_gamma;
+        if (diff_shift) diff_shift[c] = diff_beta;
+    });
+
+    // diff_src = gamma * r * (diff_dst - (d_beta + (src - mean) * d_gamma * r)
+    // / CSP) is computed as (src - mean) * a + diff_dst * b + c per image and
+    // channel. With global statistics it is diff_dst * a.
+    auto compute_coeffs = [&](dim_t n, dim_t ch, float &m, float &a,
+                                  float &b, float &c) {
+        const dim_t stat_off = n * G + ch / C_PER_G;
+        const float r = inv_sqrtvar(stat_off);
+        const float gamma_r = (scale ? scale[ch] : 1.0f) * r;
+        if (calculate_diff_stats) {
+            m = mean[stat_off];
+            a = -gamma_r * r * d_gamma[ch] / CSP;
+            b = gamma_r;
+            c = -gamma_r * d_beta[ch] / CSP;
+        } else {
+            m = 0;
+            a = gamma_r;
+            b = 0;
+            c = 0;
+        }
+    };
+    const char *data_src = calculate_diff_stats ? src : diff_dst;
+    const size_t data_src_dt_sz
+            = calculate_diff_stats ? src_dt_sz : diff_dst_dt_sz;
+    const float one = 1.f;
+
+    if (layout.by_columns) {
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            float *m = coeffs + ithr * 4 * C_pad;
+            float *a = m + C_pad;
+            float *b = a + C_pad;
+            float *c = b + C_pad;
+            dim_t n_prev = -1;
+            for_nd(ithr, nthr, N, nchunks, [&](dim_t n, dim_t ichunk) {
+                dim_t sp_s {0}, sp_e {0};
+                balance211(SP, nchunks, ichunk, sp_s, sp_e);
+                if (sp_s >= sp_e) return;
+
+                if (n != n_prev) {
+                    for (dim_t ch = 0; ch < C; ch++)
+                        compute_coeffs(n, ch, m[ch], a[ch], b[ch], c[ch]);
+                    n_prev = n;
+                }
+                for (dim_t cb = 0; cb < nblk; cb++) {
+                    const dim_t off = data_off(n, cb, sp_s);
+                    gnorm_data_kernel_t::call_params_t p;
+                    p.src = data_src + off * data_src_dt_sz;
+                    p.src2 = diff_dst + off * diff_dst_dt_sz;
+                    p.dst = diff_src + off * diff_src_dt_sz;
+                    p.m = m + cb * blk;
+                    p.a = a + cb * blk;
+                    p.b = b + cb * blk;
+                    p.c = c + cb * blk;
+                    p.dst_scale = &one;
+                    p.nrows = sp_e - sp_s;
+                    (*data_kernel_)(&p);
+                }
+            });
+        });
+    } else {
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            float *m = coeffs + ithr * 4 * C_PER_G;
+            float *a = m + C_PER_G;
+            float *b = a + C_PER_G;
+            float *c = b + C_PER_G;
+            for_nd(ithr, nthr, N, G, [&](dim_t n, dim_t g) {
+                for (dim_t i = 0; i < C_PER_G; i++)
+                    compute_coeffs(
+                            n, g * C_PER_G + i, m[i], a[i], b[i], c[i]);
+
+                const dim_t off = (n * C + g * C_PER_G) * SP;
+                gnorm_data_kernel_t::call_params_t p;
+                p.src = data_src + off * data_src_dt_sz;
+                p.src2 = diff_dst + off * diff_dst_dt_sz;
+                p.dst = diff_src + off * diff_src_dt_sz;
+                p.m = m;
+                p.a = a;
+                p.b = b;
+                p.c = c;
+                p.dst_scale = &one;
+                p.nrows = C_PER_G;
+                (*data_kernel_)(&p);
+            });
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
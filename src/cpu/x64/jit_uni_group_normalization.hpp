@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+#define CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_group_normalization_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// The implementation works with two kinds of layouts where every tensor is
+// streamed contiguously:
+// - by columns (nspc and blocked): a row is `len` channels of one spatial
+//   point, all the channels for nspc and a block of channels otherwise. The
+//   statistics are accumulated per channel (column) over rows;
+// - ncsp: a row is the spatial extent of one channel (or of a whole group),
+//   the statistics are accumulated per row.
+struct gnorm_conf_t {
+    bool by_columns;
+    // Number of elements in a row processed by a kernel.
+    dim_t len;
+    data_type_t src_dt;
+    // Second input: `diff_dst` for the statistics kernel and the data kernel
+    // in backward, undefined otherwise.
+    data_type_t src2_dt;
+    data_type_t dst_dt;
+    // Data kernel only: whether `m` is subtracted from `src`.
+    bool with_mean;
+};
+
+// Accumulates statistics of a tensor, one value per column when processing
+// columns and one value per row for ncsp.
+struct gnorm_stat_kernel_t {
+    enum class kind_t {
+        // acc0 = sum(src - pivot), acc1 = sum((src - pivot)^2) accumulated
+        // in f64, where `pivot` is the first row (by columns) or the first
+        // element of a row (ncsp), and is stored as well. Subtracting a
+        // value close to the mean keeps the single pass accurate. Results
+        // are stored for whole vectors of columns, so the buffers have to be
+        // padded to a multiple of the vector length.
+        mean_var,
+        // acc0 += diff_dst, acc1 += diff_dst * (src - mean) in f32.
+        diff,
+    };
+
+    struct call_params_t {
+        const void *src;
+        const void *diff_dst;
+        // diff: per column by columns, a single value for ncsp.
+        const float *mean;
+        // mean_var: per column by columns, per row for ncsp.
+        float *pivot;
+        void *acc0;
+        void *acc1;
+        size_t nrows;
+    };
+
+    static gnorm_stat_kernel_t *create(
+            const gnorm_conf_t &conf, kind_t kind);
+    virtual ~gnorm_stat_kernel_t() = default;
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+// Computes `dst = po((src - m) * a + src2 * b + c) * dst_scale`, where `m`,
+// `a`, `b` and `c` are per column by columns and per row for ncsp, and `po`
+// is a chain of eltwise post-ops.
+struct gnorm_data_kernel_t {
+    struct call_params_t {
+        const void *src;
+        const void *src2;
+        void *dst;
+        const float *m;
+        const float *a;
+        const float *b;
+        const float *c;
+        const float *dst_scale;
+        size_t nrows;
+    };
+
+    static gnorm_data_kernel_t *create(
+            const gnorm_conf_t &conf, const post_ops_t &post_ops);
+    virtual ~gnorm_data_kernel_t() = default;
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+// Layout parameters shared by forward and backward. By columns, an image is
+// `C / blk` blocks of `SP` rows of `blk` channels, and the spatial dimension
+// is split into `sp_nchunks` chunks with their own partial sums.
+struct gnorm_layout_t {
+    bool by_columns = false;
+    dim_t blk = 0;
+    dim_t sp_nchunks = 0;
+};
+
+struct jit_uni_group_normalization_fwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_fwd_pd_t {
+        using cpu_group_normalization_fwd_pd_t::
+                cpu_group_normalization_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("jit:uni", jit_uni_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        gnorm_layout_t layout_;
+        int nthr_ = 0;
+
+    private:
+        bool post_ops_ok() const;
+        void init_scratchpad();
+    };
+
+    jit_uni_group_normalization_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    status_t execute_by_columns(const exec_ctx_t &ctx) const;
+    status_t execute_ncsp(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<gnorm_stat_kernel_t> stat_kernel_;
+    std::unique_ptr<gnorm_data_kernel_t> data_kernel_;
+};
+
+struct jit_uni_group_normalization_bwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_bwd_pd_t {
+        using cpu_group_normalization_bwd_pd_t::
+                cpu_group_normalization_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("jit:uni", jit_uni_group_normalization_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        gnorm_layout_t layout_;
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_group_normalization_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<gnorm_stat_kernel_t> diff_kernel_;
+    std::unique_ptr<gnorm_data_kernel_t> data_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1168,10 +1168,12 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
     }
 
     const int max_nthr = pd()->nthr_;
+    const dim_t nchunks = pd()->nchunks_;
 
-    parallel(max_nthr, [&](int ithr, int nthr) {
+    // Every chunk of rows has its own partial sums, see diff_ss_nchunks().
+    parallel_nd(nchunks, [&](dim_t ichunk) {
         dim_t N_start = 0, N_end = 0;
-        balance211(N, nthr, ithr, N_start, N_end);
+        balance211(N, nchunks, ichunk, N_start, N_end);
         const int block_size = N_end - N_start;
         const char *const __restrict src_ptr
                 = reinterpret_cast<const char *>(src)
@@ -1180,8 +1182,8 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
                 = reinterpret_cast<const char *>(diff_dst)
                 + N_start * C_padded * diff_dst_d.data_type_size();
 
-        float *my_diff_gamma = reduce + C * ithr;
-        float *my_diff_beta = reduce + C * nthr + C * ithr;
+        float *my_diff_gamma = reduce + C * ichunk;
+        float *my_diff_beta = reduce + C * nchunks + C * ichunk;
         for (dim_t c = 0; c < C; c++) {
             my_diff_gamma[c] = 0.;
             my_diff_beta[c] = 0.;
@@ -1193,9 +1195,9 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
 
     parallel_nd(C, [&](dim_t c) {
         float diff_gamma = 0, diff_beta = 0;
-        for (dim_t n = 0; n < max_nthr; n++) {
+        for (dim_t n = 0; n < nchunks; n++) {
             diff_gamma += reduce[C * n + c];
-            diff_beta += reduce[C * max_nthr + C * n + c];
+            diff_beta += reduce[C * nchunks + C * n + c];
         }
         diff_scale[c] = diff_gamma;
         diff_shift[c] = diff_beta;
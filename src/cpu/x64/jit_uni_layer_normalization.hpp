@@ -260,6 +260,7 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
             }
 
             nthr_ = dnnl_get_max_threads();
+            nchunks_ = diff_ss_nchunks(nthr_);
             init_scratchpad();
             return status::success;
         }
@@ -269,6 +270,7 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
         std::shared_ptr<primitive_desc_t> reorder_pd_;
         memory_desc_t reordered_stat_md_;
         int nthr_; // To not exceed the limit in execute used for set up.
+        int nchunks_; // Number of partial sums of diff_scale and diff_shift.
 
     private:
         void init_scratchpad() {
@@ -281,7 +283,7 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
                         key_lnorm_tmp_var, across_axis());
             }
             scratchpad.template book<float>(
-                    key_lnorm_reduction, 2 * norm_axis() * nthr_);
+                    key_lnorm_reduction, 2 * norm_axis() * nchunks_);
             scratchpad.template book<float>(
                     key_lnorm_tmp_diff_ss, 2 * norm_axis());
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/x64/jit_uni_reduction.hpp"
@@ -49,6 +53,42 @@ static bool impl_supports_datatype(data_type_t data_type) {
     }
 }
 
+// Describes a dense memory descriptor as a list of (size, logical dimension)
+// from the outermost to the innermost physical dimension. Physical dimensions
+// of size one are skipped. Inner blocks are marked with `is_block`.
+struct physical_dim_t {
+    dim_t size;
+    int dim;
+    bool is_block;
+};
+
+static bool get_physical_dims(
+        const memory_desc_wrapper &mdw, std::vector<physical_dim_t> &pdims) {
+    if (!mdw.is_blocking_desc() || !mdw.is_dense() || mdw.has_runtime_dims())
+        return false;
+
+    const int ndims = mdw.ndims();
+    const auto &bd = mdw.blocking_desc();
+    dims_t blocks;
+    mdw.compute_blocks(blocks);
+
+    std::vector<int> order(ndims);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+            [&](int a, int b) { return bd.strides[a] > bd.strides[b]; });
+
+    pdims.clear();
+    for (int d : order) {
+        const dim_t size = mdw.padded_dims()[d] / blocks[d];
+        if (size > 1) pdims.push_back({size, d, false});
+    }
+    for (int i = 0; i < bd.inner_nblks; i++) {
+        if (bd.inner_blks[i] > 1)
+            pdims.push_back({bd.inner_blks[i], (int)bd.inner_idxs[i], true});
+    }
+    return true;
+}
+
 status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     using namespace alg_kind;
     using namespace data_type;
@@ -108,13 +148,7 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     conf_.with_postops
             = conf_.with_eltwise || conf_.with_binary || conf_.with_sum;
 
-    const format_tag_t src_md_desired_format = memory_desc_matches_one_of_tag(
-            *src_md(), x, nc, ncw, nchw, ncdhw);
-    const format_tag_t dst_md_desired_format = memory_desc_matches_one_of_tag(
-            *dst_md(), x, nc, ncw, nchw, ncdhw);
-    if (src_md_desired_format != dst_md_desired_format
-            || src_md_desired_format == format_tag::undef)
-        return status::unimplemented;
+    if (src_mdw.has_zero_dim()) return status::unimplemented;
 
     const int ndims = src_mdw.ndims();
     const auto &src_dims = src_mdw.dims();
@@ -122,115 +156,291 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
 
     conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
 
-    int num_of_reduced_dims = 0;
     conf_.idle_size = dst_mdw.nelems();
     conf_.reduce_size = 1;
-    for (int d = ndims - 1; d >= 0; --d) {
-        if (src_dims[d] != dst_dims[d]) {
-            num_of_reduced_dims++;
-            conf_.reduce_size *= src_dims[d];
-        } else
-            break;
-    }
+    for (int d = 0; d < ndims; ++d)
+        if (src_dims[d] != dst_dims[d]) conf_.reduce_size *= src_dims[d];
+    if (conf_.reduce_size == 1) return status::unimplemented;
+    conf_.full_reduce_size = conf_.reduce_size;
 
-    if (num_of_reduced_dims == 0) return status::unimplemented;
+    conf_.alg = desc()->alg_kind;
+    conf_.p = desc()->p;
+    conf_.eps = desc()->eps;
 
-    for (int d = 0; d < ndims - num_of_reduced_dims; ++d)
-        if (src_dims[d] != dst_dims[d]) return status::unimplemented;
+    CHECK(init_passes());
+    init_scratchpad();
 
-    conf_.alg = desc()->alg_kind;
-    if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum,
-                reduction_norm_lp_power_p_max, reduction_norm_lp_power_p_sum))
+    return status::success;
+}
+
+// Splits the reduction into passes. The physical dimensions of src are
+// grouped into runs of reduced and kept dimensions, so that src is a
+// [kept][reduced][kept]...[reduced][kept] tensor. Every pass reduces the
+// innermost remaining reduced group: the trailing group is reduced
+// horizontally, any other group is reduced vertically, i.e. by accumulating
+// rows of the kept inner elements. When a pass doesn't provide enough
+// parallel work, its reduced group is split to let threads compute partial
+// results which are reduced by the next pass.
+status_t jit_uni_reduction_t::pd_t::init_passes() {
+    const memory_desc_wrapper src_mdw(src_md());
+    const memory_desc_wrapper dst_mdw(dst_md());
+    const auto &src_dims = src_mdw.dims();
+    const auto &dst_dims = dst_mdw.dims();
+
+    std::vector<physical_dim_t> src_pdims, dst_pdims;
+    if (!get_physical_dims(src_mdw, src_pdims)
+            || !get_physical_dims(dst_mdw, dst_pdims))
         return status::unimplemented;
 
+    // dst layout must be the src one with the reduced dimensions removed,
+    // reduced dimensions can't be blocked
+    std::vector<physical_dim_t> kept_pdims;
+    for (const auto &pd : src_pdims) {
+        const bool is_reduced = src_dims[pd.dim] != dst_dims[pd.dim];
+        if (is_reduced && pd.is_block) return status::unimplemented;
+        if (!is_reduced) kept_pdims.push_back(pd);
+    }
+    if (kept_pdims.size() != dst_pdims.size()) return status::unimplemented;
+    for (size_t i = 0; i < kept_pdims.size(); i++)
+        if (kept_pdims[i].size != dst_pdims[i].size
+                || kept_pdims[i].dim != dst_pdims[i].dim)
+            return status::unimplemented;
+
+    // (size, is_reduced) from the outermost group to the innermost one
+    std::vector<std::pair<dim_t, bool>> groups;
+    for (const auto &pd : src_pdims) {
+        const bool is_reduced = src_dims[pd.dim] != dst_dims[pd.dim];
+        if (!groups.empty() && groups.back().second == is_reduced)
+            groups.back().first *= pd.size;
+        else
+            groups.emplace_back(pd.size, is_reduced);
+    }
+
+    const auto simd_w = static_cast<dim_t>(
+            isa_max_vlen(conf_.isa) / sizeof(float));
+    const int nthr = dnnl_get_max_threads();
+
+    auto prod = [&](size_t begin, size_t end) {
+        dim_t ret = 1;
+        for (size_t i = begin; i < end; i++)
+            ret *= groups[i].first;
+        return ret;
+    };
+    // largest divisor of n not greater than max_div for which pred is true
+    auto largest_divisor = [](dim_t n, dim_t max_div,
+                                   const std::function<bool(dim_t)> &pred) {
+        for (dim_t div = nstl::min(n, max_div); div > 1; div--)
+            if (n % div == 0 && pred(div)) return div;
+        return dim_t(1);
+    };
+
+    pass_confs_.clear();
+    bool is_first_pass = true;
+    while (true) {
+        size_t r = groups.size();
+        for (size_t i = 0; i < groups.size(); i++)
+            if (groups[i].second) r = i;
+        if (r == groups.size()) break;
+
+        dim_t outer = prod(0, r);
+        dim_t reduce = groups[r].first;
+        const dim_t inner = prod(r + 1, groups.size());
+
+        // Split inner elements between calls in chunks of full vectors.
+        dim_t nb_inner = 1;
+        if (inner > 1 && outer < nthr)
+            nb_inner = largest_divisor(inner, utils::div_up(nthr, outer),
+                    [&](dim_t div) { return (inner / div) % simd_w == 0; });
+
+        // Compute per-thread partial results for the first pass if there is
+        // still not enough parallel work.
+        if (is_first_pass && outer * nb_inner < nthr) {
+            const dim_t min_reduce = inner > 1 ? 2 : 4 * simd_w;
+            const dim_t nparts = largest_divisor(reduce,
+                    utils::div_up(nthr, outer * nb_inner),
+                    [&](dim_t div) { return reduce / div >= min_reduce; });
+            if (nparts > 1) {
+                groups[r].first = nparts;
+                groups.insert(groups.begin() + r + 1, {reduce / nparts, true});
+                continue;
+            }
+        }
+
+        jit_reduction_conf_t pass_conf = conf_;
+        pass_conf.idle_size = outer;
+        pass_conf.reduce_size = reduce;
+        pass_conf.inner_size = inner / nb_inner;
+        pass_conf.inner_stride = inner;
+        pass_conf.is_first_pass = is_first_pass;
+        if (!is_first_pass) {
+            pass_conf.src_type = data_type::f32;
+            pass_conf.src_dt_size = sizeof(float);
+        }
+        pass_confs_.push_back(pass_conf);
+
+        is_first_pass = false;
+        groups.erase(groups.begin() + r);
+        // merge kept groups around the reduced one
+        if (r > 0 && r < groups.size() && !groups[r - 1].second
+                && !groups[r].second) {
+            groups[r - 1].first *= groups[r].first;
+            groups.erase(groups.begin() + r);
+        }
+    }
+
+    // A vector of a vertical pass holds several dst elements that may belong
+    // to different channels, while the binary injector computes a single
+    // channel offset for a vector.
+    if (conf_.with_binary && pass_confs_.back().inner_size > 1) {
+        for (const auto &e : attr()->post_ops_.entry_) {
+            if (!e.is_binary()) continue;
+            const auto bcast = get_rhs_arg_broadcasting_strategy(
+                    e.binary.src1_desc, dst_mdw,
+                    {broadcasting_strategy_t::scalar,
+                            broadcasting_strategy_t::no_broadcast});
+            if (bcast == broadcasting_strategy_t::unsupported)
+                return status::unimplemented;
+        }
+    }
+
+    for (size_t i = 0; i < pass_confs_.size(); i++) {
+        auto &pass_conf = pass_confs_[i];
+        pass_conf.is_last_pass = i + 1 == pass_confs_.size();
+        if (pass_conf.is_last_pass) continue;
+
+        pass_conf.dst_type = data_type::f32;
+        pass_conf.dst_dt_size = sizeof(float);
+        pass_conf.is_saturation_needed = false;
+        pass_conf.with_postops = pass_conf.with_eltwise = false;
+        pass_conf.with_binary = pass_conf.with_sum = false;
+        pass_conf.sum_scales = std::queue<float>();
+    }
+
     return status::success;
 }
 
+// Intermediate results of the passes alternate between two buffers.
+void jit_uni_reduction_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    size_t buf_size[2] = {0, 0};
+    for (size_t i = 0; i + 1 < pass_confs_.size(); i++) {
+        const auto &pass_conf = pass_confs_[i];
+        const size_t size = pass_conf.idle_size * pass_conf.inner_stride;
+        buf_size[i % 2] = nstl::max(buf_size[i % 2], size);
+    }
+
+    auto scratchpad = scratchpad_registry().registrar();
+    if (buf_size[0]) scratchpad.book<float>(key_reduction, buf_size[0]);
+    if (buf_size[1]) scratchpad.book<float>(key_reduction_1, buf_size[1]);
+}
+
 status_t jit_uni_reduction_t::init(engine_t *engine) {
     using namespace format_tag;
 
     const memory_desc_t *dst_md = pd()->dst_md();
-    const jit_reduction_conf_t &conf = pd()->get_conf();
 
-    CHECK(get_proper_kernel(dst_md, conf));
-    CHECK(kernel_->create_kernel());
+    for (const auto &conf : pd()->get_pass_confs()) {
+        std::unique_ptr<jit_uni_reduction_kernel_base_t> kernel;
+        CHECK(get_proper_kernel(dst_md, conf, kernel));
+        CHECK(kernel->create_kernel());
+        kernels_.push_back(std::move(kernel));
+    }
 
     return status::success;
 }
 
 status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
     const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
 
-    const dim_t idle_size = pd()->get_conf().idle_size;
-    const dim_t reduce_size = pd()->get_conf().reduce_size;
-    const std::size_t src_dt_size = pd()->get_conf().src_dt_size;
-    const std::size_t dst_dt_size = pd()->get_conf().dst_dt_size;
     const auto &post_ops = pd()->attr()->post_ops_;
     const auto &post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(post_ops, ctx);
 
-    parallel_nd(idle_size, [&](dim_t i) {
-        const dim_t src_off = i * reduce_size * src_dt_size;
-        const dim_t dst_off = i * dst_dt_size;
-
-        jit_reduction_call_s args = jit_reduction_call_s();
-        args.src = src + src_off;
-        args.dst = dst + dst_off;
-        args.dst_orig = dst;
-        args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
-
-        (*kernel_)(&args);
-    });
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    uint8_t *const bufs[2] = {scratchpad.template get<uint8_t>(key_reduction),
+            scratchpad.template get<uint8_t>(key_reduction_1)};
+
+    const auto &pass_confs = pd()->get_pass_confs();
+    const uint8_t *pass_src = src;
+    for (size_t i = 0; i < pass_confs.size(); i++) {
+        const auto &conf = pass_confs[i];
+        const auto &kernel = kernels_[i];
+        uint8_t *pass_dst = conf.is_last_pass ? dst : bufs[i % 2];
+
+        const dim_t nb_inner = conf.inner_stride / conf.inner_size;
+        parallel_nd(conf.idle_size, nb_inner, [&](dim_t o, dim_t ib) {
+            const dim_t src_off
+                    = (o * conf.reduce_size * conf.inner_stride
+                              + ib * conf.inner_size)
+                    * conf.src_dt_size;
+            const dim_t dst_off = (o * conf.inner_stride + ib * conf.inner_size)
+                    * conf.dst_dt_size;
+
+            jit_reduction_call_s args = jit_reduction_call_s();
+            args.src = pass_src + src_off;
+            args.dst = pass_dst + dst_off;
+            args.dst_orig = dst;
+            args.post_ops_binary_rhs_arg_vec
+                    = post_ops_binary_rhs_arg_vec.data();
+
+            (*kernel)(&args);
+        });
+
+        pass_src = pass_dst;
+    }
 
     return status::success;
 }
 
-status_t jit_uni_reduction_t::get_proper_kernel(
-        const memory_desc_t *dst_md, const jit_reduction_conf_t &conf) {
+status_t jit_uni_reduction_t::get_proper_kernel(const memory_desc_t *dst_md,
+        const jit_reduction_conf_t &conf,
+        std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel) {
     using namespace data_type;
 
     if (conf.isa == avx512_core_fp16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_fp16>(conf, dst_md));
     if (conf.isa == avx512_core_bf16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_bf16>(conf, dst_md));
     else if (conf.isa == avx512_core)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core>(conf, dst_md));
     else if (is_superset(conf.isa, avx)) {
         const bool is_src_i8 = utils::one_of(conf.src_type, s8, u8);
         const bool is_dst_i8 = utils::one_of(conf.dst_type, s8, u8);
         if (conf.isa == avx2_vnni_2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2>(
                                 conf, dst_md));
         } else if (conf.isa == avx2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2>(conf, dst_md));
         } else {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx>(conf, dst_md));
         }
     } else if (conf.isa == sse41)
         return safe_ptr_assign(
-                kernel_, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
+                kernel, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
     else
         return status::runtime_error;
 }
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2022 Intel Corporation
+* Copyright 2021-2023 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -17,6 +17,9 @@
 #ifndef CPU_X64_UNI_REDUCTION_HPP
 #define CPU_X64_UNI_REDUCTION_HPP
 
+#include <memory>
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 
@@ -41,11 +44,18 @@ struct jit_uni_reduction_t : public primitive_t {
         status_t init(engine_t *engine);
 
         const jit_reduction_conf_t &get_conf() const { return conf_; };
+        const std::vector<jit_reduction_conf_t> &get_pass_confs() const {
+            return pass_confs_;
+        }
 
     private:
         bool fill_post_ops_conf();
+        status_t init_passes();
+        void init_scratchpad();
 
         jit_reduction_conf_t conf_;
+        // Reduction passes in execution order, see init_passes().
+        std::vector<jit_reduction_conf_t> pass_confs_;
     };
 
     jit_uni_reduction_t(const pd_t *apd) : primitive_t(apd) {}
@@ -55,12 +65,13 @@ struct jit_uni_reduction_t : public primitive_t {
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
-    status_t get_proper_kernel(
-            const memory_desc_t *dst_md, const jit_reduction_conf_t &conf);
+    status_t get_proper_kernel(const memory_desc_t *dst_md,
+            const jit_reduction_conf_t &conf,
+            std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel);
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    std::unique_ptr<jit_uni_reduction_kernel_base_t> kernel_;
+    std::vector<std::unique_ptr<jit_uni_reduction_kernel_base_t>> kernels_;
 };
 
 } // namespace x64
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2022 Intel Corporation
+* Copyright 2021-2023 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -38,7 +38,10 @@ template <cpu_isa_t isa, typename Vmm>
 jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
         const jit_reduction_conf_t &conf, const memory_desc_t *dst_md)
     : jit_uni_reduction_kernel_base_t(conf)
-    , load_tail_size_(conf.reduce_size % simd_w_)
+    , is_vertical_(conf.inner_size > 1)
+    , load_tail_size_(is_vertical_ ? conf.inner_size % simd_w_
+                                   : conf.reduce_size % simd_w_)
+    , store_tail_size_(is_vertical_ ? conf.inner_size % simd_w_ : 1)
     , io_load_(this, isa, conf_.src_type, {false},
               io::io_tail_conf_t {simd_w_, load_tail_size_, k_tail_load_mask_,
                       vmm_tail_load_mask_.getIdx(), reg_tmp_},
@@ -56,10 +59,11 @@ jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
     init_compute_op();
     init_compute_scalar_op();
     if (conf_.with_postops) init_post_ops_injector(dst_md);
+    if (is_lp_alg()) init_lp_injectors();
 }
 
 template <cpu_isa_t isa, typename Vmm>
-void jit_uni_reduction_kernel_t<isa, Vmm>::init_acc() {
+void jit_uni_reduction_kernel_t<isa, Vmm>::init_acc(const Vmm &vmm_acc) {
     using namespace alg_kind;
     using namespace nstl;
 
@@ -74,12 +78,16 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_acc() {
         case reduction_mean:
         case reduction_sum: starting_val = 0.f; break;
         case reduction_mul: starting_val = 1.f; break;
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum: starting_val = 0.f; break;
         default: assert(!"unknown alg");
     }
 
     mov(reg_tmp_.cvt32(), float2int(starting_val));
     uni_vmovd(xmm_tmp_, reg_tmp_.cvt32());
-    uni_vbroadcastss(vmm_acc_, xmm_tmp_);
+    uni_vbroadcastss(vmm_acc, xmm_tmp_);
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -98,6 +106,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_op_ = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                 uni_vaddps(acc, acc, to_acc);
             };
@@ -130,6 +142,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_scalar_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_scalar_op_
                     = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                           addss(acc, to_acc);
@@ -168,6 +184,27 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_post_ops_injector(
             this, conf_.post_ops, bsp, esp);
 }
 
+// |x|^p is computed as (x^2)^(p/2), so that p equal to 1 and 2 only need
+// sqrt and mul, other values of p use the eltwise pow.
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::init_lp_injectors() {
+    using namespace alg_kind;
+    if (utils::one_of(conf_.p, 1.f, 2.f)) return;
+
+    if (conf_.is_first_pass)
+        pow_injector_ = utils::make_unique<
+                jit_uni_eltwise_injector_f32<inject_isa_, Vmm>>(this,
+                eltwise_pow, 1.f, conf_.p / 2.f, 1.f, true /*save_state*/,
+                reg_po_injector_helper_1_, elt_inj_opmask_);
+    if (conf_.is_last_pass
+            && utils::one_of(
+                    conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum))
+        root_injector_ = utils::make_unique<
+                jit_uni_eltwise_injector_f32<inject_isa_, Vmm>>(this,
+                eltwise_pow, 1.f, 1.f / conf_.p, 1.f, true /*save_state*/,
+                reg_po_injector_helper_1_, elt_inj_opmask_);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_zmm_to_ymm(
         const Xmm &acc, const Xmm &tmp) {
@@ -269,8 +306,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
     L(label_work_begin);
     {
         cmp(reg_work_, 2);
-        jl(label_work_tail_begin);
+        jl(label_work_tail_begin, T_NEAR);
         io_load_.load_two_simdw_xf16(ptr[reg_src_], vmm_tmp1_, vmm_tmp2_);
+        apply_power(vmm_tmp1_);
+        apply_power(vmm_tmp2_);
 
         compute_op_(vmm_acc_, vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp2_);
@@ -284,8 +323,9 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
     L(label_work_tail_begin);
     {
         cmp(reg_work_, 0);
-        je(label_work_tail_end);
+        je(label_work_tail_end, T_NEAR);
         io_load_.load(ptr[reg_src_], vmm_tmp1_, false);
+        apply_power(vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp1_);
 
         add(reg_src_, simd_w_ * conf_.src_dt_size);
@@ -297,6 +337,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
 
     if (load_tail_size_) {
         io_load_.load(ptr[reg_src_], vmm_tmp1_, true);
+        apply_power(vmm_tmp1_);
         reduce_vmm_to_scalar(
                 vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, vmm_tmp4_, load_tail_size_);
         compute_scalar_op_(Xmm(vmm_acc_.getIdx()), Xmm(vmm_tmp1_.getIdx()));
@@ -310,8 +351,9 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_base() {
     L(label_work_begin);
     {
         cmp(reg_work_, 0);
-        je(label_work_end);
+        je(label_work_end, T_NEAR);
         io_load_.load(ptr[reg_src_], vmm_tmp1_, false);
+        apply_power(vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp1_);
 
         add(reg_src_, simd_w_ * conf_.src_dt_size);
@@ -323,6 +365,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_base() {
 
     if (load_tail_size_) {
         io_load_.load(ptr[reg_src_], vmm_tmp1_, true);
+        apply_power(vmm_tmp1_);
         reduce_vmm_to_scalar(
                 vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, vmm_tmp4_, load_tail_size_);
         compute_scalar_op_(Xmm(vmm_acc_.getIdx()), Xmm(vmm_tmp1_.getIdx()));
@@ -338,32 +381,153 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce() {
         reduce_base();
 }
 
+// Reduces a [reduce_size][inner_stride] block to inner_size outputs, ur
+// vectors of a row are accumulated at once.
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_vertical_block(
+        const int ur, const bool tail) {
+    for (int u = 0; u < ur; u++)
+        init_acc(vmm_vertical_acc(u));
+
+    Label label_reduce_begin;
+    mov(reg_src_row_, reg_src_);
+    mov(reg_reduce_work_, conf_.reduce_size);
+    L(label_reduce_begin);
+    {
+        for (int u = 0; u < ur; u++) {
+            const Vmm vmm_src = u % 2 ? vmm_tmp2_ : vmm_tmp1_;
+            io_load_.load(ptr[reg_src_row_ + u * simd_w_ * conf_.src_dt_size],
+                    vmm_src, tail);
+            apply_power(vmm_src);
+            compute_op_(vmm_vertical_acc(u), vmm_src);
+        }
+        add(reg_src_row_, conf_.inner_stride * conf_.src_dt_size);
+        dec(reg_reduce_work_);
+        jnz(label_reduce_begin, T_NEAR);
+    }
+
+    std::vector<int> acc_idxs;
+    for (int u = 0; u < ur; u++) {
+        apply_finalization(vmm_vertical_acc(u));
+        acc_idxs.push_back(vmm_vertical_acc(u).getIdx());
+    }
+    if (conf_.with_postops && conf_.is_last_pass)
+        apply_postops(acc_idxs, tail);
+
+    for (int u = 0; u < ur; u++)
+        io_store_.store(vmm_vertical_acc(u),
+                ptr[reg_dst_ + u * simd_w_ * conf_.dst_dt_size], tail);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_vertical() {
+    const dim_t nvecs = conf_.inner_size / simd_w_;
+    const dim_t nblocks = nvecs / vertical_max_ur_;
+    const int ur_tail = nvecs % vertical_max_ur_;
+
+    if (nblocks > 0) {
+        Label label_inner_begin;
+        mov(reg_inner_work_, nblocks);
+        L(label_inner_begin);
+        {
+            reduce_vertical_block(vertical_max_ur_, false);
+            add(reg_src_, vertical_max_ur_ * simd_w_ * conf_.src_dt_size);
+            add(reg_dst_, vertical_max_ur_ * simd_w_ * conf_.dst_dt_size);
+            dec(reg_inner_work_);
+            jnz(label_inner_begin, T_NEAR);
+        }
+    }
+    if (ur_tail > 0) {
+        reduce_vertical_block(ur_tail, false);
+        add(reg_src_, ur_tail * simd_w_ * conf_.src_dt_size);
+        add(reg_dst_, ur_tail * simd_w_ * conf_.dst_dt_size);
+    }
+    if (load_tail_size_ > 0) reduce_vertical_block(1, true);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::load_params() {
     mov(reg_src_, ptr[reg_param_ + GET_OFF(src)]);
     mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
-    mov(reg_work_, conf_.reduce_size / simd_w_);
+    if (!is_vertical_) mov(reg_work_, conf_.reduce_size / simd_w_);
+}
+
+// Lp norms accumulate |x|^p, intermediate passes accumulate the partial sums.
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_power(const Vmm &vmm_src) {
+    if (!is_lp_alg() || !conf_.is_first_pass) return;
+
+    uni_vmulps(vmm_src, vmm_src, vmm_src);
+    if (conf_.p == 1.f)
+        uni_vsqrtps(vmm_src, vmm_src);
+    else if (conf_.p != 2.f)
+        pow_injector_->compute_vector(vmm_src.getIdx());
 }
 
 template <cpu_isa_t isa, typename Vmm>
-void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(const int data_idx) {
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_finalization(
+        const Vmm &vmm_acc) {
+    using namespace alg_kind;
+    if (!conf_.is_last_pass) return;
+
+    const Xmm xmm_tmp(vmm_tmp3_.getIdx());
+    auto broadcast_val = [&](float val) {
+        mov(reg_tmp_.cvt32(), float2int(val));
+        uni_vmovd(xmm_tmp, reg_tmp_.cvt32());
+        uni_vbroadcastss(vmm_tmp3_, xmm_tmp);
+    };
+
+    switch (conf_.alg) {
+        case reduction_mean:
+            broadcast_val(static_cast<float>(conf_.full_reduce_size));
+            uni_vdivps(vmm_acc, vmm_acc, vmm_tmp3_);
+            break;
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_power_p_max:
+            broadcast_val(conf_.eps);
+            uni_vmaxps(vmm_acc, vmm_acc, vmm_tmp3_);
+            break;
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_sum:
+            broadcast_val(conf_.eps);
+            uni_vaddps(vmm_acc, vmm_acc, vmm_tmp3_);
+            break;
+        default: break;
+    }
+
+    if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum)
+            && conf_.p != 1.f) {
+        if (conf_.p == 2.f)
+            uni_vsqrtps(vmm_acc, vmm_acc);
+        else
+            root_injector_->compute_vector(vmm_acc.getIdx());
+    }
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(
+        const std::vector<int> &data_idxs, const bool tail) {
     if (conf_.with_sum) {
         assert(!conf_.sum_scales.empty()
                 && "No scales for sum post operation.");
-        const auto sum_injector = [this, data_idx]() {
+        const auto sum_injector = [this, data_idxs, tail]() {
             const Vmm vmm_prev_dst(vmm_tmp1_.getIdx());
-            const Vmm vmm_dst(data_idx);
-
-            io_store_.load(ptr[reg_dst_], vmm_prev_dst, true);
             const float sum_scale = sum_scales_.front();
-            if (sum_scale == 1.f)
-                uni_vaddps(vmm_dst, vmm_dst, vmm_prev_dst);
-            else {
+            if (sum_scale != 1.f) {
                 const Xmm xmm_sum_scale = Xmm(vmm_sum_scale_.getIdx());
                 mov(reg_tmp1_.cvt32(), float2int(sum_scale));
                 uni_vmovd(xmm_sum_scale, reg_tmp1_.cvt32());
                 uni_vbroadcastss(vmm_sum_scale_, xmm_sum_scale);
-                uni_vfmadd231ps(vmm_dst, vmm_prev_dst, vmm_sum_scale_);
+            }
+            for (size_t i = 0; i < data_idxs.size(); i++) {
+                const Vmm vmm_dst(data_idxs[i]);
+                io_store_.load(
+                        ptr[reg_dst_ + i * simd_w_ * conf_.dst_dt_size],
+                        vmm_prev_dst, tail);
+                if (sum_scale == 1.f)
+                    uni_vaddps(vmm_dst, vmm_dst, vmm_prev_dst);
+                else
+                    uni_vfmadd231ps(vmm_dst, vmm_prev_dst, vmm_sum_scale_);
             }
             sum_scales_.push(sum_scale);
             sum_scales_.pop();
@@ -374,17 +538,24 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(const int data_idx) {
 }
 
 template <cpu_isa_t isa, typename Vmm>
-void jit_uni_reduction_kernel_t<isa, Vmm>::apply_postops(const int data_idx) {
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_postops(
+        const std::vector<int> &data_idxs, const bool tail) {
     binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
 
-    if (conf_.with_sum) apply_sum(data_idx);
+    if (conf_.with_sum) apply_sum(data_idxs, tail);
 
     if (conf_.with_binary) {
-        rhs_arg_params.vmm_idx_to_out_reg.emplace(data_idx, reg_dst_);
-        rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
+        for (size_t i = 0; i < data_idxs.size(); i++) {
+            rhs_arg_params.vmm_idx_to_out_reg.emplace(data_idxs[i], reg_dst_);
+            rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                    data_idxs[i], i * simd_w_);
+            if (tail) rhs_arg_params.vmm_tail_idx_.emplace(data_idxs[i]);
+        }
     }
 
-    postops_injector_->compute_vector(data_idx, rhs_arg_params);
+    postops_injector_->compute_vector_range(
+            injector_utils::vmm_index_set_t(data_idxs.begin(), data_idxs.end()),
+            rhs_arg_params);
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -394,15 +565,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::finalize() {
                 vmm_acc_, vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, simd_w_);
     }
 
-    if (conf_.alg == alg_kind::reduction_mean) {
-        const Xmm xmm_acc(vmm_acc_.getIdx());
-        const Xmm xmm_reduce_size(vmm_tmp1_.getIdx());
-        mov(reg_tmp_.cvt32(), float2int(static_cast<float>(conf_.reduce_size)));
-        uni_vmovd(xmm_reduce_size, reg_tmp_.cvt32());
-        uni_vdivss(xmm_acc, xmm_acc, xmm_reduce_size);
-    }
+    apply_finalization(vmm_acc_);
 
-    if (conf_.with_postops) apply_postops(vmm_acc_.getIdx());
+    if (conf_.with_postops && conf_.is_last_pass)
+        apply_postops({vmm_acc_.getIdx()}, true);
 
     io_store_.store(vmm_acc_, ptr[reg_dst_], true);
 }
@@ -415,17 +581,23 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::generate() {
     if (conf_.is_saturation_needed) io_store_.init_saturate_f32();
 
     if (load_tail_size_ > 0) io_load_.prepare_tail_mask();
-    io_store_.prepare_tail_mask();
+    if (store_tail_size_ > 0) io_store_.prepare_tail_mask();
 
     load_params();
-    init_acc();
-    reduce();
-    finalize();
+    if (is_vertical_)
+        reduce_vertical();
+    else {
+        init_acc(vmm_acc_);
+        reduce();
+        finalize();
+    }
 
     postamble();
 
     if (conf_.with_eltwise && postops_injector_)
         postops_injector_->prepare_table();
+    if (pow_injector_) pow_injector_->prepare_table();
+    if (root_injector_) root_injector_->prepare_table();
 }
 
 template struct jit_uni_reduction_kernel_t<avx512_core_fp16>;
@@ -17,6 +17,8 @@
 #ifndef CPU_X64_UNI_REDUCTION_KERNEL_HPP
 #define CPU_X64_UNI_REDUCTION_KERNEL_HPP
 
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -62,10 +64,11 @@ private:
     using compute_fn_t = std::function<void(
             const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc)>;
 
-    void init_acc();
+    void init_acc(const Vmm &vmm_acc);
     void init_compute_op();
     void init_compute_scalar_op();
     void init_post_ops_injector(const memory_desc_t *dst_md);
+    void init_lp_injectors();
 
     void reduce_ymm_to_xmm(const Xbyak::Xmm &acc, const Xbyak::Xmm &tmp);
     void reduce_xmm_to_scalar(const Xbyak::Xmm &acc, const Xbyak::Xmm &tmp,
@@ -84,13 +87,25 @@ private:
     void reduce();
     void reduce_base();
     void reduce_ne_convert_xf16();
+    void reduce_vertical_block(const int ur, const bool tail);
+    void reduce_vertical();
 
     void load_params();
-    void apply_sum(const int data_idx);
-    void apply_postops(const int data_idx);
+    void apply_power(const Vmm &vmm_src);
+    void apply_finalization(const Vmm &vmm_acc);
+    void apply_sum(const std::vector<int> &data_idxs, const bool tail);
+    void apply_postops(const std::vector<int> &data_idxs, const bool tail);
     void finalize();
     void generate() override;
 
+    bool is_lp_alg() const {
+        using namespace alg_kind;
+        return utils::one_of(conf_.alg, reduction_norm_lp_max,
+                reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+                reduction_norm_lp_power_p_sum);
+    }
+    Vmm vmm_vertical_acc(const int u) const { return Vmm(11 + u); }
+
     const Vmm vmm_tail_load_mask_ = Vmm(0);
     const Vmm vmm_tail_store_mask_ = Vmm(1);
     const Vmm vmm_zero_saturation_ = Vmm(2);
@@ -116,6 +131,9 @@ private:
     const Xbyak::Reg64 reg_param_ = abi_param1;
     const Xbyak::Reg64 reg_tmp_ = abi_not_param1;
     const Xbyak::Reg64 reg_tmp1_ = r13;
+    const Xbyak::Reg64 reg_src_row_ = r8;
+    const Xbyak::Reg64 reg_reduce_work_ = r9;
+    const Xbyak::Reg64 reg_inner_work_ = r10;
 
     static constexpr bool is_zmm_ = std::is_same<Vmm, Xbyak::Zmm>::value;
     static constexpr bool is_ymm_ = std::is_same<Vmm, Xbyak::Ymm>::value;
@@ -124,8 +142,12 @@ private:
     static constexpr std::size_t number_of_f32_in_xmm_ = 4;
     static constexpr std::size_t number_of_f32_in_ymm_ = 8;
     static constexpr std::size_t number_of_f32_in_zmm_ = 16;
+    // Vertical reduction is done over rows of inner_size elements, at most
+    // vertical_max_ur_ vectors of a row are processed at once.
+    static constexpr int vertical_max_ur_ = 4;
+    const bool is_vertical_;
     const std::size_t load_tail_size_;
-    static constexpr std::size_t store_tail_size_ = 1;
+    const std::size_t store_tail_size_;
 
     io::jit_io_helper_t<Vmm> io_load_;
     io::jit_io_helper_t<Vmm> io_store_;
@@ -143,6 +165,11 @@ private:
             = isa == avx512_core_bf16 ? avx512_core : isa;
     std::unique_ptr<injector::jit_uni_postops_injector_t<inject_isa_, Vmm>>
             postops_injector_;
+    // compute x^p and x^(1/p) for Lp norms with p other than 1 and 2
+    std::unique_ptr<jit_uni_eltwise_injector_f32<inject_isa_, Vmm>>
+            pow_injector_;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<inject_isa_, Vmm>>
+            root_injector_;
 };
 
 } // namespace x64
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <bitset>
+#include <climits>
 #include <cassert>
 
 #include "common/bfloat16.hpp"
@@ -220,9 +221,15 @@ status_t jit_uni_resampling_fwd_t::get_proper_kernel_for_avx(
         return safe_ptr_assign(kernel_,
                 new jit_uni_resampling_kernel_t<avx2_vnni_2, Xbyak::Ymm>(
                         conf, dst_md));
-    if (is_src_i8 || is_dst_i8)
+    if (is_src_i8 || is_dst_i8) {
+        // Conversions of int8 data in ymm registers require avx2.
+        if (is_superset(conf.isa, avx2))
+            return safe_ptr_assign(kernel_,
+                    new jit_uni_resampling_kernel_t<avx2, Xbyak::Ymm>(
+                            conf, dst_md));
         return safe_ptr_assign(kernel_,
                 new jit_uni_resampling_kernel_t<avx, Xbyak::Xmm>(conf, dst_md));
+    }
 
     return safe_ptr_assign(kernel_,
             new jit_uni_resampling_kernel_t<avx, Xbyak::Ymm>(conf, dst_md));
@@ -561,6 +568,184 @@ status_t jit_uni_resampling_fwd_t::interpolate_linear(const uint8_t *src,
     return status::success;
 }
 
+status_t jit_uni_resampling_bwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    const memory_desc_wrapper diff_src_d(diff_src_md());
+    const memory_desc_wrapper diff_dst_d(diff_dst_md());
+
+    conf_.src_data_type = diff_src_md()->data_type;
+    conf_.dst_data_type = diff_dst_md()->data_type;
+
+    const bool ok = !is_fwd() && !has_zero_dim_memory()
+            && utils::one_of(conf_.src_data_type, f32, bf16, f16)
+            && utils::one_of(conf_.dst_data_type, f32, bf16, f16)
+            && impl_supports_datatype(conf_.src_data_type)
+            && impl_supports_datatype(conf_.dst_data_type)
+            && set_default_params() == status::success
+            && attr()->has_default_values();
+    if (!ok) return status::unimplemented;
+
+    conf_.isa = get_supported_isa(diff_src_d.is_plain());
+    if (!is_superset(conf_.isa, avx2)) return status::unimplemented;
+    if (utils::one_of(f16, conf_.src_data_type, conf_.dst_data_type)
+            && !diff_src_d.is_plain())
+        return status::unimplemented;
+
+    const format_tag_t blocked_format = memory_desc_matches_one_of_tag(
+            *diff_src_md(), nCw16c, nChw16c, nCdhw16c, nCw8c, nChw8c, nCdhw8c);
+    const format_tag_t nspc_format = memory_desc_matches_one_of_tag(
+            *diff_src_md(), nwc, nhwc, ndhwc);
+    if (blocked_format != format_tag::undef) {
+        conf_.tag_kind = jit_memory_tag_kind_t::blocked;
+        conf_.src_tag = blocked_format;
+        conf_.is_blocked_8_format = utils::one_of(
+                blocked_format, nCw8c, nChw8c, nCdhw8c);
+    } else if (nspc_format != format_tag::undef) {
+        conf_.tag_kind = jit_memory_tag_kind_t::nspc;
+        conf_.src_tag = nspc_format;
+    } else
+        return status::unimplemented;
+
+    if (!memory_desc_matches_tag(*diff_dst_md(), conf_.src_tag))
+        return status::unimplemented;
+
+    conf_.alg = desc()->alg_kind;
+    conf_.c = C();
+    conf_.od = OD();
+    conf_.oh = OH();
+    conf_.ow = OW();
+    conf_.id = ID();
+    conf_.ih = IH();
+    conf_.iw = IW();
+    conf_.ndims = ndims();
+
+    conf_.src_dt_size = types::data_type_size(conf_.src_data_type);
+    conf_.dst_dt_size = types::data_type_size(conf_.dst_data_type);
+
+    conf_.inner_stride = diff_src_d.blocking_desc().strides[ndims() - 1];
+    conf_.stride_d = OH() * OW() * conf_.inner_stride * conf_.dst_dt_size;
+    conf_.stride_h = OW() * conf_.inner_stride * conf_.dst_dt_size;
+    conf_.stride_w = conf_.inner_stride * conf_.dst_dt_size;
+
+    // Offsets of diff_dst points are kept in 32 bits.
+    const dim_t diff_dst_sp_size
+            = OD() * OH() * OW() * conf_.inner_stride * conf_.dst_dt_size;
+    if (diff_dst_sp_size > static_cast<dim_t>(UINT_MAX))
+        return status::unimplemented;
+
+    return status::success;
+}
+
+status_t jit_uni_resampling_bwd_t::init(engine_t *engine) {
+    const jit_resampling_conf_t &conf = pd()->get_conf();
+
+    if (is_superset(conf.isa, avx512_core) && !conf.is_blocked_8_format)
+        CHECK(safe_ptr_assign(kernel_,
+                new jit_uni_resampling_bwd_kernel_t<Xbyak::Zmm>(conf)));
+    else
+        CHECK(safe_ptr_assign(kernel_,
+                new jit_uni_resampling_bwd_kernel_t<Xbyak::Ymm>(conf)));
+
+    CHECK(kernel_->create_kernel());
+
+    fill_data_for_interpolation();
+
+    return status::success;
+}
+
+void jit_uni_resampling_bwd_t::fill_bwd_entries(dim_t in, dim_t out,
+        unsigned stride, std::vector<unsigned> &ranges,
+        std::vector<jit_resampling_bwd_entry_t> &entries) const {
+    ranges.resize(in + 1);
+    entries.clear();
+
+    for (dim_t x = 0; x < in; x++) {
+        ranges[x] = static_cast<unsigned>(entries.size());
+
+        if (pd()->desc()->alg_kind == alg_kind::resampling_nearest) {
+            const dim_t start = ceil_idx(((float)x * out / in) - 0.5f);
+            const dim_t end = ceil_idx(((x + 1.f) * out / in) - 0.5f);
+            for (dim_t o = start; o < end; o++)
+                entries.push_back({static_cast<unsigned>(o * stride), 1.f});
+        } else {
+            const bwd_linear_coeffs_t coeffs(x, out, in);
+            for_(int i = 0; i < 2; i++)
+            for (dim_t o = coeffs.start[i]; o < coeffs.end[i]; o++)
+                entries.push_back({static_cast<unsigned>(o * stride),
+                        linear_weight(i, o, out, in)});
+        }
+    }
+    ranges[in] = static_cast<unsigned>(entries.size());
+}
+
+void jit_uni_resampling_bwd_t::fill_data_for_interpolation() {
+    const jit_resampling_conf_t &conf = pd()->get_conf();
+
+    std::vector<unsigned> ranges_d, ranges_h;
+    std::vector<jit_resampling_bwd_entry_t> entries_d, entries_h;
+    fill_bwd_entries(pd()->ID(), pd()->OD(), conf.stride_d, ranges_d,
+            entries_d);
+    fill_bwd_entries(pd()->IH(), pd()->OH(), conf.stride_h, ranges_h,
+            entries_h);
+    fill_bwd_entries(pd()->IW(), pd()->OW(), conf.stride_w, ranges_w_,
+            entries_w_);
+
+    ranges_dh_.reserve(pd()->ID() * pd()->IH() + 1);
+    for_(dim_t id = 0; id < pd()->ID(); id++)
+    for (dim_t ih = 0; ih < pd()->IH(); ih++) {
+        ranges_dh_.push_back(static_cast<unsigned>(entries_dh_.size()));
+        for_(unsigned d = ranges_d[id]; d < ranges_d[id + 1]; d++)
+        for (unsigned h = ranges_h[ih]; h < ranges_h[ih + 1]; h++)
+            entries_dh_.push_back(
+                    {entries_d[d].offset + entries_h[h].offset,
+                            entries_d[d].weight * entries_h[h].weight});
+    }
+    ranges_dh_.push_back(static_cast<unsigned>(entries_dh_.size()));
+}
+
+status_t jit_uni_resampling_bwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto diff_dst = CTX_IN_MEM(const uint8_t *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DIFF_SRC);
+
+    const size_t diff_src_dt_size = pd()->get_conf().src_dt_size;
+    const size_t diff_dst_dt_size = pd()->get_conf().dst_dt_size;
+    const size_t inner_stride = pd()->get_conf().inner_stride;
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t CB = utils::div_up(C, inner_stride);
+    const dim_t nsp_outer = MB * CB;
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+
+    parallel_nd(nsp_outer, ID, IH, [&](dim_t nsp, dim_t id, dim_t ih) {
+        const dim_t diff_dst_off
+                = nsp * OD * OH * OW * inner_stride * diff_dst_dt_size;
+        const dim_t diff_src_off
+                = ((nsp * ID + id) * IH + ih) * IW * inner_stride
+                * diff_src_dt_size;
+        const dim_t dh = id * IH + ih;
+
+        jit_resampling_bwd_call_s args = jit_resampling_bwd_call_s();
+        args.diff_dst = diff_dst + diff_dst_off;
+        args.diff_src = diff_src + diff_src_off;
+        args.entries_dh = entries_dh_.data() + ranges_dh_[dh];
+        args.entries_dh_end = entries_dh_.data() + ranges_dh_[dh + 1];
+        args.ranges_w = ranges_w_.data();
+        args.entries_w = entries_w_.data();
+
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
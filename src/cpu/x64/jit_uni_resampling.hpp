@@ -184,6 +184,58 @@ private:
     std::vector<float> weights_;
 };
 
+struct jit_uni_resampling_bwd_t : public primitive_t {
+    struct pd_t : public cpu_resampling_bwd_pd_t {
+        using cpu_resampling_bwd_pd_t::cpu_resampling_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", conf_.isa, ""),
+                jit_uni_resampling_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        const jit_resampling_conf_t &get_conf() const { return conf_; }
+
+    private:
+        jit_resampling_conf_t conf_;
+    };
+
+    jit_uni_resampling_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+    virtual ~jit_uni_resampling_bwd_t() = default;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    /*
+     * Fills ranges and entries with the points of diff_dst that contribute
+     * to every point of diff_src along one dimension:
+     * x_0 = (o_0 * stride, weight_0), (o_1 * stride, weight_1), ...
+     * x_1 = ...
+     * where the entries for x are entries[ranges[x]:ranges[x + 1]].
+     */
+    void fill_bwd_entries(dim_t in, dim_t out, unsigned stride,
+            std::vector<unsigned> &ranges,
+            std::vector<jit_resampling_bwd_entry_t> &entries) const;
+    /*
+     * Fills ranges_dh_ and entries_dh_ with the contributions along the
+     * depth and height dimensions combined:
+     * (id_0, ih_0) = (od_0 * stride_d + oh_0 * stride_h, wd_0 * wh_0),
+     *                (od_0 * stride_d + oh_1 * stride_h, wd_0 * wh_1), ...
+     * (id_0, ih_1) = ...
+     * and ranges_w_ and entries_w_ with the contributions along the width.
+     */
+    void fill_data_for_interpolation();
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_resampling_bwd_kernel_base_t> kernel_;
+
+    std::vector<unsigned> ranges_dh_;
+    std::vector<jit_resampling_bwd_entry_t> entries_dh_;
+    std::vector<unsigned> ranges_w_;
+    std::vector<jit_resampling_bwd_entry_t> entries_w_;
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
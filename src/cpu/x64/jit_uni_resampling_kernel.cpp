@@ -913,10 +913,130 @@ void jit_uni_resampling_kernel_t<isa, Vmm>::generate() {
         postops_injector_->prepare_table();
 }
 
+#undef GET_OFF
+
+#define GET_OFF(field) offsetof(jit_resampling_bwd_call_s, field)
+
+template <typename Vmm>
+jit_uni_resampling_bwd_kernel_t<Vmm>::jit_uni_resampling_bwd_kernel_t(
+        const jit_resampling_conf_t &conf)
+    : jit_uni_resampling_bwd_kernel_base_t(conf)
+    , tail_size_(conf.inner_stride % simd_w_)
+    , io_(this, conf_.isa, {conf_.src_data_type, conf_.dst_data_type},
+              io::io_conf_t {},
+              io::io_tail_conf_t {simd_w_, tail_size_, k_tail_mask_,
+                      vmm_tail_mask_.getIdx(), reg_tmp_},
+              io::io_emu_bf16_conf_t {vmm_bf16_emu_1_, vmm_bf16_emu_2_,
+                      vmm_bf16_emu_3_, reg_tmp_, vmm_bf16_emu_4_}) {}
+
+template <typename Vmm>
+void jit_uni_resampling_bwd_kernel_t<Vmm>::compute_channels(
+        size_t c_off, int n_vregs, bool is_tail) {
+    for (int i = 0; i < n_vregs; i++)
+        uni_vpxor(vmm_acc(i), vmm_acc(i), vmm_acc(i));
+
+    Label dh_loop, dh_end, w_loop, w_end;
+
+    mov(reg_dh_ptr_, reg_dh_begin_);
+    L(dh_loop);
+    {
+        cmp(reg_dh_ptr_, reg_dh_end_);
+        jge(dh_end, T_NEAR);
+
+        mov(reg_off_dh_.cvt32(), dword[reg_dh_ptr_]);
+        add(reg_off_dh_, reg_diff_dst_);
+        uni_vbroadcastss(vmm_weight_dh_, dword[reg_dh_ptr_ + sizeof(float)]);
+
+        mov(reg_w_ptr_, reg_w_begin_);
+        L(w_loop);
+        {
+            cmp(reg_w_ptr_, reg_w_end_);
+            jge(w_end, T_NEAR);
+
+            mov(reg_off_.cvt32(), dword[reg_w_ptr_]);
+            add(reg_off_, reg_off_dh_);
+            uni_vbroadcastss(vmm_weight_, dword[reg_w_ptr_ + sizeof(float)]);
+            uni_vmulps(vmm_weight_, vmm_weight_, vmm_weight_dh_);
+
+            for (int i = 0; i < n_vregs; i++) {
+                const size_t off = (c_off + i * simd_w_) * conf_.dst_dt_size;
+                io_.at(conf_.dst_data_type)
+                        ->load(ptr[reg_off_ + off], vmm_diff_dst(i),
+                                is_tail && i == n_vregs - 1);
+            }
+            for (int i = 0; i < n_vregs; i++)
+                uni_vfmadd231ps(vmm_acc(i), vmm_diff_dst(i), vmm_weight_);
+
+            add(reg_w_ptr_, sizeof(jit_resampling_bwd_entry_t));
+            jmp(w_loop, T_NEAR);
+        }
+        L(w_end);
+
+        add(reg_dh_ptr_, sizeof(jit_resampling_bwd_entry_t));
+        jmp(dh_loop, T_NEAR);
+    }
+    L(dh_end);
+
+    for (int i = 0; i < n_vregs; i++) {
+        const size_t off = (c_off + i * simd_w_) * conf_.src_dt_size;
+        io_.at(conf_.src_data_type)
+                ->store(vmm_acc(i), ptr[reg_diff_src_ + off],
+                        is_tail && i == n_vregs - 1);
+    }
+}
+
+template <typename Vmm>
+void jit_uni_resampling_bwd_kernel_t<Vmm>::generate() {
+    preamble();
+
+    io_.init_bf16();
+    if (tail_size_ > 0) io_.prepare_tail_mask();
+
+    mov(reg_diff_dst_, ptr[reg_param + GET_OFF(diff_dst)]);
+    mov(reg_diff_src_, ptr[reg_param + GET_OFF(diff_src)]);
+    mov(reg_dh_begin_, ptr[reg_param + GET_OFF(entries_dh)]);
+    mov(reg_dh_end_, ptr[reg_param + GET_OFF(entries_dh_end)]);
+    mov(reg_ranges_w_, ptr[reg_param + GET_OFF(ranges_w)]);
+    mov(reg_entries_w_, ptr[reg_param + GET_OFF(entries_w)]);
+
+    static_assert(sizeof(jit_resampling_bwd_entry_t) == 8,
+            "Unexpected size of the contribution entry.");
+
+    const size_t n_full_vregs = conf_.inner_stride / simd_w_;
+
+    Label iw_loop;
+    mov(reg_iw_, conf_.iw);
+    L(iw_loop);
+    {
+        mov(reg_w_begin_.cvt32(), dword[reg_ranges_w_]);
+        lea(reg_w_begin_, ptr[reg_entries_w_ + reg_w_begin_ * 8]);
+        mov(reg_w_end_.cvt32(), dword[reg_ranges_w_ + sizeof(unsigned)]);
+        lea(reg_w_end_, ptr[reg_entries_w_ + reg_w_end_ * 8]);
+
+        for (size_t v = 0; v < n_full_vregs; v += max_unroll_) {
+            const int n_vregs = static_cast<int>(
+                    nstl::min<size_t>(max_unroll_, n_full_vregs - v));
+            compute_channels(v * simd_w_, n_vregs, false);
+        }
+        if (tail_size_ > 0) compute_channels(n_full_vregs * simd_w_, 1, true);
+
+        add(reg_diff_src_, conf_.inner_stride * conf_.src_dt_size);
+        add(reg_ranges_w_, sizeof(unsigned));
+        dec(reg_iw_);
+        jnz(iw_loop, T_NEAR);
+    }
+
+    postamble();
+}
+
+template struct jit_uni_resampling_bwd_kernel_t<Zmm>;
+template struct jit_uni_resampling_bwd_kernel_t<Ymm>;
+
 template struct jit_uni_resampling_kernel_t<avx512_core_fp16, Zmm>;
 template struct jit_uni_resampling_kernel_t<avx512_core, Zmm>;
 template struct jit_uni_resampling_kernel_t<avx512_core, Ymm>;
 template struct jit_uni_resampling_kernel_t<avx2_vnni_2, Ymm>;
+template struct jit_uni_resampling_kernel_t<avx2, Ymm>;
 template struct jit_uni_resampling_kernel_t<avx, Ymm>;
 template struct jit_uni_resampling_kernel_t<avx, Xmm>;
 template struct jit_uni_resampling_kernel_t<sse41, Xmm>;
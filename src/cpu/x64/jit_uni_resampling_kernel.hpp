@@ -210,6 +210,78 @@ private:
     std::unique_ptr<injector::jit_uni_postops_injector_t<isa, Vmm>>
             postops_injector_;
 };
+
+struct jit_uni_resampling_bwd_kernel_base_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resampling_bwd)
+
+    jit_uni_resampling_bwd_kernel_base_t(const jit_resampling_conf_t &conf)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, conf.isa)
+        , conf_(conf) {}
+
+    virtual ~jit_uni_resampling_bwd_kernel_base_t() = default;
+
+protected:
+    const jit_resampling_conf_t &conf_;
+};
+
+// Computes a row of diff_src points along the width dimension for channel
+// oriented formats. Every point is a weighted sum of diff_dst points given
+// by the contribution entries, in the configuration `src` stands for
+// diff_src and `dst` stands for diff_dst.
+template <typename Vmm>
+struct jit_uni_resampling_bwd_kernel_t
+    : public jit_uni_resampling_bwd_kernel_base_t {
+
+    jit_uni_resampling_bwd_kernel_t(const jit_resampling_conf_t &conf);
+
+    virtual ~jit_uni_resampling_bwd_kernel_t() = default;
+
+private:
+    using Reg64 = Xbyak::Reg64;
+
+    void compute_channels(size_t c_off, int n_vregs, bool is_tail);
+    void generate() override;
+
+    static constexpr bool is_zmm_ = std::is_same<Vmm, Xbyak::Zmm>::value;
+    static constexpr bool is_ymm_ = std::is_same<Vmm, Xbyak::Ymm>::value;
+    static constexpr std::size_t vlen_ = is_zmm_ ? 64 : is_ymm_ ? 32 : 16;
+    static constexpr std::size_t simd_w_ = vlen_ / sizeof(float);
+    // Number of vector registers accumulated at once.
+    static constexpr int max_unroll_ = 4;
+    const std::size_t tail_size_;
+
+    // Used only for avx2 and if c tail is present.
+    const Vmm vmm_tail_mask_ = Vmm(0);
+    const Vmm vmm_weight_ = Vmm(2);
+    const Vmm vmm_weight_dh_ = Vmm(3);
+    Vmm vmm_acc(int i) const { return Vmm(4 + i); }
+    Vmm vmm_diff_dst(int i) const { return Vmm(4 + max_unroll_ + i); }
+
+    const Xbyak::Zmm vmm_bf16_emu_1_ = Xbyak::Zmm(28);
+    const Xbyak::Zmm vmm_bf16_emu_2_ = Xbyak::Zmm(29);
+    const Xbyak::Zmm vmm_bf16_emu_3_ = Xbyak::Zmm(30);
+    const Xbyak::Zmm vmm_bf16_emu_4_ = Xbyak::Zmm(31);
+
+    const Xbyak::Opmask k_tail_mask_ = k3;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_tmp_ = rax;
+    const Reg64 reg_diff_dst_ = rbx;
+    const Reg64 reg_diff_src_ = rdx;
+    const Reg64 reg_dh_begin_ = rsi;
+    const Reg64 reg_dh_end_ = rbp;
+    const Reg64 reg_dh_ptr_ = r8;
+    const Reg64 reg_off_dh_ = r9;
+    const Reg64 reg_ranges_w_ = r10;
+    const Reg64 reg_entries_w_ = r11;
+    const Reg64 reg_w_begin_ = r12;
+    const Reg64 reg_w_end_ = r13;
+    const Reg64 reg_w_ptr_ = r14;
+    const Reg64 reg_off_ = r15;
+    const Reg64 reg_iw_ = abi_not_param1;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+};
 } // namespace x64
 } // namespace cpu
 } // namespace impl
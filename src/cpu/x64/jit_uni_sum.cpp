@@ -0,0 +1,437 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <limits.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_sum.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace data_type;
+using namespace Xbyak;
+
+namespace {
+
+using io_data_types_t = io::jit_io_multi_dt_helper_t<Zmm>::data_types_t;
+
+// Number of vectors processed by a kernel at once.
+constexpr int sum_unroll = 4;
+// Number of elements of a row processed by a thread at once.
+constexpr dim_t sum_chunk_len = 4096;
+
+cpu_isa_t get_sum_isa() {
+    return mayiuse(avx512_core) ? avx512_core : avx2;
+}
+
+bool sum_dt_ok(data_type_t dt) {
+    return utils::one_of(dt, f32, s8, u8);
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_sum_kernel_impl_t : public jit_uni_sum_kernel_t,
+                                   public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sum_kernel_impl_t);
+
+    jit_uni_sum_kernel_impl_t(
+            const jit_uni_sum_conf_t &conf, const post_ops_t &post_ops)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , conf_(conf)
+        , n_inputs_(static_cast<int>(conf.src_dts.size()))
+        , simd_w_(cpu_isa_traits<isa>::vlen / sizeof(float))
+        , dst_dt_sz_(types::data_type_size(conf.dst_dt))
+        , tail_(conf.row_len % simd_w_) {
+        io_data_types_t dts(conf_.src_dts.cbegin(), conf_.src_dts.cend());
+        dts.insert(conf_.dst_dt);
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_saturation_conf_t io_saturation_conf(
+                vmm_zero.getIdx(), vmm_saturation_ubound.getIdx(), reg_tmp);
+        io::io_gather_conf_t io_gather_conf(simd_w_, Opmask(full_opmask_idx),
+                vmm_full_mask.getIdx(), reg_tmp, reg_tmp1,
+                vmm_gather_tmp.getIdx());
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, isa, dts,
+                io::io_conf_t(), io_tail_conf, utils::nullopt,
+                {{conf_.dst_dt, io_saturation_conf}}, io_gather_conf);
+
+        for (const auto &e : post_ops.entry_) {
+            assert(e.is_eltwise());
+            eltwise_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this, e.eltwise,
+                            true /*save_state*/, reg_table, Opmask(2)));
+        }
+
+        idx_tables_.resize(n_inputs_);
+    }
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    const jit_uni_sum_conf_t conf_;
+    const int n_inputs_;
+    const dim_t simd_w_;
+    const size_t dst_dt_sz_;
+    const dim_t tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+    // Per input offsets of the gathered elements of a vector.
+    std::vector<Label> idx_tables_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_srcs = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_scales = r10;
+    const Reg64 reg_nelems = r11;
+    const Reg64 reg_off = r12;
+    const Reg64 reg_src = r13;
+    const Reg64 reg_tmp = r14;
+    const Reg64 reg_tmp1 = r15;
+    const Reg64 reg_tmp2 = rax;
+    const Reg64 reg_table = rbx;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_zero = Vmm(1);
+    const Vmm vmm_saturation_ubound = Vmm(2);
+    const Vmm vmm_scale = Vmm(3);
+    const Vmm vmm_src = Vmm(4);
+    const Vmm vmm_full_mask = Vmm(5);
+    const Vmm vmm_gather_tmp = Vmm(6);
+    const Vmm vmm_idx = Vmm(7);
+
+    const int tail_opmask_idx = 1;
+    const int full_opmask_idx = 3;
+
+    Vmm vmm_acc(int i) const { return Vmm(8 + i); }
+
+    bool is_gathered(int i) const { return conf_.src_strides[i] != 1; }
+
+    void accumulate(int i, int nvec, bool tail) {
+        const data_type_t dt = conf_.src_dts[i];
+        const dim_t dt_sz = types::data_type_size(dt);
+        const dim_t stride = conf_.src_strides[i];
+
+        mov(reg_src, ptr[reg_srcs + i * sizeof(void *)]);
+        uni_vbroadcastss(vmm_scale, ptr[reg_scales + i * sizeof(float)]);
+
+        if (is_gathered(i)) {
+            imul(reg_tmp2, reg_off, stride * dt_sz);
+            add(reg_src, reg_tmp2);
+            mov(reg_tmp2, idx_tables_[i]);
+            uni_vmovups(vmm_idx, ptr[reg_tmp2]);
+        }
+
+        for (int v = 0; v < nvec; v++) {
+            if (is_gathered(i)) {
+                if (v > 0) add(reg_src, simd_w_ * stride * dt_sz);
+                io_[dt]->gather(reg_src, vmm_idx, vmm_src, tail);
+            } else {
+                io_[dt]->load(
+                        ptr[reg_src + reg_off * dt_sz + v * simd_w_ * dt_sz],
+                        vmm_src, tail);
+            }
+            uni_vfmadd231ps(vmm_acc(v), vmm_src, vmm_scale);
+        }
+    }
+
+    void compute_block(int nvec, bool tail) {
+        for (int v = 0; v < nvec; v++)
+            uni_vpxor(vmm_acc(v), vmm_acc(v), vmm_acc(v));
+
+        for (int i = 0; i < n_inputs_; i++)
+            accumulate(i, nvec, tail);
+
+        for (auto &inj : eltwise_injectors_)
+            inj->compute_vector_range(
+                    vmm_acc(0).getIdx(), vmm_acc(0).getIdx() + nvec);
+
+        for (int v = 0; v < nvec; v++)
+            io_[conf_.dst_dt]->store(vmm_acc(v),
+                    ptr[reg_dst + reg_off * dst_dt_sz_
+                            + v * simd_w_ * dst_dt_sz_],
+                    tail);
+    }
+
+    void advance(dim_t elems) {
+        add(reg_off, elems);
+        sub(reg_nelems, elems);
+    }
+
+    void generate() override {
+        preamble();
+
+        if (tail_) io_.prepare_tail_mask();
+        io_.init_saturate_f32({conf_.dst_dt});
+        for (int i = 0; i < n_inputs_; i++) {
+            if (!is_gathered(i) || conf_.src_dts[i] != f32) continue;
+            io_[f32]->init_full_mask();
+            io_[f32]->prepare_full_mask();
+            break;
+        }
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_srcs, ptr[reg_param + PARAM_OFF(srcs)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_scales, ptr[reg_param + PARAM_OFF(scales)]);
+        mov(reg_nelems, ptr[reg_param + PARAM_OFF(nelems)]);
+#undef PARAM_OFF
+        xor_(reg_off, reg_off);
+
+        Label unroll_loop, unroll_end, vec_loop, vec_end;
+        L(unroll_loop);
+        {
+            cmp(reg_nelems, sum_unroll * simd_w_);
+            jl(unroll_end, T_NEAR);
+            compute_block(sum_unroll, false);
+            advance(sum_unroll * simd_w_);
+            jmp(unroll_loop, T_NEAR);
+        }
+        L(unroll_end);
+
+        L(vec_loop);
+        {
+            cmp(reg_nelems, simd_w_);
+            jl(vec_end, T_NEAR);
+            compute_block(1, false);
+            advance(simd_w_);
+            jmp(vec_loop, T_NEAR);
+        }
+        L(vec_end);
+
+        // Only the chunk covering the end of a row has a tail.
+        if (tail_) {
+            Label tail_end;
+            cmp(reg_nelems, 0);
+            je(tail_end, T_NEAR);
+            compute_block(1, true);
+            L(tail_end);
+        }
+
+        postamble();
+
+        for (auto &inj : eltwise_injectors_)
+            inj->prepare_table();
+
+        for (int i = 0; i < n_inputs_; i++) {
+            if (!is_gathered(i)) continue;
+            const dim_t step = conf_.src_strides[i]
+                    * types::data_type_size(conf_.src_dts[i]);
+            align(64);
+            L(idx_tables_[i]);
+            for (dim_t k = 0; k < simd_w_; k++)
+                dd(static_cast<uint32_t>(k * step));
+        }
+    }
+};
+
+jit_uni_sum_kernel_t *jit_uni_sum_kernel_t::create(
+        const jit_uni_sum_conf_t &conf, const post_ops_t &post_ops) {
+    if (mayiuse(avx512_core))
+        return new jit_uni_sum_kernel_impl_t<avx512_core>(conf, post_ops);
+    else if (mayiuse(avx2))
+        return new jit_uni_sum_kernel_impl_t<avx2>(conf, post_ops);
+    assert(!"kernel is empty.");
+    return nullptr;
+}
+
+status_t jit_uni_sum_t::pd_t::init(engine_t *engine) {
+    using sm = primitive_attr_t::skip_mask_t;
+
+    if (!mayiuse(avx2)) return status::unimplemented;
+    if (n_inputs() > max_num_arrs) return status::unimplemented;
+    if (!attr()->has_default_values(sm::post_ops) || !post_ops_ok())
+        return status::unimplemented;
+
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper src_d(src_md(i));
+        if (!src_d.is_blocking_desc() || src_d.is_additional_buffer()
+                || !sum_dt_ok(src_d.data_type()))
+            return status::unimplemented;
+    }
+    if (set_default_params() != status::success) return status::unimplemented;
+
+    const memory_desc_wrapper dst_d(dst_md());
+    if (!dst_d.is_blocking_desc() || dst_d.is_additional_buffer()
+            || !dst_d.is_dense(true) || !sum_dt_ok(dst_d.data_type()))
+        return status::unimplemented;
+
+    if (!layouts_ok()) return status::unimplemented;
+
+    return status::success;
+}
+
+bool jit_uni_sum_t::pd_t::post_ops_ok() const {
+    const cpu_isa_t isa = get_sum_isa();
+    for (const auto &e : attr()->post_ops_.entry_) {
+        if (!e.is_eltwise()) return false;
+        if (!eltwise_injector::is_supported(isa, e.eltwise.alg)) return false;
+    }
+    return true;
+}
+
+bool jit_uni_sum_t::pd_t::layouts_ok() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int n = n_inputs();
+
+    conf_.src_dts.resize(n);
+    conf_.src_strides.assign(n, 1);
+    conf_.dst_dt = dst_d.data_type();
+
+    bool all_similar = true;
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper src_d(src_md(i));
+        conf_.src_dts[i] = src_d.data_type();
+        all_similar = all_similar && src_d.is_dense(true)
+                && dst_d.similar_to(src_d, true, false, 0);
+    }
+
+    if (all_similar) {
+        row_dim_ = -1;
+        nrows_ = 1;
+        conf_.row_len = dst_d.size() / dst_d.data_type_size();
+        return true;
+    }
+
+    // Otherwise the rows go along the innermost dimension of a plain
+    // destination and inputs in other plain layouts are gathered.
+    const auto &dst_bd = dst_d.blocking_desc();
+    if (dst_bd.inner_nblks != 0) return false;
+
+    row_dim_ = -1;
+    for (int d = 0; d < dst_d.ndims(); ++d)
+        if (dst_d.dims()[d] > 1 && dst_bd.strides[d] == 1) row_dim_ = d;
+    if (row_dim_ < 0) return false;
+
+    conf_.row_len = dst_d.dims()[row_dim_];
+    nrows_ = dst_d.nelems() / conf_.row_len;
+
+    const dim_t simd_w = isa_max_vlen(get_sum_isa()) / sizeof(float);
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper src_d(src_md(i));
+        if (src_d.blocking_desc().inner_nblks != 0) return false;
+
+        const dim_t stride = src_d.blocking_desc().strides[row_dim_];
+        // Gathered offsets within a block of vectors are 32-bit.
+        if (stride * src_d.data_type_size() * simd_w * sum_unroll > INT_MAX)
+            return false;
+        conf_.src_strides[i] = stride;
+    }
+
+    return true;
+}
+
+status_t jit_uni_sum_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            jit_uni_sum_kernel_t::create(
+                    pd()->conf_, pd()->attr()->post_ops_)));
+    return kernel_->create_kernel();
+}
+
+status_t jit_uni_sum_t::execute(const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->conf_;
+    const int n = pd()->n_inputs();
+    const int row_dim = pd()->row_dim_;
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const int ndims = dst_d.ndims();
+    const size_t dst_dt_sz = dst_d.data_type_size();
+
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    if (dst == nullptr) return status::success;
+    dst += dst_d.offset0() * dst_dt_sz;
+
+    const char *src_bases[max_num_arrs];
+    size_t src_dt_szs[max_num_arrs];
+    const dim_t *src_strides[max_num_arrs];
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper src_d(pd()->src_md(i));
+        src_dt_szs[i] = src_d.data_type_size();
+        src_bases[i] = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + i)
+                + src_d.offset0() * src_dt_szs[i];
+        src_strides[i] = src_d.blocking_desc().strides;
+    }
+    const dim_t *dims = dst_d.dims();
+    const dim_t *dst_strides = dst_d.blocking_desc().strides;
+
+    const dim_t chunks_per_row = utils::div_up(conf.row_len, sum_chunk_len);
+    const dim_t work_amount = pd()->nrows_ * chunks_per_row;
+    const float *scales = pd()->scales();
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+
+        const void *srcs[max_num_arrs];
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            dim_t row = iwork / chunks_per_row;
+            const dim_t e_start = (iwork % chunks_per_row) * sum_chunk_len;
+
+            dim_t dst_off = e_start;
+            dim_t src_offs[max_num_arrs];
+            for (int i = 0; i < n; ++i)
+                src_offs[i] = e_start * conf.src_strides[i];
+
+            if (row_dim >= 0) {
+                for (int d = ndims - 1; d >= 0; --d) {
+                    if (d == row_dim) continue;
+                    const dim_t idx = row % dims[d];
+                    row /= dims[d];
+                    dst_off += idx * dst_strides[d];
+                    for (int i = 0; i < n; ++i)
+                        src_offs[i] += idx * src_strides[i][d];
+                }
+            }
+
+            for (int i = 0; i < n; ++i)
+                srcs[i] = src_bases[i] + src_offs[i] * src_dt_szs[i];
+
+            jit_uni_sum_kernel_t::call_params_t p;
+            p.srcs = srcs;
+            p.dst = dst + dst_off * dst_dt_sz;
+            p.scales = scales;
+            p.nelems = nstl::min(sum_chunk_len, conf.row_len - e_start);
+            (*kernel_)(&p);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SUM_HPP
+#define CPU_X64_JIT_UNI_SUM_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// The destination is processed row by row, where a row is a contiguous
+// part of the destination. Inputs in the destination layout are read
+// contiguously as well, inputs in a different plain layout are gathered
+// with a stride.
+struct jit_uni_sum_conf_t {
+    std::vector<data_type_t> src_dts;
+    // Distance in elements between consecutive elements of a row for every
+    // input, `1` means the input is read contiguously.
+    std::vector<dim_t> src_strides;
+    data_type_t dst_dt;
+    dim_t row_len;
+};
+
+// Computes `dst = po(sum_i(src_i * scales[i]))` for `nelems` elements,
+// where `po` is a chain of eltwise post-ops.
+struct jit_uni_sum_kernel_t {
+    struct call_params_t {
+        const void *const *srcs;
+        void *dst;
+        const float *scales;
+        size_t nelems;
+    };
+
+    static jit_uni_sum_kernel_t *create(
+            const jit_uni_sum_conf_t &conf, const post_ops_t &post_ops);
+    virtual ~jit_uni_sum_kernel_t() = default;
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+struct jit_uni_sum_t : public primitive_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T("jit:uni", jit_uni_sum_t);
+
+        status_t init(engine_t *engine);
+
+        jit_uni_sum_conf_t conf_;
+        // Logical dimension the rows go along, -1 when the whole tensor is
+        // processed as a single row.
+        int row_dim_ = -1;
+        dim_t nrows_ = 0;
+
+    private:
+        bool post_ops_ok() const;
+        bool layouts_ok();
+    };
+
+    jit_uni_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    static constexpr int max_num_arrs = 16;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_sum_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -2375,7 +2375,14 @@ private:
     }
 
     void thread_distribution(dim_t C_blks, bnorm_dims_t &nthr) {
-        if (do_blocking_) {
+        if (dnnl_thr_deterministic() && !normalize_only(pd_)) {
+            // Statistics of a channel are accumulated by a single thread, so
+            // that the order of summation does not depend on the number of
+            // threads.
+            nthr.C = nstl::min<dim_t>(C_blks, nthr_);
+            nthr.N = 1;
+            nthr.S = 1;
+        } else if (do_blocking_) {
             nthr.N = nstl::min<dim_t>(N_, nthr_);
             nthr.C = nstl::min<dim_t>(C_blks, nthr_ / nthr.N);
             nthr.S = utils::saturate((dim_t)1, S_, nthr_ / (nthr.C * nthr.N));
@@ -0,0 +1,523 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace data_type;
+using namespace topk_utils;
+using namespace Xbyak;
+
+namespace {
+
+// Number of vectors filtered by a kernel at once.
+constexpr int topk_unroll = 4;
+
+// The buffer of a thread holds the values and the indices of the candidates,
+// the candidates as entries for the selection, and the elements of a block
+// gathered from a source with strided axis.
+struct thr_buf_layout_t {
+    thr_buf_layout_t(const jit_topk_conf_t &conf) {
+        const size_t cap = conf.cand_cap;
+        values_off = 0;
+        indices_off = values_off + utils::rnd_up(cap * sizeof(float), align);
+        entries_off
+                = indices_off + utils::rnd_up(cap * sizeof(int32_t), align);
+        gather_off = entries_off + utils::rnd_up(cap * sizeof(entry_t), align);
+        size = gather_off
+                + utils::rnd_up(conf.block * types::data_type_size(conf.src_dt),
+                        align);
+    }
+
+    static constexpr size_t align = 64;
+    size_t values_off;
+    size_t indices_off;
+    size_t entries_off;
+    size_t gather_off;
+    size_t size;
+};
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_topk_kernel_impl_t : public jit_uni_topk_kernel_t,
+                                    public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_topk_kernel_impl_t);
+
+    jit_uni_topk_kernel_impl_t(const jit_topk_conf_t &conf)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , conf_(conf)
+        , simd_w_(cpu_isa_traits<isa>::vlen / sizeof(float))
+        , src_dt_sz_(types::data_type_size(conf.src_dt)) {}
+
+    void operator()(call_params_t *p) const override {
+        jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    const jit_topk_conf_t conf_;
+    const int simd_w_;
+    const size_t src_dt_sz_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_values = r9;
+    const Reg64 reg_indices = r10;
+    const Reg64 reg_len = r11;
+    const Reg64 reg_cnt = r12;
+    const Reg64 reg_val = r13;
+    // Index of the first element of the vectors being filtered.
+    const Reg64 reg_cur_idx = r14;
+    const Reg64 reg_mask = r15;
+    const Reg64 reg_bit = rdx;
+    const Reg64 reg_tmp = rax;
+
+    const Vmm vmm_thr = Vmm(0);
+    // Indices of the elements of the first vector being filtered.
+    const Vmm vmm_idx = Vmm(1);
+    const Vmm vmm_cur_idx = Vmm(2);
+    const Vmm vmm_step = Vmm(3);
+    const Vmm vmm_any = Vmm(4);
+
+    Vmm vmm_x(int i) const { return Vmm(5 + i); }
+    Vmm vmm_m(int i) const { return Vmm(5 + topk_unroll + i); }
+    Opmask k_m(int i) const { return Opmask(1 + i); }
+    const Opmask k_any = Opmask(1 + topk_unroll);
+
+    Label l_iota;
+
+    bool is_avx512() const { return is_superset(isa, avx512_core); }
+
+    int cmp_predicate() const {
+        // NaNs are unordered, so they always pass.
+        return conf_.select_max ? _cmp_nle_us : _cmp_nge_us;
+    }
+
+    void load(const Vmm &v, int i) {
+        const auto addr = ptr[reg_src + i * simd_w_ * src_dt_sz_];
+        if (conf_.src_dt == bf16) {
+            vpmovzxwd(v, addr);
+            vpslld(v, v, 16);
+        } else {
+            uni_vmovups(v, addr);
+        }
+    }
+
+    // Appends the elements of a vector which pass the filter with
+    // compressing stores.
+    void append_avx512(int i) {
+        const Vmm vmm_i = i == 0 ? vmm_idx : vmm_cur_idx;
+        if (i > 0)
+            vpaddd(vmm_cur_idx, i == 1 ? vmm_idx : vmm_cur_idx, vmm_step);
+        vcompressps(ptr[reg_values + reg_cnt * sizeof(float)],
+                vmm_x(i) | k_m(i));
+        vpcompressd(ptr[reg_indices + reg_cnt * sizeof(int32_t)],
+                vmm_i | k_m(i));
+        kmovw(reg_tmp.cvt32(), k_m(i));
+        popcnt(reg_tmp.cvt32(), reg_tmp.cvt32());
+        add(reg_cnt, reg_tmp);
+    }
+
+    // Appends the elements of a vector which pass the filter one by one, the
+    // vector is spilled to the stack.
+    void append_avx2(int i) {
+        Label l_bits, l_end;
+        vmovmskps(reg_mask.cvt32(), vmm_m(i));
+        test(reg_mask.cvt32(), reg_mask.cvt32());
+        jz(l_end, T_NEAR);
+        uni_vmovups(ptr[rsp], vmm_x(i));
+        L(l_bits);
+        {
+            bsf(reg_bit.cvt32(), reg_mask.cvt32());
+            mov(reg_val.cvt32(), dword[rsp + reg_bit * sizeof(float)]);
+            mov(dword[reg_values + reg_cnt * sizeof(float)], reg_val.cvt32());
+            lea(reg_val, ptr[reg_cur_idx + reg_bit + i * simd_w_]);
+            mov(dword[reg_indices + reg_cnt * sizeof(int32_t)],
+                    reg_val.cvt32());
+            inc(reg_cnt);
+            lea(reg_tmp.cvt32(), ptr[reg_mask - 1]);
+            and_(reg_mask.cvt32(), reg_tmp.cvt32());
+            jnz(l_bits, T_NEAR);
+        }
+        L(l_end);
+    }
+
+    void filter(int nvec) {
+        Label l_skip;
+        for (int i = 0; i < nvec; i++) {
+            load(vmm_x(i), i);
+            if (is_avx512())
+                vcmpps(k_m(i), vmm_x(i), vmm_thr, cmp_predicate());
+            else
+                vcmpps(vmm_m(i), vmm_x(i), vmm_thr, cmp_predicate());
+        }
+
+        // Most of the vectors have no candidates at all.
+        if (is_avx512()) {
+            if (nvec > 1) {
+                korw(k_any, k_m(0), k_m(1));
+                for (int i = 2; i < nvec; i++)
+                    korw(k_any, k_any, k_m(i));
+                kortestw(k_any, k_any);
+            } else {
+                kortestw(k_m(0), k_m(0));
+            }
+            jz(l_skip, T_NEAR);
+            for (int i = 0; i < nvec; i++)
+                append_avx512(i);
+        } else {
+            uni_vmovups(vmm_any, vmm_m(0));
+            for (int i = 1; i < nvec; i++)
+                vorps(vmm_any, vmm_any, vmm_m(i));
+            vmovmskps(reg_tmp.cvt32(), vmm_any);
+            test(reg_tmp.cvt32(), reg_tmp.cvt32());
+            jz(l_skip, T_NEAR);
+            for (int i = 0; i < nvec; i++)
+                append_avx2(i);
+        }
+        L(l_skip);
+
+        const int n = nvec * simd_w_;
+        if (is_avx512()) {
+            for (int i = 0; i < nvec; i++)
+                vpaddd(vmm_idx, vmm_idx, vmm_step);
+        }
+        add(reg_cur_idx, n);
+        add(reg_src, n * src_dt_sz_);
+        sub(reg_len, n);
+    }
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+    void generate() override {
+        preamble();
+        if (!is_avx512()) sub(rsp, cpu_isa_traits<isa>::vlen);
+
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_values, ptr[reg_param + PARAM_OFF(values)]);
+        mov(reg_indices, ptr[reg_param + PARAM_OFF(indices)]);
+        mov(reg_len, ptr[reg_param + PARAM_OFF(len)]);
+        mov(reg_cur_idx, ptr[reg_param + PARAM_OFF(base_index)]);
+        uni_vbroadcastss(vmm_thr, ptr[reg_param + PARAM_OFF(threshold)]);
+        xor_(reg_cnt, reg_cnt);
+
+        if (is_avx512()) {
+            uni_vpbroadcastd(vmm_idx, reg_cur_idx.cvt32());
+            mov(reg_tmp, l_iota);
+            vpaddd(vmm_idx, vmm_idx, ptr[reg_tmp]);
+            mov(reg_tmp.cvt32(), simd_w_);
+            uni_vpbroadcastd(vmm_step, reg_tmp.cvt32());
+        }
+
+        Label l_unroll_loop, l_vec_loop, l_end;
+        L(l_unroll_loop);
+        {
+            cmp(reg_len, topk_unroll * simd_w_);
+            jl(l_vec_loop, T_NEAR);
+            filter(topk_unroll);
+            jmp(l_unroll_loop, T_NEAR);
+        }
+        L(l_vec_loop);
+        {
+            cmp(reg_len, simd_w_);
+            jl(l_end, T_NEAR);
+            filter(1);
+            jmp(l_vec_loop, T_NEAR);
+        }
+        L(l_end);
+
+        mov(ptr[reg_param + PARAM_OFF(count)], reg_cnt);
+
+        if (!is_avx512()) add(rsp, cpu_isa_traits<isa>::vlen);
+        postamble();
+
+        if (is_avx512()) {
+            align(64);
+            L(l_iota);
+            for (int i = 0; i < simd_w_; i++)
+                dd(i);
+        }
+    }
+#undef PARAM_OFF
+};
+
+jit_uni_topk_kernel_t *jit_uni_topk_kernel_t::create(
+        const jit_topk_conf_t &conf) {
+    switch (conf.isa) {
+        case avx512_core:
+            return new jit_uni_topk_kernel_impl_t<avx512_core>(conf);
+        case avx2: return new jit_uni_topk_kernel_impl_t<avx2>(conf);
+        default: assert(!"kernel is empty.");
+    }
+    return nullptr;
+}
+
+status_t jit_uni_topk_t::pd_t::init(engine_t *engine) {
+    conf_ = jit_topk_conf_t();
+    VDISPATCH_TOPK(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_TOPK(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_TOPK(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+
+    conf_.select_max = select_max();
+    conf_.src_dt = src_md()->data_type;
+    conf_.dst_dt = dst_md()->data_type;
+    VDISPATCH_TOPK(utils::one_of(conf_.src_dt, f32, bf16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOPK(utils::one_of(conf_.dst_dt, f32, bf16, f16)
+                    && platform::has_data_type_support(conf_.dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    conf_.isa = mayiuse(avx512_core) ? avx512_core : avx2;
+
+    // Elements of a row are addressed with the stride of the axis. The
+    // destination and the indices are written with any layout.
+    const memory_desc_wrapper src_d(src_md());
+    VDISPATCH_TOPK(src_d.is_plain(), VERBOSE_UNSUPPORTED_TAG_S, "src");
+
+    const dim_t K = this->K();
+    const dim_t L = axis_size();
+    conf_.block = 1024;
+    conf_.cand_cap = 2 * K + conf_.block;
+
+    // A chunk is long enough to amortize the merge of its k elements.
+    nthr_ = dnnl_get_max_threads();
+    const dim_t rows = outer_size() * inner_size();
+    conf_.n_chunks = 1;
+    if (rows < nthr_) {
+        const dim_t max_chunks = L / nstl::max<dim_t>(4 * K, 2048);
+        conf_.n_chunks = nstl::max<dim_t>(1,
+                nstl::min<dim_t>(utils::div_up(nthr_, rows), max_chunks));
+    }
+    conf_.chunk = L / conf_.n_chunks;
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void jit_uni_topk_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    const thr_buf_layout_t layout(conf_);
+    scratchpad.book<char>(key_topk_cand, layout.size * nthr_);
+    if (conf_.n_chunks > 1) {
+        const dim_t rows = outer_size() * inner_size();
+        scratchpad.book<entry_t>(key_topk_partial, rows * conf_.n_chunks * K());
+    }
+}
+
+status_t jit_uni_topk_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, jit_uni_topk_kernel_t::create(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+const entry_t *jit_uni_topk_t::select_chunk(const char *src,
+        dim_t axis_stride, dim_t l_start, dim_t l_end, char *thr_buf) const {
+    const auto &conf = pd()->conf_;
+    const thr_buf_layout_t layout(conf);
+    float *values = reinterpret_cast<float *>(thr_buf + layout.values_off);
+    int32_t *indices
+            = reinterpret_cast<int32_t *>(thr_buf + layout.indices_off);
+    entry_t *entries
+            = reinterpret_cast<entry_t *>(thr_buf + layout.entries_off);
+    char *gathered = thr_buf + layout.gather_off;
+
+    const data_type_t src_dt = conf.src_dt;
+    const size_t src_dt_sz = types::data_type_size(src_dt);
+    const bool select_max = conf.select_max;
+    const precedes_t precedes(select_max);
+    const dim_t K = pd()->K();
+    const dim_t simd_w = isa_max_vlen(conf.isa) / sizeof(float);
+
+    // The first k elements are the initial candidates, a chunk is never
+    // shorter than k.
+    dim_t count = 0;
+    for (dim_t l = l_start; l < l_start + K; l++) {
+        values[count] = io::load_float_value(src_dt, src, l * axis_stride);
+        indices[count] = static_cast<int32_t>(l);
+        count++;
+    }
+    dim_t worst = 0;
+    for (dim_t i = 1; i < count; i++)
+        if (precedes({values[worst], indices[worst]}, {values[i], indices[i]}))
+            worst = i;
+    float thr = values[worst];
+
+    // Moves the k best candidates to the front of the selection buffer.
+    auto select = [&]() {
+        for (dim_t i = 0; i < count; i++)
+            entries[i] = {values[i], indices[i]};
+        if (count > K)
+            std::nth_element(
+                    entries, entries + K - 1, entries + count, precedes);
+    };
+
+    for (dim_t b = l_start + K; b < l_end; b += conf.block) {
+        const dim_t len = nstl::min(conf.block, l_end - b);
+        if (count + len > conf.cand_cap) {
+            select();
+            for (dim_t i = 0; i < K; i++) {
+                values[i] = entries[i].value;
+                indices[i] = entries[i].index;
+            }
+            count = K;
+            thr = values[K - 1];
+        }
+
+        const char *block_src = src + b * axis_stride * src_dt_sz;
+        if (axis_stride != 1) {
+            for (dim_t i = 0; i < len; i++) {
+                const char *s = block_src + i * axis_stride * src_dt_sz;
+                if (src_dt_sz == sizeof(float))
+                    reinterpret_cast<float *>(gathered)[i]
+                            = *reinterpret_cast<const float *>(s);
+                else
+                    reinterpret_cast<uint16_t *>(gathered)[i]
+                            = *reinterpret_cast<const uint16_t *>(s);
+            }
+            block_src = gathered;
+        }
+
+        const dim_t len_vec = utils::rnd_dn(len, simd_w);
+        if (len_vec > 0) {
+            jit_uni_topk_kernel_t::call_params_t p;
+            p.src = block_src;
+            p.values = values + count;
+            p.indices = indices + count;
+            p.len = len_vec;
+            p.base_index = b;
+            p.threshold = thr;
+            p.count = 0;
+            (*kernel_)(&p);
+            count += p.count;
+        }
+        for (dim_t i = len_vec; i < len; i++) {
+            const float x = io::load_float_value(src_dt, block_src, i);
+            if (!passes(x, thr, select_max)) continue;
+            values[count] = x;
+            indices[count] = static_cast<int32_t>(b + i);
+            count++;
+        }
+    }
+
+    select();
+    std::sort(entries, entries + K, precedes);
+    return entries;
+}
+
+status_t jit_uni_topk_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_INDICES, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper indices_d(pd()->indices_md());
+    const size_t src_dt_sz = src_d.data_type_size();
+
+    const auto &conf = pd()->conf_;
+    const int axis = pd()->axis();
+    const dim_t K = pd()->K();
+    const dim_t L = pd()->axis_size();
+    const dim_t inner = pd()->inner_size();
+    const dim_t rows = pd()->outer_size() * inner;
+    const dim_t n_chunks = conf.n_chunks;
+    const dim_t axis_stride = src_d.blocking_desc().strides[axis];
+    if (rows == 0) return status::success;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    char *thr_bufs = scratchpad.template get<char>(
+            memory_tracking::names::key_topk_cand);
+    entry_t *partial = scratchpad.template get<entry_t>(
+            memory_tracking::names::key_topk_partial);
+    const size_t thr_buf_size = thr_buf_layout_t(conf).size;
+
+    auto write_row = [&](dim_t r, const entry_t *res) {
+        dims_t pos;
+        pd()->row_pos(r / inner, r % inner, pos);
+        for (dim_t k = 0; k < K; k++) {
+            pos[axis] = k;
+            io::store_float_value(
+                    conf.dst_dt, res[k].value, dst, dst_d.off_v(pos));
+            indices[indices_d.off_v(pos)] = res[k].index;
+        }
+    };
+    auto row_src = [&](dim_t r) {
+        dims_t pos;
+        pd()->row_pos(r / inner, r % inner, pos);
+        return src + src_d.off_v(pos) * src_dt_sz;
+    };
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(rows * n_chunks, nthr, ithr, start, end);
+        char *thr_buf = thr_bufs + ithr * thr_buf_size;
+
+        for (dim_t w = start; w < end; w++) {
+            const dim_t r = w / n_chunks;
+            const dim_t c = w % n_chunks;
+            const dim_t l_start = c * conf.chunk;
+            const dim_t l_end = c == n_chunks - 1 ? L : l_start + conf.chunk;
+            const entry_t *res = select_chunk(
+                    row_src(r), axis_stride, l_start, l_end, thr_buf);
+            if (n_chunks == 1)
+                write_row(r, res);
+            else
+                std::copy(res, res + K, partial + w * K);
+        }
+    });
+
+    if (n_chunks == 1) return status::success;
+
+    // The sorted elements of the chunks of a row are merged.
+    const precedes_t precedes(conf.select_max);
+    parallel_nd(rows, [&](dim_t r) {
+        entry_t *row_partial = partial + r * n_chunks * K;
+        std::partial_sort(row_partial, row_partial + K,
+                row_partial + n_chunks * K, precedes);
+        write_row(r, row_partial);
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
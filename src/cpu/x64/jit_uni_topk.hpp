@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_TOPK_HPP
+#define CPU_X64_JIT_UNI_TOPK_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/topk_utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_topk_conf_t {
+    cpu_isa_t isa;
+    bool select_max;
+    data_type_t src_dt;
+    data_type_t dst_dt;
+    // Number of source elements filtered by a single kernel call.
+    dim_t block;
+    // Capacity of the candidates buffer of a thread.
+    dim_t cand_cap;
+    // The axis is split into `n_chunks` chunks of `chunk` elements, except
+    // for the last one, when there are fewer rows than threads.
+    dim_t n_chunks;
+    dim_t chunk;
+};
+
+// Filters a block of source elements with a threshold: the elements which
+// can precede the threshold in the output are appended to the candidates
+// together with their indices. Almost every element of a long axis is
+// rejected, so the filter runs at the memory bandwidth.
+struct jit_uni_topk_kernel_t {
+    struct call_params_t {
+        const void *src;
+        // Candidates at the first free position.
+        float *values;
+        int32_t *indices;
+        // Number of elements, a multiple of the vector length.
+        size_t len;
+        // Index of the first element of the block along the axis.
+        size_t base_index;
+        float threshold;
+        // Output: the number of appended candidates.
+        size_t count;
+    };
+
+    static jit_uni_topk_kernel_t *create(const jit_topk_conf_t &conf);
+    virtual ~jit_uni_topk_kernel_t() = default;
+
+    virtual void operator()(call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+// Top-k with plain source layout. The k best elements seen so far are kept
+// in a candidates buffer of a thread, and the worst of them is the threshold
+// for the rest of the axis. The buffer is shrunk back to k elements with a
+// selection when it overflows. Rows with long axes are split into chunks
+// when there are fewer rows than threads, and the sorted results of the
+// chunks are merged.
+struct jit_uni_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", conf_.isa, ""), jit_uni_topk_t);
+
+        status_t init(engine_t *engine);
+
+        jit_topk_conf_t conf_;
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Returns the sorted k best elements of the chunk [l_start, l_end) of a
+    // row, which are kept in the buffer of the thread. `src` points to the
+    // first element of the row.
+    const topk_utils::entry_t *select_chunk(const char *src,
+            dim_t axis_stride, dim_t l_start, dim_t l_end,
+            char *thr_buf) const;
+
+    std::unique_ptr<jit_uni_topk_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::cpu::matmul;
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+constexpr int brgemm_grouped_matmul_t<isa>::pd_t::m_kernel_sizes[];
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    bool ok = mayiuse(isa) && is_grouped() && is_dense_data()
+            && everyone_is(f32, src_md()->data_type, weights_md()->data_type,
+                    dst_md()->data_type)
+            && attr()->has_default_values() && set_default_formats();
+    if (!ok) return status::unimplemented;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    // The kernels require unit stride along K for src and along N for
+    // weights and dst, the leading dimensions may be arbitrary.
+    if (!(src_d.is_plain() && wei_d.is_plain() && dst_d.is_plain()))
+        return status::unimplemented;
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &wei_strides = wei_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    if (!everyone_is(1, src_strides[1], wei_strides[2], dst_strides[1]))
+        return status::unimplemented;
+    if (K() == 0 || N() == 0) return status::unimplemented;
+
+    lda_ = src_strides[0];
+    ldb_ = wei_strides[1];
+    ldc_ = dst_strides[0];
+    wei_group_stride_ = wei_strides[0];
+
+    const dim_t simd_w = isa_max_vlen(isa) / sizeof(float);
+    N_blk_ = nstl::min(N(), 4 * simd_w);
+    N_tail_ = N() % N_blk_;
+    nb_N_ = div_up(N(), N_blk_);
+
+    for_(int i_M = 0; i_M < n_m_kernels; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const dim_t vN = i_N ? N_tail_ : N_blk_;
+        if (vN == 0) continue;
+        brgemm_t &brg = brgs_[i_M][i_N];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.f, 0.f, lda_, ldb_, ldc_,
+                m_kernel_sizes[i_M], vN, K()));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        brgattr.fpmath_mode = attr()->fpmath_mode_;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::init(engine_t *engine) {
+    for_(int i_M = 0; i_M < pd_t::n_m_kernels; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        if (i_N == 1 && pd()->N_tail_ == 0) continue;
+        brgemm_kernel_t *brg_kernel = nullptr;
+        CHECK(brgemm_kernel_create(&brg_kernel, pd()->brgs_[i_M][i_N]));
+        CHECK(safe_ptr_assign(brg_kernels_[i_M][i_N], brg_kernel));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_grouped_matmul_t<isa>::compute_tile(const float *src,
+        const float *wei, float *dst, dim_t g, dim_t m, dim_t m_len,
+        dim_t nb) const {
+    const auto *p = pd();
+    const int i_N = (p->N_tail_ != 0 && nb == p->nb_N_ - 1) ? 1 : 0;
+    const dim_t n = nb * p->N_blk_;
+
+    brgemm_batch_element_t addr_batch;
+    addr_batch.ptr.B = wei + g * p->wei_group_stride_ + n;
+
+    // Rows are covered by the largest kernels first, so that at most one
+    // call per power of two is made for the remainder of a group.
+    for (int i_M = 0; i_M < pd_t::n_m_kernels && m_len > 0; i_M++) {
+        const dim_t vM = pd_t::m_kernel_sizes[i_M];
+        for (; m_len >= vM; m_len -= vM, m += vM) {
+            addr_batch.ptr.A = src + m * p->lda_;
+            brgemm_kernel_execute(brg_kernels_[i_M][i_N].get(), 1,
+                    &addr_batch, dst + m * p->ldc_ + n);
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_GROUP_OFFSETS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const dim_t G = pd()->ngroups();
+    const dim_t nb_N = pd()->nb_N_;
+    constexpr dim_t M_blk = pd_t::M_blk;
+
+    if (!group_offsets_ok(offsets, G, pd()->M()))
+        return status::invalid_arguments;
+
+    // Tiles of a group are enumerated N block major so that the tiles a
+    // thread gets mostly share the same block of weights.
+    std::vector<dim_t> tile_offsets(G + 1, 0);
+    for (dim_t g = 0; g < G; g++) {
+        const dim_t nb_M = div_up(offsets[g + 1] - offsets[g], M_blk);
+        tile_offsets[g + 1] = tile_offsets[g] + nb_M * nb_N;
+    }
+    const dim_t work_amount = tile_offsets[G];
+    if (work_amount == 0) return status::success;
+
+    const int nthr = nstl::min<dim_t>(dnnl_get_max_threads(), work_amount);
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        dim_t g = 0;
+        while (tile_offsets[g + 1] <= start)
+            g++;
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            while (tile_offsets[g + 1] <= iwork)
+                g++;
+            const dim_t rows = offsets[g + 1] - offsets[g];
+            const dim_t nb_M = div_up(rows, M_blk);
+            const dim_t local = iwork - tile_offsets[g];
+            const dim_t nb = local / nb_M;
+            const dim_t mb = local % nb_M;
+            const dim_t m_len = nstl::min(M_blk, rows - mb * M_blk);
+            compute_tile(src, weights, dst, g, offsets[g] + mb * M_blk, m_len,
+                    nb);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_grouped_matmul_t<avx512_core>;
+template struct brgemm_grouped_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
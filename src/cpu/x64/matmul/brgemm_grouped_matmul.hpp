@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Grouped matmul for f32 with plain layouts.
+//
+// The number of rows of a group is known only at execution time, so rows of
+// every group are split into blocks of M_blk rows and the remainder is
+// computed with a sequence of kernels for decreasing powers of two rows, as
+// brgemm_matmul_t does for runtime M. The (row block, N block) tiles of all
+// the groups are distributed across threads at once, tiles sharing a block
+// of weights are assigned to a thread one after another.
+template <cpu_isa_t isa>
+struct brgemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_grouped:", isa, ""),
+                brgemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Row counts of the kernels: M_blk followed by the tail kernels.
+        static constexpr int M_blk = 32;
+        static constexpr int m_kernel_sizes[] = {M_blk, 16, 8, 4, 2, 1};
+        static constexpr int n_m_kernels
+                = sizeof(m_kernel_sizes) / sizeof(m_kernel_sizes[0]);
+
+        dim_t N_blk_ = 0, N_tail_ = 0, nb_N_ = 0;
+        dim_t lda_ = 0, ldb_ = 0, ldc_ = 0, wei_group_stride_ = 0;
+        brgemm_t brgs_[n_m_kernels][2];
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Computes `m_len` rows starting at `m` and a block of N of a group.
+    void compute_tile(const float *src, const float *wei, float *dst,
+            dim_t g, dim_t m, dim_t m_len, dim_t nb) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::n_m_kernels][2];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -23,6 +23,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/rope_utils.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -116,6 +117,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
 
+    // The rope post-op is applied outside of the brgemm kernels.
+    CHECK(brg_attr_.copy_from(attr_));
+    if (bgmmc_.with_rope) brg_attr_.post_ops_.entry_.pop_back();
+
     const float alpha = 1.0;
     const float beta = 1.0;
     const float beta_init = 0.0;
@@ -158,7 +163,7 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
         auto LDD = bgmmc_.LDD;
         CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+                &brg, &brg_attr_, &dst_md_, LDD, bgmmc_.bia_dt));
 
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
@@ -185,6 +190,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     auto scratchpad = scratchpad_registry().registrar();
     init_scratchpad(scratchpad, bgmmc_);
     book_precomputed_scales(scratchpad, attr()->scales_, N());
+    if (bgmmc_.with_rope) {
+        const auto &rope = attr()->post_ops_.entry_[bgmmc_.rope_idx].rope;
+        scratchpad.template book<float>(
+                key_brgemm_primitive_rope_cos_sin,
+                (size_t)bgmmc_.nthr * rope.rotary_dim);
+    }
 
     return status::success;
 }
@@ -295,6 +306,10 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
                             kc == kc_start, prev_ker_idx);
                 }
             }
+            // The chunk is complete and still hot in cache.
+            if (bgmmc.with_rope)
+                apply_rope(
+                        brgmm_ctx, ithr, b, m_start, m_end, n_start, n_end);
             ++start;
             nd_iterator_step(b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
         }
@@ -687,6 +702,33 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
     }
 }
 
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::apply_rope(const brg_matmul_exec_ctx_t &brgmm_ctx,
+        int ithr, int b_idx, int m_blk_start, int m_blk_end, int n_blk_start,
+        int n_blk_end) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &rope = pd()->attr()->post_ops_.entry_[bgmmc.rope_idx].rope;
+    const dim_t rd = rope.rotary_dim;
+    float *cos = brgmm_ctx.get_rope_cos_sin_ptr(ithr);
+    float *sin = cos + rd / 2;
+
+    // The chunk consists of complete heads, see init_brgemm_matmul_conf().
+    const dim_t m_start = brgmm_ctx.get_M_idx(m_blk_start);
+    const dim_t m_end = nstl::min(m_blk_end * bgmmc.M_blk, bgmmc.M);
+    const dim_t n_start = n_blk_start * bgmmc.N_blk;
+    const dim_t n_end = nstl::min(n_blk_end * bgmmc.N_blk, bgmmc.N);
+    assert(n_start % rope.head_dim == 0 && n_end % rope.head_dim == 0);
+    for (dim_t m = m_start; m < m_end; m++) {
+        rope_utils::compute_cos_sin(
+                cos, sin, brgmm_ctx.get_rope_pos(b_idx, m), rd, rope.base);
+        for (dim_t n = n_start; n < n_end; n += rope.head_dim) {
+            auto x = reinterpret_cast<float *>(
+                    brgmm_ctx.get_data_C_ptr(b_idx, (int)m, (int)n));
+            rope_utils::rotate(x, cos, sin, rd, rope.alg);
+        }
+    }
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::accumulate(
         char *result_ptr, const char *reduce_ptr, size_t size) const {
@@ -774,6 +816,19 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         zero_point_c_val_ = dst_zp;
 
+        rope_offsets_ptr_ = bgmmc.with_rope
+                ? CTX_IN_MEM(const int32_t *,
+                        DNNL_ARG_ATTR_MULTIPLE_POST_OP(bgmmc.rope_idx)
+                                | DNNL_ARG_OFFSETS)
+                : nullptr;
+        rope_cos_sin_ptr_ = bgmmc.with_rope
+                ? scratchpad.template get<float>(
+                        key_brgemm_primitive_rope_cos_sin)
+                : nullptr;
+        rope_rotary_dim_ = bgmmc.with_rope
+                ? pd->attr()->post_ops_.entry_[bgmmc.rope_idx].rope.rotary_dim
+                : 0;
+
         post_ops_binary_rhs_arg_vec_ = binary_injector::prepare_binary_args(
                 pd->attr()->post_ops_, ctx);
         base_brg_ker_idx_
@@ -1289,6 +1344,14 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return ithr_bmn < parallel_work_amount_ ? ithr_bmn : -1;
     }
     int get_num_threads_for_parallelization() const { return nthr_; }
+
+    // The position of the row `m` of the batch `b` for the rope post-op.
+    dim_t get_rope_pos(int b, dim_t m) const {
+        return m + (rope_offsets_ptr_ ? rope_offsets_ptr_[b] : 0);
+    }
+    float *get_rope_cos_sin_ptr(int ithr) const {
+        return rope_cos_sin_ptr_ + ithr * rope_rotary_dim_;
+    }
     dim_t get_M() const { return M_; }
     int get_M_chunks() const { return M_chunks_; }
     int get_num_M_blocks() const { return num_M_blocks_; }
@@ -1439,6 +1502,9 @@ private:
     int32_t zero_point_b_negative_val_;
     int32_t zero_point_mixed_ab_compensation_component_;
     int32_t zero_point_c_val_;
+    const int32_t *rope_offsets_ptr_;
+    float *rope_cos_sin_ptr_;
+    dim_t rope_rotary_dim_;
     std::vector<const void *> post_ops_binary_rhs_arg_vec_;
 
     int base_brg_ker_idx_;
@@ -98,6 +98,9 @@ struct brgemm_matmul_t : public primitive_t {
     private:
         brgemm_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
+        // Attributes of the brgemm kernels: the attributes of the primitive
+        // without the rope post-op.
+        primitive_attr_t brg_attr_;
     };
 
     brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
@@ -123,6 +126,9 @@ private:
             int ithr, int b_idx, int n_blk_idx, int k_blk_idx) const;
     void maybe_reduce_partial_results_and_apply_postops(
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
+    void apply_rope(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
+            int m_blk_start, int m_blk_end, int n_blk_start,
+            int n_blk_end) const;
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
 
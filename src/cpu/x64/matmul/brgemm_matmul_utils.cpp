@@ -17,7 +17,9 @@
 #include <unordered_set>
 
 #include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
 #include "cpu/platform.hpp"
+#include "cpu/rope_utils.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 
@@ -96,7 +98,9 @@ bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr,
         const memory_desc_wrapper &dst_d) {
     using namespace injector;
 
-    const auto &post_ops = attr.post_ops_;
+    // The rope post-op is not applied by the brgemm kernels.
+    auto post_ops = attr.post_ops_;
+    if (bgmmc.with_rope) post_ops.entry_.pop_back();
     const auto ndims = dst_d.ndims();
 
     bool is_binary_po_per_oc_sp_bcast {};
@@ -578,6 +582,13 @@ size_t matmul_amx_blocking_params_t::L2_threshold() {
     return 3 * platform::get_per_core_cache_size(2) / 4;
 }
 
+// Returns whether K may be split between threads. In deterministic mode the
+// number of partial results must not depend on the number of threads, and
+// the rope post-op requires complete rows of the destination.
+bool is_k_split_allowed(const brgemm_matmul_conf_t &bgmmc) {
+    return !dnnl_thr_deterministic() && !bgmmc.with_rope;
+}
+
 void compute_blocking_heuristic_amx(const brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils,
         matmul_amx_blocking_params_t &best_blocking) {
@@ -595,6 +606,7 @@ void compute_blocking_heuristic_amx(const brgemm_matmul_conf_t &bgmmc,
     const bool runtime_dims
             = bgmmc.is_runtime_M || bgmmc.is_runtime_N || bgmmc.is_runtime_K;
     const int max_nthr_k = !runtime_dims && is_amx_xf16 && bgmmc.batch == 1
+                    && is_k_split_allowed(bgmmc)
             ? nstl::min(saturate(1, 7, bgmmc.nthr / 8), max_k_parallel_work)
             : 1;
     int iter = 0;
@@ -658,6 +670,38 @@ void compute_blocking_heuristic_amx(const brgemm_matmul_conf_t &bgmmc,
     }
 }
 
+// Returns the maximum number of threads the K dimension may be split
+// between. Splitting K is considered for problems with M and N too small to
+// occupy all the threads, like the final projections in classifier heads or
+// weights gradients. Every thread along K accumulates its chunks of K into
+// its own buffer and the buffers are summed up in a fixed order afterwards,
+// so the result does not depend on how threads are scheduled.
+int get_max_nthr_k_for_split_k(const brgemm_matmul_conf_t &bgmmc,
+        const matmul_avx512_blocking_params_t::matmul_params_t &matmul,
+        int min_m_blk, int n_blk, int k_blk) {
+    const bool runtime_dims
+            = bgmmc.is_runtime_M || bgmmc.is_runtime_N || bgmmc.is_runtime_K;
+    // The reduction of partial results does not support batched problems
+    // and compensations computed in copy routines.
+    const bool compensations_in_copy_routines
+            = bgmmc.wei_zp_type != brgemm_broadcast_t::none
+            || !IMPLICATION(bgmmc.src_zp_type != brgemm_broadcast_t::none
+                            || bgmmc.s8s8_compensation_required,
+                    bgmmc.blocked_B);
+    if (!is_k_split_allowed(bgmmc) || runtime_dims || matmul.batch != 1
+            || compensations_in_copy_routines)
+        return 1;
+
+    const int mn_work = div_up(matmul.M, min_m_blk) * div_up(matmul.N, n_blk);
+    if (mn_work >= bgmmc.nthr) return 1;
+
+    // Every thread should get at least two blocks of K for the split to pay
+    // off the reduction.
+    const int max_k_parallel_work = matmul.K / (2 * k_blk);
+    return nstl::max(1,
+            nstl::min(div_up(bgmmc.nthr, mn_work), max_k_parallel_work));
+}
+
 float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils,
         const matmul_avx512_blocking_params_t::matmul_params_t &matmul,
@@ -712,7 +756,7 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         }
 
         // Parallelize across K for shapes with big 'K' dimension
-        bool bwd_w_par_k_blk = bgmmc.batch == 1
+        bool bwd_w_par_k_blk = bgmmc.batch == 1 && is_k_split_allowed(bgmmc)
                 && bm_conf_utils.check_is_transposed(bgmmc.src_tag)
                 && IMPLICATION(bm_conf_utils.is_bf16(), math::is_pow2(matmul.K))
                 && matmul.K >= 2048;
@@ -720,6 +764,10 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
             start_nthr_k = nstl::min(nthr, 4);
             assert(k_blk == nstl::min(matmul.K, 512));
         }
+
+        start_nthr_k = nstl::max(start_nthr_k,
+                get_max_nthr_k_for_split_k(
+                        bgmmc, matmul, min_m_blk, n_blk, k_blk));
     }
 
     float best_imbalance = 1.f; // reduce
@@ -777,6 +825,9 @@ float compute_blocking_heuristic_avx2(brgemm_matmul_conf_t &bgmmc,
                     && IMPLICATION(n_chunks == 1, bgmmc.batch_ndims > 0))
                 n_blk = nstl::min(matmul.N, 32);
         }
+
+        start_nthr_k = get_max_nthr_k_for_split_k(
+                bgmmc, matmul, min_m_blk, n_blk, k_blk);
     }
 
     float best_imbalance = 1.f; // reduce
@@ -1002,6 +1053,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     const int binary_ind = p.find(primitive_kind::binary);
     const int prelu_ind = p.find(primitive_kind::prelu);
     bgmmc.with_binary = !everyone_is(-1, binary_ind, prelu_ind);
+    bgmmc.rope_idx = rope_utils::po_idx(p);
+    bgmmc.with_rope = bgmmc.rope_idx != -1;
+    VCONDCHECK_BG(p.find(primitive_kind::rope) == bgmmc.rope_idx,
+            VERBOSE_UNSUPPORTED_POSTOP);
     VCONDCHECK_BG(post_ops_ok(bgmmc, attr, dst_d), VERBOSE_UNSUPPORTED_POSTOP);
 
     bgmmc.src_zp_type = get_zp_type(attr, DNNL_ARG_SRC);
@@ -1030,6 +1085,15 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             || bgmmc.is_runtime_K)
         return status::unimplemented;
 
+    // The rope post-op rotates the final f32 values in the destination, so
+    // nothing may be applied to them after the post-ops.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_rope,
+                          bgmmc.dst_dt == f32 && !bgmmc.is_runtime_M
+                                  && !bgmmc.with_dst_scales
+                                  && bgmmc.dst_zp_type
+                                          == brgemm_broadcast_t::none),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
     // Runtime value for M dimension is supported for 2d AMX int8/bfloat16
     // problems only.
     const bool runtime_M_supported = bgmmc.is_amx && bgmmc.ndims == 2
@@ -1181,6 +1245,18 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.LDC
             = bgmmc.use_buffer_c && bgmmc.nthr_k <= 1 ? bgmmc.N_blk : bgmmc.LDD;
 
+    if (bgmmc.with_rope) {
+        // A work chunk must consist of complete heads.
+        VCONDCHECK_BG(bgmmc.nthr_k == 1, VERBOSE_UNSUPPORTED_POSTOP);
+        const auto &rope = attr.post_ops_.entry_[bgmmc.rope_idx].rope;
+        const int blks_per_heads
+                = math::lcm((int)bgmmc.N_blk, (int)rope.head_dim)
+                / (int)bgmmc.N_blk;
+        bgmmc.N_chunk_size
+                = nstl::min(rnd_up(bgmmc.N_chunk_size, blks_per_heads),
+                        (int)div_up(bgmmc.N, bgmmc.N_blk));
+    }
+
     init_aux_values(bgmmc, src_d, weights_d, dst_d);
 
     return status::success;
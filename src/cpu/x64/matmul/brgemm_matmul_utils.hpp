@@ -94,6 +94,10 @@ struct brgemm_matmul_conf_t {
     bool with_sum;
     bool with_eltwise;
     bool with_binary;
+    // The rope post-op is applied to complete rows of a work chunk after the
+    // brgemm kernels, it is the last post-op with the index `rope_idx`.
+    bool with_rope;
+    int rope_idx;
     bool with_scales;
     bool with_dst_scales;
     bool s8s8_compensation_required;
@@ -0,0 +1,433 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/matmul/jit_gemv_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+// Computes acc[m][n] = sum_k src[m][k] * wei[k][n] for all M rows of src,
+// a block of N and a chunk of K. Weights are read row by row, every row is
+// used by all the rows of src held in registers.
+struct gemv_matmul_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(gemv_matmul_kernel_t)
+
+    struct call_params_t {
+        const void *src, *wei;
+        void *acc;
+        dim_t K;
+    };
+
+    gemv_matmul_kernel_t(const jit_gemv_matmul_conf_t &conf, bool is_tail)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, avx512_core)
+        , conf_(conf)
+        , n_vecs_(is_tail ? (int)div_up(conf.N_tail, simd_w_) : conf.n_vecs)
+        , tail_size_(is_tail ? (int)(conf.N_tail % simd_w_) : 0)
+        , src_dt_size_(types::data_type_size(conf.src_dt))
+        , wei_dt_size_(types::data_type_size(conf.wei_dt)) {}
+
+    void operator()(const call_params_t *p) {
+        return jit_generator::operator()(p);
+    }
+
+private:
+    static constexpr int simd_w_ = cpu_isa_traits<avx512_core>::vlen
+            / sizeof(float);
+
+    const jit_gemv_matmul_conf_t &conf_;
+    const int n_vecs_;
+    const int tail_size_;
+    const size_t src_dt_size_;
+    const size_t wei_dt_size_;
+
+    const Reg64 reg_param_ = abi_param1;
+    const Reg64 reg_src_ = r8;
+    const Reg64 reg_wei_ = r9;
+    const Reg64 reg_acc_ = r10;
+    const Reg64 reg_K_ = r11;
+    const Reg64 reg_ldb_ = r12;
+    const Reg64 reg_wei_pf_ = r13;
+    const Reg64 reg_tmp_ = rax;
+
+    const Opmask k_tail_ = k1;
+
+    Zmm vmm_acc(int m, int v) const { return Zmm(m * 4 + v); }
+    Zmm vmm_wei(int v) const { return Zmm(16 + v); }
+    Zmm vmm_src(int m) const { return Zmm(20 + m); }
+    const Zmm vmm_tmp_ = Zmm(24);
+
+    bool is_tail_vec(int v) const {
+        return tail_size_ > 0 && v == n_vecs_ - 1;
+    }
+    Zmm maybe_mask(const Zmm &vmm, int v) const {
+        return is_tail_vec(v) ? vmm | k_tail_ | T_z : vmm;
+    }
+
+    void load_src(int m);
+    void load_wei(int v);
+    void compute_row();
+    void generate() override;
+};
+
+// Broadcasts src[m][k] converted to the accumulation data type.
+void gemv_matmul_kernel_t::load_src(int m) {
+    const Zmm vmm = vmm_src(m);
+    const int offt = (int)(m * conf_.lda * src_dt_size_);
+    switch (conf_.src_dt) {
+        case f32: vbroadcastss(vmm, ptr[reg_src_ + offt]); break;
+        case bf16:
+            vpbroadcastw(vmm, word[reg_src_ + offt]);
+            vpslld(vmm, vmm, 16);
+            break;
+        case u8:
+            movzx(reg_tmp_.cvt32(), byte[reg_src_ + offt]);
+            vpbroadcastd(vmm, reg_tmp_.cvt32());
+            break;
+        case s8:
+            movsx(reg_tmp_.cvt32(), byte[reg_src_ + offt]);
+            vpbroadcastd(vmm, reg_tmp_.cvt32());
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// Loads a vector of the current row of weights converted to the
+// accumulation data type.
+void gemv_matmul_kernel_t::load_wei(int v) {
+    const Zmm vmm = maybe_mask(vmm_wei(v), v);
+    const auto addr = ptr[reg_wei_ + (int)(v * simd_w_ * wei_dt_size_)];
+    switch (conf_.wei_dt) {
+        case f32: vmovups(vmm, addr); break;
+        case bf16:
+            vpmovzxwd(vmm, addr);
+            vpslld(vmm_wei(v), vmm_wei(v), 16);
+            break;
+        case s8: vpmovsxbd(vmm, addr); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void gemv_matmul_kernel_t::compute_row() {
+    // The part of the row of weights `pf_rows` ahead is requested from
+    // memory now, rows are too far apart for the hardware prefetcher to
+    // follow them.
+    const int row_bytes = n_vecs_ * simd_w_ * (int)wei_dt_size_;
+    for (int offt = 0; offt < row_bytes; offt += 64)
+        prefetcht0(ptr[reg_wei_pf_ + offt]);
+
+    for (int v = 0; v < n_vecs_; v++)
+        load_wei(v);
+    for (int m = 0; m < conf_.M; m++) {
+        load_src(m);
+        for (int v = 0; v < n_vecs_; v++) {
+            if (conf_.is_int8) {
+                vpmulld(vmm_tmp_, vmm_src(m), vmm_wei(v));
+                vpaddd(vmm_acc(m, v), vmm_acc(m, v), vmm_tmp_);
+            } else {
+                vfmadd231ps(vmm_acc(m, v), vmm_src(m), vmm_wei(v));
+            }
+        }
+    }
+}
+
+void gemv_matmul_kernel_t::generate() {
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+    preamble();
+
+    if (tail_size_ > 0) {
+        mov(reg_tmp_.cvt32(), (1 << tail_size_) - 1);
+        kmovw(k_tail_, reg_tmp_.cvt32());
+    }
+
+    mov(reg_src_, ptr[reg_param_ + PARAM_OFF(src)]);
+    mov(reg_wei_, ptr[reg_param_ + PARAM_OFF(wei)]);
+    mov(reg_acc_, ptr[reg_param_ + PARAM_OFF(acc)]);
+    mov(reg_K_, ptr[reg_param_ + PARAM_OFF(K)]);
+
+    const dim_t ldb_bytes = conf_.ldb * wei_dt_size_;
+    mov(reg_ldb_, ldb_bytes);
+    mov(reg_wei_pf_, conf_.pf_rows * ldb_bytes);
+    add(reg_wei_pf_, reg_wei_);
+
+    for_(int m = 0; m < conf_.M; m++)
+    for (int v = 0; v < n_vecs_; v++)
+        vpxord(vmm_acc(m, v), vmm_acc(m, v), vmm_acc(m, v));
+
+    Label k_loop, k_loop_end;
+    L(k_loop);
+    {
+        cmp(reg_K_, 0);
+        jle(k_loop_end, T_NEAR);
+
+        compute_row();
+
+        add(reg_src_, src_dt_size_);
+        add(reg_wei_, reg_ldb_);
+        add(reg_wei_pf_, reg_ldb_);
+        dec(reg_K_);
+        jmp(k_loop, T_NEAR);
+    }
+    L(k_loop_end);
+
+    // Accumulators are stored as is, f32 and s32 have the same size.
+    for_(int m = 0; m < conf_.M; m++)
+    for (int v = 0; v < n_vecs_; v++) {
+        const auto addr = ptr[reg_acc_
+                + (int)((m * conf_.N + v * simd_w_) * sizeof(float))];
+        if (is_tail_vec(v))
+            vmovups(addr | k_tail_, vmm_acc(m, v));
+        else
+            vmovups(addr, vmm_acc(m, v));
+    }
+
+    postamble();
+#undef PARAM_OFF
+}
+
+bool jit_gemv_matmul_t::pd_t::data_types_ok() const {
+    const auto src_dt = src_md()->data_type;
+    const auto wei_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+    const auto bia_dt = weights_md(1)->data_type;
+
+    switch (src_dt) {
+        case f32:
+            return everyone_is(f32, wei_dt, dst_dt)
+                    && IMPLICATION(with_bias(), bia_dt == f32);
+        case bf16:
+            return wei_dt == bf16 && one_of(dst_dt, f32, bf16)
+                    && IMPLICATION(with_bias(), one_of(bia_dt, f32, bf16));
+        case u8:
+        case s8:
+            return wei_dt == s8 && one_of(dst_dt, f32, bf16, s32, s8, u8)
+                    && IMPLICATION(with_bias(),
+                            one_of(bia_dt, f32, bf16, s32, s8, u8));
+        default: return false;
+    }
+}
+
+// Rows of src, weights and dst must be dense, the leading dimensions are
+// arbitrary.
+bool jit_gemv_matmul_t::pd_t::formats_ok() const {
+    const int nd = ndims();
+    for (const auto *md : {src_md(), weights_md(), dst_md()}) {
+        const memory_desc_wrapper mdw(md);
+        if (!mdw.is_plain() || mdw.blocking_desc().strides[nd - 1] != 1)
+            return false;
+    }
+    if (with_bias()) {
+        const memory_desc_wrapper bia_d(weights_md(1));
+        if (!is_bias_1xN() || !bia_d.is_plain()
+                || bia_d.blocking_desc().strides[nd - 1] != 1)
+            return false;
+    }
+    return true;
+}
+
+status_t jit_gemv_matmul_t::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const bool ok = mayiuse(avx512_core) && is_dense_data()
+            && !has_runtime_dims_or_strides() && batch() == 1
+            && M() <= max_M && M() > 0 && N() > 0 && K() > 0
+            && data_types_ok()
+            && attr()->has_default_values(smask_t::scales_runtime)
+            && attr_scales_ok() && set_default_formats() && formats_ok();
+    if (!ok) return status::unimplemented;
+
+    init_conf();
+    init_scratchpad();
+
+    return status::success;
+}
+
+void jit_gemv_matmul_t::pd_t::init_conf() {
+    auto &c = conf_;
+    const int nd = ndims();
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    c.src_dt = src_d.data_type();
+    c.wei_dt = wei_d.data_type();
+    c.dst_dt = dst_d.data_type();
+    c.bia_dt = with_bias() ? weights_md(1)->data_type : data_type::undef;
+    c.is_int8 = one_of(c.src_dt, u8, s8);
+    c.M = M();
+    c.N = N();
+    c.K = K();
+    c.lda = src_d.blocking_desc().strides[nd - 2];
+    c.ldb = wei_d.blocking_desc().strides[nd - 2];
+    c.ldc = dst_d.blocking_desc().strides[nd - 2];
+
+    const dim_t simd_w = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+    c.n_vecs = (int)nstl::min<dim_t>(4, div_up(c.N, simd_w));
+    c.N_blk = c.n_vecs * simd_w;
+    c.N_tail = c.N % c.N_blk;
+    c.nb_N = div_up(c.N, c.N_blk);
+
+    // Pick the smallest number of K chunks that keeps the threads busy.
+    // Chunks shorter than min_K_blk rows do not let prefetching ramp up.
+    const dim_t min_K_blk = 128;
+    const int nthr = dnnl_get_max_threads();
+    // In deterministic mode K is not split, so that the order of the
+    // accumulation does not depend on the number of threads.
+    const dim_t max_nb_K = dnnl_thr_deterministic()
+            ? 1
+            : nstl::max<dim_t>(1, nstl::min<dim_t>(nthr, c.K / min_K_blk));
+    dim_t best_nb_K = 1;
+    float best_eff = 0.f;
+    for (dim_t nb_K = 1; nb_K <= max_nb_K; nb_K++) {
+        const dim_t work = c.nb_N * nb_K;
+        const float eff = (float)work / rnd_up(work, nthr);
+        if (eff > best_eff) {
+            best_eff = eff;
+            best_nb_K = nb_K;
+        }
+        if (best_eff >= 0.9f) break;
+    }
+    c.K_blk = div_up(c.K, best_nb_K);
+    c.nb_K = div_up(c.K, c.K_blk);
+    c.nthr = (int)nstl::min<dim_t>(nthr, c.nb_N * c.nb_K);
+
+    // Far enough to hide the memory latency for a single row of src, rows
+    // are processed in a few cycles each.
+    c.pf_rows = 32;
+}
+
+void jit_gemv_matmul_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    // Partial results of every chunk of K, f32 or s32.
+    scratchpad.book<float>(
+            key_matmul_dst_in_acc_dt, conf_.nb_K * conf_.M * conf_.N);
+}
+
+jit_gemv_matmul_t::jit_gemv_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+jit_gemv_matmul_t::~jit_gemv_matmul_t() = default;
+
+status_t jit_gemv_matmul_t::init(engine_t *engine) {
+    const auto &conf = pd()->conf_;
+    CHECK(safe_ptr_assign(kernel_, new gemv_matmul_kernel_t(conf, false)));
+    CHECK(kernel_->create_kernel());
+    if (conf.N_tail > 0) {
+        CHECK(safe_ptr_assign(
+                kernel_tail_, new gemv_matmul_kernel_t(conf, true)));
+        CHECK(kernel_tail_->create_kernel());
+    }
+    return status::success;
+}
+
+status_t jit_gemv_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const auto &c = pd()->conf_;
+    const dim_t wei_scale_stride
+            = pd()->attr()->scales_.get(DNNL_ARG_WEIGHTS).mask_ == 0 ? 0 : 1;
+    const size_t src_dt_size = types::data_type_size(c.src_dt);
+    const size_t wei_dt_size = types::data_type_size(c.wei_dt);
+
+    auto acc = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_matmul_dst_in_acc_dt);
+
+    // Sums up partial results of all chunks of K in a fixed order and
+    // converts them to the destination.
+    auto finalize = [&](dim_t n_start, dim_t n_end) {
+        for_(dim_t m = 0; m < c.M; m++)
+        for (dim_t n = n_start; n < n_end; n++) {
+            float d = 0.f;
+            if (c.is_int8) {
+                const auto acc_s32 = reinterpret_cast<const int32_t *>(acc);
+                int32_t sum = 0;
+                for (dim_t kc = 0; kc < c.nb_K; kc++)
+                    sum += acc_s32[(kc * c.M + m) * c.N + n];
+                d = static_cast<float>(sum);
+            } else {
+                for (dim_t kc = 0; kc < c.nb_K; kc++)
+                    d += acc[(kc * c.M + m) * c.N + n];
+            }
+            d *= src_scales[0] * wei_scales[wei_scale_stride * n];
+            if (bias) d += io::load_float_value(c.bia_dt, bias, n);
+            d *= dst_scales[0];
+            io::store_float_value(c.dst_dt, d, dst, m * c.ldc + n);
+        }
+    };
+
+    const dim_t work_amount = c.nb_N * c.nb_K;
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t nb = iwork / c.nb_K;
+            const dim_t kc = iwork % c.nb_K;
+            const dim_t n = nb * c.N_blk;
+            const dim_t k = kc * c.K_blk;
+            const bool is_tail = c.N_tail > 0 && nb == c.nb_N - 1;
+
+            gemv_matmul_kernel_t::call_params_t p;
+            p.src = src + k * src_dt_size;
+            p.wei = weights + (k * c.ldb + n) * wei_dt_size;
+            p.acc = acc + kc * c.M * c.N + n;
+            p.K = nstl::min(c.K_blk, c.K - k);
+            (is_tail ? *kernel_tail_ : *kernel_)(&p);
+
+            if (c.nb_K == 1)
+                finalize(n, nstl::min(n + c.N_blk, c.N));
+        }
+    });
+
+    if (c.nb_K > 1) {
+        parallel_nd(c.nb_N, [&](dim_t nb) {
+            const dim_t n = nb * c.N_blk;
+            finalize(n, nstl::min(n + c.N_blk, c.N));
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
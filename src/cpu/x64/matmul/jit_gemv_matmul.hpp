@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_JIT_GEMV_MATMUL_HPP
+#define CPU_X64_MATMUL_JIT_GEMV_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct jit_gemv_matmul_conf_t {
+    data_type_t src_dt, wei_dt, dst_dt, bia_dt;
+    // s32 accumulation for int8, f32 otherwise.
+    bool is_int8;
+    dim_t M, N, K;
+    // Leading dimensions in elements.
+    dim_t lda, ldb, ldc;
+
+    // Columns of weights processed by a kernel call: n_vecs vectors.
+    int n_vecs;
+    dim_t N_blk, N_tail, nb_N;
+    // K is split between threads when there are not enough blocks of N to
+    // occupy all of them, the partial results are reduced afterwards.
+    dim_t K_blk, nb_K;
+    // Prefetch distance in rows of weights.
+    int pf_rows;
+    int nthr;
+};
+
+struct gemv_matmul_kernel_t;
+
+// Matrix-vector product for small M (up to 4 rows of src) and no batch.
+//
+// Such problems are bound by the bandwidth of reading weights, so the
+// implementation streams weights once with software prefetching, keeps the
+// rows of src in registers, and splits K across threads when N alone does
+// not provide enough parallel work.
+struct jit_gemv_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_gemv:", avx512_core, ""),
+                jit_gemv_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        static constexpr dim_t max_M = 4;
+
+        jit_gemv_matmul_conf_t conf_;
+
+    private:
+        bool data_types_ok() const;
+        bool formats_ok() const;
+        void init_conf();
+        void init_scratchpad();
+    };
+
+    jit_gemv_matmul_t(const pd_t *apd);
+    ~jit_gemv_matmul_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<gemv_matmul_kernel_t> kernel_;
+    std::unique_ptr<gemv_matmul_kernel_t> kernel_tail_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,479 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/cpu_barrier.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/rnn/jit_uni_persistent_rnn.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace memory_tracking::names;
+using namespace data_type;
+using namespace Xbyak;
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+
+template <cpu_isa_t isa>
+struct jit_uni_persistent_rnn_kernel_t : public jit_persistent_rnn_kernel_t,
+                                         public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_persistent_rnn_kernel_t);
+
+    jit_uni_persistent_rnn_kernel_t(const jit_persistent_rnn_conf_t &conf)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , conf_(conf)
+        , is_lbr_(conf.cell_kind == alg_kind::lbr_gru)
+        , tail_(conf.dhc % simd_w_) {
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(
+                this, isa, {f32}, io::io_conf_t(), io_tail_conf);
+        sigmoid_injector_ = utils::make_unique<injector_t>(this,
+                alg_kind::eltwise_logistic, 0.f, 0.f, 1.f,
+                true /*save_state*/, reg_table, Opmask(2));
+        tanh_injector_ = utils::make_unique<injector_t>(this,
+                alg_kind::eltwise_tanh, 0.f, 0.f, 1.f, true /*save_state*/,
+                reg_table, Opmask(2));
+    }
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using injector_t = jit_uni_eltwise_injector_f32<isa>;
+    static constexpr dim_t simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr size_t vlen_ = cpu_isa_traits<isa>::vlen;
+    // Gates are accumulated in two sets of registers for even and odd
+    // channels to hide the latency of FMAs.
+    static constexpr int n_acc_ = 4;
+
+    const jit_persistent_rnn_conf_t conf_;
+    const bool is_lbr_;
+    const dim_t tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    std::unique_ptr<injector_t> sigmoid_injector_;
+    std::unique_ptr<injector_t> tanh_injector_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_wei = r9;
+    const Reg64 reg_k = r10;
+    const Reg64 reg_ptr = r11;
+    const Reg64 reg_tmp = r12;
+    const Reg64 reg_nunits = r13;
+    const Reg64 reg_table = rbx;
+
+    const Vmm vmm_src0 = Vmm(8);
+    const Vmm vmm_src1 = Vmm(9);
+    const Vmm vmm_state = Vmm(10);
+    const Vmm vmm_aux = Vmm(11);
+    const Vmm vmm_tail_mask = Vmm(15);
+    const int tail_opmask_idx = 1;
+
+    Vmm vmm_acc(int set, int i) const { return Vmm(set * n_acc_ + i); }
+
+    // For linear-before-reset GRU the iteration part of the last gate is
+    // kept separately, as it is scaled by the reset gate.
+    int acc_idx(int gate, bool is_iter) const {
+        return is_lbr_ && is_iter && gate == 2 ? 3 : gate;
+    }
+
+    void fma_channel(int set, const Vmm &src, int k_off, bool is_iter) {
+        for (int g = 0; g < conf_.n_gates; g++)
+            uni_vfmadd231ps(vmm_acc(set, acc_idx(g, is_iter)), src,
+                    ptr[reg_wei + (k_off * conf_.n_gates + g) * vlen_]);
+    }
+
+    // Accumulates `src[0:K] x weights[0:K][gates]`, advances `reg_wei` past
+    // the weights.
+    void accumulate(dim_t K, bool is_iter) {
+        const size_t wei_k_stride = conf_.n_gates * vlen_;
+
+        Label loop, loop_end;
+        mov(reg_k, K / 2);
+        test(reg_k, reg_k);
+        jz(loop_end, T_NEAR);
+        L(loop);
+        {
+            uni_vbroadcastss(vmm_src0, ptr[reg_src]);
+            uni_vbroadcastss(vmm_src1, ptr[reg_src + sizeof(float)]);
+            fma_channel(0, vmm_src0, 0, is_iter);
+            fma_channel(1, vmm_src1, 1, is_iter);
+            add(reg_src, 2 * sizeof(float));
+            add(reg_wei, 2 * wei_k_stride);
+            dec(reg_k);
+            jnz(loop, T_NEAR);
+        }
+        L(loop_end);
+
+        if (K % 2) {
+            uni_vbroadcastss(vmm_src0, ptr[reg_src]);
+            fma_channel(0, vmm_src0, 0, is_iter);
+            add(reg_wei, wei_k_stride);
+        }
+    }
+
+    // c_t = G1 * c_{t-1} + G0 * G2, h_t = G3 * tanh(c_t)
+    void lstm_elemwise(bool tail) {
+        const Vmm G0 = vmm_acc(0, 0), G1 = vmm_acc(0, 1), G2 = vmm_acc(0, 2),
+                  G3 = vmm_acc(0, 3);
+        sigmoid_injector_->compute_vector_range(
+                {size_t(G0.getIdx()), size_t(G1.getIdx()),
+                        size_t(G3.getIdx())});
+        tanh_injector_->compute_vector(G2.getIdx());
+
+        mov(reg_ptr, ptr[reg_param + PARAM_OFF(c_prev)]);
+        io_[f32]->load(ptr[reg_ptr], vmm_state, tail);
+        uni_vmulps(vmm_state, vmm_state, G1);
+        uni_vfmadd231ps(vmm_state, G0, G2);
+        mov(reg_ptr, ptr[reg_param + PARAM_OFF(c_dst)]);
+        io_[f32]->store(vmm_state, ptr[reg_ptr], tail);
+
+        uni_vmovups(vmm_aux, vmm_state);
+        tanh_injector_->compute_vector(vmm_aux.getIdx());
+        uni_vmulps(vmm_aux, vmm_aux, G3);
+        mov(reg_ptr, ptr[reg_param + PARAM_OFF(dst)]);
+        io_[f32]->store(vmm_aux, ptr[reg_ptr], tail);
+    }
+
+    // G2 = tanh(W2 x + b2 + G1 * (U2 h + b3)), h_t = G2 + G0 * (h_{t-1} - G2)
+    void lbr_gru_elemwise(bool tail) {
+        const Vmm G0 = vmm_acc(0, 0), G1 = vmm_acc(0, 1), G2 = vmm_acc(0, 2),
+                  U2 = vmm_acc(0, 3);
+        sigmoid_injector_->compute_vector_range(
+                {size_t(G0.getIdx()), size_t(G1.getIdx())});
+        uni_vfmadd231ps(G2, G1, U2);
+        tanh_injector_->compute_vector(G2.getIdx());
+
+        mov(reg_ptr, ptr[reg_param + PARAM_OFF(h_prev)]);
+        io_[f32]->load(ptr[reg_ptr], vmm_state, tail);
+        uni_vsubps(vmm_state, vmm_state, G2);
+        uni_vfmadd231ps(G2, G0, vmm_state);
+        mov(reg_ptr, ptr[reg_param + PARAM_OFF(dst)]);
+        io_[f32]->store(G2, ptr[reg_ptr], tail);
+    }
+
+    void elemwise(bool tail) {
+        if (is_lbr_)
+            lbr_gru_elemwise(tail);
+        else
+            lstm_elemwise(tail);
+    }
+
+    void generate() override {
+        preamble();
+
+        if (tail_) io_.prepare_tail_mask();
+
+        for_(int set = 0; set < 2; set++)
+        for (int i = 0; i < n_acc_; i++)
+            uni_vpxor(vmm_acc(set, i), vmm_acc(set, i), vmm_acc(set, i));
+
+        mov(reg_wei, ptr[reg_param + PARAM_OFF(weights)]);
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src_layer)]);
+        accumulate(conf_.slc, false);
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src_iter)]);
+        accumulate(conf_.sic, true);
+
+        // `reg_wei` points to the bias now.
+        for (int i = 0; i < n_acc_; i++) {
+            uni_vaddps(vmm_acc(0, i), vmm_acc(0, i), vmm_acc(1, i));
+            if (i < conf_.n_bias)
+                uni_vaddps(vmm_acc(0, i), vmm_acc(0, i),
+                        ptr[reg_wei + i * vlen_]);
+        }
+
+        if (tail_) {
+            Label tail, end;
+            mov(reg_nunits, ptr[reg_param + PARAM_OFF(nunits)]);
+            cmp(reg_nunits, simd_w_);
+            jl(tail, T_NEAR);
+            elemwise(false);
+            jmp(end, T_NEAR);
+            L(tail);
+            elemwise(true);
+            L(end);
+        } else
+            elemwise(false);
+
+        postamble();
+
+        sigmoid_injector_->prepare_table();
+        tanh_injector_->prepare_table();
+    }
+};
+
+#undef PARAM_OFF
+
+jit_persistent_rnn_kernel_t *jit_persistent_rnn_kernel_t::create(
+        const jit_persistent_rnn_conf_t &conf, cpu_isa_t isa) {
+    if (isa == avx512_core)
+        return new jit_uni_persistent_rnn_kernel_t<avx512_core>(conf);
+    else if (isa == avx2)
+        return new jit_uni_persistent_rnn_kernel_t<avx2>(conf);
+    assert(!"kernel is empty.");
+    return nullptr;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_persistent_rnn_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace utils;
+
+    const bool ok = mayiuse(isa) && dnnl_thr_syncable()
+            && desc()->prop_kind == prop_kind::forward_inference
+            && one_of(cell_kind(), alg_kind::vanilla_lstm, alg_kind::lbr_gru)
+            && one_of(direction(), dnnl_unidirectional_left2right,
+                    dnnl_unidirectional_right2left)
+            && !is_lstm_peephole() && !is_lstm_projection() && with_bias()
+            && SIC() == DHC() && MB() <= max_mb
+            && attr()->has_default_values()
+            && set_default_params() == status::success;
+    if (!ok) return status::unimplemented;
+
+    for (const memory_desc_t *md :
+            {src_md(0), src_md(1), src_md(2), weights_md(0), weights_md(1),
+                    weights_md(2), dst_md(0), dst_md(1), dst_md(2)})
+        if (!types::is_zero_md(md) && md->data_type != f32)
+            return status::unimplemented;
+
+    if (!layouts_ok()) return status::unimplemented;
+
+    conf_.cell_kind = cell_kind();
+    conf_.slc = SLC();
+    conf_.sic = SIC();
+    conf_.dhc = DHC();
+    conf_.n_gates = static_cast<int>(G());
+    conf_.n_bias = conf_.n_gates + is_lbr();
+
+    n_blocks_ = div_up(DHC(), simd_w);
+    block_size_ = ((SLC() + SIC()) * G() + conf_.n_bias) * simd_w;
+    nthr_ = static_cast<int>(
+            nstl::min<dim_t>(dnnl_get_max_threads(), n_blocks_));
+
+    // The weights of a thread are to stay in its L2 for all time steps.
+    const size_t wei_per_thr_size
+            = div_up(n_blocks_, nthr_) * block_size_ * sizeof(float);
+    if (wei_per_thr_size > platform::get_per_core_cache_size(2))
+        return status::unimplemented;
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+bool jit_uni_persistent_rnn_fwd_t<isa>::pd_t::layouts_ok() {
+    using namespace format_tag;
+
+    for (memory_desc_t *md : {&weights_layer_md_, &weights_iter_md_})
+        if (md->format_kind == format_kind::any
+                && memory_desc_init_by_tag(*md, ldigo) != status::success)
+            return false;
+
+    const auto matches = [](const memory_desc_t *md, format_tag_t tag) {
+        return types::is_zero_md(md)
+                || memory_desc_wrapper(md).matches_tag(tag);
+    };
+    return matches(src_md(0), tnc) && matches(dst_md(0), tnc)
+            && matches(src_md(1), ldnc) && matches(src_md(2), ldnc)
+            && matches(dst_md(1), ldnc) && matches(dst_md(2), ldnc)
+            && matches(weights_md(0), ldigo) && matches(weights_md(1), ldigo)
+            && matches(weights_md(2), ldgo);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_persistent_rnn_fwd_t<isa>::pd_t::init_scratchpad() {
+    const dim_t state_size = MB() * DHC();
+    // Outputs of intermediate layers alternate between two buffers.
+    layer_ws_off_ = 0;
+    c_ws_off_ = layer_ws_off_ + (L() > 1 ? 2 * T() * state_size : 0);
+    zero_off_ = c_ws_off_ + (is_lstm() ? state_size : 0);
+    const dim_t states_size = zero_off_ + state_size;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_rnn_persistent_weights, n_blocks_ * block_size_);
+    scratchpad.template book<float>(key_rnn_persistent_states, states_size);
+    scratchpad.template book<simple_barrier::ctx_t>(key_barrier, 1);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_persistent_rnn_fwd_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, jit_persistent_rnn_kernel_t::create(pd()->conf_, isa)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+void jit_uni_persistent_rnn_fwd_t<isa>::pack_weights(float *wei, dim_t l,
+        dim_t b_s, dim_t b_e, const float *weights_layer,
+        const float *weights_iter, const float *bias) const {
+    const auto &conf = pd()->conf_;
+    const dim_t G = conf.n_gates;
+    const dim_t DHC = conf.dhc;
+
+    for (dim_t b = b_s; b < b_e; b++) {
+        const dim_t u = b * simd_w;
+        const dim_t nu = nstl::min(simd_w, DHC - u);
+        float *p = wei + b * pd()->block_size_;
+
+        const auto pack_row = [&](const float *src) {
+            for (dim_t i = 0; i < nu; i++)
+                p[i] = src[u + i];
+            for (dim_t i = nu; i < simd_w; i++)
+                p[i] = 0.f;
+            p += simd_w;
+        };
+        const auto pack = [&](const float *w, dim_t K) {
+            for_(dim_t k = 0; k < K; k++)
+            for (dim_t g = 0; g < G; g++)
+                pack_row(w + (k * G + g) * DHC);
+        };
+        pack(weights_layer + l * conf.slc * G * DHC, conf.slc);
+        pack(weights_iter + l * conf.sic * G * DHC, conf.sic);
+        for (dim_t i = 0; i < conf.n_bias; i++)
+            pack_row(bias + (l * conf.n_bias + i) * DHC);
+    }
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_persistent_rnn_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto src_layer = CTX_IN_MEM(const float *, DNNL_ARG_SRC_LAYER);
+    const auto src_iter = CTX_IN_MEM(const float *, DNNL_ARG_SRC_ITER);
+    const auto src_iter_c = CTX_IN_MEM(const float *, DNNL_ARG_SRC_ITER_C);
+    const auto weights_layer
+            = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS_LAYER);
+    const auto weights_iter = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS_ITER);
+    const auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst_layer = CTX_OUT_MEM(float *, DNNL_ARG_DST_LAYER);
+    auto dst_iter = CTX_OUT_MEM(float *, DNNL_ARG_DST_ITER);
+    auto dst_iter_c = CTX_OUT_MEM(float *, DNNL_ARG_DST_ITER_C);
+
+    const auto pd_ = pd();
+    const bool is_lstm = pd_->is_lstm();
+    const bool is_l2r = pd_->direction() == dnnl_unidirectional_left2right;
+    const dim_t T = pd_->T(), MB = pd_->MB(), L = pd_->L();
+    const dim_t SLC = pd_->SLC(), DHC = pd_->DHC();
+    const dim_t state_size = MB * DHC;
+    const dim_t n_blocks = pd_->n_blocks_;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *const wei_global
+            = scratchpad.template get<float>(key_rnn_persistent_weights);
+    float *const states
+            = scratchpad.template get<float>(key_rnn_persistent_states);
+    auto bctx = scratchpad.template get<simple_barrier::ctx_t>(key_barrier);
+    simple_barrier::ctx_init(bctx);
+
+    const float *const zero = states + pd_->zero_off_;
+    utils::array_set(states + pd_->zero_off_, 0.f, state_size);
+    float *const c_ws = states + pd_->c_ws_off_;
+    float *const layer_ws = states + pd_->layer_ws_off_;
+    const auto layer_out = [&](dim_t l) {
+        return l == L - 1 ? dst_layer : layer_ws + (l % 2) * T * state_size;
+    };
+
+    parallel(pd_->nthr_, [&](const int ithr, const int nthr) {
+        dim_t b_s {0}, b_e {0};
+        balance211(n_blocks, nthr, ithr, b_s, b_e);
+        const dim_t u_s = nstl::min(DHC, b_s * simd_w);
+        const dim_t u_e = nstl::min(DHC, b_e * simd_w);
+
+        jit_persistent_rnn_kernel_t::call_params_t p;
+        for (dim_t l = 0; l < L; l++) {
+            // Only the blocks of the thread are packed, so no barrier is
+            // needed before they are used.
+            pack_weights(
+                    wei_global, l, b_s, b_e, weights_layer, weights_iter, bias);
+
+            const float *const src = l == 0 ? src_layer : layer_out(l - 1);
+            const dim_t src_ld = l == 0 ? SLC : DHC;
+            float *const dst = layer_out(l);
+
+            for (dim_t step = 0; step < T; step++) {
+                const dim_t t = is_l2r ? step : T - 1 - step;
+                const dim_t t_prev = is_l2r ? t - 1 : t + 1;
+                const float *const h_prev = step > 0
+                        ? dst + t_prev * state_size
+                        : (src_iter ? src_iter + l * state_size : zero);
+                // The cell state of the thread units is updated in place.
+                const float *const c_prev = step > 0
+                        ? c_ws
+                        : (src_iter_c ? src_iter_c + l * state_size : zero);
+
+                for_(dim_t b = b_s; b < b_e; b++)
+                for (dim_t n = 0; n < MB; n++) {
+                    const dim_t u = b * simd_w;
+                    p.src_layer = src + (t * MB + n) * src_ld;
+                    p.src_iter = h_prev + n * DHC;
+                    p.weights = wei_global + b * pd_->block_size_;
+                    p.h_prev = p.src_iter + u;
+                    p.c_prev = is_lstm ? c_prev + n * DHC + u : nullptr;
+                    p.dst = dst + (t * MB + n) * DHC + u;
+                    p.c_dst = is_lstm ? c_ws + n * DHC + u : nullptr;
+                    p.nunits = nstl::min(simd_w, DHC - u);
+                    (*kernel_)(&p);
+                }
+
+                if (step == T - 1 && u_e > u_s) {
+                    for (dim_t n = 0; n < MB; n++) {
+                        const dim_t off = n * DHC + u_s;
+                        if (dst_iter)
+                            utils::array_copy(dst_iter + l * state_size + off,
+                                    dst + t * state_size + off, u_e - u_s);
+                        if (dst_iter_c && is_lstm)
+                            utils::array_copy(
+                                    dst_iter_c + l * state_size + off,
+                                    c_ws + off, u_e - u_s);
+                    }
+                }
+
+                // The next step reads the hidden state of all units.
+                simple_barrier::barrier(bctx, nthr);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_persistent_rnn_fwd_t<avx512_core>;
+template struct jit_uni_persistent_rnn_fwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
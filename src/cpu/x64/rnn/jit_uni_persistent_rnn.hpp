@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_RNN_JIT_UNI_PERSISTENT_RNN_HPP
+#define CPU_X64_RNN_JIT_UNI_PERSISTENT_RNN_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/rnn/cpu_rnn_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_persistent_rnn_conf_t {
+    alg_kind_t cell_kind;
+    dim_t slc;
+    dim_t sic;
+    dim_t dhc;
+    int n_gates;
+    int n_bias;
+};
+
+// Computes a block of `simd_w` hidden units of one cell for one row of the
+// minibatch: the gates are accumulated from packed weights of the block and
+// the cell elementwise part is applied in registers.
+//
+// The packed weights of a block are
+//   weights_layer[slc][n_gates][simd_w], weights_iter[sic][n_gates][simd_w],
+//   bias[n_bias][simd_w],
+// where the hidden units beyond `dhc` are zero.
+struct jit_persistent_rnn_kernel_t {
+    struct call_params_t {
+        const float *src_layer;
+        const float *src_iter;
+        const float *weights;
+        // Previous hidden and cell states at the first unit of the block.
+        const float *h_prev;
+        const float *c_prev;
+        float *dst;
+        float *c_dst;
+        size_t nunits;
+    };
+
+    static jit_persistent_rnn_kernel_t *create(
+            const jit_persistent_rnn_conf_t &conf, cpu_isa_t isa);
+    virtual ~jit_persistent_rnn_kernel_t() = default;
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+};
+
+// Forward inference of a unidirectional LSTM or linear-before-reset GRU for
+// small minibatches. Every thread owns a range of hidden units of all gates,
+// so the elementwise part of a cell needs no data of other threads. The
+// weights of the units are packed once per layer into a thread-local buffer
+// which stays in L2 for all time steps, and threads synchronize with a single
+// barrier per time step.
+template <cpu_isa_t isa>
+struct jit_uni_persistent_rnn_fwd_t : public primitive_t {
+    struct pd_t : public cpu_rnn_fwd_pd_t {
+        using cpu_rnn_fwd_pd_t::cpu_rnn_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_persistent:", isa, ""),
+                jit_uni_persistent_rnn_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_persistent_rnn_conf_t conf_;
+        int nthr_ = 0;
+        dim_t n_blocks_ = 0;
+        // Size of the packed weights of a block of hidden units, in floats.
+        dim_t block_size_ = 0;
+        // Offsets of the layer outputs, the cell state and the zero state in
+        // the states scratchpad buffer, in floats.
+        dim_t layer_ws_off_ = 0;
+        dim_t c_ws_off_ = 0;
+        dim_t zero_off_ = 0;
+
+    private:
+        bool layouts_ok();
+        void init_scratchpad();
+    };
+
+    jit_uni_persistent_rnn_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    // The implementation targets latency-bound inference.
+    static constexpr dim_t max_mb = 16;
+    static constexpr dim_t simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void pack_weights(float *wei, dim_t l, dim_t b_s, dim_t b_e,
+            const float *weights_layer, const float *weights_iter,
+            const float *bias) const;
+
+    std::unique_ptr<jit_persistent_rnn_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
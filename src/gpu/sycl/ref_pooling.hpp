@@ -52,6 +52,7 @@ struct ref_pooling_fwd_t : public sycl_gpu_primitive_t {
             const memory_desc_wrapper ws_d(workspace_md(0));
 
             const bool ok = is_fwd() && set_default_params() == status::success
+                    && !is_adaptive()
                     && (src_md(0)->format_desc.blocking.inner_nblks == 0)
                     && (utils::everyone_is(
                                 s8, src_md(0)->data_type, dst_md(0)->data_type)
@@ -105,6 +106,7 @@ struct ref_pooling_bwd_t : public sycl_gpu_primitive_t {
             const memory_desc_wrapper ws_d(workspace_md(0));
 
             const bool ok = !is_fwd() && set_default_params() == status::success
+                    && !is_adaptive()
                     && (utils::everyone_is(f32, diff_src_md(0)->data_type,
                                 diff_dst_md(0)->data_type)
                             || utils::everyone_is(bf16,
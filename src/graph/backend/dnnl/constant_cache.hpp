@@ -30,6 +30,10 @@
 
 #include "graph/backend/dnnl/common.hpp"
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/huge_pages.hpp"
+#endif
+
 #include "oneapi/dnnl/dnnl.hpp"
 
 #ifdef _WIN32
@@ -47,6 +51,13 @@ struct constant_buffer_t {
         : size_(size), p_engine_(p_engine), alc_(alc) {
         data_ = dnnl_allocator_t::malloc(
                 size, p_engine, alc, allocator_t::mem_type_t::persistent);
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+        // Cached constant buffers (e.g. packed weights) are long-lived and
+        // read on every execution, so they benefit from huge pages the most.
+        if (p_engine.get_kind() == dnnl::engine::kind::cpu)
+            dnnl::impl::cpu::advise_huge_pages(data_, size);
+#endif
         const_cast<allocator_t *>(alc)->retain();
     }
 
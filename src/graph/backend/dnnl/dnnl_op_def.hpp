@@ -1048,6 +1048,27 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_reorder, 1,
                         executable_creator<reorder_executable_t>)
                 .SET_ARG_INDICES_GETTER(reorder_executable_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_embedding_bag, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(2)
+                .set_input(0, "input")
+                .set_input(1, "indices")
+                .set_input(2, "offsets")
+                .set_input(3, "per_sample_weights")
+                .set_output(0, "output")
+                .set_output(1, "scratchpad")
+                // New added attributes
+                .set_attr(op_attr::alg_kind, true, attribute_kind::i)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_embedding_bag_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_embedding_bag)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<embedding_bag_executable_t>)
+                .SET_ARG_INDICES_GETTER(embedding_bag_executable_t))
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
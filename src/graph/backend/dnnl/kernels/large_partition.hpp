@@ -284,6 +284,12 @@ public:
             mem_offkey.first.set_data_handle(
                     var_grantor.get(mem_offkey.second));
         }
+
+        for (const auto &mem_view : res->get_mems_use_views()) {
+            mem_view.mem_.set_data_handle(
+                    static_cast<char *>(mem_view.base_.get_data_handle())
+                    + mem_view.offset_);
+        }
     }
 
     status_t execute_impl(const stream_t *g_stream,
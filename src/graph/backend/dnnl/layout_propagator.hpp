@@ -87,6 +87,7 @@ DECLARE_LAYOUT_PROPAGATOR(sum);
 DECLARE_LAYOUT_PROPAGATOR(softmax);
 DECLARE_LAYOUT_PROPAGATOR(softmax_bwd);
 DECLARE_LAYOUT_PROPAGATOR(reduction);
+DECLARE_LAYOUT_PROPAGATOR(embedding_bag);
 DECLARE_LAYOUT_PROPAGATOR(constant_filler);
 DECLARE_LAYOUT_PROPAGATOR(sub_zps);
 DECLARE_LAYOUT_PROPAGATOR(add_zps);
@@ -1082,19 +1082,26 @@ concat_executable_t::desc_t concat_executable_t::create_desc(
     }
     prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
 
+    const auto tmp_desc = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+    auto dst = memory::desc {tmp_desc.get_dims(), tmp_desc.get_data_type(),
+            get_forced_format_tag(tmp_desc.get_dims())};
+
     std::vector<memory::desc> src_mds;
     src_mds.reserve(op->num_inputs());
     for (const auto &in_val : op->get_input_values()) {
-        const auto tmp_desc
+        const auto in_desc
                 = make_dnnl_memory_desc(in_val->get_logical_tensor());
+        // Inputs placed into the dst buffer by memory planner are views of
+        // dst, keep their strides so that concat can skip them.
+        if (is_plain(in_desc) && in_desc.get_strides() == dst.get_strides()) {
+            src_mds.emplace_back(in_desc);
+            continue;
+        }
         src_mds.emplace_back(
-                memory::desc {tmp_desc.get_dims(), tmp_desc.get_data_type(),
-                        get_forced_format_tag(tmp_desc.get_dims())});
+                memory::desc {in_desc.get_dims(), in_desc.get_data_type(),
+                        get_forced_format_tag(in_desc.get_dims())});
     }
-    const auto tmp_desc = make_dnnl_memory_desc(
-            op->get_output_value(0)->get_logical_tensor());
-    auto dst = memory::desc {tmp_desc.get_dims(), tmp_desc.get_data_type(),
-            get_forced_format_tag(tmp_desc.get_dims())};
 
     dnnl::concat::primitive_desc pd(
             p_engine, dst, static_cast<int>(axis), src_mds, prm_attr);
@@ -1489,6 +1496,49 @@ reduction_executable_t::desc_t reduction_executable_t::create_desc(
     return {pd, false};
 }
 
+embedding_bag_executable_t::desc_t embedding_bag_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    UNUSED(mgr);
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<dnnl::embedding_bag::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+
+    dnnl::primitive_attr prm_attr;
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+    const algorithm alg = static_cast<dnnl::algorithm>(
+            op->get_attr<int64_t>(op_attr::alg_kind));
+
+    auto src = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto indices = make_dnnl_memory_desc(
+            op->get_input_value(1)->get_logical_tensor());
+    auto offsets = make_dnnl_memory_desc(
+            op->get_input_value(2)->get_logical_tensor());
+    auto dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+    dst = to_format_any(dst);
+
+    dnnl::embedding_bag::primitive_desc pd;
+    if (op->num_inputs() > 3) {
+        auto weights = make_dnnl_memory_desc(
+                op->get_input_value(3)->get_logical_tensor());
+        pd = dnnl::embedding_bag::primitive_desc(p_engine, alg, src, indices,
+                offsets, weights, dst, prm_attr);
+    } else {
+        pd = dnnl::embedding_bag::primitive_desc(
+                p_engine, alg, src, indices, offsets, dst, prm_attr);
+    }
+
+    pd_cache.insert({op.get(), pd});
+
+    return {pd, false};
+}
+
 reorder_executable_t::desc_t reorder_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
@@ -1879,6 +1929,26 @@ arg_indices_t reduction_executable_t::get_arg_indices(
     return get_arg_indices_for_siso_op(op, mgr);
 }
 
+arg_indices_t embedding_bag_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(mgr);
+    arg_indices_t arg_indices;
+
+    // add input args
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_INDICES, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_OFFSETS, indices_t {input, 2}});
+    if (op->num_inputs() > 3) {
+        arg_indices.insert({DNNL_ARG_WEIGHTS, indices_t {input, 3}});
+    }
+
+    // add output args
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 1}});
+
+    return arg_indices;
+}
+
 arg_indices_t resampling_executable_t::get_arg_indices(
         const op_t *op, fusion_info_mgr_t &mgr) {
     return get_arg_indices_for_siso_op(op, mgr);
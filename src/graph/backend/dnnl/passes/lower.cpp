@@ -189,6 +189,27 @@ static status_t reduction_handler(
     return status::success;
 }
 
+static status_t embedding_bag_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    const auto &mode = op->get_attr<std::string>(op_attr::mode);
+    dnnl::algorithm alg = dnnl::algorithm::undef;
+    if (mode == "sum")
+        alg = dnnl::algorithm::embedding_bag_sum;
+    else if (mode == "mean")
+        alg = dnnl::algorithm::embedding_bag_mean;
+    else if (mode == "max")
+        alg = dnnl::algorithm::embedding_bag_max;
+    else
+        return status::unimplemented;
+
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_embedding_bag);
+    new_op->set_attr<int64_t>(op_attr::alg_kind, static_cast<int64_t>(alg));
+
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
 static status_t reorder_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
     auto new_op = std::make_shared<op_t>(op_kind::dnnl_reorder);
@@ -645,6 +666,8 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         ITEM(ReduceMin, reduction_handler),
         ITEM(ReduceProd, reduction_handler),
         ITEM(ReduceSum, reduction_handler),
+        // embedding bag
+        ITEM(EmbeddingBag, embedding_bag_handler),
         // softplus
         ITEM(SoftPlus, softplus_handler),
         ITEM(SoftPlusBackward, softplus_handler),
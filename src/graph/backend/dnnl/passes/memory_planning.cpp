@@ -26,6 +26,7 @@
 
 #include "graph/backend/dnnl/common.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
+#include "graph/backend/dnnl/utils.hpp"
 
 #include "graph/backend/dnnl/passes/constant_propagation.hpp"
 #include "graph/backend/dnnl/passes/memory_planning.hpp"
@@ -204,6 +205,14 @@ std::shared_ptr<execution_args_set_t> execution_args_set_t::clone() const {
                 mem_offkey.second);
     }
 
+    ret->mems_use_views_.reserve(mems_use_views_.size());
+    for (const auto &mem_view : mems_use_views_) {
+        ret->mems_use_views_.push_back(
+                {ret->value_mem_map_.at(find_val(mem_view.mem_)),
+                        ret->value_mem_map_.at(find_val(mem_view.base_)),
+                        mem_view.offset_});
+    }
+
     ret->topo_ordered_exec_args_.reserve(topo_ordered_exec_args_.size());
     for (const auto &args : topo_ordered_exec_args_) {
         std::unordered_map<int, memory> new_args;
@@ -223,6 +232,7 @@ void execution_args_set_t::clear() {
     mems_use_external_outputs_.clear();
     mems_use_internal_temporary_.clear();
     mems_use_internal_persistent_.clear();
+    mems_use_views_.clear();
     value_mem_map_.clear();
     topo_ordered_exec_args_.clear();
 }
@@ -380,6 +390,11 @@ status_t memory_planner_t::assign_external_outputs_buffer(
                         q.push(alias);
                     }
 
+                    // push the views to queue for next visit
+                    for (const auto &view : views_) {
+                        if (view.second.base_ == cur_val) q.push(view.first);
+                    }
+
                     // push the inplaced input to queue for next visit
                     auto &producer = cur_val->get_producer();
                     auto op_inplace_pairs = get_op_inplace_pairs(producer, mgr);
@@ -490,7 +505,7 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
                         = temporary_buffer_ref_count[info.index_] == 1;
                 if (reuse_in_buffer) {
                     value_t *out = op->get_output_value(pair.out_idx_).get();
-                    if (!buffer_assignments_.count(out)) {
+                    if (!buffer_assignments_.count(out) && !views_.count(out)) {
                         buffer_assignments_.insert(std::make_pair(out, info));
                         temporary_buffer_ref_count[info.index_]
                                 += edge_ref_count.at(out);
@@ -504,6 +519,29 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             // already assigned buffer, skip it
             if (buffer_assignments_.count(out.get())) continue;
 
+            // this output is a view into the buffer of a concat output. The
+            // buffer is alive since the first view is written, so allocate
+            // it here if it hasn't been allocated yet
+            auto view_pos = views_.find(out.get());
+            if (view_pos != views_.end()) {
+                auto base = const_cast<value_t *>(view_pos->second.base_);
+                if (!buffer_assignments_.count(base)) {
+                    size_t idx = temporary_buffer_assigner_.request(
+                            make_dnnl_memory_desc(base->get_logical_tensor())
+                                    .get_size());
+                    buffer_assignments_.insert(std::make_pair(
+                            base, assign_info_t(internal_temporary, idx)));
+                    temporary_buffer_ref_count[idx] = edge_ref_count.at(base);
+                }
+                assign_info_t info = buffer_assignments_.at(base);
+                buffer_assignments_.insert(std::make_pair(out.get(), info));
+                if (info.kind_ == internal_temporary) {
+                    temporary_buffer_ref_count[info.index_]
+                            += edge_ref_count.at(out.get());
+                }
+                continue;
+            }
+
             // this output need a new buffer, record it
             auto lt = out->get_logical_tensor();
             size_t idx = temporary_buffer_assigner_.request(
@@ -686,6 +724,8 @@ status_t memory_planner_t::prepare_execution_args_set(
     status_t ret;
 
     auto classify_mem = [&, this](const dnnl::memory &mem, const value_t *val) {
+        // the data handle of views is derived from their base memory
+        if (views_.count(val)) return;
         const assign_info_t &info = buffer_assignments_.at(val);
         switch (info.kind_) {
             case external_input:
@@ -730,6 +770,16 @@ status_t memory_planner_t::prepare_execution_args_set(
     });
     if (ret != status::success) return ret;
 
+    for (const auto &view : views_) {
+        dnnl::memory mem, base_mem;
+        if (!exec_args_set_.find_value_mem_map(
+                    const_cast<value_t *>(view.first), mem)
+                || !exec_args_set_.find_value_mem_map(
+                        const_cast<value_t *>(view.second.base_), base_mem))
+            return status::invalid_arguments;
+        exec_args_set_.add_mem_use_view({mem, base_mem, view.second.offset_});
+    }
+
     // construct the dnnl execution args for each op
     ret = topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
         const op_schema_t *opm
@@ -776,9 +826,81 @@ status_t memory_planner_t::prepare_execution_args_set(
     return ret;
 }
 
+// Place the inputs of concat ops into the slices of the concat output buffer,
+// so that their producers write the concat result directly. Since the slice of
+// a plain tensor along the concat axis is a strided tensor starting at a fixed
+// offset, an input can be placed there when:
+// - the concat output has a plain layout,
+// - the input is produced by a reorder-based op (which supports any strided
+//   output) and is consumed by the concat only.
+// The strides of such inputs are changed to the ones of the concat output, and
+// the cached pds of the producers and the concat are dropped so that they will
+// be created with the new layout. The concat primitive skips the inputs that
+// are already in place.
+status_t memory_planner_t::prepare_concat_views(
+        std::shared_ptr<subgraph_t> &sg) {
+    // views are created with pointer arithmetic on the data handles
+    if (sg->p_engine_->get_kind() != dnnl::engine::kind::cpu)
+        return status::success;
+
+    const static std::set<op_kind_t> producer_kinds {
+            op_kind::dnnl_reorder, op_kind::dnnl_mul_scales};
+    auto is_constant_op = [](const op_t &op) {
+        return op.has_attr(op_attr::is_constant)
+                && op.get_attr<bool>(op_attr::is_constant);
+    };
+
+    const auto sg_outs = sg->get_output_values();
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_concat
+                || is_constant_op(*cur_op))
+            continue;
+
+        value_t *dst = cur_op->get_output_value(0).get();
+        const auto dst_md = make_dnnl_memory_desc(dst->get_logical_tensor());
+        if (!is_plain(dst_md)) continue;
+
+        const auto res = utils::try_reverse_axis(
+                cur_op->get_attr<int64_t>(op_attr::axis), dst_md.get_ndims());
+        if (!res.first) continue;
+        const auto axis = res.second;
+        const auto &dst_strides = dst_md.get_strides();
+        const size_t axis_stride = static_cast<size_t>(dst_strides[axis])
+                * memory::data_type_size(dst_md.get_data_type());
+
+        bool has_views = false;
+        size_t offset = 0;
+        for (auto &in : cur_op->get_input_values()) {
+            const auto in_md = make_dnnl_memory_desc(in->get_logical_tensor());
+            const size_t in_offset = offset;
+            offset += static_cast<size_t>(in_md.get_dims()[axis]) * axis_stride;
+
+            if (!in->has_producer()) continue;
+            op_t &producer = in->get_producer();
+            const bool ok = producer_kinds.count(producer.get_kind())
+                    && !is_constant_op(producer)
+                    && in->get_consumers().size() == 1
+                    && std::find(sg_outs.begin(), sg_outs.end(), in.get())
+                            == sg_outs.end()
+                    && alias_analyzer_.get_all_aliases(in.get()).empty()
+                    && in_md.get_data_type() == dst_md.get_data_type()
+                    && is_plain(in_md) && !views_.count(in.get());
+            if (!ok) continue;
+
+            in->set_strides(dst_strides);
+            views_.insert({in.get(), view_info_t {dst, in_offset}});
+            sg->pd_cache_.erase(&producer);
+            has_views = true;
+        }
+        if (has_views) sg->pd_cache_.erase(cur_op.get());
+    }
+    return status::success;
+}
+
 // In this function, we will do the following things:
 // - Build the alias map. both the key and value in the map are edges. the key
 //   is the alias of value.
+// - Place the inputs of concat ops into the concat output buffer.
 // - Count the reference count of each edges. the reference count will be used
 //   during assign temporary buffer to determine which edge's buffer can be
 //   reused since it ref count reduce to zero.
@@ -798,6 +920,9 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
 
     alias_analyzer_.run(sg);
 
+    ret = prepare_concat_views(sg);
+    if (ret != status::success) return ret;
+
     // get the reference count of each edge
     std::unordered_map<value_t *, size_t> edge_ref_count;
     for (auto &cur_op : sg->get_ops()) {
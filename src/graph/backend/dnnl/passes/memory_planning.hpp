@@ -45,6 +45,15 @@ namespace dnnl_impl {
 // multi-threads, each thread should have a replica.
 class execution_args_set_t {
 public:
+    // A memory object which is a view into the buffer of another memory object
+    // (e.g. an input of concat written directly into the concat destination).
+    // Its data handle is the one of the base memory plus the offset in bytes.
+    struct mem_view_t {
+        dnnl::memory mem_;
+        dnnl::memory base_;
+        size_t offset_;
+    };
+
     execution_args_set_t() = default;
 
     execution_args_set_t(const execution_args_set_t &) = delete;
@@ -86,6 +95,10 @@ public:
         return mems_use_internal_persistent_;
     }
 
+    const std::vector<mem_view_t> &get_mems_use_views() const {
+        return mems_use_views_;
+    }
+
     // adders
     void add_exec_args(const exec_args &args) {
         topo_ordered_exec_args_.emplace_back(args);
@@ -115,6 +128,10 @@ public:
         mems_use_internal_persistent_.emplace_back(mem_offkey);
     }
 
+    void add_mem_use_view(const mem_view_t &mem_view) {
+        mems_use_views_.emplace_back(mem_view);
+    }
+
     // finders
     bool find_value_mem_map(value_t *key, memory &mem) const {
         auto pos = value_mem_map_.find(key);
@@ -136,6 +153,8 @@ private:
     // memory <-> offset key of used underlying buffer in the internal
     // persistent registry
     std::vector<std::pair<dnnl::memory, size_t>> mems_use_internal_persistent_;
+    // memories which are views into the buffer of other memories
+    std::vector<mem_view_t> mems_use_views_;
     // value pointer -> memory
     std::unordered_map<value_t *, memory> value_mem_map_;
     // execution args for each op in the subgraph
@@ -282,6 +301,9 @@ private:
 //   Take this subgraph 't1 -> op1 -> t2 -> op2 -> t3 -> op3 -> t4-> op4 -> t5'
 //   as an example: when writing data to t4, t2 is not used any more, so they
 //   have disjoint live range and we can make them share same buffer.
+// - View sharing. Inputs of concat are placed into the slices of the concat
+//   output buffer, so that their producers write the concat result directly
+//   and the concat doesn't need to copy them.
 //
 // The following internal env vars can be used to control the memory planning:
 // - _ONEDNN_GRAPH_ENABLE_MEM_REUSE
@@ -339,6 +361,10 @@ public:
         }
 
         str += std::to_string(info.index_);
+
+        auto view_pos = views_.find(val);
+        if (view_pos != views_.end())
+            str += "+" + std::to_string(view_pos->second.offset_);
         return str;
     }
 
@@ -371,6 +397,12 @@ private:
         size_t index_; // the index to allocated buffer
     };
 
+    // the value is placed into the buffer of the base value at the offset
+    struct view_info_t {
+        const value_t *base_;
+        size_t offset_; // in bytes
+    };
+
     struct time_bound_t {
         size_t start_;
         size_t end_;
@@ -386,8 +418,11 @@ private:
         temporary_registry_.clear();
         external_inputs_live_range_.clear();
         inplace_pairs_.clear();
+        views_.clear();
     }
 
+    status_t prepare_concat_views(std::shared_ptr<subgraph_t> &sg);
+
     status_t assign_external_inputs_buffer(std::shared_ptr<subgraph_t> &sg,
             const std::vector<logical_tensor_t> &inputs);
 
@@ -423,6 +458,7 @@ private:
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+    std::unordered_map<const value_t *, view_info_t> views_;
 };
 
 } // namespace dnnl_impl
@@ -170,6 +170,8 @@ DNNL_BACKEND_SINGLE_OP_TRANSFORM(gelu_pass, GELU, float_eltwise_fwd)
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(gelu_bw_pass, GELUBackward, eltwise_bwd_t)
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(elu_pass, Elu, float_eltwise_fwd)
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(elu_bw_pass, EluBackward, eltwise_bwd_t)
+DNNL_BACKEND_SINGLE_OP_TRANSFORM(
+        embedding_bag_pass, EmbeddingBag, embedding_bag_fwd_t)
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(exp_pass, Exp, float_eltwise_fwd)
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(
         hardsigmoid_pass, HardSigmoid, float_eltwise_fwd)
@@ -204,6 +204,13 @@ bool check_dyn_quant_dequant_scales_zps(const op_t *n) {
     return true;
 }
 
+// check function for EmbeddingBag: per-sample weights are only defined for
+// the sum mode.
+bool check_embedding_bag_weights(const op_t *n) {
+    if (n->num_inputs() < 4) return true;
+    return n->get_attr<std::string>(op_attr::mode) == "sum";
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
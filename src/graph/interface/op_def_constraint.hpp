@@ -47,6 +47,8 @@ bool check_quant_dequant_scales_zps(const op_t *n);
 
 bool check_dyn_quant_dequant_scales_zps(const op_t *n);
 
+bool check_embedding_bag_weights(const op_t *n);
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
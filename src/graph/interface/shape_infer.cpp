@@ -1505,6 +1505,34 @@ status_t infer_prelu_bwd_output_shape(op_t *n,
             n, inputs, outputs, identity_shapes_pos);
 }
 
+status_t infer_embedding_bag_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto table = logical_tensor_wrapper_t(inputs[0]);
+    auto indices = logical_tensor_wrapper_t(inputs[1]);
+    auto offsets = logical_tensor_wrapper_t(inputs[2]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+    if (!out0.is_shape_unknown()) return status::success;
+
+    if (table.ndims() != 2 || indices.ndims() != 1 || offsets.ndims() != 1)
+        return status::invalid_shape;
+    if (inputs.size() > 3) {
+        auto weights = logical_tensor_wrapper_t(inputs[3]);
+        if (weights.vdims() != indices.vdims()) return status::invalid_shape;
+    }
+
+    // every bag is reduced to a single row of the table
+    dims inferred_out_shape {offsets.dims()[0], table.dims()[1]};
+    if (out0.ndims() != -1) {
+        if (!validate(inferred_out_shape, out0.vdims())) {
+            return status::invalid_shape;
+        }
+    }
+
+    set_shape_and_strides(*outputs[0], inferred_out_shape);
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -621,6 +621,12 @@ void flex_rewrite::infer_output_shape(deserialized_graph &dgraph) {
                     // no need to do one way broadcast
                 }
                 break;
+            // infer_embedding_bag_output_shape
+            case dnnl::graph::op::kind::EmbeddingBag:
+                in0 = aop.in_lts_[0].id_;
+                out0 = aop.out_lts_[0].id_;
+                gi[out0] = {gi[aop.in_lts_[2].id_][0], gi[in0][1]};
+                break;
             // infer_static_reshape_output_shape
             case dnnl::graph::op::kind::StaticReshape:
                 in0 = aop.in_lts_[0].id_;
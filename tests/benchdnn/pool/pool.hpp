@@ -37,9 +37,11 @@ enum alg_t {
     max,
     avg_np,
     avg_p,
+    avg_adaptive,
     pooling_max = max,
     pooling_avg_exclude_padding = avg_np,
     pooling_avg_include_padding = avg_p,
+    pooling_avg_adaptive = avg_adaptive,
 };
 alg_t str2alg(const char *str);
 const char *alg2str(alg_t alg);
@@ -39,6 +39,8 @@ alg_t str2alg(const char *str) {
     CASE(pooling_avg_exclude_padding);
     CASE(avg_p);
     CASE(pooling_avg_include_padding);
+    CASE(avg_adaptive);
+    CASE(pooling_avg_adaptive);
 #undef CASE
     assert(!"unknown algorithm");
     return undef;
@@ -48,6 +50,7 @@ const char *alg2str(alg_t alg) {
     if (alg == max) return "max";
     if (alg == avg_np) return "avg_np";
     if (alg == avg_p) return "avg_p";
+    if (alg == avg_adaptive) return "avg_adaptive";
     assert(!"unknown algorithm");
     return "undef";
 }
@@ -56,6 +59,7 @@ dnnl_alg_kind_t alg2alg_kind(alg_t alg) {
     if (alg == max) return dnnl_pooling_max;
     if (alg == avg_np) return dnnl_pooling_avg_exclude_padding;
     if (alg == avg_p) return dnnl_pooling_avg_include_padding;
+    if (alg == avg_adaptive) return dnnl_pooling_avg_adaptive;
     assert(!"unknown algorithm");
     return dnnl_alg_kind_undef;
 }
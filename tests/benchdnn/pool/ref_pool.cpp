@@ -20,6 +20,29 @@
 
 namespace pool {
 
+// Boundaries [start, end) of the window of the adaptive pooling along a
+// dimension with `I` inputs and `O` outputs.
+void adaptive_window(
+        int64_t o, int64_t I, int64_t O, int64_t &start, int64_t &end) {
+    start = o * I / O;
+    end = div_up((o + 1) * I, O);
+}
+
+float compute_adaptive_avg(const prb_t *prb, const dnn_mem_t &src,
+        int64_t mb, int64_t ic, int64_t od, int64_t oh, int64_t ow) {
+    int64_t id_s, id_e, ih_s, ih_e, iw_s, iw_e;
+    adaptive_window(od, prb->id, prb->od, id_s, id_e);
+    adaptive_window(oh, prb->ih, prb->oh, ih_s, ih_e);
+    adaptive_window(ow, prb->iw, prb->ow, iw_s, iw_e);
+
+    float sum = 0.f;
+    for_(int64_t id = id_s; id < id_e; ++id)
+    for_(int64_t ih = ih_s; ih < ih_e; ++ih)
+    for (int64_t iw = iw_s; iw < iw_e; ++iw)
+        sum += src.get_elem(src_off_f(prb, mb, ic, id, ih, iw));
+    return sum / ((id_e - id_s) * (ih_e - ih_s) * (iw_e - iw_s));
+}
+
 void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &src = args.find(DNNL_ARG_SRC);
     const dnn_mem_t &dst = args.find(DNNL_ARG_DST);
@@ -69,6 +92,8 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
             if (!(prb->dir & FLAG_INF)) ws.set_elem(dst_off, ws_off);
         } else if (prb->alg == avg_np || prb->alg == avg_p) {
             res = avg_value / get_num_summands(prb, od, oh, ow);
+        } else if (prb->alg == avg_adaptive) {
+            res = compute_adaptive_avg(prb, src, mb, ic, od, oh, ow);
         }
 
         const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, dst_off);
@@ -97,7 +122,30 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
             d_src_ptr[src_off_f(prb, mb, ic, id, ih, iw)] = 0.f;
     };
 
+    auto ker_adaptive = [&](int64_t mb, int64_t ic, int64_t od, int64_t oh,
+                                int64_t ow) {
+        int64_t id_s, id_e, ih_s, ih_e, iw_s, iw_e;
+        adaptive_window(od, prb->id, prb->od, id_s, id_e);
+        adaptive_window(oh, prb->ih, prb->oh, ih_s, ih_e);
+        adaptive_window(ow, prb->iw, prb->ow, iw_s, iw_e);
+        const int64_t num_summands
+                = (id_e - id_s) * (ih_e - ih_s) * (iw_e - iw_s);
+
+        const float d_dst_val
+                = d_dst.get_elem(dst_off_f(prb, mb, ic, od, oh, ow));
+        for_(int64_t id = id_s; id < id_e; ++id)
+        for_(int64_t ih = ih_s; ih < ih_e; ++ih)
+        for (int64_t iw = iw_s; iw < iw_e; ++iw)
+            d_src_ptr[src_off_f(prb, mb, ic, id, ih, iw)]
+                    += d_dst_val / num_summands;
+    };
+
     auto ker = [&](int64_t mb, int64_t ic, int64_t od, int64_t oh, int64_t ow) {
+        if (prb->alg == avg_adaptive) {
+            ker_adaptive(mb, ic, od, oh, ow);
+            return;
+        }
+
         const auto d_dst_off = dst_off_f(prb, mb, ic, od, oh, ow);
         float d_dst_val = d_dst.get_elem(d_dst_off);
         int ws_off = (prb->alg == max) ? ws.get_elem(d_dst_off) : 0;
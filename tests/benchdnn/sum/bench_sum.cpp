@@ -44,11 +44,12 @@ void check_correctness(
     for_(const auto &i_stag : s.stag)
     for_(const auto &i_dtag : s.dtag)
     for_(const auto &i_input_scales : s.input_scales)
+    for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
     for_(const auto &i_ctx_init : s.ctx_init)
     for_(const auto &i_ctx_exe : s.ctx_exe)
     for (auto i_inplace : s.inplace) {
-        auto attr = settings_t::get_attr(i_scratchpad_mode);
+        auto attr = settings_t::get_attr(i_post_ops, i_scratchpad_mode);
 
         const prb_t prb(s.prb_dims, i_sdt, i_ddt, i_stag, i_dtag,
                 i_input_scales, i_inplace, attr, i_ctx_init, i_ctx_exe);
@@ -111,6 +112,7 @@ int bench(int argc, char **argv) {
                 || parse_multivector_option(s.input_scales, def.input_scales,
                         atof, argv[0], "scales", help_scales)
                 || parse_inplace(s.inplace, def.inplace, argv[0])
+                || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
                 || parse_ctx_init(s.ctx_init, def.ctx_init, argv[0])
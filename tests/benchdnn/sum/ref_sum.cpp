@@ -29,11 +29,13 @@ void compute_ref(
     const auto nelems = dst.nelems();
 
     benchdnn_parallel_nd(nelems, [&](int64_t k) {
-        dst_ptr[k] = 0;
+        float res = 0;
         for (int i_input = 0; i_input < prb->n_inputs(); ++i_input) {
             const dnn_mem_t &src_i = args.find(DNNL_ARG_MULTIPLE_SRC + i_input);
-            dst_ptr[k] += (src_i.get_elem(k) * prb->input_scales[i_input]);
+            res += (src_i.get_elem(k) * prb->input_scales[i_input]);
         }
+        maybe_post_ops(prb->attr, res);
+        dst_ptr[k] = res;
     });
 }
 
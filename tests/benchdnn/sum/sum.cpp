@@ -85,6 +85,15 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_data_type(dts, prb->dir, res);
     skip_unimplemented_sum_po(prb->attr, res, dnnl_sum, prb->sdt[0]);
     skip_unimplemented_prelu_po(prb->attr, res, dnnl_sum);
+
+    // Only eltwise post-ops are supported and only on CPU.
+    const auto &po = prb->attr.post_ops;
+    for (int idx = 0; idx < po.len(); ++idx) {
+        if (is_gpu() || !po.entry[idx].is_eltwise_kind()) {
+            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+            return;
+        }
+    }
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
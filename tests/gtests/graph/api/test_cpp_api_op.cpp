@@ -113,6 +113,7 @@ TEST(APIOp, CreateAllOps) {
             op::kind::HardSigmoidBackward,
             op::kind::Select,
             op::kind::Pow,
+            op::kind::EmbeddingBag,
     };
     // clang-format on
 
@@ -155,7 +155,10 @@ INSTANTIATE_TEST_SUITE_P(Execute, concat_t,
                         {1, 2, 2, 2}, {1, 2, 2, 2}, {1, 2, 2, 4}, 3, false},
                 // 4D, axis = -1
                 concat_params_t {
-                        {1, 2, 2, 2}, {1, 2, 2, 2}, {1, 2, 2, 4}, -1, false}));
+                        {1, 2, 2, 2}, {1, 2, 2, 2}, {1, 2, 2, 4}, -1, false},
+                // 4D, axis = 1, inputs are written into strided slices of dst
+                concat_params_t {
+                        {2, 3, 4, 5}, {2, 5, 4, 5}, {2, 8, 4, 5}, 1, false}));
 
 TEST(Compile, ConcatWithMoreInputs) {
     size_t num_inputs = 64;
@@ -114,4 +114,22 @@ TEST(onednn_default_fpmath_mode_env_var_test, TestEnvVars) {
     EXPECT_EQ(func_got_val, dnnl_fpmath_mode_strict);
 }
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(onednn_huge_pages_env_var_test, TestEnvVars) {
+    custom_setenv("ONEDNN_HUGE_PAGES", "2m", 1);
+    // A buffer large enough to be backed by huge pages. Whatever pages the
+    // library ends up with, the memory must be fully usable.
+    const memory::dim nelems = 3 * 1024 * 1024;
+    engine eng(engine::kind::cpu, 0);
+    memory mem({{nelems}, memory::data_type::f32, memory::format_tag::a}, eng);
+    float *ptr = static_cast<float *>(mem.get_data_handle());
+    ASSERT_NE(ptr, nullptr);
+    for (memory::dim i = 0; i < nelems; ++i)
+        ptr[i] = static_cast<float>(i % 1024);
+    for (memory::dim i = 0; i < nelems; i += 4099)
+        ASSERT_EQ(ptr[i], static_cast<float>(i % 1024));
+}
+#endif
+
 } // namespace dnnl
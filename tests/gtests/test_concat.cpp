@@ -444,4 +444,47 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+// The sources are sub-memory views of the destination: their producers have
+// already written the result, so concat must keep the destination intact.
+TEST(concat_test_inplace, SrcsAreSubMemoriesOfDst) {
+    auto eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Views are created with pointer arithmetic.");
+    auto strm = make_stream(eng);
+
+    const memory::dims dst_dims {2, 8, 3, 4};
+    const std::vector<memory::dims> srcs_dims {{2, 3, 3, 4}, {2, 5, 3, 4}};
+    memory::desc dst_md(
+            dst_dims, memory::data_type::f32, memory::format_tag::nchw);
+    auto dst = test::make_memory(dst_md, eng);
+    const memory::dim nelems = dst_md.get_size() / sizeof(float);
+    fill_data<float>(nelems, dst);
+
+    std::vector<float> ref(nelems);
+    {
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < nelems; i++)
+            ref[i] = dst_ptr[i];
+    }
+
+    std::vector<memory::desc> srcs_md;
+    std::unordered_map<int, memory> args = {{DNNL_ARG_DST, dst}};
+    memory::dim c_off = 0;
+    for (size_t i = 0; i < srcs_dims.size(); i++) {
+        srcs_md.push_back(
+                dst_md.submemory_desc(srcs_dims[i], {0, c_off, 0, 0}));
+        args.insert({DNNL_ARG_MULTIPLE_SRC + (int)i,
+                memory(srcs_md.back(), eng, dst.get_data_handle())});
+        c_off += srcs_dims[i][1];
+    }
+
+    concat::primitive_desc concat_pd(eng, dst_md, 1, srcs_md);
+    concat(concat_pd).execute(strm, args);
+    strm.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    for (memory::dim i = 0; i < nelems; i++)
+        ASSERT_EQ(dst_ptr[i], ref[i]);
+}
+
 } // namespace dnnl
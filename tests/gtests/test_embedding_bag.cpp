@@ -0,0 +1,239 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct embedding_bag_test_params_t {
+    algorithm aalgorithm;
+    memory::dim rows;
+    memory::dim dim;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> offsets;
+    bool with_weights;
+    bool with_scales;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename src_data_t>
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_test_params_t> {
+private:
+    embedding_bag_test_params_t p;
+    memory::data_type src_dt;
+
+protected:
+    void SetUp() override {
+        src_dt = data_traits<src_data_t>::data_type;
+
+        p = ::testing::TestWithParam<embedding_bag_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(src_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void check_result(const memory &src, const memory &indices,
+            const memory &offsets, const memory &weights, const memory &scales,
+            const memory &dst) {
+        auto src_ptr = map_memory<src_data_t>(src);
+        auto ind_ptr = map_memory<int32_t>(indices);
+        auto off_ptr = map_memory<int32_t>(offsets);
+        auto dst_ptr = map_memory<float>(dst);
+        auto wei_ptr = map_memory<float>(weights);
+        auto sc_ptr = map_memory<float>(scales);
+
+        const memory::dim n_indices = (memory::dim)p.indices.size();
+        const memory::dim n_bags = (memory::dim)p.offsets.size();
+        for_(memory::dim b = 0; b < n_bags; b++)
+        for (memory::dim d = 0; d < p.dim; d++) {
+            const memory::dim start = off_ptr[b];
+            const memory::dim end
+                    = b + 1 < n_bags ? off_ptr[b + 1] : n_indices;
+            float ref = p.aalgorithm == algorithm::embedding_bag_max ? -FLT_MAX
+                                                                     : 0.f;
+            for (memory::dim i = start; i < end; i++) {
+                const memory::dim idx = ind_ptr[i];
+                float s = (float)src_ptr[idx * p.dim + d];
+                if (p.with_scales) s *= sc_ptr[idx];
+                if (p.with_weights) s *= wei_ptr[i];
+                ref = p.aalgorithm == algorithm::embedding_bag_max
+                        ? std::max(ref, s)
+                        : ref + s;
+            }
+            if (start == end)
+                ref = 0.f;
+            else if (p.aalgorithm == algorithm::embedding_bag_mean)
+                ref /= (end - start);
+
+            const float out = dst_ptr[b * p.dim + d];
+            ASSERT_NEAR(out, ref, 1e-4f * std::max(1.f, std::abs(ref)))
+                    << "bag: " << b << " d: " << d;
+        }
+    }
+
+    void Test() {
+        using pd_t = embedding_bag::primitive_desc;
+        allows_attr_t allowed_attributes {false};
+        allowed_attributes.scales = true;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim n_indices = (memory::dim)p.indices.size();
+        const memory::dim n_bags = (memory::dim)p.offsets.size();
+        auto desc_src = memory::desc({p.rows, p.dim}, src_dt, tag::ab);
+        auto desc_ind = memory::desc({n_indices}, dt::s32, tag::a);
+        auto desc_off = memory::desc({n_bags}, dt::s32, tag::a);
+        auto desc_wei = memory::desc({n_indices}, dt::f32, tag::a);
+        auto desc_dst = memory::desc({n_bags, p.dim}, dt::f32, tag::any);
+
+        primitive_attr attr;
+        if (p.with_scales) attr.set_scales_mask(DNNL_ARG_SRC, 1);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        if (p.with_weights) {
+            pd = pd_t(eng, p.aalgorithm, desc_src, desc_ind, desc_off,
+                    desc_wei, desc_dst, attr);
+            test_fwd_pd_constructors<pd_t>(pd, allowed_attributes,
+                    p.aalgorithm, desc_src, desc_ind, desc_off, desc_wei,
+                    desc_dst);
+        } else {
+            pd = pd_t(eng, p.aalgorithm, desc_src, desc_ind, desc_off,
+                    desc_dst, attr);
+            test_fwd_pd_constructors<pd_t>(pd, allowed_attributes,
+                    p.aalgorithm, desc_src, desc_ind, desc_off, desc_dst);
+        }
+
+        EXPECT_ANY_THROW(embedding_bag(pd, {}));
+        // default primitive ctor
+        auto prim = embedding_bag();
+        // regular primitive ctor
+        prim = embedding_bag(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC)
+                == pd.src_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST)
+                == pd.dst_desc());
+        ASSERT_TRUE(pd.indices_desc() == desc_ind);
+        ASSERT_TRUE(pd.offsets_desc() == desc_off);
+        if (p.with_weights) {
+            ASSERT_TRUE(pd.weights_desc() == desc_wei);
+        }
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = test::make_memory(pd.src_desc(), test_engine);
+        auto mem_ind = test::make_memory(desc_ind, test_engine);
+        auto mem_off = test::make_memory(desc_off, test_engine);
+        auto mem_wei = test::make_memory(desc_wei, test_engine);
+        auto mem_sc = test::make_memory(
+                memory::desc({p.rows}, dt::f32, tag::a), test_engine);
+        auto mem_dst = test::make_memory(pd.dst_desc(), test_engine);
+
+        fill_data<src_data_t>(p.rows * p.dim, mem_src);
+        fill_data<float>(n_indices, mem_wei);
+        fill_data<float>(p.rows, mem_sc);
+        {
+            auto ind_ptr = map_memory<int32_t>(mem_ind);
+            auto off_ptr = map_memory<int32_t>(mem_off);
+            for (memory::dim i = 0; i < n_indices; i++)
+                ind_ptr[i] = p.indices[i];
+            for (memory::dim b = 0; b < n_bags; b++)
+                off_ptr[b] = p.offsets[b];
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+                {DNNL_ARG_INDICES, mem_ind}, {DNNL_ARG_OFFSETS, mem_off},
+                {DNNL_ARG_DST, mem_dst}};
+        if (p.with_weights) args.insert({DNNL_ARG_WEIGHTS, mem_wei});
+        if (p.with_scales)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, mem_sc});
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        check_result(mem_src, mem_ind, mem_off, mem_wei, mem_sc, mem_dst);
+    }
+
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // weights are supported by the sum algorithm only
+            embedding_bag_test_params_t {algorithm::embedding_bag_max, 4, 8,
+                    {0, 1}, {0}, true, false, true, dnnl_invalid_arguments},
+            // not supported alg_kind
+            embedding_bag_test_params_t {algorithm::reduction_sum, 4, 8,
+                    {0, 1}, {0}, false, false, true, dnnl_invalid_arguments},
+            // index out of the table
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 4, 8,
+                    {0, 4}, {0}, false, false, true, dnnl_invalid_arguments},
+            // decreasing offsets
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 4, 8,
+                    {0, 1, 2}, {0, 2, 1}, false, false, true,
+                    dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 10, 16,
+                    {1, 2, 4, 5, 4, 3, 2, 9}, {0, 4}},
+            embedding_bag_test_params_t {algorithm::embedding_bag_mean, 10,
+                    16, {1, 2, 4, 5, 4, 3, 2, 9}, {0, 2, 2, 7}},
+            embedding_bag_test_params_t {algorithm::embedding_bag_max, 10, 7,
+                    {1, 2, 4, 5, 4, 3, 2, 9}, {0, 1, 5}},
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 32, 67,
+                    {0, 31, 7, 7, 7, 12, 3, 15, 28, 1, 2, 3, 4, 5, 6},
+                    {0, 3, 6, 6, 14}, true},
+            embedding_bag_test_params_t {algorithm::embedding_bag_mean, 20,
+                    300, {19, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18}, {0}},
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 16, 24,
+                    {3, 4, 5, 6, 7, 8, 9, 10}, {0, 4}, true, true},
+            embedding_bag_test_params_t {algorithm::embedding_bag_max, 16, 24,
+                    {3, 4, 5, 6, 7, 8, 9, 10}, {0, 3}, false, true});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsEmbeddingBag) {} \
+    INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagSimple, test, simple_cases());
+
+using embedding_bag_test_f32 = embedding_bag_test_t<float>;
+using embedding_bag_test_s8 = embedding_bag_test_t<int8_t>;
+using embedding_bag_test_u8 = embedding_bag_test_t<uint8_t>;
+
+INST_TEST_CASE(embedding_bag_test_f32)
+INST_TEST_CASE(embedding_bag_test_s8)
+INST_TEST_CASE(embedding_bag_test_u8)
+
+} // namespace dnnl
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+
+namespace dnnl {
+
+namespace {
+
+template <typename T>
+std::vector<T> make_data(size_t size, int seed) {
+    std::vector<T> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<T>((i * 7 + seed * 13) % 11) - 5;
+    return data;
+}
+
+template <typename T>
+void check_equal(const std::vector<T> &ref, const std::vector<T> &got) {
+    ASSERT_EQ(ref.size(), got.size());
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_LE(std::fabs(static_cast<float>(ref[i] - got[i])), 1e-4f)
+                << "at index " << i;
+}
+
+} // namespace
+
+TEST(gemm_batch_test, SgemmStrided) {
+    const dnnl_dim_t M = 13, N = 17, K = 19, batch = 64;
+    const dnnl_dim_t lda = K, ldb = N, ldc = N;
+    const dnnl_dim_t stridea = M * lda, strideb = K * ldb, stridec = M * ldc;
+
+    auto A = make_data<float>(batch * stridea, 1);
+    auto B = make_data<float>(batch * strideb, 2);
+    auto C = make_data<float>(batch * stridec, 3);
+    auto C_ref = C;
+
+    for (dnnl_dim_t i = 0; i < batch; i++)
+        ASSERT_EQ(dnnl_sgemm('N', 'N', M, N, K, 0.5f, A.data() + i * stridea,
+                          lda, B.data() + i * strideb, ldb, 2.f,
+                          C_ref.data() + i * stridec, ldc),
+                dnnl_success);
+
+    ASSERT_EQ(dnnl_sgemm_batch_strided('N', 'N', M, N, K, 0.5f, A.data(), lda,
+                      stridea, B.data(), ldb, strideb, 2.f, C.data(), ldc,
+                      stridec, batch),
+            dnnl_success);
+    check_equal(C_ref, C);
+}
+
+TEST(gemm_batch_test, SgemmGroups) {
+    // Two groups of problems with different shapes and transpositions.
+    const char transa[] = {'N', 'T'}, transb[] = {'T', 'N'};
+    const dnnl_dim_t M[] = {8, 3}, N[] = {5, 33}, K[] = {16, 7};
+    const dnnl_dim_t lda[] = {16, 3}, ldb[] = {16, 33}, ldc[] = {5, 33};
+    const float alpha[] = {1.f, 2.f}, beta[] = {0.f, 1.f};
+    const dnnl_dim_t group_size[] = {3, 40};
+    const dnnl_dim_t group_count = 2;
+
+    std::vector<std::vector<float>> A, B, C, C_ref;
+    std::vector<const float *> a_ptrs, b_ptrs;
+    std::vector<float *> c_ptrs;
+    for (dnnl_dim_t g = 0, seed = 0; g < group_count; g++) {
+        for (dnnl_dim_t i = 0; i < group_size[g]; i++, seed++) {
+            A.push_back(make_data<float>(M[g] * K[g], (int)seed));
+            B.push_back(make_data<float>(K[g] * N[g], (int)seed + 1));
+            C.push_back(make_data<float>(M[g] * N[g], (int)seed + 2));
+            C_ref.push_back(C.back());
+            ASSERT_EQ(dnnl_sgemm(transa[g], transb[g], M[g], N[g], K[g],
+                              alpha[g], A.back().data(), lda[g],
+                              B.back().data(), ldb[g], beta[g],
+                              C_ref.back().data(), ldc[g]),
+                    dnnl_success);
+        }
+    }
+    for (size_t i = 0; i < C.size(); i++) {
+        a_ptrs.push_back(A[i].data());
+        b_ptrs.push_back(B[i].data());
+        c_ptrs.push_back(C[i].data());
+    }
+
+    ASSERT_EQ(dnnl_sgemm_batch(transa, transb, M, N, K, alpha, a_ptrs.data(),
+                      lda, b_ptrs.data(), ldb, beta, c_ptrs.data(), ldc,
+                      group_count, group_size),
+            dnnl_success);
+    for (size_t i = 0; i < C.size(); i++)
+        check_equal(C_ref[i], C[i]);
+}
+
+TEST(gemm_batch_test, GemmU8S8S32Strided) {
+    const dnnl_dim_t M = 9, N = 24, K = 31, batch = 32;
+    const dnnl_dim_t lda = K, ldb = N, ldc = N;
+    const dnnl_dim_t stridea = M * lda, strideb = K * ldb, stridec = M * ldc;
+    const uint8_t ao = 1;
+    const int8_t bo = -2;
+    const int32_t co = 3;
+
+    auto A = make_data<uint8_t>(batch * stridea, 1);
+    auto B = make_data<int8_t>(batch * strideb, 2);
+    auto C = make_data<int32_t>(batch * stridec, 3);
+    auto C_ref = C;
+
+    for (dnnl_dim_t i = 0; i < batch; i++)
+        ASSERT_EQ(dnnl_gemm_u8s8s32('N', 'N', 'F', M, N, K, 1.f,
+                          A.data() + i * stridea, lda, ao,
+                          B.data() + i * strideb, ldb, bo, 1.f,
+                          C_ref.data() + i * stridec, ldc, &co),
+                dnnl_success);
+
+    ASSERT_EQ(dnnl_gemm_u8s8s32_batch_strided('N', 'N', 'F', M, N, K, 1.f,
+                      A.data(), lda, stridea, ao, B.data(), ldb, strideb, bo,
+                      1.f, C.data(), ldc, stridec, &co, batch),
+            dnnl_success);
+    check_equal(C_ref, C);
+}
+
+TEST(gemm_batch_test, InvalidArguments) {
+    const dnnl_dim_t group_size[] = {-1};
+    ASSERT_EQ(dnnl_sgemm_batch(nullptr, nullptr, nullptr, nullptr, nullptr,
+                      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                      nullptr, nullptr, 1, group_size),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_batch_strided('N', 'N', 1, 1, 1, 1.f, nullptr, 1, 1,
+                      nullptr, 1, 1, 0.f, nullptr, 1, 1, -1),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
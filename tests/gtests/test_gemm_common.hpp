@@ -345,84 +345,55 @@ struct dnnl_gemm<uint8_t, int8_t, int32_t> {
     static dnnl_status_t call_packed(const test_params &p,
             const test_memory &a_mem, const test_memory &b_mem,
             const test_memory &c_mem, const test_memory &oc_mem) {
-        /* Alas, the internal API still uses Fortran notation.
-         * So in addition to the changes for pack API, we also need to take
-         * care of conversions and layouts */
-
-        using namespace dnnl::impl::cpu;
-
         assert(p.alpha == 1.f);
         assert(p.igemm_params.oa() == 0);
         assert(p.igemm_params.ob() == 0);
 
-        /* Prepare for Fortran style, hence A <-> B */
-        char trans_a = p.transB, trans_b = p.transA;
-
-        int64_t m = p.N, n = p.M, k = p.K;
-        int64_t lda = p.ldb, ldb = p.lda, ldc = p.ldc;
-
-        int8_t *A = map_memory<int8_t>(b_mem), *a_eff = A;
-        uint8_t *B = map_memory<uint8_t>(a_mem), *b_eff = B;
+        uint8_t *A = map_memory<uint8_t>(a_mem);
+        int8_t *B = map_memory<int8_t>(b_mem);
+        const void *a_eff = A, *b_eff = B;
 
         auto C = map_memory<int32_t>(c_mem);
         auto oc = map_memory<int32_t>(oc_mem);
 
-        char offset_c = '\0';
-        switch (p.igemm_params.offsetc) {
-            case 'R': offset_c = 'C'; break;
-            case 'r': offset_c = 'c'; break;
-            case 'C': offset_c = 'R'; break;
-            case 'c': offset_c = 'r'; break;
-            default: offset_c = p.igemm_params.offsetc;
-        }
-
-        std::vector<int8_t> a_pack_buf;
-        std::vector<uint8_t> b_pack_buf;
-        bool pack_a = p.pack_params.pack_b;
-        bool pack_b = p.pack_params.pack_a;
+        std::vector<uint8_t> a_pack_buf, b_pack_buf;
+        char trans_a = p.transA, trans_b = p.transB;
 
         dnnl_status_t status = dnnl_success;
 
-        if (pack_a) {
+        if (p.pack_params.pack_a) {
             size_t a_sz;
-            status = gemm_s8u8s32_pack_get_size(
-                    "A", &trans_a, &trans_b, &m, &n, &k, &lda, &ldb, &a_sz);
+            status = dnnl_gemm_u8s8s32_pack_get_size('A', p.transA, p.transB,
+                    p.M, p.N, p.K, p.lda, p.ldb, &a_sz);
             if (status != dnnl_success) return status;
 
-            if (pack_a) {
-                a_pack_buf.resize(a_sz);
-                a_eff = a_pack_buf.data();
+            a_pack_buf.resize(a_sz);
+            status = dnnl_gemm_u8s8s32_pack('A', p.transA, p.transB, p.M, p.N,
+                    p.K, p.lda, p.ldb, A, a_pack_buf.data());
+            if (status != dnnl_success) return status;
 
-                status = gemm_s8u8s32_pack("A", &trans_a, &trans_b, &m, &n, &k,
-                        &lda, &ldb, A, a_eff);
-                if (status != dnnl_success) return status;
-            }
+            a_eff = a_pack_buf.data();
+            trans_a = 'P';
         }
 
-        if (pack_b) {
+        if (p.pack_params.pack_b) {
             size_t b_sz;
-
-            status = gemm_s8u8s32_pack_get_size(
-                    "B", &trans_a, &trans_b, &m, &n, &k, &lda, &ldb, &b_sz);
+            status = dnnl_gemm_u8s8s32_pack_get_size('B', p.transA, p.transB,
+                    p.M, p.N, p.K, p.lda, p.ldb, &b_sz);
             if (status != dnnl_success) return status;
 
-            if (pack_b) {
-                b_pack_buf.resize(b_sz);
-                b_eff = b_pack_buf.data();
+            b_pack_buf.resize(b_sz);
+            status = dnnl_gemm_u8s8s32_pack('B', p.transA, p.transB, p.M, p.N,
+                    p.K, p.lda, p.ldb, B, b_pack_buf.data());
+            if (status != dnnl_success) return status;
 
-                status = gemm_s8u8s32_pack("B", &trans_a, &trans_b, &m, &n, &k,
-                        &lda, &ldb, B, b_eff);
-                if (status != dnnl_success) return status;
-            }
+            b_eff = b_pack_buf.data();
+            trans_b = 'P';
         }
 
-        if (pack_a) trans_a = 'P';
-        if (pack_b) trans_b = 'P';
-
-        status = gemm_s8u8s32_compute(&trans_a, &trans_b, &offset_c, &m, &n, &k,
-                a_eff, &lda, b_eff, &ldb, &p.beta, C, &ldc, oc);
-
-        return status;
+        return dnnl_gemm_u8s8s32_compute(trans_a, trans_b,
+                p.igemm_params.offsetc, p.M, p.N, p.K, a_eff, p.lda, b_eff,
+                p.ldb, p.beta, C, p.ldc, oc);
     }
 
     static dnnl_status_t call(const test_params &p, const test_memory &a_mem,
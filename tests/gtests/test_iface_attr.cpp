@@ -15,6 +15,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <cstring>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -88,6 +92,314 @@ TEST_F(attr_test_t, TestScratchpadModeEx) {
     }
 }
 
+TEST_F(attr_test_t, TestThreadTeamSize) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_thread_team_size(), 0);
+
+    for (int size : {1, 2, 0}) {
+        attr.set_thread_team_size(size);
+        ASSERT_EQ(size, attr.get_thread_team_size());
+    }
+    EXPECT_ANY_THROW(attr.set_thread_team_size(-1));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestThreadTeamSizeExec) {
+    engine eng = get_test_engine();
+
+    const memory::dim M = 64, K = 96, N = 48;
+    memory::desc src_md({M, K}, data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, data_type::f32, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * N, wei);
+
+    stream s(eng);
+    std::vector<float> ref_dst;
+    for (int size : {0, 1, 2, 3}) {
+        dnnl::primitive_attr attr;
+        attr.set_thread_team_size(size);
+        auto matmul_pd
+                = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+        ASSERT_EQ(size, matmul_pd.get_primitive_attr().get_thread_team_size());
+
+        auto dst = test::make_memory(dst_md, eng);
+        matmul(matmul_pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        s.wait();
+
+        auto dst_mapped = map_memory<float>(dst);
+        const float *dst_ptr = dst_mapped;
+        // Limiting the number of threads changes the work distribution only,
+        // the results are expected to be close to the unlimited ones.
+        if (ref_dst.empty()) {
+            ref_dst.assign(dst_ptr, dst_ptr + M * N);
+            continue;
+        }
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_NEAR(ref_dst[i], dst_ptr[i], 1e-4f * K);
+    }
+}
+
+TEST_F(attr_test_t, TestDeterministic) {
+    dnnl::primitive_attr attr;
+    ASSERT_FALSE(attr.get_deterministic());
+
+    for (bool value : {true, false}) {
+        attr.set_deterministic(value);
+        ASSERT_EQ(value, attr.get_deterministic());
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestDeterministicExec) {
+    SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+            "GPU engine is not supported");
+    engine eng = get_test_engine();
+
+    // Few channels and a large minibatch make implementations reduce the
+    // statistics across threads unless the deterministic mode is set.
+    const memory::dim N = 64, C = 16, H = 7, W = 7;
+    for (auto data_tag : {tag::nchw, tag::nhwc, tag::nChw16c}) {
+        memory::desc data_md({N, C, H, W}, data_type::f32, data_tag);
+        auto src = test::make_memory(data_md, eng);
+        fill_data<float>(N * C * H * W, src);
+
+        stream s(eng);
+        std::vector<float> ref_mean;
+        for (int size : {0, 1, 2, 3}) {
+            dnnl::primitive_attr attr;
+            attr.set_deterministic(true);
+            attr.set_thread_team_size(size);
+            auto bnorm_pd = batch_normalization_forward::primitive_desc(eng,
+                    prop_kind::forward_training, data_md, data_md, 1e-5f,
+                    normalization_flags::none, attr);
+            ASSERT_TRUE(bnorm_pd.get_primitive_attr().get_deterministic());
+
+            auto dst = test::make_memory(bnorm_pd.dst_desc(), eng);
+            auto mean = test::make_memory(bnorm_pd.mean_desc(), eng);
+            auto var = test::make_memory(bnorm_pd.variance_desc(), eng);
+            batch_normalization_forward(bnorm_pd).execute(s,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_MEAN, mean}, {DNNL_ARG_VARIANCE, var}});
+            s.wait();
+
+            auto mean_mapped = map_memory<float>(mean);
+            auto var_mapped = map_memory<float>(var);
+            const float *mean_ptr = mean_mapped;
+            const float *var_ptr = var_mapped;
+            if (ref_mean.empty()) {
+                ref_mean.assign(mean_ptr, mean_ptr + C);
+                ref_mean.insert(ref_mean.end(), var_ptr, var_ptr + C);
+                continue;
+            }
+            // The results are expected to be bitwise equal.
+            for (memory::dim c = 0; c < C; c++) {
+                ASSERT_EQ(ref_mean[c], mean_ptr[c]);
+                ASSERT_EQ(ref_mean[C + c], var_ptr[c]);
+            }
+        }
+    }
+}
+
+TEST_F(attr_test_t, TestRoundingMode) {
+    dnnl::primitive_attr attr;
+    for (int arg : {DNNL_ARG_DST, DNNL_ARG_DIFF_SRC, DNNL_ARG_DIFF_WEIGHTS})
+        ASSERT_EQ(attr.get_rounding_mode(arg), rounding_mode::environment);
+
+    for (auto m : {rounding_mode::stochastic, rounding_mode::environment}) {
+        attr.set_rounding_mode(DNNL_ARG_DST, m);
+        ASSERT_EQ(attr.get_rounding_mode(DNNL_ARG_DST), m);
+        ASSERT_EQ(attr.get_rounding_mode(DNNL_ARG_DIFF_SRC),
+                rounding_mode::environment);
+    }
+
+    EXPECT_ANY_THROW(
+            attr.set_rounding_mode(DNNL_ARG_SRC, rounding_mode::stochastic));
+    EXPECT_ANY_THROW(attr.get_rounding_mode(DNNL_ARG_WEIGHTS));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestRoundingModeExec) {
+    SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+            "GPU engine is not supported");
+    SKIP_IF(unsupported_data_type(data_type::bf16),
+            "Engine does not support this data type.");
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim M = 16, K = 48, N = 32;
+    memory::desc src_md({M, K}, data_type::bf16, tag::ab);
+    memory::desc wei_md({K, N}, data_type::bf16, tag::ab);
+    memory::desc dst_f32_md({M, N}, data_type::f32, tag::ab);
+    memory::desc dst_bf16_md({M, N}, data_type::bf16, tag::ab);
+    memory::desc seed_md({1}, data_type::s32, tag::x);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    fill_data<bfloat16_t>(M * K, src);
+    fill_data<bfloat16_t>(K * N, wei);
+
+    auto ref_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_f32_md);
+    auto ref = test::make_memory(dst_f32_md, eng);
+    matmul(ref_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, ref}});
+
+    dnnl::primitive_attr attr;
+    attr.set_rounding_mode(DNNL_ARG_DST, rounding_mode::stochastic);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_bf16_md, attr);
+    ASSERT_EQ(pd.get_primitive_attr().get_rounding_mode(DNNL_ARG_DST),
+            rounding_mode::stochastic);
+    matmul prim(pd);
+
+    // The seed is a mandatory argument.
+    auto dst = test::make_memory(dst_bf16_md, eng);
+    EXPECT_ANY_THROW(prim.execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}}));
+
+    auto run = [&](int32_t seed_value) {
+        auto seed = test::make_memory(seed_md, eng);
+        {
+            auto seed_mapped = map_memory<int32_t>(seed);
+            seed_mapped[0] = seed_value;
+        }
+        auto out = test::make_memory(dst_bf16_md, eng);
+        prim.execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, out},
+                        {DNNL_ARG_ATTR_ROUNDING_SEED, seed}});
+        s.wait();
+        auto out_mapped = map_memory<uint16_t>(out);
+        const uint16_t *out_ptr = out_mapped;
+        return std::vector<uint16_t>(out_ptr, out_ptr + M * N);
+    };
+
+    const auto res_a = run(1);
+    const auto res_b = run(1);
+    const auto res_c = run(2);
+    ASSERT_EQ(res_a, res_b);
+    ASSERT_NE(res_a, res_c);
+
+    // Stochastic rounding returns one of the two bf16 values around the
+    // exact result.
+    auto ref_mapped = map_memory<float>(ref);
+    const float *ref_ptr = ref_mapped;
+    for (memory::dim i = 0; i < M * N; i++) {
+        uint32_t bits = static_cast<uint32_t>(res_a[i]) << 16;
+        float val;
+        std::memcpy(&val, &bits, sizeof(val));
+        const float ulp = std::fabs(ref_ptr[i]) / 128.f;
+        ASSERT_LE(std::fabs(val - ref_ptr[i]), ulp);
+    }
+}
+
+TEST_F(attr_test_t, TestDropout) {
+    dnnl::primitive_attr attr;
+    memory::desc mask_md;
+    ASSERT_FALSE(attr.get_dropout(mask_md));
+    ASSERT_EQ(mask_md, memory::desc());
+
+    attr.set_dropout();
+    ASSERT_TRUE(attr.get_dropout(mask_md));
+    ASSERT_EQ(mask_md, memory::desc());
+
+    memory::desc user_mask_md({2, 3}, data_type::u8, tag::any);
+    attr.set_dropout(user_mask_md);
+    ASSERT_TRUE(attr.get_dropout(mask_md));
+    ASSERT_EQ(mask_md, user_mask_md);
+
+    EXPECT_ANY_THROW(attr.set_dropout(
+            memory::desc({2, 3}, data_type::f32, tag::any)));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestDropoutExec) {
+    SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+            "GPU engine is not supported");
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim M = 16, K = 8, N = 40;
+    memory::desc src_md({M, K}, data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, data_type::f32, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+    memory::desc mask_md({M, N}, data_type::u8, tag::any);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * N, wei);
+
+    auto ref_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    auto ref = test::make_memory(dst_md, eng);
+    matmul(ref_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, ref}});
+
+    dnnl::primitive_attr attr;
+    attr.set_dropout(mask_md);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    const auto exec_mask_md
+            = pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_DROPOUT_MASK);
+    ASSERT_EQ(exec_mask_md.get_format_kind(), memory::format_kind::blocked);
+    matmul prim(pd);
+
+    auto make_scalar = [&](memory::data_type dt, float value) {
+        auto mem = test::make_memory(memory::desc({1}, dt, tag::x), eng);
+        if (dt == data_type::f32) {
+            auto mapped = map_memory<float>(mem);
+            mapped[0] = value;
+        } else {
+            auto mapped = map_memory<int32_t>(mem);
+            mapped[0] = static_cast<int32_t>(value);
+        }
+        return mem;
+    };
+
+    auto run = [&](float p, int32_t seed, memory &dst, memory &mask) {
+        dst = test::make_memory(dst_md, eng);
+        mask = test::make_memory(exec_mask_md, eng);
+        prim.execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_DROPOUT_MASK, mask},
+                        {DNNL_ARG_ATTR_DROPOUT_PROBABILITY,
+                                make_scalar(data_type::f32, p)},
+                        {DNNL_ARG_ATTR_DROPOUT_SEED,
+                                make_scalar(data_type::s32, seed)}});
+        s.wait();
+    };
+
+    memory dst_a, mask_a, dst_b, mask_b, dst_c, mask_c;
+    run(0.25f, 7, dst_a, mask_a);
+    run(0.25f, 7, dst_b, mask_b);
+    run(0.25f, 8, dst_c, mask_c);
+
+    auto ref_ptr = map_memory<float>(ref);
+    auto dst_a_ptr = map_memory<float>(dst_a);
+    auto dst_b_ptr = map_memory<float>(dst_b);
+    auto mask_a_ptr = map_memory<uint8_t>(mask_a);
+    auto mask_b_ptr = map_memory<uint8_t>(mask_b);
+    auto mask_c_ptr = map_memory<uint8_t>(mask_c);
+
+    memory::dim n_kept = 0, n_diff = 0;
+    for (memory::dim i = 0; i < M * N; i++) {
+        ASSERT_EQ(mask_a_ptr[i], mask_b_ptr[i]);
+        ASSERT_EQ(dst_a_ptr[i], dst_b_ptr[i]);
+        ASSERT_TRUE(mask_a_ptr[i] == 0 || mask_a_ptr[i] == 1);
+        const float expected = mask_a_ptr[i] ? ref_ptr[i] / 0.75f : 0.f;
+        ASSERT_NEAR(dst_a_ptr[i], expected, 1e-5f * std::fabs(expected));
+        n_kept += mask_a_ptr[i];
+        n_diff += mask_a_ptr[i] != mask_c_ptr[i];
+    }
+    // The share of kept elements is expected to be close to 1 - p.
+    ASSERT_GT(n_kept, M * N / 2);
+    ASSERT_LT(n_kept, M * N);
+    ASSERT_GT(n_diff, 0);
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
@@ -581,6 +893,389 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusion) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, PointwiseFusionPostop) {
+    dnnl::primitive_attr attr;
+    dnnl::post_ops ops;
+
+    data_type wei_dt = data_type::undef;
+    data_type bias_dt = data_type::undef;
+    data_type dst_dt = data_type::undef;
+    memory::dim oc = -1;
+
+    // Pointwise post-op must follow a depthwise one.
+    EXPECT_ANY_THROW(ops.append_pw(memory::data_type::s8,
+            memory::data_type::f32, memory::data_type::u8, 32));
+    ASSERT_EQ(ops.len(), 0);
+
+    ops.append_dw(memory::data_type::s8, memory::data_type::f32,
+            memory::data_type::u8, 3, 1, 1);
+    ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    ops.append_pw(memory::data_type::s8, memory::data_type::f32,
+            memory::data_type::f32, 32);
+    attr.set_post_ops(ops);
+
+    ASSERT_EQ(attr.get_post_ops().len(), 3);
+    ASSERT_EQ(attr.get_post_ops().kind(2), primitive::kind::inner_product);
+    attr.get_post_ops().get_params_pw(2, wei_dt, bias_dt, dst_dt, oc);
+    ASSERT_EQ(wei_dt, memory::data_type::s8);
+    ASSERT_EQ(bias_dt, memory::data_type::f32);
+    ASSERT_EQ(dst_dt, memory::data_type::f32);
+    ASSERT_EQ(oc, 32);
+
+    EXPECT_ANY_THROW(attr.get_post_ops().get_params_pw(
+            0, wei_dt, bias_dt, dst_dt, oc));
+
+    // Only one pointwise post-op is allowed.
+    EXPECT_ANY_THROW(ops.append_pw(memory::data_type::f32,
+            memory::data_type::f32, memory::data_type::f32, 16));
+    EXPECT_ANY_THROW(ops.append_pw(memory::data_type::f32,
+            memory::data_type::undef, memory::data_type::f32, 0));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, InvertedResidualFusion) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Pointwise fusion is only supported on CPU engine");
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim mb = 2, ic = 16, c = 96, oc = 24, h = 112, w = 112;
+    const auto dt = data_type::f32;
+
+    // Brings user data in a plain layout to the layout a primitive expects.
+    auto prepare = [&](const memory::desc &md, memory user_mem) -> memory {
+        if (md == user_mem.get_desc()) return user_mem;
+        memory mem(md, e);
+        reorder(user_mem, mem).execute(s, user_mem, mem);
+        return mem;
+    };
+
+    for (memory::dim stride : {1, 2}) {
+        const memory::dim oh = (h + stride - 1) / stride;
+        const memory::dim ow = (w + stride - 1) / stride;
+
+        memory::desc src_md {{mb, ic, h, w}, dt, tag::nhwc};
+        memory::desc mid_md {{mb, c, h, w}, dt, tag::nhwc};
+        memory::desc dw_dst_md {{mb, c, oh, ow}, dt, tag::nhwc};
+        memory::desc dst_md {{mb, oc, oh, ow}, dt, tag::nhwc};
+        memory::desc wei_1x1_md {{c, ic, 1, 1}, dt, tag::oihw};
+        memory::desc wei_dw_md {{c, 1, 1, 3, 3}, dt, tag::goihw};
+        memory::desc wei_pw_md {{oc, c, 1, 1}, dt, tag::oihw};
+        memory::desc bia_md {{c}, dt, tag::x};
+        memory::desc bia_pw_md {{oc}, dt, tag::x};
+
+        memory src(src_md, e), wei_1x1(wei_1x1_md, e), bia_1x1(bia_md, e);
+        memory wei_dw(wei_dw_md, e), bia_dw(bia_md, e);
+        memory wei_pw(wei_pw_md, e), bia_pw(bia_pw_md, e);
+        memory dst(dst_md, e), dst_ref(dst_md, e);
+        for (auto *m : {&src, &wei_1x1, &bia_1x1, &wei_dw, &bia_dw})
+            fill_data<float>(
+                    m->get_desc().get_size() / sizeof(float), *m, 0.f, 1.f);
+        // The clipped depthwise output is non-negative, so the final
+        // destination does not suffer from cancellation if the rest of the
+        // data is non-negative as well.
+        for (auto *m : {&wei_pw, &bia_pw, &dst})
+            fill_data<float>(
+                    m->get_desc().get_size() / sizeof(float), *m, 0.5f, 0.5f);
+        {
+            auto dst_ptr = map_memory<float>(dst);
+            auto dst_ref_ptr = map_memory<float>(dst_ref);
+            for (size_t i = 0; i < dst_md.get_size() / sizeof(float); ++i)
+                dst_ref_ptr[i] = dst_ptr[i];
+        }
+
+        // Reference: three separate convolutions.
+        post_ops ops_1x1, ops_dw, ops_pw;
+        ops_1x1.append_eltwise(algorithm::eltwise_clip, 0.f, 6.f);
+        ops_dw.append_eltwise(algorithm::eltwise_clip, 0.f, 6.f);
+        ops_pw.append_sum();
+        primitive_attr attr_1x1, attr_dw, attr_pw;
+        attr_1x1.set_post_ops(ops_1x1);
+        attr_dw.set_post_ops(ops_dw);
+        attr_pw.set_post_ops(ops_pw);
+
+        auto pd_1x1 = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_1x1_md, bia_md, mid_md, {1, 1}, {0, 0}, {0, 0},
+                attr_1x1);
+        auto pd_dw = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                mid_md, wei_dw_md, bia_md, dw_dst_md, {stride, stride},
+                {1, 1}, {(oh - 1) * stride - h + 2, (ow - 1) * stride - w + 2},
+                attr_dw);
+        auto pd_pw = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                dw_dst_md, wei_pw_md, bia_pw_md, dst_md, {1, 1}, {0, 0},
+                {0, 0}, attr_pw);
+
+        memory mid(mid_md, e), dw_dst(dw_dst_md, e);
+        convolution_forward(pd_1x1).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei_1x1},
+                        {DNNL_ARG_BIAS, bia_1x1}, {DNNL_ARG_DST, mid}});
+        convolution_forward(pd_dw).execute(s,
+                {{DNNL_ARG_SRC, mid}, {DNNL_ARG_WEIGHTS, wei_dw},
+                        {DNNL_ARG_BIAS, bia_dw}, {DNNL_ARG_DST, dw_dst}});
+        convolution_forward(pd_pw).execute(s,
+                {{DNNL_ARG_SRC, dw_dst}, {DNNL_ARG_WEIGHTS, wei_pw},
+                        {DNNL_ARG_BIAS, bia_pw}, {DNNL_ARG_DST, dst_ref}});
+
+        // Fused inverted residual block.
+        post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_clip, 0.f, 6.f);
+        ops.append_dw(dt, dt, dt, 3, stride, 1);
+        ops.append_eltwise(algorithm::eltwise_clip, 0.f, 6.f);
+        ops.append_pw(dt, dt, dt, oc);
+        ops.append_sum();
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        const int pw_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(3);
+
+        auto pd = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, memory::desc({c, ic, 1, 1}, dt, tag::any), bia_md,
+                mid_md, {1, 1}, {0, 0}, {0, 0}, attr);
+        ASSERT_EQ(pd.dst_desc(), dst_md);
+        std::string impl_info;
+        ASSERT_NO_THROW(impl_info = pd.impl_info_str());
+        ASSERT_EQ(impl_info.find("streaming_fused_convolution"), 0u);
+
+        convolution_forward(pd).execute(s,
+                {{DNNL_ARG_SRC, src},
+                        {DNNL_ARG_WEIGHTS,
+                                prepare(pd.weights_desc(), wei_1x1)},
+                        {DNNL_ARG_BIAS, bia_1x1},
+                        {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS,
+                                prepare(pd.query_md(query::exec_arg_md,
+                                                DNNL_ARG_ATTR_POST_OP_DW
+                                                        | DNNL_ARG_WEIGHTS),
+                                        wei_dw)},
+                        {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS, bia_dw},
+                        {pw_arg | DNNL_ARG_WEIGHTS,
+                                prepare(pd.query_md(query::exec_arg_md,
+                                                pw_arg | DNNL_ARG_WEIGHTS),
+                                        wei_pw)},
+                        {pw_arg | DNNL_ARG_BIAS, bia_pw},
+                        {DNNL_ARG_DST, dst}});
+        s.wait();
+
+        compare_data<float>(dst_ref, dst);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, PoolingPostop) {
+    dnnl::primitive_attr attr;
+    dnnl::post_ops ops;
+
+    algorithm alg = algorithm::undef;
+    memory::dim kh = -1, kw = -1;
+
+    EXPECT_ANY_THROW(ops.append_pooling(algorithm::eltwise_relu, 2, 2));
+    EXPECT_ANY_THROW(ops.append_pooling(algorithm::pooling_max, 0, 2));
+    ASSERT_EQ(ops.len(), 0);
+
+    ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    ops.append_pooling(algorithm::pooling_avg_exclude_padding, 2, 3);
+    attr.set_post_ops(ops);
+
+    ASSERT_EQ(attr.get_post_ops().len(), 2);
+    ASSERT_EQ(attr.get_post_ops().kind(1), primitive::kind::pooling);
+    attr.get_post_ops().get_params_pooling(1, alg, kh, kw);
+    ASSERT_EQ(alg, algorithm::pooling_avg_exclude_padding);
+    ASSERT_EQ(kh, 2);
+    ASSERT_EQ(kw, 3);
+
+    EXPECT_ANY_THROW(attr.get_post_ops().get_params_pooling(0, alg, kh, kw));
+
+    // Only one pooling post-op is allowed.
+    EXPECT_ANY_THROW(ops.append_pooling(algorithm::pooling_max, 2, 2));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, ConvolutionPoolingFusion) {
+    auto engine_kind = get_test_engine_kind();
+    bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
+            || (engine_kind != engine::kind::cpu);
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    skip_test = skip_test || !dnnl::mayiuse(cpu_isa::avx512_core);
+#endif
+    SKIP_IF(skip_test,
+            "Pooling post-op is supported by brgemm convolution on CPU only");
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim mb = 2, ic = 32, oc = 64, h = 28, w = 27;
+    const memory::dim ph = h / 2, pw = w / 2;
+    const auto dt = data_type::f32;
+
+    memory::desc src_md {{mb, ic, h, w}, dt, tag::nhwc};
+    memory::desc wei_md {{oc, ic, 3, 3}, dt, tag::oihw};
+    memory::desc bia_md {{oc}, dt, tag::x};
+    memory::desc conv_dst_md {{mb, oc, h, w}, dt, tag::nhwc};
+    memory::desc dst_md {{mb, oc, ph, pw}, dt, tag::nhwc};
+
+    memory src(src_md, e), wei(wei_md, e), bia(bia_md, e);
+    for (auto *m : {&src, &wei, &bia})
+        fill_data<float>(
+                m->get_desc().get_size() / sizeof(float), *m, 0.f, 1.f);
+
+    for (auto alg : {algorithm::pooling_max,
+                 algorithm::pooling_avg_include_padding}) {
+        // Reference: convolution followed by pooling.
+        post_ops ops_conv;
+        ops_conv.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr_conv;
+        attr_conv.set_post_ops(ops_conv);
+        auto pd_conv = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, bia_md, conv_dst_md, {1, 1}, {1, 1}, {1, 1},
+                attr_conv);
+        auto pd_pool = pooling_forward::primitive_desc(e,
+                prop_kind::forward_inference, alg, conv_dst_md, dst_md, {2, 2},
+                {2, 2}, {0, 0}, {0, 0}, {0, 0});
+
+        memory conv_dst(conv_dst_md, e), dst_ref(dst_md, e);
+        convolution_forward(pd_conv).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, conv_dst}});
+        pooling_forward(pd_pool).execute(
+                s, {{DNNL_ARG_SRC, conv_dst}, {DNNL_ARG_DST, dst_ref}});
+
+        // Fused convolution with pooling post-op.
+        post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+        ops.append_pooling(alg, 2, 2);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+
+        auto pd = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, memory::desc({oc, ic, 3, 3}, dt, tag::any), bia_md,
+                conv_dst_md, {1, 1}, {1, 1}, {1, 1}, attr);
+        ASSERT_EQ(pd.dst_desc(), dst_md);
+        std::string impl_info;
+        ASSERT_NO_THROW(impl_info = pd.impl_info_str());
+        ASSERT_EQ(impl_info.find("brg"), 0u);
+
+        memory fused_wei = wei;
+        if (pd.weights_desc() != wei_md) {
+            fused_wei = memory(pd.weights_desc(), e);
+            reorder(wei, fused_wei).execute(s, wei, fused_wei);
+        }
+        memory dst(dst_md, e);
+        convolution_forward(pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, fused_wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst}});
+        s.wait();
+
+        compare_data<float>(dst_ref, dst);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestBatchNormalizationStats) {
+    dnnl::primitive_attr attr;
+    ASSERT_FALSE(attr.get_batch_normalization_stats());
+
+    attr.set_batch_normalization_stats();
+    ASSERT_TRUE(attr.get_batch_normalization_stats());
+
+    attr.set_batch_normalization_stats(false);
+    ASSERT_FALSE(attr.get_batch_normalization_stats());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, ConvolutionBatchNormalizationStats) {
+    auto engine_kind = get_test_engine_kind();
+    bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
+            || (engine_kind != engine::kind::cpu);
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    skip_test = skip_test || !dnnl::mayiuse(cpu_isa::avx512_core);
+#endif
+    SKIP_IF(skip_test,
+            "Batch normalization statistics are supported by brgemm "
+            "convolution on CPU only");
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    struct conv_shape_t {
+        memory::dim mb, ic, oc, h, w, k, stride, pad;
+        bool with_post_ops;
+    };
+    // Shapes with padded borders store part of dst through the post-ops
+    // kernel, the last one has no bias and no post-ops.
+    const std::vector<conv_shape_t> shapes {
+            {3, 32, 40, 13, 17, 3, 1, 1, true},
+            {2, 16, 64, 15, 15, 3, 2, 0, true},
+            {2, 24, 24, 9, 7, 5, 1, 2, true},
+            {1, 16, 48, 11, 11, 3, 1, 1, false},
+    };
+    const auto dt = data_type::f32;
+
+    for (const auto &sh : shapes) {
+        const memory::dim oh = (sh.h + 2 * sh.pad - sh.k) / sh.stride + 1;
+        const memory::dim ow = (sh.w + 2 * sh.pad - sh.k) / sh.stride + 1;
+        memory::desc src_md {{sh.mb, sh.ic, sh.h, sh.w}, dt, tag::nhwc};
+        memory::desc wei_md {{sh.oc, sh.ic, sh.k, sh.k}, dt, tag::oihw};
+        memory::desc bia_md {{sh.oc}, dt, tag::x};
+        memory::desc dst_md {{sh.mb, sh.oc, oh, ow}, dt, tag::nhwc};
+        memory::desc stat_md {{sh.oc}, dt, tag::x};
+
+        memory src(src_md, e), wei(wei_md, e), bia(bia_md, e);
+        for (auto *m : {&src, &wei, &bia})
+            fill_data<float>(
+                    m->get_desc().get_size() / sizeof(float), *m, 0.f, 1.f);
+
+        primitive_attr attr;
+        if (sh.with_post_ops) {
+            post_ops ops;
+            ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+            attr.set_post_ops(ops);
+        }
+        attr.set_batch_normalization_stats();
+
+        auto pd = convolution_forward::primitive_desc(e,
+                prop_kind::forward_training, algorithm::convolution_direct,
+                src_md, memory::desc({sh.oc, sh.ic, sh.k, sh.k}, dt, tag::any),
+                sh.with_post_ops ? bia_md : memory::desc(), dst_md,
+                {sh.stride, sh.stride}, {sh.pad, sh.pad}, {sh.pad, sh.pad},
+                attr);
+        std::string impl_info;
+        ASSERT_NO_THROW(impl_info = pd.impl_info_str());
+        ASSERT_EQ(impl_info.find("brg"), 0u);
+        ASSERT_EQ(pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_STATS_MEAN),
+                stat_md);
+        ASSERT_EQ(pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_STATS_VARIANCE),
+                stat_md);
+
+        memory conv_wei = wei;
+        if (pd.weights_desc() != wei_md) {
+            conv_wei = memory(pd.weights_desc(), e);
+            reorder(wei, conv_wei).execute(s, wei, conv_wei);
+        }
+        memory dst(dst_md, e), mean(stat_md, e), variance(stat_md, e);
+        convolution_forward(pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, conv_wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_STATS_MEAN, mean},
+                        {DNNL_ARG_ATTR_STATS_VARIANCE, variance}});
+
+        // Reference: statistics computed by batch normalization.
+        auto pd_bnorm = batch_normalization_forward::primitive_desc(e,
+                prop_kind::forward_training, dst_md, dst_md, 0.f,
+                normalization_flags::none);
+        memory bnorm_dst(dst_md, e), mean_ref(stat_md, e),
+                variance_ref(stat_md, e);
+        batch_normalization_forward(pd_bnorm).execute(s,
+                {{DNNL_ARG_SRC, dst}, {DNNL_ARG_DST, bnorm_dst},
+                        {DNNL_ARG_MEAN, mean_ref},
+                        {DNNL_ARG_VARIANCE, variance_ref}});
+        s.wait();
+
+        compare_data<float>(mean_ref, mean);
+        compare_data<float>(variance_ref, variance);
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, InnerProdBlockedWeights) {
     auto engine_kind = get_test_engine_kind();
     bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
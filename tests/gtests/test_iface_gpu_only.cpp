@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2022 Intel Corporation
+* Copyright 2021-2023 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -33,6 +33,15 @@ TEST(iface_gpu_only, gemm) {
     status = dnnl_gemm_s8s8s32('N', 'N', 'C', 1, 1, 1, 1.0f, nullptr, 1, 0,
             nullptr, 1, 0, 0.0f, nullptr, 1, nullptr);
     ASSERT_EQ(status, dnnl_unimplemented);
+
+    size_t size = 0;
+    status = dnnl_sgemm_pack_get_size('A', 'N', 'N', 1, 1, 1, 1, 1, &size);
+    ASSERT_EQ(status, dnnl_unimplemented);
+    status = dnnl_sgemm_pack('A', 'N', 'N', 1, 1, 1, 1, 1, nullptr, nullptr);
+    ASSERT_EQ(status, dnnl_unimplemented);
+    status = dnnl_sgemm_compute(
+            'P', 'N', 1, 1, 1, nullptr, 1, nullptr, 1, 0.0f, nullptr, 1);
+    ASSERT_EQ(status, dnnl_unimplemented);
 }
 
 TEST(iface_gpu_only, isa) {
@@ -53,6 +53,10 @@ protected:
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
         input_f32.wino_supported = is_gpu;
         input_f16.wino_supported = is_gpu;
+#endif
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        if (get_test_engine_kind() == engine::kind::cpu)
+            input_f32.wino_supported = mayiuse(cpu_isa::avx2);
 #endif
     }
 };
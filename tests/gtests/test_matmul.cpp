@@ -19,6 +19,7 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include <cmath>
 #include <vector>
 
 namespace dnnl {
@@ -383,6 +384,76 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(
     ASSERT_EQ(impl_info_no_postops, impl_info_with_postops);
 }
 
+struct grouped_test_t
+    : public ::testing::TestWithParam<std::tuple<memory::dim, memory::dim,
+              memory::dim, std::vector<int32_t>>> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(grouped_test_t, TestGroupedMatmul) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Grouped matmul is supported on CPU only");
+    engine e {engine_kind, 0};
+
+    const memory::dim M = std::get<0>(GetParam());
+    const memory::dim K = std::get<1>(GetParam());
+    const memory::dim N = std::get<2>(GetParam());
+    const auto &offsets = std::get<3>(GetParam());
+    const memory::dim G = (memory::dim)offsets.size() - 1;
+
+    memory::desc src_md({M, K}, memory::data_type::f32, tag::ab);
+    memory::desc wei_md({G, K, N}, memory::data_type::f32, tag::abc);
+    memory::desc dst_md({M, N}, memory::data_type::f32, tag::ab);
+    memory::desc off_md({G + 1}, memory::data_type::s32, tag::a);
+
+    auto pd = matmul::primitive_desc(e, src_md, wei_md, dst_md);
+    auto src = test::make_memory(src_md, e);
+    auto wei = test::make_memory(wei_md, e);
+    auto dst = test::make_memory(dst_md, e);
+    auto off = test::make_memory(off_md, e);
+    fill_data<float>(M * K, src, 1.f, 0.5f);
+    fill_data<float>(G * K * N, wei, 1.f, 0.5f);
+    fill_data<float>(M * N, dst, 7.f, 0.f);
+    {
+        auto off_ptr = map_memory<int32_t>(off);
+        for (memory::dim g = 0; g <= G; g++)
+            off_ptr[g] = offsets[g];
+    }
+
+    stream s(e);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}, {DNNL_ARG_GROUP_OFFSETS, off}});
+    s.wait();
+
+    auto src_ptr = map_memory<float>(src);
+    auto wei_ptr = map_memory<float>(wei);
+    auto dst_ptr = map_memory<float>(dst);
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        memory::dim g = -1;
+        for (memory::dim i = 0; i < G; i++)
+            if (offsets[i] <= m && m < offsets[i + 1]) g = i;
+        // Rows not covered by any group are left untouched.
+        float ref = 7.f;
+        if (g >= 0) {
+            ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src_ptr[m * K + k] * wei_ptr[(g * K + k) * N + n];
+        }
+        ASSERT_NEAR(ref, dst_ptr[m * N + n], 1e-4f * (1.f + std::fabs(ref)))
+                << "m: " << m << " n: " << n;
+    }
+
+    // Offsets outside of [0, M] are rejected at execution time.
+    {
+        auto off_ptr = map_memory<int32_t>(off);
+        off_ptr[G] = (int32_t)M + 1;
+    }
+    EXPECT_ANY_THROW(matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}, {DNNL_ARG_GROUP_OFFSETS, off}}));
+}
+
 /********************************* TEST CASES *********************************/
 
 using iface = matmul_iface_test_t;
@@ -404,8 +475,9 @@ static auto cases_ef = []() {
                              {{1, 20}, data_type::f32, tag::ab},
                              {{10, 21}, data_type::f32, tag::ab}},
             {}, true, dnnl_invalid_arguments});
+    // 2D src with 3D weights is a grouped matmul
     cases.push_back({{{{10, 1}, data_type::f32, tag::ab},
-                             {{1, 1, 20}, data_type::f32, tag::abc},
+                             {{1, 2, 20}, data_type::f32, tag::abc},
                              {{10, 20}, data_type::f32, tag::ab}},
             {}, true, dnnl_invalid_arguments});
     cases.push_back({{{{1, 10, 1}, data_type::u8, tag::abc},
@@ -683,4 +755,14 @@ INSTANTIATE_TEST_SUITE_P(TensorDims, attr_test_t,
                         memory::dims {2, 10, 10, 10}, tag::abcd,
                         memory::data_type::f16, 4)));
 
+INSTANTIATE_TEST_SUITE_P(Grouped, grouped_test_t,
+        ::testing::Values(
+                // M, K, N, group offsets
+                std::make_tuple(64, 16, 24, std::vector<int32_t> {0, 64}),
+                std::make_tuple(
+                        100, 33, 70, std::vector<int32_t> {0, 7, 7, 61, 100}),
+                std::make_tuple(
+                        50, 8, 130, std::vector<int32_t> {3, 40, 41, 45}),
+                std::make_tuple(5, 3, 1, std::vector<int32_t> {0, 0, 0})));
+
 } // namespace dnnl
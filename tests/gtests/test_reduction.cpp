@@ -163,7 +163,16 @@ static auto simple_cases = []() {
                     {1, 4, 4, 1}},
             reduction_test_params_t {tag::nChw16c, tag::any,
                     algorithm::reduction_min, 0.0f, 0.0f, {4, 4, 4, 4},
-                    {1, 1, 1, 1}});
+                    {1, 1, 1, 1}},
+            reduction_test_params_t {tag::nhwc, tag::nhwc,
+                    algorithm::reduction_sum, 0.0f, 0.0f, {2, 32, 4, 4},
+                    {2, 32, 1, 1}},
+            reduction_test_params_t {tag::nchw, tag::nchw,
+                    algorithm::reduction_max, 0.0f, 0.0f, {2, 64, 4, 4},
+                    {2, 1, 4, 4}},
+            reduction_test_params_t {tag::nChw16c, tag::nChw16c,
+                    algorithm::reduction_sum, 0.0f, 0.0f, {2, 32, 8, 8},
+                    {1, 32, 1, 8}});
 };
 
 static auto f32_cases = []() {
@@ -175,7 +184,10 @@ static auto f32_cases = []() {
                     {1, 1, 1, 4}, {1, 1, 1, 1}},
             reduction_test_params_t {tag::nchw, tag::nchw,
                     algorithm::reduction_mean, 0.0f, 0.0f, {1, 4, 4, 4},
-                    {1, 1, 4, 4}});
+                    {1, 1, 4, 4}},
+            reduction_test_params_t {tag::nhwc, tag::nhwc,
+                    algorithm::reduction_norm_lp_sum, 3.0f, 1e-4f,
+                    {2, 32, 4, 4}, {2, 32, 1, 1}});
 };
 
 #define INST_TEST_CASE(test) \
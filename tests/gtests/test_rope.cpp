@@ -0,0 +1,403 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <math.h>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+namespace {
+
+memory::dim product(const memory::dims &dims) {
+    memory::dim prod = 1;
+    for (auto d : dims)
+        prod *= d;
+    return prod;
+}
+
+// Rotates pairs of `x` of a head for the position `pos`.
+void ref_rope(float *x, memory::dim pos, algorithm alg, memory::dim rd,
+        float base, const float *cos = nullptr, const float *sin = nullptr) {
+    for (memory::dim i = 0; i < rd / 2; i++) {
+        const float angle = pos * powf(base, -2.f * i / rd);
+        const float c = cos ? cos[i] : cosf(angle);
+        const float s = sin ? sin[i] : sinf(angle);
+        const memory::dim i0 = alg == algorithm::rope_interleaved ? 2 * i : i;
+        const memory::dim i1
+                = alg == algorithm::rope_interleaved ? 2 * i + 1 : i + rd / 2;
+        const float x0 = x[i0], x1 = x[i1];
+        x[i0] = x0 * c - x1 * s;
+        x[i1] = x0 * s + x1 * c;
+    }
+}
+
+} // namespace
+
+struct rope_test_params_t {
+    algorithm aalgorithm;
+    memory::dims dims;
+    memory::dim rotary_dim;
+    bool with_cos_sin;
+    std::vector<int32_t> offsets;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class rope_test_t : public ::testing::TestWithParam<rope_test_params_t> {
+private:
+    rope_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits<data_t>::data_type;
+
+        p = ::testing::TestWithParam<rope_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    const float base = 10000.f;
+
+    void check_result(const memory &src, const memory &cos, const memory &sin,
+            const memory &dst) {
+        auto src_ptr = map_memory<data_t>(src);
+        auto dst_ptr = map_memory<data_t>(dst);
+        auto cos_ptr = map_memory<float>(cos);
+        auto sin_ptr = map_memory<float>(sin);
+
+        const memory::dim MB = p.dims[0];
+        const memory::dim S = p.dims[p.dims.size() - 2];
+        const memory::dim D = p.dims[p.dims.size() - 1];
+        const memory::dim rows = product(p.dims) / D;
+        const float eps = data_dt == dt::f32 ? 1e-5f : 2e-2f;
+
+        std::vector<float> x(D);
+        for (memory::dim r = 0; r < rows; r++) {
+            const memory::dim mb = r / (rows / MB);
+            const memory::dim s = r % S;
+            const memory::dim pos = s + (p.offsets.empty() ? 0 : p.offsets[mb]);
+            for (memory::dim d = 0; d < D; d++)
+                x[d] = (float)src_ptr[r * D + d];
+            if (p.with_cos_sin)
+                ref_rope(x.data(), pos, p.aalgorithm, p.rotary_dim, base,
+                        &cos_ptr[pos * p.rotary_dim / 2],
+                        &sin_ptr[pos * p.rotary_dim / 2]);
+            else
+                ref_rope(x.data(), pos, p.aalgorithm, p.rotary_dim, base);
+            for (memory::dim d = 0; d < D; d++) {
+                const float out = (float)dst_ptr[r * D + d];
+                ASSERT_NEAR(out, x[d], eps * std::max(1.f, std::abs(x[d])))
+                        << "row: " << r << " d: " << d;
+            }
+        }
+    }
+
+    void Test() {
+        using pd_t = rope::primitive_desc;
+        allows_attr_t allowed_attributes {false};
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim MB = p.dims[0];
+        const memory::dim S = p.dims[p.dims.size() - 2];
+        const memory::dim n_positions = S + 8;
+        const memory::format_tag plain
+                = p.dims.size() == 4 ? tag::abcd : tag::abc;
+        auto desc_src = memory::desc(p.dims, data_dt, plain);
+        auto desc_cs = memory::desc(
+                {n_positions, p.rotary_dim / 2}, dt::f32, tag::ab);
+        auto desc_off = p.offsets.empty()
+                ? memory::desc()
+                : memory::desc({MB}, dt::s32, tag::a);
+        auto desc_dst = memory::desc(p.dims, data_dt, tag::any);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        if (p.with_cos_sin || !p.offsets.empty()) {
+            auto cs = p.with_cos_sin ? desc_cs : memory::desc();
+            pd = pd_t(eng, p.aalgorithm, desc_src, cs, desc_off, desc_dst,
+                    p.rotary_dim, base);
+            test_fwd_pd_constructors<pd_t>(pd, allowed_attributes,
+                    p.aalgorithm, desc_src, cs, desc_off, desc_dst,
+                    p.rotary_dim, base);
+        } else {
+            pd = pd_t(eng, p.aalgorithm, desc_src, desc_dst, p.rotary_dim,
+                    base);
+            test_fwd_pd_constructors<pd_t>(pd, allowed_attributes,
+                    p.aalgorithm, desc_src, desc_dst, p.rotary_dim, base);
+        }
+
+        EXPECT_ANY_THROW(rope(pd, {}));
+        // default primitive ctor
+        auto prim = rope();
+        // regular primitive ctor
+        prim = rope(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC)
+                == pd.src_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST)
+                == pd.dst_desc());
+        if (p.with_cos_sin) { ASSERT_TRUE(pd.cos_sin_desc() == desc_cs); }
+        ASSERT_TRUE(pd.offsets_desc() == desc_off);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = test::make_memory(pd.src_desc(), test_engine);
+        auto mem_cos = test::make_memory(desc_cs, test_engine);
+        auto mem_sin = test::make_memory(desc_cs, test_engine);
+        auto mem_off = test::make_memory(
+                memory::desc({MB}, dt::s32, tag::a), test_engine);
+        auto mem_dst = test::make_memory(pd.dst_desc(), test_engine);
+
+        fill_data<data_t>(product(p.dims), mem_src);
+        {
+            // A cache is filled with arbitrary values to make sure they are
+            // used instead of computed ones.
+            auto cos_ptr = map_memory<float>(mem_cos);
+            auto sin_ptr = map_memory<float>(mem_sin);
+            for (memory::dim i = 0; i < n_positions * p.rotary_dim / 2; i++) {
+                cos_ptr[i] = std::cos(0.37f * i);
+                sin_ptr[i] = std::sin(0.53f * i);
+            }
+            auto off_ptr = map_memory<int32_t>(mem_off);
+            for (size_t mb = 0; mb < p.offsets.size(); mb++)
+                off_ptr[mb] = p.offsets[mb];
+        }
+
+        std::unordered_map<int, memory> args
+                = {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_DST, mem_dst}};
+        if (p.with_cos_sin) {
+            args.insert({DNNL_ARG_ROPE_COS, mem_cos});
+            args.insert({DNNL_ARG_ROPE_SIN, mem_sin});
+        }
+        if (!p.offsets.empty()) args.insert({DNNL_ARG_OFFSETS, mem_off});
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        check_result(mem_src, mem_cos, mem_sin, mem_dst);
+    }
+
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // odd rotary dimension
+            rope_test_params_t {algorithm::rope_interleaved, {2, 4, 16}, 7,
+                    false, {}, true, dnnl_invalid_arguments},
+            // rotary dimension above the head size
+            rope_test_params_t {algorithm::rope_rotate_half, {2, 4, 16}, 32,
+                    false, {}, true, dnnl_invalid_arguments},
+            // not supported alg_kind
+            rope_test_params_t {algorithm::eltwise_relu, {2, 4, 16}, 16,
+                    false, {}, true, dnnl_invalid_arguments},
+            // sequence out of the cache
+            rope_test_params_t {algorithm::rope_interleaved, {2, 4, 16}, 16,
+                    true, {0, 9}, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            rope_test_params_t {algorithm::rope_interleaved, {2, 5, 16}, 16,
+                    false, {}},
+            rope_test_params_t {algorithm::rope_rotate_half, {2, 5, 16}, 16,
+                    false, {}},
+            rope_test_params_t {algorithm::rope_interleaved, {3, 2, 7, 64},
+                    32, false, {0, 100, 4096}},
+            rope_test_params_t {algorithm::rope_rotate_half, {3, 2, 7, 64},
+                    64, true, {0, 1, 8}},
+            rope_test_params_t {algorithm::rope_interleaved, {1, 4, 3, 128},
+                    96, true, {}},
+            rope_test_params_t {algorithm::rope_rotate_half, {2, 9, 80}, 40,
+                    false, {3, 17}});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsRope) {} \
+    INSTANTIATE_TEST_SUITE_P(TestRopeEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestRopeSimple, test, simple_cases());
+
+using rope_test_f32 = rope_test_t<float>;
+using rope_test_bf16 = rope_test_t<bfloat16_t>;
+
+INST_TEST_CASE(rope_test_f32)
+INST_TEST_CASE(rope_test_bf16)
+
+struct matmul_rope_test_params_t {
+    algorithm aalgorithm;
+    memory::dims src_dims;
+    memory::dims wei_dims;
+    memory::dim head_dim;
+    memory::dim rotary_dim;
+    bool with_offsets;
+    bool with_relu;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+// The rope post-op of matmul: rows of the destination are positions and the
+// columns are split into heads.
+class matmul_rope_test_t
+    : public ::testing::TestWithParam<matmul_rope_test_params_t> {
+private:
+    matmul_rope_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<matmul_rope_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this post-op.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    const float base = 500.f;
+
+    void Test() {
+        using tag = memory::format_tag;
+        using dt = memory::data_type;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const int ndims = (int)p.src_dims.size();
+        const memory::dim batch = ndims == 3 ? p.src_dims[0] : 1;
+        const memory::dim M = p.src_dims[ndims - 2];
+        const memory::dim K = p.src_dims[ndims - 1];
+        const memory::dim N = p.wei_dims[ndims - 1];
+        memory::dims dst_dims = p.src_dims;
+        dst_dims[ndims - 1] = N;
+        const tag plain = ndims == 3 ? tag::abc : tag::ab;
+
+        auto desc_src = memory::desc(p.src_dims, dt::f32, plain);
+        auto desc_wei = memory::desc(p.wei_dims, dt::f32, plain);
+        auto desc_dst = memory::desc(dst_dims, dt::f32, plain);
+
+        post_ops ops;
+        if (p.with_relu) ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+        ops.append_rope(p.aalgorithm, p.head_dim, p.rotary_dim, base);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+
+        {
+            algorithm alg;
+            memory::dim hd, rd;
+            float b;
+            ops.get_params_rope(ops.len() - 1, alg, hd, rd, b);
+            ASSERT_EQ(alg, p.aalgorithm);
+            ASSERT_EQ(hd, p.head_dim);
+            ASSERT_EQ(rd, p.rotary_dim);
+            ASSERT_EQ(b, base);
+        }
+
+        auto pd = matmul::primitive_desc(
+                eng, desc_src, desc_wei, desc_dst, attr);
+        auto prim = matmul(pd);
+
+        auto mem_src = test::make_memory(desc_src, eng);
+        auto mem_wei = test::make_memory(desc_wei, eng);
+        auto mem_dst = test::make_memory(desc_dst, eng);
+        auto mem_off = test::make_memory(
+                memory::desc({batch}, dt::s32, tag::a), eng);
+        fill_data<float>(product(p.src_dims), mem_src);
+        fill_data<float>(product(p.wei_dims), mem_wei);
+        std::vector<int32_t> offsets(batch, 0);
+        if (p.with_offsets) {
+            auto off_ptr = map_memory<int32_t>(mem_off);
+            for (memory::dim b = 0; b < batch; b++)
+                off_ptr[b] = offsets[b] = (int32_t)(7 * b + 3);
+        }
+
+        const int rope_arg
+                = DNNL_ARG_ATTR_MULTIPLE_POST_OP(ops.len() - 1)
+                | DNNL_ARG_OFFSETS;
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+                {DNNL_ARG_WEIGHTS, mem_wei}, {DNNL_ARG_DST, mem_dst}};
+        if (p.with_offsets) args.insert({rope_arg, mem_off});
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto src_ptr = map_memory<float>(mem_src);
+        auto wei_ptr = map_memory<float>(mem_wei);
+        auto dst_ptr = map_memory<float>(mem_dst);
+        std::vector<float> row(N);
+        for_(memory::dim b = 0; b < batch; b++)
+        for (memory::dim m = 0; m < M; m++) {
+            for (memory::dim n = 0; n < N; n++) {
+                float acc = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    acc += src_ptr[(b * M + m) * K + k]
+                            * wei_ptr[(b * K + k) * N + n];
+                row[n] = p.with_relu ? std::max(acc, 0.f) : acc;
+            }
+            for (memory::dim h = 0; h < N / p.head_dim; h++)
+                ref_rope(&row[h * p.head_dim], m + offsets[b], p.aalgorithm,
+                        p.rotary_dim, base);
+            for (memory::dim n = 0; n < N; n++) {
+                const float out = dst_ptr[(b * M + m) * N + n];
+                const float eps = 1e-4f * std::max(1.f, std::abs(row[n]));
+                ASSERT_NEAR(out, row[n], eps) << "b: " << b << " m: " << m << " n: " << n;
+            }
+        }
+    }
+};
+
+TEST_P(matmul_rope_test_t, TestsMatmulRope) {}
+
+INSTANTIATE_TEST_SUITE_P(TestMatmulRopeEF, matmul_rope_test_t,
+        ::testing::Values(
+                // heads do not tile the destination rows
+                matmul_rope_test_params_t {algorithm::rope_interleaved,
+                        {4, 16}, {16, 48}, 32, 32, false, false, true,
+                        dnnl_unimplemented},
+                // odd rotary dimension
+                matmul_rope_test_params_t {algorithm::rope_interleaved,
+                        {4, 16}, {16, 64}, 32, 15, false, false, true,
+                        dnnl_invalid_arguments}));
+
+INSTANTIATE_TEST_SUITE_P(TestMatmulRope, matmul_rope_test_t,
+        ::testing::Values(
+                matmul_rope_test_params_t {algorithm::rope_interleaved,
+                        {5, 32}, {32, 128}, 64, 64, false, false},
+                matmul_rope_test_params_t {algorithm::rope_rotate_half,
+                        {37, 64}, {64, 384}, 96, 64, false, true},
+                matmul_rope_test_params_t {algorithm::rope_interleaved,
+                        {3, 20, 48}, {3, 48, 256}, 128, 128, true, false},
+                matmul_rope_test_params_t {algorithm::rope_rotate_half,
+                        {2, 33, 16}, {2, 16, 160}, 32, 16, true, true}));
+
+} // namespace dnnl
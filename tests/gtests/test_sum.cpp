@@ -198,6 +198,7 @@ protected:
 
         // test all pd ctors
         auto aa = allows_attr_t {false};
+        aa.po_eltwise = get_test_engine_kind() == engine::kind::cpu;
         if (p.is_output_omitted)
             test_fwd_pd_constructors<pd_t>(sum_pd, aa, p.scale, srcs_md);
         else {
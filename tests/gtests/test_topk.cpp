@@ -0,0 +1,259 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct topk_test_params_t {
+    algorithm aalgorithm;
+    memory::dims dims;
+    int axis;
+    memory::dim k;
+    memory::format_tag src_tag;
+    // Source values repeat with this period to produce ties, random values
+    // are used if it is zero.
+    int period;
+    bool with_inf;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename src_data_t>
+class topk_test_t : public ::testing::TestWithParam<topk_test_params_t> {
+private:
+    topk_test_params_t p;
+    memory::data_type src_dt;
+
+protected:
+    void SetUp() override {
+        src_dt = data_traits<src_data_t>::data_type;
+
+        p = ::testing::TestWithParam<topk_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(src_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    static memory::dim product(const memory::dims &dims, int begin, int end) {
+        memory::dim prod = 1;
+        for (int d = begin; d < end; d++)
+            prod *= dims[d];
+        return prod;
+    }
+
+    // Returns the offset of an element given by its outer, axis and inner
+    // coordinates.
+    memory::dim offset(const memory::desc &md, memory::dim outer,
+            memory::dim l, memory::dim inner) const {
+        const auto &dims = md.get_dims();
+        const auto &strides = md.get_strides();
+        const int ndims = (int)dims.size();
+        memory::dim off = l * strides[p.axis];
+        for (int d = ndims - 1; d > p.axis; d--) {
+            off += (inner % dims[d]) * strides[d];
+            inner /= dims[d];
+        }
+        for (int d = p.axis - 1; d >= 0; d--) {
+            off += (outer % dims[d]) * strides[d];
+            outer /= dims[d];
+        }
+        return off;
+    }
+
+    void fill_src(const memory &src) {
+        const memory::dim nelems = product(p.dims, 0, (int)p.dims.size());
+        if (p.period == 0) {
+            fill_data<src_data_t>(nelems, src);
+        } else {
+            auto src_ptr = map_memory<src_data_t>(src);
+            for (memory::dim i = 0; i < nelems; i++)
+                src_ptr[i] = src_data_t(
+                        (float)((i * 37) % p.period) - p.period / 2);
+        }
+        if (p.with_inf) {
+            const float inf = std::numeric_limits<float>::infinity();
+            auto src_ptr = map_memory<src_data_t>(src);
+            for (memory::dim i = 0; i < nelems; i += 7)
+                src_ptr[i] = src_data_t(-inf);
+        }
+    }
+
+    void check_result(const memory &src, const memory &dst,
+            const memory &indices) {
+        auto src_ptr = map_memory<src_data_t>(src);
+        auto dst_ptr = map_memory<float>(dst);
+        auto ind_ptr = map_memory<int32_t>(indices);
+
+        const memory::desc src_md = src.get_desc();
+        const memory::desc dst_md = dst.get_desc();
+        const memory::desc ind_md = indices.get_desc();
+        const int ndims = (int)p.dims.size();
+        const memory::dim outer = product(p.dims, 0, p.axis);
+        const memory::dim inner = product(p.dims, p.axis + 1, ndims);
+        const memory::dim L = p.dims[p.axis];
+        const bool select_max = p.aalgorithm == algorithm::topk_max;
+
+        std::vector<std::pair<float, int32_t>> row(L);
+        for_(memory::dim o = 0; o < outer; o++)
+        for (memory::dim i = 0; i < inner; i++) {
+            for (memory::dim l = 0; l < L; l++)
+                row[l] = {(float)src_ptr[offset(src_md, o, l, i)], (int32_t)l};
+            std::stable_sort(row.begin(), row.end(),
+                    [&](const std::pair<float, int32_t> &a,
+                            const std::pair<float, int32_t> &b) {
+                        return select_max ? a.first > b.first
+                                          : a.first < b.first;
+                    });
+            for (memory::dim k = 0; k < p.k; k++) {
+                const float out = dst_ptr[offset(dst_md, o, k, i)];
+                const int32_t idx = ind_ptr[offset(ind_md, o, k, i)];
+                ASSERT_EQ(out, row[k].first)
+                        << "outer: " << o << " inner: " << i << " k: " << k;
+                ASSERT_EQ(idx, row[k].second)
+                        << "outer: " << o << " inner: " << i << " k: " << k;
+            }
+        }
+    }
+
+    void Test() {
+        using pd_t = topk::primitive_desc;
+        allows_attr_t allowed_attributes {false};
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::dims dst_dims = p.dims;
+        dst_dims[p.axis < (int)p.dims.size() ? p.axis : 0] = p.k;
+        auto desc_src = memory::desc(p.dims, src_dt, p.src_tag);
+        auto desc_dst = memory::desc(dst_dims, dt::f32, tag::any);
+        auto desc_ind = memory::desc(dst_dims, dt::s32, tag::any);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, p.aalgorithm, desc_src, desc_dst, desc_ind, p.axis);
+        test_fwd_pd_constructors<pd_t>(pd, allowed_attributes, p.aalgorithm,
+                desc_src, desc_dst, desc_ind, p.axis);
+
+        EXPECT_ANY_THROW(topk(pd, {}));
+        // default primitive ctor
+        auto prim = topk();
+        // regular primitive ctor
+        prim = topk(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC)
+                == pd.src_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST)
+                == pd.dst_desc());
+        ASSERT_EQ(pd.indices_desc().get_dims(), dst_dims);
+        ASSERT_EQ(pd.indices_desc().get_data_type(), dt::s32);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_EQ(pd.get_axis(), p.axis);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = test::make_memory(pd.src_desc(), test_engine);
+        auto mem_dst = test::make_memory(pd.dst_desc(), test_engine);
+        auto mem_ind = test::make_memory(pd.indices_desc(), test_engine);
+
+        fill_src(mem_src);
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_DST, mem_dst},
+                        {DNNL_ARG_INDICES, mem_ind}});
+        strm.wait();
+
+        check_result(mem_src, mem_dst, mem_ind);
+    }
+
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+};
+
+using tag = memory::format_tag;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // k is greater than the axis
+            topk_test_params_t {algorithm::topk_max, {2, 8}, 1, 9, tag::ab, 0,
+                    false, true, dnnl_invalid_arguments},
+            // bad axis
+            topk_test_params_t {algorithm::topk_max, {2, 8}, 2, 1, tag::ab, 0,
+                    false, true, dnnl_invalid_arguments},
+            // not supported alg_kind
+            topk_test_params_t {algorithm::reduction_max, {2, 8}, 1, 2,
+                    tag::ab, 0, false, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            topk_test_params_t {
+                    algorithm::topk_max, {2, 1000}, 1, 5, tag::ab, 0},
+            topk_test_params_t {
+                    algorithm::topk_min, {3, 64, 5}, 1, 7, tag::abc, 0},
+            topk_test_params_t {
+                    algorithm::topk_max, {4, 100, 3}, 1, 10, tag::acb, 0},
+            topk_test_params_t {
+                    algorithm::topk_max, {50, 4}, 0, 3, tag::ab, 0},
+            // argmax
+            topk_test_params_t {
+                    algorithm::topk_max, {8, 513}, 1, 1, tag::ab, 0},
+            // the whole axis is sorted
+            topk_test_params_t {
+                    algorithm::topk_min, {5, 17}, 1, 17, tag::ab, 0},
+            // ties are resolved in favor of the lower index
+            topk_test_params_t {
+                    algorithm::topk_max, {2, 300}, 1, 20, tag::ab, 3},
+            topk_test_params_t {algorithm::topk_min, {2, 3000}, 1, 40,
+                    tag::ab, 5, true});
+};
+
+static auto long_axis_cases = []() {
+    return ::testing::Values(
+            // vocabulary-sized rows are split between threads
+            topk_test_params_t {
+                    algorithm::topk_max, {1, 128000}, 1, 50, tag::ab, 0},
+            topk_test_params_t {
+                    algorithm::topk_min, {2, 70001}, 1, 8, tag::ab, 1000},
+            topk_test_params_t {algorithm::topk_max, {3, 20000, 2}, 1, 16,
+                    tag::abc, 0, true});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsTopK) {} \
+    INSTANTIATE_TEST_SUITE_P(TestTopKEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopKSimple, test, simple_cases()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopKLongAxis, test, long_axis_cases());
+
+using topk_test_f32 = topk_test_t<float>;
+using topk_test_bf16 = topk_test_t<bfloat16_t>;
+
+INST_TEST_CASE(topk_test_f32)
+INST_TEST_CASE(topk_test_bf16)
+
+} // namespace dnnl